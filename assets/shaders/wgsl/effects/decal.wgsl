@@ -0,0 +1,111 @@
+// Persistent floor decal shader.
+// One instance per decal; the six vertices of each glyph quad are generated
+// from vertex_index. Instance data never changes after upload, so the
+// age-based fade and viewport culling both happen here against the
+// per-frame uniforms.
+
+struct InstanceInput {
+    @location(0) world_pos: vec2<f32>,
+    @location(1) uv_rect: vec4<f32>,    // (u1, v1, u2, v2)
+    @location(2) created_at: f32,
+    @location(3) color: vec4<f32>,      // unorm RGB, alpha unused
+}
+
+struct VertexOutput {
+    @builtin(position) position: vec4<f32>,
+    @location(0) v_uv: vec2<f32>,
+    @location(1) v_color: vec4<f32>,
+}
+
+struct DecalUniforms {
+    // vec4 0: letterbox (offset_x, offset_y, scaled_w, scaled_h)
+    letterbox: vec4<f32>,
+    // vec4 1: world -> quad top-left pixel, pixel = world * xy + zw
+    world_to_pixel: vec4<f32>,
+    // vec4 2: world -> viewport tile, tile = world * xy + zw
+    world_to_viewport: vec4<f32>,
+    // vec4 3: viewport-tile cull bounds (min_x, min_y, max_x, max_y), max exclusive
+    cull_bounds: vec4<f32>,
+    // vec4 4: quad_w_px, quad_h_px, unused, unused
+    quad_size: vec4<f32>,
+    // vec4 5: game_time, lifetime, fade_duration, base_alpha
+    fade: vec4<f32>,
+}
+
+@group(0) @binding(0) var<uniform> uniforms: DecalUniforms;
+@group(0) @binding(1) var u_texture: texture_2d<f32>;
+@group(0) @binding(2) var u_sampler: sampler;
+
+fn decal_alpha(created_at: f32) -> f32 {
+    let age = uniforms.fade.x - created_at;
+    let lifetime = uniforms.fade.y;
+    let fade_duration = uniforms.fade.z;
+    let base_alpha = uniforms.fade.w;
+    if (age < lifetime) {
+        return base_alpha;
+    }
+    return max(0.0, base_alpha * (1.0 - (age - lifetime) / fade_duration));
+}
+
+@vertex
+fn vs_main(
+    @builtin(vertex_index) vertex_index: u32,
+    instance: InstanceInput,
+) -> VertexOutput {
+    var output: VertexOutput;
+
+    let alpha = decal_alpha(instance.created_at);
+    // Cull by the viewport position of the decal's tile, like the CPU
+    // particle path, so sub-tile offsets near the edge stay visible.
+    let tile = round(
+        trunc(instance.world_pos) * uniforms.world_to_viewport.xy
+        + uniforms.world_to_viewport.zw
+    );
+    let bounds = uniforms.cull_bounds;
+    let visible = alpha > 0.0
+        && tile.x >= bounds.x && tile.x < bounds.z
+        && tile.y >= bounds.y && tile.y < bounds.w;
+    if (!visible) {
+        // Collapse the quad outside the clip volume.
+        output.position = vec4<f32>(-2.0, -2.0, 0.0, 1.0);
+        output.v_uv = vec2<f32>(0.0);
+        output.v_color = vec4<f32>(0.0);
+        return output;
+    }
+
+    // Corner order matches WGPUScreenRenderer.add_quad: TL, TR, BL, TR, BL, BR.
+    var corners = array<vec2<f32>, 6>(
+        vec2<f32>(0.0, 0.0),
+        vec2<f32>(1.0, 0.0),
+        vec2<f32>(0.0, 1.0),
+        vec2<f32>(1.0, 0.0),
+        vec2<f32>(0.0, 1.0),
+        vec2<f32>(1.0, 1.0),
+    );
+    let corner = corners[vertex_index];
+    let top_left = instance.world_pos * uniforms.world_to_pixel.xy
+        + uniforms.world_to_pixel.zw;
+    let pixel = top_left + corner * uniforms.quad_size.xy;
+
+    // Pixel -> clip space, as in the screen renderer.
+    let letterbox = uniforms.letterbox;
+    let norm_x = (pixel.x - letterbox.x) / letterbox.z;
+    let norm_y = 1.0 - ((pixel.y - letterbox.y) / letterbox.w);
+    output.position = vec4<f32>(norm_x * 2.0 - 1.0, norm_y * 2.0 - 1.0, 0.0, 1.0);
+
+    let uv = instance.uv_rect;
+    output.v_uv = mix(uv.xy, uv.zw, corner);
+    output.v_color = vec4<f32>(instance.color.rgb, alpha);
+    return output;
+}
+
+// Same warm adjustment the screen renderer applies to glyph quads.
+fn warm_color_correction(color: vec3<f32>) -> vec3<f32> {
+    return vec3<f32>(color.r * 1.15, color.g * 1.05, color.b * 0.95);
+}
+
+@fragment
+fn fs_main(input: VertexOutput) -> @location(0) vec4<f32> {
+    let sampled = textureSample(u_texture, u_sampler, input.v_uv) * input.v_color;
+    return vec4<f32>(warm_color_correction(sampled.rgb), sampled.a);
+}
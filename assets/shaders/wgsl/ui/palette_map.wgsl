@@ -0,0 +1,40 @@
+// Recolour a palette-indexed tile map (one texel per tile) for the mini-map.
+// Each cell holds (palette_index, state); the palette texture has one row per
+// state (0 = unexplored, 1 = explored, 2 = visible).
+
+struct VertexInput {
+    @location(0) position: vec2f,
+}
+
+struct VertexOutput {
+    @builtin(position) clip_position: vec4f,
+}
+
+struct PaletteMapUniforms {
+    // origin_x, origin_y (output pixel of tile 0,0), unused, unused
+    origin: vec4i,
+}
+
+@group(0) @binding(0) var<uniform> uniforms: PaletteMapUniforms;
+@group(0) @binding(1) var cell_texture: texture_2d<u32>;
+@group(0) @binding(2) var palette_texture: texture_2d<f32>;
+
+@vertex
+fn vs_main(input: VertexInput) -> VertexOutput {
+    var output: VertexOutput;
+    output.clip_position = vec4f(input.position, 0.0, 1.0);
+    return output;
+}
+
+@fragment
+fn fs_main(@builtin(position) frag_coord: vec4f) -> @location(0) vec4f {
+    let tile = vec2i(floor(frag_coord.xy)) - uniforms.origin.xy;
+    let map_size = vec2i(textureDimensions(cell_texture));
+    if (tile.x < 0 || tile.y < 0 || tile.x >= map_size.x || tile.y >= map_size.y) {
+        return vec4f(0.0, 0.0, 0.0, 1.0);
+    }
+
+    let cell = textureLoad(cell_texture, tile, 0);
+    let color = textureLoad(palette_texture, vec2i(i32(cell.r), i32(cell.g)), 0);
+    return vec4f(color.rgb, 1.0);
+}
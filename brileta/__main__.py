@@ -43,6 +43,17 @@ def main() -> None:
         default=5.0,
         help="Seconds between metric log writes (default: 5.0).",
     )
+    parser.add_argument(
+        "--record-session",
+        dest="record_session_file",
+        type=str,
+        default=None,
+        help=(
+            "Record the session's seed, player intents and logic-step "
+            "boundaries to this JSON file on quit, for "
+            "scripts/benchmark_replay.py."
+        ),
+    )
     args = parser.parse_args()
 
     # Initialize the RNG stream system for deterministic randomness
@@ -57,6 +68,7 @@ def main() -> None:
         metric_log_names=metric_log_names,
         metric_log_file=args.metric_log_file if metric_log_names else None,
         metric_log_interval_seconds=args.metric_log_interval_seconds,
+        record_session_file=args.record_session_file,
     )
 
     match config.BACKEND.app:
@@ -5,6 +5,7 @@ from dataclasses import dataclass
 from pathlib import Path
 from typing import TYPE_CHECKING
 
+from brileta.events import drain_event_queue, enable_event_queue
 from brileta.types import DeltaTime, InterpolationAlpha
 from brileta.util.live_vars import (
     MetricSpec,
@@ -24,8 +25,11 @@ from brileta.view.render.graphics import GraphicsContext
 #     time.render.light_overlay_ms, time.render.actors_smooth_ms, ...
 #                                   (sub-metrics declared in frame_manager.py)
 #   time.render.present_ms        = compositor present + buffer swap
+# time.events_ms                  = queued event dispatch (effects, sound, text)
 # time.logic_ms                   = game simulation (declared in controller.py)
 #   time.logic.animation_ms
+#   time.logic.lighting_ms
+#   time.logic.sound_ms
 #   time.logic.action_ms
 #
 # Frame-phase metrics declared here. Sub-metrics live in their respective modules.
@@ -39,6 +43,7 @@ _FRAME_METRICS: list[MetricSpec] = [
         "Compositor present and buffer swap",
         500,
     ),
+    MetricSpec("time.events_ms", "Queued event dispatch", 500),
 ]
 live_variable_registry.register_metrics(_FRAME_METRICS)
 
@@ -63,6 +68,8 @@ class AppConfig:
     metric_log_names: tuple[str, ...] = ()
     metric_log_file: str | None = None
     metric_log_interval_seconds: float = 5.0
+    # Optional session recording for headless replay, saved on quit.
+    record_session_file: str | None = None
 
 
 class App[TGraphics: GraphicsContext](ABC):
@@ -125,8 +132,15 @@ class App[TGraphics: GraphicsContext](ABC):
         """Initializes the controller after graphics context is ready."""
         from brileta.controller import Controller
 
+        # Presentation events published during input and logic steps are
+        # batched and dispatched once per frame, just before rendering.
+        enable_event_queue()
         self.controller = Controller(self, self.graphics)
         self.controller.update_fov()
+        if self.app_config.record_session_file:
+            from brileta.game.session_recording import SessionRecorder
+
+            SessionRecorder(self.controller)
 
     @abstractmethod
     def run(self) -> None:
@@ -147,6 +161,12 @@ class App[TGraphics: GraphicsContext](ABC):
         # Record total loop time from Clock's measured delta (includes sync sleep).
         live_variable_registry.record_metric("time.total_ms", delta_time * 1000)
 
+        # Frame boundaries for an attached session recorder: player actions
+        # executed by this frame's input processing are recorded into it.
+        recorder = self.controller.session_recorder
+        if recorder is not None:
+            recorder.begin_frame()
+
         # --- Player Action Processing (once per frame) ---
         # This ensures player actions are processed with zero latency,
         # independent of the fixed logic timestep.
@@ -178,6 +198,9 @@ class App[TGraphics: GraphicsContext](ABC):
         if logic_steps_this_frame >= self.controller.max_logic_steps_per_frame:
             self.controller.accumulator *= 0.8
 
+        if recorder is not None:
+            recorder.end_frame(logic_steps_this_frame)
+
     def execute_fixed_logic_step(self) -> None:
         """
         Execute exactly one logic step at fixed 60Hz timing.
@@ -232,6 +255,9 @@ class App[TGraphics: GraphicsContext](ABC):
         """
         assert self.controller is not None
 
+        with record_time_live_variable("time.events_ms"):
+            drain_event_queue()
+
         with record_time_live_variable("time.render_ms"):
             with record_time_live_variable("time.render.prepare_ms"):
                 self.prepare_for_new_frame()
@@ -280,5 +306,25 @@ class App[TGraphics: GraphicsContext](ABC):
     def quit(self) -> None:
         """Initiates the application shutdown process."""
         if self.controller:
+            self._save_session_recording()
             self.controller.cleanup()
         self._exit_backend()
+
+    def _save_session_recording(self) -> None:
+        """Write the attached session recording, if recording was enabled."""
+        assert self.controller is not None
+        recorder = self.controller.session_recorder
+        path = self.app_config.record_session_file
+        if recorder is None or not path:
+            return
+        recording = recorder.detach()
+        try:
+            recording.save(path)
+        except OSError as exc:  # pragma: no cover - defensive runtime guard
+            print(f"Warning: could not save session recording to {path}: {exc}")
+            return
+        print(f"Session recording ({recording.tick_count} ticks) -> {path}")
+        if recording.unreplayable is not None:
+            print(
+                f"Warning: session recording is not replayable: {recording.unreplayable}"
+            )
@@ -0,0 +1,297 @@
+"""WGPU renderer for persistent floor decals as instanced glyph quads."""
+
+from __future__ import annotations
+
+import struct
+from typing import TYPE_CHECKING
+
+import numpy as np
+import wgpu
+
+from brileta.types import PixelPos, PixelRect
+from brileta.util.tilesets import unicode_to_cp437_array
+
+from .resource_manager import ALPHA_BLEND_STATE
+
+if TYPE_CHECKING:
+    from brileta.view.render.effects.decals import DecalSystem
+
+    from .resource_manager import WGPUResourceManager
+    from .shader_manager import WGPUShaderManager
+
+# One instance per DecalSystem ring-buffer slot. Everything here is fixed
+# when the decal is added; the fade is computed in the shader from
+# ``created_at`` and the per-frame time uniform.
+DECAL_INSTANCE_DTYPE = np.dtype(
+    [
+        ("position", "2f4"),  # World position (sub-tile)
+        ("uv", "4f4"),  # Glyph UV rect (u1, v1, u2, v2)
+        ("created_at", "f4"),  # Game time the decal was added
+        ("color", "4u1"),  # RGB, alpha byte unused
+    ]
+)
+
+
+def pack_decal_instances(
+    decal_system: DecalSystem, slots: np.ndarray, uv_map: np.ndarray
+) -> np.ndarray:
+    """Build instance records for the decals stored in ``slots``."""
+    instances = np.zeros(len(slots), dtype=DECAL_INSTANCE_DTYPE)
+    instances["position"] = decal_system.positions[slots]
+    instances["created_at"] = decal_system.created_at[slots]
+    instances["color"][:, :3] = decal_system.rgb[slots]
+    # '<U1' chars view as their UCS-4 codepoints; empty means space.
+    codepoints = decal_system.chars[slots].view(np.uint32)
+    glyphs = unicode_to_cp437_array(np.where(codepoints == 0, ord(" "), codepoints))
+    instances["uv"] = uv_map[glyphs]
+    return instances
+
+
+class WGPUDecalRenderer:
+    """Draws a DecalSystem from a persistent GPU instance buffer.
+
+    The instance buffer mirrors the decal ring buffer slot for slot. Each
+    :meth:`sync` uploads only the sequence range added since the previous
+    sync, or every live slot after the decal storage grows or is cleared, so
+    a frame without new decals writes nothing but the uniform block. The live
+    range is drawn oldest first (two draws when it wraps the ring), which
+    keeps newer decals on top.
+    """
+
+    def __init__(
+        self,
+        resource_manager: WGPUResourceManager,
+        shader_manager: WGPUShaderManager,
+        atlas_texture: wgpu.GPUTexture,
+        surface_format: str,
+    ) -> None:
+        self.resource_manager = resource_manager
+        self.shader_manager = shader_manager
+        self.surface_format = surface_format
+
+        self._instance_buffer: wgpu.GPUBuffer | None = None
+        self._capacity = 0
+        # Decal storage state the instance buffer currently mirrors.
+        self._synced_system: DecalSystem | None = None
+        self._synced_generation = -1
+        self._synced_tail = 0
+
+        # Live slot ranges and uniforms for the frame being drawn.
+        self._draw_ranges: list[tuple[int, int]] = []
+        self._frame_uniforms: tuple[float, ...] = ()
+
+        self._uniform_buffer = self.resource_manager.device.create_buffer(
+            size=96,  # 6 * vec4<f32>
+            usage=wgpu.BufferUsage.UNIFORM | wgpu.BufferUsage.COPY_DST,
+            label="decal_uniform_buffer",
+        )
+        self._bind_group_layout = self._create_bind_group_layout()
+        self._pipeline = self._create_pipeline()
+        self._bind_group = self.shader_manager.create_bind_group(
+            layout=self._bind_group_layout,
+            entries=[
+                {"binding": 0, "resource": {"buffer": self._uniform_buffer}},
+                {
+                    "binding": 1,
+                    "resource": self.resource_manager.get_texture_view(atlas_texture),
+                },
+                {"binding": 2, "resource": self.resource_manager.nearest_sampler},
+            ],
+            label="decal_bind_group",
+        )
+
+    def _create_bind_group_layout(self) -> wgpu.GPUBindGroupLayout:
+        """Create bind group layout for the decal shader resources."""
+        return self.shader_manager.create_bind_group_layout(
+            entries=[
+                {
+                    "binding": 0,
+                    "visibility": wgpu.ShaderStage.VERTEX | wgpu.ShaderStage.FRAGMENT,
+                    "buffer": {"type": wgpu.BufferBindingType.uniform},
+                },
+                {
+                    "binding": 1,
+                    "visibility": wgpu.ShaderStage.FRAGMENT,
+                    "texture": {"sample_type": wgpu.TextureSampleType.float},
+                },
+                {
+                    "binding": 2,
+                    "visibility": wgpu.ShaderStage.FRAGMENT,
+                    "sampler": {"type": wgpu.SamplerBindingType.filtering},
+                },
+            ],
+            label="decal_bind_group_layout",
+        )
+
+    def _create_pipeline(self) -> wgpu.GPURenderPipeline:
+        """Create the instanced decal pipeline with alpha blending."""
+        vertex_layout = [
+            {
+                "array_stride": DECAL_INSTANCE_DTYPE.itemsize,
+                "step_mode": wgpu.VertexStepMode.instance,
+                "attributes": [
+                    {
+                        "format": wgpu.VertexFormat.float32x2,
+                        "offset": DECAL_INSTANCE_DTYPE.fields["position"][1],
+                        "shader_location": 0,
+                    },
+                    {
+                        "format": wgpu.VertexFormat.float32x4,
+                        "offset": DECAL_INSTANCE_DTYPE.fields["uv"][1],
+                        "shader_location": 1,
+                    },
+                    {
+                        "format": wgpu.VertexFormat.float32,
+                        "offset": DECAL_INSTANCE_DTYPE.fields["created_at"][1],
+                        "shader_location": 2,
+                    },
+                    {
+                        "format": wgpu.VertexFormat.unorm8x4,
+                        "offset": DECAL_INSTANCE_DTYPE.fields["color"][1],
+                        "shader_location": 3,
+                    },
+                ],
+            }
+        ]
+
+        targets = [
+            {
+                "format": self.surface_format,
+                "blend": ALPHA_BLEND_STATE,
+            }
+        ]
+
+        return self.shader_manager.create_render_pipeline(
+            vertex_shader_path="wgsl/effects/decal.wgsl",
+            fragment_shader_path="wgsl/effects/decal.wgsl",
+            vertex_layout=vertex_layout,
+            bind_group_layouts=[self._bind_group_layout],
+            targets=targets,
+            cache_key="decal_renderer_pipeline",
+        )
+
+    def begin_frame(self) -> None:
+        """Drop the previous frame's draw ranges."""
+        self._draw_ranges = []
+
+    def sync(self, decal_system: DecalSystem, uv_map: np.ndarray) -> None:
+        """Bring the instance buffer up to date with ``decal_system``."""
+        capacity = decal_system.capacity
+        head, tail = decal_system.live_range
+        if capacity != self._capacity:
+            if self._instance_buffer is not None:
+                self._instance_buffer.destroy()
+            self._instance_buffer = self.resource_manager.device.create_buffer(
+                size=capacity * DECAL_INSTANCE_DTYPE.itemsize,
+                usage=wgpu.BufferUsage.VERTEX | wgpu.BufferUsage.COPY_DST,
+                label="decal_instance_buffer",
+            )
+            self._capacity = capacity
+            self._synced_generation = -1
+
+        if (
+            decal_system is not self._synced_system
+            or decal_system.generation != self._synced_generation
+        ):
+            start = head
+        else:
+            start = max(self._synced_tail, head)
+        self._synced_system = decal_system
+        self._synced_generation = decal_system.generation
+        self._synced_tail = tail
+
+        for first, count in self.slot_ranges(start, tail, capacity):
+            slots = np.arange(first, first + count, dtype=np.int64)
+            instances = pack_decal_instances(decal_system, slots, uv_map)
+            self.resource_manager.queue.write_buffer(
+                self._instance_buffer,
+                first * DECAL_INSTANCE_DTYPE.itemsize,
+                memoryview(instances.tobytes()),
+            )
+
+    @staticmethod
+    def slot_ranges(start: int, stop: int, capacity: int) -> list[tuple[int, int]]:
+        """Split sequences ``[start, stop)`` into contiguous (slot, count) runs."""
+        if stop <= start:
+            return []
+        first = start % capacity
+        count = stop - start
+        if first + count <= capacity:
+            return [(first, count)]
+        return [(first, capacity - first), (0, first + count - capacity)]
+
+    def prepare(
+        self,
+        decal_system: DecalSystem,
+        world_to_pixel: tuple[float, float, float, float],
+        world_to_viewport: tuple[float, float, float, float],
+        cull_bounds: tuple[float, float, float, float],
+        quad_size: tuple[float, float],
+        game_time: float,
+    ) -> None:
+        """Queue the live decals for drawing this frame.
+
+        Args:
+            decal_system: Decals to draw; must have been :meth:`sync`-ed.
+            world_to_pixel: ``(ax, ay, bx, by)`` mapping a world position to
+                the screen pixel of its quad's top-left, ``world * a + b``.
+            world_to_viewport: The same affine form mapping world tiles to
+                viewport tiles, used for culling.
+            cull_bounds: ``(min_x, min_y, max_x, max_y)`` viewport-tile bounds
+                a decal's rounded tile must fall inside (max exclusive).
+            quad_size: Glyph quad width and height in pixels.
+            game_time: Current game time for the shader fade.
+        """
+        self._draw_ranges = self.slot_ranges(*decal_system.live_range, self._capacity)
+        self._frame_uniforms = (
+            *world_to_pixel,
+            *world_to_viewport,
+            *cull_bounds,
+            quad_size[0],
+            quad_size[1],
+            0.0,
+            0.0,
+            float(game_time),
+            decal_system.DECAL_LIFETIME,
+            decal_system.FADE_DURATION,
+            decal_system.BASE_ALPHA,
+        )
+
+    def has_pending_draw(self) -> bool:
+        """Whether :meth:`prepare` queued any decals for this frame."""
+        return bool(self._draw_ranges)
+
+    def render(
+        self,
+        render_pass: wgpu.GPURenderPassEncoder,
+        window_size: PixelPos,
+        letterbox_geometry: PixelRect | None,
+    ) -> None:
+        """Draw the decals queued by :meth:`prepare`."""
+        if not self._draw_ranges or self._instance_buffer is None:
+            return
+
+        if letterbox_geometry is None:
+            letterbox_geometry = (0, 0, int(window_size[0]), int(window_size[1]))
+        self.resource_manager.queue.write_buffer(
+            self._uniform_buffer,
+            0,
+            memoryview(self._build_uniforms(letterbox_geometry)),
+        )
+
+        render_pass.set_pipeline(self._pipeline)
+        render_pass.set_bind_group(0, self._bind_group)
+        render_pass.set_vertex_buffer(0, self._instance_buffer)
+        for first, count in self._draw_ranges:
+            render_pass.draw(6, count, 0, first)
+
+    def _build_uniforms(self, letterbox_geometry: PixelRect) -> bytes:
+        """Pack decal uniforms using the vec4-aligned shader layout."""
+        return struct.pack(
+            "24f",
+            float(letterbox_geometry[0]),
+            float(letterbox_geometry[1]),
+            float(letterbox_geometry[2]),
+            float(letterbox_geometry[3]),
+            *self._frame_uniforms,
+        )
@@ -23,7 +23,6 @@ from brileta.config import (
     SUN_SHADOW_INTENSITY,
     TILE_EMISSION_ENABLED,
 )
-from brileta.environment.tile_types import get_emission_map
 from brileta.game.lights import DirectionalLight, DynamicLight
 from brileta.types import FixedTimestep
 from brileta.util.coordinates import Rect
@@ -704,9 +703,8 @@ class GPULightingSystem(LightingSystem):
         min_y = max(0, viewport_bounds.y1)
         max_y = min(game_map.height, viewport_bounds.y2)
 
-        # Get emission map for the viewport region
-        tile_slice = game_map.tiles[min_x:max_x, min_y:max_y]
-        emission_map = get_emission_map(tile_slice)
+        # Emission map for the viewport region (cached on the map).
+        emission_map = game_map.emission_map[min_x:max_x, min_y:max_y]
 
         # Vectorized emission data population
         # Find all tiles that emit light using boolean mask
@@ -31,20 +31,25 @@ from brileta.util.coordinates import (
     Rect,
 )
 from brileta.util.glyph_buffer import GlyphBuffer
+from brileta.util.tilesets import unicode_to_cp437_array
 from brileta.view.render.graphics import GraphicsContext
 
 from .atlas_manager import WGPUAtlasManager
 from .atmospheric_renderer import WGPUAtmosphericRenderer
+from .decal_renderer import WGPUDecalRenderer
 from .glyph_renderer import WGPUGlyphRenderer
 from .light_overlay_composer import WGPULightOverlayComposer
+from .palette_map import WGPUPaletteMap
 from .rain_renderer import WGPURainRenderer
 from .resource_manager import WGPUResourceManager
 from .screen_renderer import WGPUScreenRenderer
 from .shader_manager import WGPUShaderManager
-from .sprite_atlas import SpriteAtlas
+from .sprite_atlas import PagedSpriteAtlas, SpriteAtlas
 from .textured_quad_renderer import WGPUTexturedQuadRenderer
 
 if TYPE_CHECKING:
+    from brileta.view.render.effects.decals import DecalSystem
+    from brileta.view.render.viewport import ViewportSystem
     from brileta.view.ui.cursor_manager import CursorManager
 
 logger = logging.getLogger(__name__)
@@ -212,6 +217,7 @@ class WGPUGraphicsContext(GraphicsContext):
         # Atmospheric renderer for cloud shadows and mist
         self.atmospheric_renderer: WGPUAtmosphericRenderer | None = None
         self.rain_renderer: WGPURainRenderer | None = None
+        self.decal_renderer: WGPUDecalRenderer | None = None
         self.light_overlay_composer: WGPULightOverlayComposer | None = None
         # Queued atmospheric layers for this frame
         self._atmospheric_layers: list[AtmosphericLayerState] = []
@@ -312,7 +318,9 @@ class WGPUGraphicsContext(GraphicsContext):
             self.resource_manager,
             self.shader_manager,
             surface_format,
-            max_quads=500,
+            # Floating text and speech bubbles draw one quad per glyph and
+            # bubble slice, so the UI batch holds a few thousand quads.
+            max_quads=4000,
             label="ui",
         )
         self._radial_gradient_texture = self._create_radial_gradient_texture(256)
@@ -327,6 +335,12 @@ class WGPUGraphicsContext(GraphicsContext):
             self.shader_manager,
             surface_format,
         )
+        self.decal_renderer = WGPUDecalRenderer(
+            self.resource_manager,
+            self.shader_manager,
+            self.atlas_texture,
+            surface_format,
+        )
         self.light_overlay_composer = WGPULightOverlayComposer(
             self.resource_manager,
             self.shader_manager,
@@ -351,6 +365,30 @@ class WGPUGraphicsContext(GraphicsContext):
         self._sprite_atlas = SpriteAtlas(self.resource_manager, width, height)
         return self._sprite_atlas
 
+    def create_palette_map(
+        self, width: int, height: int, palette: np.ndarray
+    ) -> WGPUPaletteMap:
+        """Create a palette-indexed tile map recoloured on the GPU."""
+        assert self.resource_manager is not None
+        assert self.shader_manager is not None
+        return WGPUPaletteMap(
+            self.resource_manager, self.shader_manager, width, height, palette
+        )
+
+    def create_paged_sprite_atlas(
+        self, page_size: int, page_count: int
+    ) -> PagedSpriteAtlas:
+        """Create a fixed-budget PagedSpriteAtlas for streaming sprites.
+
+        Used instead of :meth:`create_sprite_atlas` when a world's sprites do
+        not fit the configured atlas budget. The texture is cleared up front
+        and bound like a regular atlas; pages fill as actors stream in.
+        """
+        assert self.resource_manager is not None
+        atlas = PagedSpriteAtlas(self.resource_manager, page_size, page_count)
+        self._sprite_atlas = atlas
+        return atlas
+
     @property
     def gpu_max_texture_dimension_2d(self) -> int:
         """The GPU's maximum 2D texture dimension, or 8192 as a safe fallback."""
@@ -802,6 +840,48 @@ class WGPUGraphicsContext(GraphicsContext):
             use_sprite_atlas=False,
         )
 
+    def draw_actor_shadow_batch(
+        self,
+        *,
+        char_codes: np.ndarray,
+        screen_x: np.ndarray,
+        screen_y: np.ndarray,
+        shadow_dir_x: float,
+        shadow_dir_y: float,
+        shadow_length_pixels: np.ndarray,
+        shadow_alpha: float,
+        scale_x: float = 1.0,
+        scale_y: float = 1.0,
+        fade_tip: bool = True,
+    ) -> None:
+        """Draw many glyph shadows as one natively built vertex batch.
+
+        Produces vertices identical to repeated ``draw_actor_shadow()`` calls.
+        """
+        if self.screen_renderer is None or self.uv_map is None:
+            return
+        if len(char_codes) <= 0 or shadow_alpha <= 0.0:
+            return
+
+        direction_length = float(np.hypot(shadow_dir_x, shadow_dir_y))
+        if direction_length <= 1e-6:
+            return
+
+        glyphs = unicode_to_cp437_array(char_codes)
+        self.screen_renderer.add_glyph_shadow_batch(
+            self.uv_map[glyphs],
+            screen_x,
+            screen_y,
+            shadow_length_pixels,
+            dir_x=shadow_dir_x / direction_length,
+            dir_y=shadow_dir_y / direction_length,
+            tile_size=self.tile_dimensions,
+            scale=(scale_x, scale_y),
+            alpha=shadow_alpha,
+            fade_tip=fade_tip,
+            horizontal_threshold=self._HORIZONTAL_SHADOW_DIR_Y_THRESHOLD,
+        )
+
     def draw_sprite_shadow(
         self,
         sprite_uv: SpriteUV,
@@ -1110,6 +1190,67 @@ class WGPUGraphicsContext(GraphicsContext):
             use_sprite_atlas=use_sprite_atlas,
         )
 
+    def render_decals(
+        self,
+        decal_system: DecalSystem,
+        viewport_bounds: Rect,
+        view_offset: ViewOffset,
+        viewport_system: ViewportSystem,
+        game_time: float,
+    ) -> None:
+        """Draw decals from their persistent GPU instance buffer.
+
+        Only decals added since the last frame are uploaded; per frame the
+        CPU just hands the camera transform and game time to the shader,
+        which fades and culls each decal itself.
+        """
+        if (
+            self.screen_renderer is None
+            or self.decal_renderer is None
+            or self.uv_map is None
+        ):
+            return
+        if decal_system.total_count == 0:
+            return
+
+        self.decal_renderer.sync(decal_system, self.uv_map)
+
+        # world_to_screen_float is affine: vp = world * scale + origin.
+        origin_x, origin_y = viewport_system.world_to_screen_float(0.0, 0.0)
+        unit_x, unit_y = viewport_system.world_to_screen_float(1.0, 1.0)
+        scale_x, scale_y = unit_x - origin_x, unit_y - origin_y
+        # Root-console tile -> screen pixel, as in _console_to_screen_arrays.
+        if self.letterbox_geometry is not None:
+            offset_x, offset_y, scaled_w, scaled_h = self.letterbox_geometry
+            cell_w = scaled_w / self.console_width_tiles
+            cell_h = scaled_h / self.console_height_tiles
+        else:
+            offset_x, offset_y = 0, 0
+            cell_w, cell_h = self.tile_dimensions
+
+        display_x, display_y = viewport_system.get_display_scale_factors()
+        tile_w, tile_h = self.tile_dimensions
+        self.decal_renderer.prepare(
+            decal_system,
+            world_to_pixel=(
+                scale_x * cell_w,
+                scale_y * cell_h,
+                offset_x + (view_offset[0] + origin_x) * cell_w,
+                offset_y + (view_offset[1] + origin_y) * cell_h,
+            ),
+            world_to_viewport=(scale_x, scale_y, origin_x, origin_y),
+            # One tile of slack so sub-tile offsets near the edge stay visible.
+            cull_bounds=(
+                -1.0,
+                -1.0,
+                viewport_bounds.width + 1.0,
+                viewport_bounds.height + 1.0,
+            ),
+            quad_size=(tile_w * display_x, tile_h * display_y),
+            game_time=game_time,
+        )
+        self.screen_renderer.mark_decal_layer(self.decal_renderer)
+
     @contextmanager
     def shadow_pass(self) -> Iterator[None]:
         """Bracket shadow geometry so the screen renderer can draw it separately."""
@@ -1339,6 +1480,8 @@ class WGPUGraphicsContext(GraphicsContext):
             self.atmospheric_renderer.begin_frame()
         if self.rain_renderer is not None:
             self.rain_renderer.begin_frame()
+        if self.decal_renderer is not None:
+            self.decal_renderer.begin_frame()
         self._atmospheric_layers = []
         self._rain_state = None
 
@@ -1647,6 +1790,34 @@ class WGPUGraphicsContext(GraphicsContext):
 
         self.ui_renderer.add_textured_quad(texture, vertices)
 
+    # Corner order of the two triangles per quad, as indices into (x1, y1, x2, y2).
+    _QUAD_CORNER_X = np.array([0, 2, 0, 2, 0, 2])
+    _QUAD_CORNER_Y = np.array([1, 1, 3, 1, 3, 3])
+
+    def draw_texture_quads(
+        self,
+        texture: wgpu.GPUTexture,
+        rects: np.ndarray,
+        uvs: np.ndarray,
+        tints: np.ndarray,
+    ) -> None:
+        """Draw many sub-rectangles of one texture as a single UI batch."""
+        if len(rects) == 0 or not isinstance(texture, wgpu.GPUTexture):
+            return
+        if self.ui_renderer is None:
+            return
+
+        n = len(rects)
+        vertices = np.empty((n, 6), dtype=WGPUTexturedQuadRenderer.VERTEX_DTYPE)
+        cx, cy = self._QUAD_CORNER_X, self._QUAD_CORNER_Y
+        vertices["position"][:, :, 0] = rects[:, cx]
+        vertices["position"][:, :, 1] = rects[:, cy]
+        vertices["uv"][:, :, 0] = uvs[:, cx]
+        vertices["uv"][:, :, 1] = uvs[:, cy]
+        vertices["color"] = tints[:, None, :]
+
+        self.ui_renderer.add_textured_quads(texture, vertices.reshape(-1))
+
     def draw_background(
         self,
         texture: Any,
@@ -2058,6 +2229,7 @@ class WGPUGraphicsContext(GraphicsContext):
         self.effect_renderer = None
         self.atmospheric_renderer = None
         self.rain_renderer = None
+        self.decal_renderer = None
         self.light_overlay_composer = None
         self._radial_gradient_texture = None
         self.atlas_texture = None
@@ -0,0 +1,193 @@
+"""WGPU palette-indexed map surface.
+
+Stores one texel per map tile as ``(palette_index, state)`` in an ``rg8uint``
+texture and recolours it on the GPU through a small palette texture with one
+row per state. Callers upload only the sub-rectangles whose cells changed, so
+steady-state cost is independent of map size. Used by the mini-map.
+"""
+
+from __future__ import annotations
+
+import struct
+from typing import TYPE_CHECKING
+
+import numpy as np
+import wgpu
+
+if TYPE_CHECKING:
+    from .resource_manager import WGPUResourceManager
+    from .shader_manager import WGPUShaderManager
+
+
+_VERTEX_DTYPE = np.dtype([("position", "2f4")])
+
+
+class WGPUPaletteMap:
+    """GPU-resident ``(palette_index, state)`` grid recoloured by a shader."""
+
+    def __init__(
+        self,
+        resource_manager: WGPUResourceManager,
+        shader_manager: WGPUShaderManager,
+        width: int,
+        height: int,
+        palette: np.ndarray,
+    ) -> None:
+        """Create the cell and palette textures.
+
+        Args:
+            width: Map width in tiles.
+            height: Map height in tiles.
+            palette: ``(states, entries, 4)`` uint8 RGBA, indexed
+                ``[state, palette_index]``.
+        """
+        self.resource_manager = resource_manager
+        self.width = width
+        self.height = height
+        device = resource_manager.device
+
+        self._cell_texture = device.create_texture(
+            size=(width, height, 1),
+            format=wgpu.TextureFormat.rg8uint,
+            usage=wgpu.TextureUsage.TEXTURE_BINDING | wgpu.TextureUsage.COPY_DST,
+            label="palette_map_cells",
+        )
+        states, entries = int(palette.shape[0]), int(palette.shape[1])
+        self._palette_texture = resource_manager.create_atlas_texture(
+            entries, states, np.ascontiguousarray(palette, dtype=np.uint8).tobytes()
+        )
+
+        self._uniform_buffer = device.create_buffer(
+            size=16,  # vec4<i32>
+            usage=wgpu.BufferUsage.UNIFORM | wgpu.BufferUsage.COPY_DST,
+            label="palette_map_uniforms",
+        )
+        self._vertex_buffer = device.create_buffer(
+            size=6 * _VERTEX_DTYPE.itemsize,
+            usage=wgpu.BufferUsage.VERTEX | wgpu.BufferUsage.COPY_DST,
+            label="palette_map_fullscreen_quad",
+        )
+        vertices = np.array(
+            [
+                ((-1.0, -1.0),),
+                ((1.0, -1.0),),
+                ((-1.0, 1.0),),
+                ((1.0, -1.0),),
+                ((-1.0, 1.0),),
+                ((1.0, 1.0),),
+            ],
+            dtype=_VERTEX_DTYPE,
+        )
+        resource_manager.queue.write_buffer(
+            self._vertex_buffer, 0, memoryview(vertices.tobytes())
+        )
+
+        self._bind_group_layout = device.create_bind_group_layout(
+            entries=[
+                {
+                    "binding": 0,
+                    "visibility": wgpu.ShaderStage.FRAGMENT,
+                    "buffer": {"type": wgpu.BufferBindingType.uniform},
+                },
+                {
+                    "binding": 1,
+                    "visibility": wgpu.ShaderStage.FRAGMENT,
+                    "texture": {"sample_type": wgpu.TextureSampleType.uint},
+                },
+                {
+                    "binding": 2,
+                    "visibility": wgpu.ShaderStage.FRAGMENT,
+                    "texture": {"sample_type": wgpu.TextureSampleType.float},
+                },
+            ],
+            label="palette_map_bind_group_layout",
+        )
+        self._pipeline = shader_manager.create_render_pipeline(
+            vertex_shader_path="wgsl/ui/palette_map.wgsl",
+            fragment_shader_path="wgsl/ui/palette_map.wgsl",
+            vertex_layout=[
+                {
+                    "array_stride": _VERTEX_DTYPE.itemsize,
+                    "step_mode": wgpu.VertexStepMode.vertex,
+                    "attributes": [
+                        {
+                            "format": wgpu.VertexFormat.float32x2,
+                            "offset": 0,
+                            "shader_location": 0,
+                        }
+                    ],
+                }
+            ],
+            bind_group_layouts=[self._bind_group_layout],
+            targets=[{"format": "rgba8unorm"}],
+            cache_key="palette_map_pipeline",
+        )
+        get_view = resource_manager.get_texture_view
+        self._bind_group = device.create_bind_group(
+            layout=self._bind_group_layout,
+            entries=[
+                {"binding": 0, "resource": {"buffer": self._uniform_buffer}},
+                {"binding": 1, "resource": get_view(self._cell_texture)},
+                {"binding": 2, "resource": get_view(self._palette_texture)},
+            ],
+            label="palette_map_bind_group",
+        )
+
+    def write_cells(self, x0: int, y0: int, cells: np.ndarray) -> None:
+        """Upload a ``(h, w, 2)`` uint8 block of cells at tile ``(x0, y0)``."""
+        h, w = int(cells.shape[0]), int(cells.shape[1])
+        if w <= 0 or h <= 0:
+            return
+        data = np.ascontiguousarray(cells, dtype=np.uint8)
+        self.resource_manager.queue.write_texture(
+            {"texture": self._cell_texture, "mip_level": 0, "origin": (x0, y0, 0)},
+            memoryview(data).cast("B"),
+            {"offset": 0, "bytes_per_row": w * 2, "rows_per_image": h},
+            (w, h, 1),
+        )
+
+    def render(
+        self, out_width: int, out_height: int, origin_x: int, origin_y: int
+    ) -> wgpu.GPUTexture:
+        """Recolour the map into an opaque ``out_width`` x ``out_height`` texture.
+
+        Tile ``(0, 0)`` lands on output pixel ``(origin_x, origin_y)``; pixels
+        outside the map are opaque black. The returned texture is owned by the
+        resource manager's render-texture cache and must not be released.
+        """
+        output_texture = self.resource_manager.get_or_create_render_texture(
+            width=out_width,
+            height=out_height,
+            texture_format="rgba8unorm",
+            cache_key_suffix="palette_map",
+        )
+        self.resource_manager.queue.write_buffer(
+            self._uniform_buffer,
+            0,
+            memoryview(struct.pack("4i", origin_x, origin_y, 0, 0)),
+        )
+
+        command_encoder = self.resource_manager.device.create_command_encoder()
+        render_pass = command_encoder.begin_render_pass(
+            color_attachments=[
+                {
+                    "view": self.resource_manager.get_texture_view(output_texture),
+                    "resolve_target": None,
+                    "clear_value": (0.0, 0.0, 0.0, 1.0),
+                    "load_op": wgpu.LoadOp.clear,
+                    "store_op": wgpu.StoreOp.store,
+                }
+            ]
+        )
+        render_pass.set_pipeline(self._pipeline)
+        render_pass.set_bind_group(0, self._bind_group)
+        render_pass.set_vertex_buffer(0, self._vertex_buffer)
+        render_pass.draw(6, 1, 0, 0)
+        render_pass.end()
+        self.resource_manager.queue.submit([command_encoder.finish()])
+        return output_texture
+
+    def release(self) -> None:
+        """Destroy the textures this map owns."""
+        self._cell_texture.destroy()
+        self._palette_texture.destroy()
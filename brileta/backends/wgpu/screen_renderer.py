@@ -3,6 +3,7 @@
 from __future__ import annotations
 
 import struct
+from itertools import pairwise
 from typing import TYPE_CHECKING
 
 import numpy as np
@@ -16,26 +17,29 @@ from brileta.types import (
     UVRect,
     WorldTilePos,
 )
+from brileta.util._native import (
+    write_glyph_shadow_batch as _write_glyph_shadow_batch,
+)
+from brileta.util._native import (
+    write_parallelogram_batch as _write_parallelogram_batch,
+)
+from brileta.util._native import write_quad_batch as _write_quad_batch
 
 from .resource_manager import ALPHA_BLEND_STATE
 
 if TYPE_CHECKING:
+    from .decal_renderer import WGPUDecalRenderer
     from .resource_manager import WGPUResourceManager
     from .shader_manager import WGPUShaderManager
 
 # Maximum number of quads (2 triangles per quad) to draw per frame.
 MAX_QUADS = 10000
 
-# Constant local UV patterns for the two quad-emission methods.  Hoisted here
-# so we avoid re-creating identical numpy arrays on every batch call.
-_PARALLELOGRAM_LOCAL_UVS = np.array(
-    [(0.0, 1.0), (1.0, 1.0), (0.0, 0.0), (1.0, 1.0), (0.0, 0.0), (1.0, 0.0)],
-    dtype=np.float32,
-)
-_QUAD_LOCAL_UVS = np.array(
-    [(0.0, 0.0), (1.0, 0.0), (0.0, 1.0), (1.0, 0.0), (0.0, 1.0), (1.0, 1.0)],
-    dtype=np.float32,
-)
+
+def _as_f32(values: np.ndarray) -> np.ndarray:
+    """Contiguous float32 view (or copy) of a batch input for the native writers."""
+    return np.ascontiguousarray(values, dtype=np.float32)
+
 
 # and makes field indexing like arr["position"] type-check.
 VERTEX_DTYPE = np.dtype(
@@ -91,6 +95,9 @@ class WGPUScreenRenderer:
         self.vertex_count = 0
         self._shadow_start = 0
         self._shadow_end = 0
+        # Instanced decal draw spliced into the vertex stream at this index.
+        self._decal_layer: WGPUDecalRenderer | None = None
+        self._decal_vertex_index = 0
         self._actor_lightmap_texture: wgpu.GPUTexture | None = None
         self._actor_light_viewport_origin: WorldTilePos = (0, 0)
         self._actor_lighting_enabled = False
@@ -325,6 +332,7 @@ class WGPUScreenRenderer:
         self.vertex_count = 0
         self._shadow_start = 0
         self._shadow_end = 0
+        self._decal_layer = None
 
     def set_actor_lighting_context(
         self,
@@ -360,6 +368,15 @@ class WGPUScreenRenderer:
         """Record where shadow vertices end in the shared vertex buffer."""
         self._shadow_end = self.vertex_count
 
+    def mark_decal_layer(self, decal_layer: WGPUDecalRenderer) -> None:
+        """Draw ``decal_layer`` at the current point of the vertex stream.
+
+        Decals live in their own persistent instance buffer; this keeps them
+        layered above the quads added so far and below those added after.
+        """
+        self._decal_layer = decal_layer
+        self._decal_vertex_index = self.vertex_count
+
     def add_quad(
         self,
         x: float,
@@ -596,80 +613,85 @@ class WGPUScreenRenderer:
         """Add multiple projected shadow parallelograms in one buffer write.
 
         This mirrors :meth:`add_parallelogram` exactly (same corner order, UV
-        mapping, triangle winding, defaults, and shader flags) but avoids the
-        per-quad ``np.zeros(...)`` allocation and tuple packing overhead in the
-        hot shadow rendering path.
-        """
-        quad_count = len(corners)
-        if quad_count <= 0:
-            return
+        mapping, triangle winding, defaults, and shader flags). The vertices
+        are written natively in one sequential pass (``write_parallelogram_batch``
+        in ``_native_quad_vertices.c``); quads beyond the buffer's remaining
+        capacity are dropped.
 
-        remaining_vertices = len(self.cpu_vertex_buffer) - self.vertex_count
-        max_quads = remaining_vertices // 6
-        if max_quads <= 0:
+        Args:
+            corners: (base_left, base_right, tip_left, tip_right) per quad,
+                shape (N, 4, 2).
+            uv_coords: UV rectangles (u1, v1, u2, v2), shape (N, 4).
+            base_colors, tip_colors: RGBA per edge, shape (N, 4).
+            flags: Per-quad uint32 flags, shape (N,).
+            vertex_colors: Optional per-corner RGBA overriding base/tip colors,
+                shape (N, 4, 4), in corner order.
+        """
+        if len(corners) <= 0:
             return
-        if quad_count > max_quads:
-            quad_count = max_quads
-            corners = corners[:quad_count]
-            uv_coords = uv_coords[:quad_count]
-            base_colors = base_colors[:quad_count]
-            tip_colors = tip_colors[:quad_count]
-            flags = flags[:quad_count]
-            if vertex_colors is not None:
-                vertex_colors = vertex_colors[:quad_count]
 
         start = self.vertex_count
-        end = start + (quad_count * 6)
-        vertices = self.cpu_vertex_buffer[start:end].reshape((quad_count, 6))
-
-        # Corner order in the two triangles: BL, BR, TL, BR, TL, TR.
-        vertices["position"][:, 0] = corners[:, 0]
-        vertices["position"][:, 1] = corners[:, 1]
-        vertices["position"][:, 2] = corners[:, 2]
-        vertices["position"][:, 3] = corners[:, 1]
-        vertices["position"][:, 4] = corners[:, 2]
-        vertices["position"][:, 5] = corners[:, 3]
-
-        u1 = uv_coords[:, 0]
-        v1 = uv_coords[:, 1]
-        u2 = uv_coords[:, 2]
-        v2 = uv_coords[:, 3]
-        vertices["uv"][:, 0, 0] = u1
-        vertices["uv"][:, 0, 1] = v2
-        vertices["uv"][:, 1, 0] = u2
-        vertices["uv"][:, 1, 1] = v2
-        vertices["uv"][:, 2, 0] = u1
-        vertices["uv"][:, 2, 1] = v1
-        vertices["uv"][:, 3, 0] = u2
-        vertices["uv"][:, 3, 1] = v2
-        vertices["uv"][:, 4, 0] = u1
-        vertices["uv"][:, 4, 1] = v1
-        vertices["uv"][:, 5, 0] = u2
-        vertices["uv"][:, 5, 1] = v1
-
-        vertices["uv_local"][:] = _PARALLELOGRAM_LOCAL_UVS[np.newaxis, :, :]
+        written = _write_parallelogram_batch(
+            self.cpu_vertex_buffer[start:],
+            _as_f32(corners),
+            _as_f32(uv_coords),
+            _as_f32(base_colors),
+            _as_f32(tip_colors),
+            np.ascontiguousarray(flags, dtype=np.uint32),
+            None if vertex_colors is None else _as_f32(vertex_colors),
+        )
+        self.vertex_count = start + written * 6
 
-        if vertex_colors is not None:
-            vertices["color"][:, 0] = vertex_colors[:, 0]
-            vertices["color"][:, 1] = vertex_colors[:, 1]
-            vertices["color"][:, 2] = vertex_colors[:, 2]
-            vertices["color"][:, 3] = vertex_colors[:, 1]
-            vertices["color"][:, 4] = vertex_colors[:, 2]
-            vertices["color"][:, 5] = vertex_colors[:, 3]
-        else:
-            vertices["color"][:, 0] = base_colors
-            vertices["color"][:, 1] = base_colors
-            vertices["color"][:, 2] = tip_colors
-            vertices["color"][:, 3] = base_colors
-            vertices["color"][:, 4] = tip_colors
-            vertices["color"][:, 5] = tip_colors
+    def add_glyph_shadow_batch(
+        self,
+        uv_coords: np.ndarray,
+        screen_x: np.ndarray,
+        screen_y: np.ndarray,
+        lengths: np.ndarray,
+        *,
+        dir_x: float,
+        dir_y: float,
+        tile_size: tuple[float, float],
+        scale: tuple[float, float],
+        alpha: float,
+        fade_tip: bool,
+        horizontal_threshold: float,
+    ) -> None:
+        """Project and add many centred glyph shadows in one native pass.
+
+        Builds the same corners, UV mirroring and per-vertex alpha fade as
+        ``WGPUGraphicsContext.draw_actor_shadow()`` and writes the vertices
+        straight into the buffer (``write_glyph_shadow_batch`` in
+        ``_native_quad_vertices.c``). Shadows with a non-positive length are
+        skipped; quads beyond the buffer's remaining capacity are dropped.
 
-        vertices["world_pos"][:] = (-1.0, -1.0)
-        vertices["actor_light_scale"][:] = 1.0
-        vertices["flags"][:] = flags[:, np.newaxis]
-        vertices["tile_bg"][:] = (0.0, 0.0, 0.0)
+        Args:
+            uv_coords: Glyph UV rectangles (u1, v1, u2, v2), shape (N, 4).
+            screen_x, screen_y: Glyph tile top-left in pixels, shape (N,).
+            lengths: Shadow lengths in pixels, shape (N,).
+            dir_x, dir_y: Unit shadow direction shared by the batch.
+        """
+        if len(uv_coords) <= 0:
+            return
 
-        self.vertex_count = end
+        start = self.vertex_count
+        written = _write_glyph_shadow_batch(
+            self.cpu_vertex_buffer[start:],
+            _as_f32(uv_coords),
+            np.ascontiguousarray(screen_x, dtype=np.float64),
+            np.ascontiguousarray(screen_y, dtype=np.float64),
+            np.ascontiguousarray(lengths, dtype=np.float64),
+            float(dir_x),
+            float(dir_y),
+            float(tile_size[0]),
+            float(tile_size[1]),
+            float(scale[0]),
+            float(scale[1]),
+            float(alpha),
+            bool(fade_tip),
+            float(horizontal_threshold),
+        )
+        self.vertex_count = start + written * 6
 
     def add_quad_batch(
         self,
@@ -687,8 +709,11 @@ class WGPUScreenRenderer:
     ) -> None:
         """Add multiple axis-aligned quads in one buffer write.
 
-        Vectorized version of :meth:`add_quad` for batch actor/sprite rendering.
-        Each quad is defined by position (x, y), size (w, h), and UV coordinates.
+        Vectorized version of :meth:`add_quad` for batch actor/sprite/particle
+        rendering. Each quad is defined by position (x, y), size (w, h), and UV
+        coordinates. All 6 vertices per quad are written natively in one
+        sequential pass (``write_quad_batch`` in ``_native_quad_vertices.c``);
+        quads beyond the buffer's remaining capacity are dropped.
 
         Args:
             x, y: Quad top-left positions, shape (N,).
@@ -700,102 +725,24 @@ class WGPUScreenRenderer:
             flags: Per-quad uint32 flags, shape (N,). Default 0.
             tile_bg: Per-quad tile background RGB, shape (N, 3). Default (0,0,0).
         """
-        quad_count = len(x)
-        if quad_count <= 0:
+        if len(x) <= 0:
             return
 
-        remaining = len(self.cpu_vertex_buffer) - self.vertex_count
-        max_quads = remaining // 6
-        if max_quads <= 0:
-            return
-        if quad_count > max_quads:
-            quad_count = max_quads
-            x = x[:quad_count]
-            y = y[:quad_count]
-            w = w[:quad_count]
-            h = h[:quad_count]
-            uv_coords = uv_coords[:quad_count]
-            colors = colors[:quad_count]
-            if world_pos is not None:
-                world_pos = world_pos[:quad_count]
-            if actor_light_scale is not None:
-                actor_light_scale = actor_light_scale[:quad_count]
-            if flags is not None:
-                flags = flags[:quad_count]
-            if tile_bg is not None:
-                tile_bg = tile_bg[:quad_count]
-
         start = self.vertex_count
-        end = start + (quad_count * 6)
-        vertices = self.cpu_vertex_buffer[start:end].reshape((quad_count, 6))
-
-        # Two triangles per quad: v0=TL, v1=TR, v2=BL, v3=TR, v4=BL, v5=BR.
-        x_right = x + w
-        y_bottom = y + h
-
-        # Positions: [N, 6, 2]
-        vertices["position"][:, 0, 0] = x
-        vertices["position"][:, 0, 1] = y
-        vertices["position"][:, 1, 0] = x_right
-        vertices["position"][:, 1, 1] = y
-        vertices["position"][:, 2, 0] = x
-        vertices["position"][:, 2, 1] = y_bottom
-        vertices["position"][:, 3, 0] = x_right
-        vertices["position"][:, 3, 1] = y
-        vertices["position"][:, 4, 0] = x
-        vertices["position"][:, 4, 1] = y_bottom
-        vertices["position"][:, 5, 0] = x_right
-        vertices["position"][:, 5, 1] = y_bottom
-
-        # UVs: [N, 6, 2]
-        u1 = uv_coords[:, 0]
-        v1 = uv_coords[:, 1]
-        u2 = uv_coords[:, 2]
-        v2 = uv_coords[:, 3]
-        vertices["uv"][:, 0, 0] = u1
-        vertices["uv"][:, 0, 1] = v1
-        vertices["uv"][:, 1, 0] = u2
-        vertices["uv"][:, 1, 1] = v1
-        vertices["uv"][:, 2, 0] = u1
-        vertices["uv"][:, 2, 1] = v2
-        vertices["uv"][:, 3, 0] = u2
-        vertices["uv"][:, 3, 1] = v1
-        vertices["uv"][:, 4, 0] = u1
-        vertices["uv"][:, 4, 1] = v2
-        vertices["uv"][:, 5, 0] = u2
-        vertices["uv"][:, 5, 1] = v2
-
-        # Local UVs: constant pattern for axis-aligned quads.
-        vertices["uv_local"][:] = _QUAD_LOCAL_UVS[np.newaxis, :, :]
-
-        # Colors: broadcast per-quad RGBA to all 6 vertices.
-        vertices["color"][:] = colors[:, np.newaxis, :]
-
-        # World positions.
-        if world_pos is not None:
-            vertices["world_pos"][:] = world_pos[:, np.newaxis, :]
-        else:
-            vertices["world_pos"][:] = (-1.0, -1.0)
-
-        # Actor light scale.
-        if actor_light_scale is not None:
-            vertices["actor_light_scale"][:] = actor_light_scale[:, np.newaxis]
-        else:
-            vertices["actor_light_scale"][:] = 1.0
-
-        # Flags.
-        if flags is not None:
-            vertices["flags"][:] = flags[:, np.newaxis]
-        else:
-            vertices["flags"][:] = np.uint32(0)
-
-        # Tile background.
-        if tile_bg is not None:
-            vertices["tile_bg"][:] = tile_bg[:, np.newaxis, :]
-        else:
-            vertices["tile_bg"][:] = (0.0, 0.0, 0.0)
-
-        self.vertex_count = end
+        written = _write_quad_batch(
+            self.cpu_vertex_buffer[start:],
+            _as_f32(x),
+            _as_f32(y),
+            _as_f32(w),
+            _as_f32(h),
+            _as_f32(uv_coords),
+            _as_f32(colors),
+            None if world_pos is None else _as_f32(world_pos),
+            None if actor_light_scale is None else _as_f32(actor_light_scale),
+            None if flags is None else np.ascontiguousarray(flags, dtype=np.uint32),
+            None if tile_bg is None else _as_f32(tile_bg),
+        )
+        self.vertex_count = start + written * 6
 
     def render_to_screen(
         self,
@@ -810,7 +757,10 @@ class WGPUScreenRenderer:
             window_size: Full window dimensions
             letterbox_geometry: (offset_x, offset_y, scaled_w, scaled_h) for letterbox
         """
-        if self.vertex_count == 0:
+        decal_layer = self._decal_layer
+        if decal_layer is not None and not decal_layer.has_pending_draw():
+            decal_layer = None
+        if self.vertex_count == 0 and decal_layer is None:
             return
 
         # Determine letterbox parameters
@@ -846,11 +796,12 @@ class WGPUScreenRenderer:
         )
 
         # Upload vertex data to GPU
-        self.resource_manager.queue.write_buffer(
-            self.vertex_buffer,
-            0,
-            memoryview(self.cpu_vertex_buffer[: self.vertex_count].tobytes()),
-        )
+        if self.vertex_count > 0:
+            self.resource_manager.queue.write_buffer(
+                self.vertex_buffer,
+                0,
+                memoryview(self.cpu_vertex_buffer[: self.vertex_count].tobytes()),
+            )
 
         # Set the viewport to the full size of the window to ensure rendering
         # is not clipped after a resize.
@@ -858,30 +809,33 @@ class WGPUScreenRenderer:
             0.0, 0.0, float(window_size[0]), float(window_size[1]), 0.0, 1.0
         )
 
-        # Set up render pass
-        render_pass.set_pipeline(self.pipeline)
-        render_pass.set_vertex_buffer(0, self.vertex_buffer)
-
-        # Split one vertex buffer into three draw ranges:
-        # pre-shadow sharp pass, blurred shadow pass, post-shadow sharp pass.
+        # Split one vertex buffer into draw ranges: pre-shadow sharp pass,
+        # blurred shadow pass, post-shadow sharp pass, further split where the
+        # instanced decal layer is spliced in.
         shadow_start = min(max(self._shadow_start, 0), self.vertex_count)
         shadow_end = min(max(self._shadow_end, shadow_start), self.vertex_count)
-
-        pre_shadow_count = shadow_start
-        shadow_count = shadow_end - shadow_start
-        post_shadow_count = self.vertex_count - shadow_end
+        decal_index = min(max(self._decal_vertex_index, 0), self.vertex_count)
+        boundaries = {0, shadow_start, shadow_end, self.vertex_count}
+        if decal_layer is not None:
+            boundaries.add(decal_index)
 
         assert self._cached_bind_group is not None
         assert self._shadow_bind_group is not None
 
-        if pre_shadow_count > 0:
-            render_pass.set_bind_group(0, self._cached_bind_group)
-            render_pass.draw(pre_shadow_count, 1, 0)
-
-        if shadow_count > 0:
-            render_pass.set_bind_group(0, self._shadow_bind_group)
-            render_pass.draw(shadow_count, 1, shadow_start)
-
-        if post_shadow_count > 0:
-            render_pass.set_bind_group(0, self._cached_bind_group)
-            render_pass.draw(post_shadow_count, 1, shadow_end)
+        pipeline_bound = False
+        for start, end in pairwise(sorted(boundaries)):
+            if decal_layer is not None and start == decal_index:
+                decal_layer.render(render_pass, window_size, letterbox_geometry)
+                pipeline_bound = False
+            if not pipeline_bound:
+                render_pass.set_pipeline(self.pipeline)
+                render_pass.set_vertex_buffer(0, self.vertex_buffer)
+                pipeline_bound = True
+            in_shadow = shadow_start <= start < shadow_end
+            render_pass.set_bind_group(
+                0, self._shadow_bind_group if in_shadow else self._cached_bind_group
+            )
+            render_pass.draw(end - start, 1, start)
+
+        if decal_layer is not None and decal_index == self.vertex_count:
+            decal_layer.render(render_pass, window_size, letterbox_geometry)
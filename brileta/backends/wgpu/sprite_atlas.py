@@ -7,19 +7,25 @@ renderer uses to draw from this atlas instead of the CP437 glyph atlas.
 
 The atlas is auto-sized at map load time to fit all sprites for the current
 map.  On map transitions, the old atlas is dropped and a fresh one is
-created at the appropriate size for the new map.
+created at the appropriate size for the new map.  Worlds whose sprites
+exceed the configured GPU budget use :class:`PagedSpriteAtlas` instead: a
+fixed-size texture of square pages that holds only the sprites near the
+camera and evicts whole pages least-recently-used first.
 """
 
 from __future__ import annotations
 
+import hashlib
 import logging
 import math
-from dataclasses import dataclass
+from collections.abc import Hashable
+from dataclasses import dataclass, field
 from typing import TYPE_CHECKING
 
 import numpy as np
 
 from brileta.types import SpriteUV
+from brileta.util._native import atlas_pack_blit
 
 if TYPE_CHECKING:
     import wgpu
@@ -62,6 +68,35 @@ def compute_atlas_size(
     if not sprites:
         return _MIN_ATLAS_SIZE
 
+    side, total_area = _estimate_atlas_side(sprites, extra_area)
+    side = max(_MIN_ATLAS_SIZE, min(side, gpu_max_texture_dim))
+
+    if side * side < total_area:
+        logger.warning(
+            "Sprite atlas clamped to GPU max (%dx%d). %d sprites totalling "
+            "%d px^2 may not all fit - some actors will use glyph fallback.",
+            side,
+            side,
+            len(sprites),
+            total_area,
+        )
+
+    return side
+
+
+def required_atlas_side(sprites: list[np.ndarray], extra_area: int = 0) -> int:
+    """Power-of-two atlas side that would fit *sprites*, ignoring GPU limits.
+
+    The unclamped counterpart of :func:`compute_atlas_size`, for callers that
+    compare a world's need against a memory budget before creating anything.
+    """
+    if not sprites:
+        return _MIN_ATLAS_SIZE
+    return max(_MIN_ATLAS_SIZE, _estimate_atlas_side(sprites, extra_area)[0])
+
+
+def _estimate_atlas_side(sprites: list[np.ndarray], extra_area: int) -> tuple[int, int]:
+    """Return ``(power-of-two side, padded area)`` needed to pack *sprites*."""
     # Sum padded pixel areas and track the widest/tallest sprite (the atlas
     # must be at least that large on each axis or the sprite can never fit).
     total_area = 0
@@ -77,20 +112,35 @@ def compute_atlas_size(
     target_area = total_area * _PACKING_OVERHEAD
     # Side length from area, then round up to next power of two.
     side = max(max_dim, math.ceil(math.sqrt(target_area)))
-    side = _next_power_of_two(side)
-    side = max(_MIN_ATLAS_SIZE, min(side, gpu_max_texture_dim))
+    return _next_power_of_two(side), total_area
 
-    if side * side < total_area:
-        logger.warning(
-            "Sprite atlas clamped to GPU max (%dx%d). %d sprites totalling "
-            "%d px^2 may not all fit - some actors will use glyph fallback.",
-            side,
-            side,
-            len(sprites),
-            total_area,
-        )
 
-    return side
+def sprite_content_key(pixels: np.ndarray) -> bytes:
+    """Digest identifying a sprite's exact pixels, shape included.
+
+    Two sprites with equal keys are byte-identical, so they can share one atlas
+    rectangle (see the ``dedupe`` flag on :meth:`SpriteAtlas.pack_all`).
+    """
+    h = hashlib.blake2b(digest_size=16)
+    h.update(np.asarray(pixels.shape, dtype=np.int32).tobytes())
+    h.update(np.ascontiguousarray(pixels, dtype=np.uint8).data)
+    return h.digest()
+
+
+def unique_sprites(sprites: list[np.ndarray]) -> list[np.ndarray]:
+    """First occurrence of each distinct sprite, in input order.
+
+    Sizes a deduplicating atlas: pass the result to :func:`compute_atlas_size`
+    so repeated pixel blocks are not budgeted twice.
+    """
+    seen: set[bytes] = set()
+    out: list[np.ndarray] = []
+    for px in sprites:
+        key = sprite_content_key(px)
+        if key not in seen:
+            seen.add(key)
+            out.append(px)
+    return out
 
 
 def _next_power_of_two(n: int) -> int:
@@ -174,6 +224,12 @@ class SpriteAtlas:
         self._shelf_y: int = 0
         self._shelf_h: int = 0
 
+        # Content digest -> UV for sprites packed with dedupe=True, so a later
+        # byte-identical sprite reuses the rectangle instead of taking another.
+        self._uv_by_content: dict[bytes, SpriteUV] = {}
+        # Sprites that resolved to an existing rectangle instead of packing.
+        self.deduplicated_count: int = 0
+
     # ------------------------------------------------------------------
     # Public API
     # ------------------------------------------------------------------
@@ -224,17 +280,22 @@ class SpriteAtlas:
 
         return uv
 
-    def pack_all(self, sprites: list[np.ndarray]) -> list[SpriteUV | None]:
+    def pack_all(
+        self, sprites: list[np.ndarray], *, dedupe: bool = False
+    ) -> list[SpriteUV | None]:
         """Pack all sprites at once using fast shelf packing.
 
         Sorts sprites by height descending and packs them left-to-right in
-        fixed-height rows (shelves).  This is O(1) per sprite - pure integer
-        arithmetic, no list manipulation - and much faster than per-sprite
-        skyline packing for large batches.
+        fixed-height rows (shelves).  Placement and the pixel blits run in one
+        native pass (``atlas_pack_blit``) with the GIL released; Python only
+        sorts, dedupes, and turns the returned positions into UVs.
 
         Returns UVs in the **same order** as the input list.  Sprites that
         don't fit return None in their slot.
 
+        With ``dedupe=True``, byte-identical sprites are packed once and every
+        copy gets the same UV rectangle (see :func:`sprite_content_key`).
+
         Also builds the CPU staging buffer.  Call :meth:`flush` afterwards
         to upload to the GPU.
         """
@@ -248,29 +309,33 @@ class SpriteAtlas:
         # placement starts at the origin (and so a later pack_incremental resumes
         # from wherever this batch leaves off).
         self._shelf_x = self._shelf_y = self._shelf_h = 0
+        self._uv_by_content.clear()
+        self.deduplicated_count = 0
 
         # Allocate the CPU staging buffer.
         buf = np.zeros((atlas_h, atlas_w, 4), dtype=np.uint8)
 
         results: list[SpriteUV | None] = [None] * len(sprites)
-        placed = 0
-        for i in self._tallest_first(sprites):
-            px = sprites[i]
-            sp_h, sp_w = px.shape[0], px.shape[1]
-            pos = self._shelf_place(sp_w + PADDING, sp_h + PADDING)
-            if pos is None:
-                continue  # Atlas full for this sprite.
-            x, y = pos
-
-            # Blit sprite into CPU buffer.
-            buf[y : y + sp_h, x : x + sp_w] = px
-            # Bottom-row edge extension for shadow linear filtering.
-            if sp_h > 0 and y + sp_h < atlas_h:
-                buf[y + sp_h, x : x + sp_w] = px[sp_h - 1]
+        to_pack, packed_keys, duplicates = self._split_duplicates(sprites, dedupe)
+        order = np.asarray(self._tallest_first(sprites, to_pack), dtype=np.int32)
+        cursor = np.zeros(3, dtype=np.int32)
+        positions = np.full((len(sprites), 2), -1, dtype=np.int32)
+        placed = atlas_pack_blit(
+            [np.ascontiguousarray(px, dtype=np.uint8) for px in sprites],
+            order,
+            buf,
+            cursor,
+            positions,
+            PADDING,
+        )
+        self._shelf_x, self._shelf_y, self._shelf_h = (int(v) for v in cursor)
 
-            results[i] = self._uv_for(x, y, sp_w, sp_h)
-            placed += 1
+        for i, (x, y) in enumerate(positions.tolist()):
+            if x >= 0:
+                sp_h, sp_w = sprites[i].shape[:2]
+                results[i] = self._uv_for(x, y, sp_w, sp_h)
 
+        self._resolve_duplicates(results, packed_keys, duplicates)
         self._cpu_buffer = buf
         # Update region count to match what we placed (for allocated_count).
         # We skip individual _regions tracking for pack_all since the UVs are
@@ -278,18 +343,22 @@ class SpriteAtlas:
         self._bulk_count = placed
         return results
 
-    def pack_incremental(self, sprites: list[np.ndarray]) -> list[SpriteUV | None]:
-        """Pack late-added sprites into the atlas and upload each region now.
+    def pack_incremental(
+        self, sprites: list[np.ndarray], *, dedupe: bool = False
+    ) -> list[SpriteUV | None]:
+        """Pack late-added sprites into the atlas and upload them now.
 
-        Continues the shelf cursor left by :meth:`pack_all` and uploads each
-        sprite with an immediate partial ``write_texture`` - the batch
-        :meth:`flush` already ran, so there is no CPU staging buffer to reuse.
-        This lets an actor created after the batch build join the live atlas
-        without re-flushing the whole texture.
+        Continues the shelf cursor left by :meth:`pack_all` and uploads with
+        partial ``write_texture`` calls, one per shelf row touched (see
+        :meth:`_upload_placed`) - the batch :meth:`flush` already ran, so there
+        is no CPU staging buffer to reuse. This lets an actor created after the
+        batch build join the live atlas without re-flushing the whole texture.
 
         Returns UVs in the **same order** as the input list; a sprite that no
         longer fits returns None in its slot (the caller treats a partial pack
-        as a full atlas and rebuilds).
+        as a full atlas and rebuilds). With ``dedupe=True`` a sprite identical
+        to one already in the atlas (from either pack path) reuses its UV
+        without uploading anything.
         """
         if not sprites:
             return []
@@ -301,7 +370,9 @@ class SpriteAtlas:
             self._texture = self._create_texture()
 
         results: list[SpriteUV | None] = [None] * len(sprites)
-        for i in self._tallest_first(sprites):
+        to_pack, packed_keys, duplicates = self._split_duplicates(sprites, dedupe)
+        placements: list[tuple[int, int, np.ndarray]] = []
+        for i in self._tallest_first(sprites, to_pack):
             px = sprites[i]
             sp_h, sp_w = px.shape[0], px.shape[1]
             pos = self._shelf_place(sp_w + PADDING, sp_h + PADDING)
@@ -309,23 +380,69 @@ class SpriteAtlas:
                 continue  # Atlas full for this sprite; slot stays None.
             x, y = pos
 
-            self._upload_region(x, y, sp_w, sp_h, px)
+            placements.append((x, y, px))
             results[i] = self._uv_for(x, y, sp_w, sp_h)
             self._bulk_count += 1
 
+        self._upload_placed(placements)
+        self._resolve_duplicates(results, packed_keys, duplicates)
         return results
 
     @staticmethod
-    def _tallest_first(sprites: list[np.ndarray]) -> list[int]:
-        """Input indices ordered by sprite height descending.
+    def _tallest_first(sprites: list[np.ndarray], indices: list[int]) -> list[int]:
+        """*indices* ordered by sprite height descending.
 
         Shelf packing sizes each shelf by its first sprite, so feeding sprites
         tallest-first makes every later sprite on a shelf no taller than it -
         which keeps :meth:`_shelf_place`'s height guard from tripping mid-shelf.
         """
-        return sorted(
-            range(len(sprites)), key=lambda i: sprites[i].shape[0], reverse=True
-        )
+        return sorted(indices, key=lambda i: sprites[i].shape[0], reverse=True)
+
+    def _split_duplicates(
+        self, sprites: list[np.ndarray], dedupe: bool
+    ) -> tuple[list[int], dict[int, bytes], dict[int, bytes]]:
+        """Split input indices into sprites to pack and content duplicates.
+
+        Returns ``(to_pack, packed_keys, duplicates)``: the indices that need a
+        rectangle, the content key of each of those (empty without *dedupe*),
+        and for every other index the key whose UV it will share - either an
+        earlier sprite in this batch or one already in the atlas.
+        """
+        if not dedupe:
+            return list(range(len(sprites))), {}, {}
+
+        packed_keys: dict[int, bytes] = {}
+        duplicates: dict[int, bytes] = {}
+        first_in_batch: set[bytes] = set()
+        for i, px in enumerate(sprites):
+            key = sprite_content_key(px)
+            if key in self._uv_by_content or key in first_in_batch:
+                duplicates[i] = key
+            else:
+                first_in_batch.add(key)
+                packed_keys[i] = key
+        return list(packed_keys), packed_keys, duplicates
+
+    def _resolve_duplicates(
+        self,
+        results: list[SpriteUV | None],
+        packed_keys: dict[int, bytes],
+        duplicates: dict[int, bytes],
+    ) -> None:
+        """Record packed content keys and fill duplicate slots with their UVs.
+
+        A duplicate of a sprite that failed to pack stays None, like its
+        original, so the caller's atlas-full handling sees it.
+        """
+        for i, key in packed_keys.items():
+            uv = results[i]
+            if uv is not None:
+                self._uv_by_content[key] = uv
+        for i, key in duplicates.items():
+            uv = self._uv_by_content.get(key)
+            results[i] = uv
+            if uv is not None:
+                self.deduplicated_count += 1
 
     def _shelf_place(self, padded_w: int, padded_h: int) -> tuple[int, int] | None:
         """Advance the shelf cursor for one sprite; return its (x, y) or None.
@@ -335,8 +452,11 @@ class SpriteAtlas:
         so pack_all resets it first (fresh atlas) and pack_incremental resumes it
         to append below the last batch row. Callers must feed sprites
         tallest-first (see :meth:`_tallest_first`). Returns None when the sprite
-        no longer fits vertically (atlas full).
+        no longer fits vertically (atlas full) or is larger than the atlas
+        itself; the latter leaves the cursor untouched.
         """
+        if padded_w > self.width or padded_h > self.height:
+            return None
         # Start a new shelf when the sprite would overflow the current row's
         # width, or is taller than the current shelf (its band is not reserved
         # for us, so placing it would overlap the row above). The height guard is
@@ -498,6 +618,7 @@ class SpriteAtlas:
         """
         self._skyline = [_SkylineNode(x=0, y=0, width=self.width)]
         self._regions.clear()
+        self._uv_by_content.clear()
 
     @property
     def allocated_count(self) -> int:
@@ -668,6 +789,49 @@ class SpriteAtlas:
         )
         return texture
 
+    def _upload_placed(self, placements: list[tuple[int, int, np.ndarray]]) -> None:
+        """Upload freshly shelf-placed sprites, one ``write_texture`` per row.
+
+        *placements* are ``(x, y, pixels)`` from :meth:`_shelf_place` (or a
+        page's equivalent). Sprites sharing a ``y`` sit on the same shelf, so
+        each row is staged as one band spanning its new sprites - with their
+        bottom-row edge extensions - and sent in a single call instead of two
+        per sprite. Everything else inside the band is padding or unused shelf
+        space below shorter sprites, which is transparent in the texture
+        already, so writing zeros there changes nothing.
+        """
+        if not placements:
+            return
+        assert self._texture is not None
+
+        rows: dict[int, list[tuple[int, np.ndarray]]] = {}
+        for x, y, px in placements:
+            rows.setdefault(y, []).append((x, px))
+
+        for y, row in rows.items():
+            x0 = min(x for x, _ in row)
+            x1 = max(x + px.shape[1] for x, px in row)
+            band_h = min(max(px.shape[0] for _, px in row) + PADDING, self.height - y)
+            band = np.zeros((band_h, x1 - x0, 4), dtype=np.uint8)
+            for x, px in row:
+                sp_h, sp_w = px.shape[:2]
+                bx = x - x0
+                band[:sp_h, bx : bx + sp_w] = px
+                # Bottom-row extension, as in _upload_region.
+                if 0 < sp_h < band_h:
+                    band[sp_h, bx : bx + sp_w] = px[sp_h - 1]
+
+            self._resource_manager.queue.write_texture(
+                {"texture": self._texture, "mip_level": 0, "origin": (x0, y, 0)},
+                memoryview(band.tobytes()),
+                {
+                    "offset": 0,
+                    "bytes_per_row": (x1 - x0) * 4,
+                    "rows_per_image": band_h,
+                },
+                (x1 - x0, band_h, 1),
+            )
+
     def _upload_region(
         self,
         x: int,
@@ -721,3 +885,238 @@ class SpriteAtlas:
                 {"offset": 0, "bytes_per_row": width * 4, "rows_per_image": 1},
                 (width, 1, 1),
             )
+
+
+@dataclass
+class _AtlasPage:
+    """One fixed-size square page of a :class:`PagedSpriteAtlas`.
+
+    Pages shelf-pack like :meth:`SpriteAtlas.pack_all` within their own square
+    and are evicted whole, so no free-list bookkeeping is needed.
+    """
+
+    x: int
+    y: int
+    shelf_x: int = 0
+    shelf_y: int = 0
+    shelf_h: int = 0
+    # Residency stamp of the last frame any of this page's groups was touched.
+    last_used: int = -1
+    groups: set[Hashable] = field(default_factory=set)
+    # Page-local content dedupe: identical sprites in one page share a rect.
+    uv_by_content: dict[bytes, SpriteUV] = field(default_factory=dict)
+
+    def reset(self) -> None:
+        self.shelf_x = self.shelf_y = self.shelf_h = 0
+        self.last_used = -1
+        self.groups.clear()
+        self.uv_by_content.clear()
+
+
+class PagedSpriteAtlas(SpriteAtlas):
+    """Fixed-budget sprite atlas split into square pages with LRU eviction.
+
+    The texture is a grid of ``page_count`` pages of ``page_size`` pixels and
+    never grows, so GPU memory is bounded however many sprites the world has.
+    Sprites are packed in *groups* (one actor's pose set, or a single tree)
+    that always live on one page; :meth:`pack_group` fills the current page,
+    then an empty one, then evicts the least recently touched page and
+    reports which groups lost their UVs so the caller can fall back to glyphs.
+
+    A texture array would give each page its own layer, but the screen shader
+    samples one 2D sprite texture, so pages are tiled into a single texture
+    and UVs stay plain :class:`SpriteUV` rectangles.
+    """
+
+    def __init__(
+        self,
+        resource_manager: WGPUResourceManager,
+        page_size: int,
+        page_count: int,
+    ) -> None:
+        columns = math.ceil(math.sqrt(page_count))
+        rows = math.ceil(page_count / columns)
+        super().__init__(resource_manager, page_size * columns, page_size * rows)
+        self.page_size = page_size
+        self._pages = [
+            _AtlasPage(x=(i % columns) * page_size, y=(i // columns) * page_size)
+            for i in range(page_count)
+        ]
+        self._page_of: dict[Hashable, int] = {}
+        # Page new groups go to first; replaced when it fills up.
+        self._fill_page: int | None = None
+        self.evicted_page_count: int = 0
+
+    @property
+    def texture(self) -> wgpu.GPUTexture:
+        """The page texture, created cleared on first access so it can be
+        bound before any sprite streams in."""
+        if self._texture is None:
+            self._texture = self._create_texture()
+        return self._texture
+
+    @property
+    def page_count(self) -> int:
+        return len(self._pages)
+
+    @property
+    def resident_count(self) -> int:
+        """Number of groups currently holding UVs in the atlas."""
+        return len(self._page_of)
+
+    def page_of(self, key: Hashable) -> int | None:
+        """Page index holding *key*'s sprites, or None if not resident."""
+        return self._page_of.get(key)
+
+    def touch(self, key: Hashable, stamp: int) -> bool:
+        """Mark *key* as used during residency frame *stamp*.
+
+        Returns False when the group is not resident.
+        """
+        index = self._page_of.get(key)
+        if index is None:
+            return False
+        page = self._pages[index]
+        page.last_used = max(page.last_used, stamp)
+        return True
+
+    def pack_group(
+        self, key: Hashable, sprites: list[np.ndarray], stamp: int
+    ) -> tuple[list[SpriteUV] | None, list[Hashable]]:
+        """Make *key*'s sprites resident on one page and upload them now.
+
+        Returns ``(uvs, evicted)``: UVs in input order, and the keys of any
+        groups whose page was evicted to make room. ``uvs`` is None when the
+        group is larger than a page or every page was touched during *stamp*
+        (the working set already fills the budget); the group then stays
+        non-resident. A group that is already resident keeps its page.
+        """
+        if key in self._page_of:
+            raise ValueError(f"Sprite group {key!r} is already resident")
+        if self._texture is None:
+            self._texture = self._create_texture()
+
+        evicted: list[Hashable] = []
+        uvs = None
+        if self._fill_page is not None:
+            uvs = self._place_group(self._fill_page, sprites)
+        if uvs is None:
+            index = self._free_page()
+            if index is None:
+                index = self._least_recent_page(stamp)
+                if index is None:
+                    return None, evicted
+                evicted = self._evict(index)
+            uvs = self._place_group(index, sprites)
+            if uvs is None:
+                return None, evicted  # Larger than a whole page.
+            self._fill_page = index
+
+        assert self._fill_page is not None
+        page = self._pages[self._fill_page]
+        page.groups.add(key)
+        page.last_used = max(page.last_used, stamp)
+        self._page_of[key] = self._fill_page
+        return uvs, evicted
+
+    def clear(self) -> None:
+        super().clear()
+        for page in self._pages:
+            page.reset()
+        self._page_of.clear()
+        self._fill_page = None
+
+    def _free_page(self) -> int | None:
+        for index, page in enumerate(self._pages):
+            if not page.groups and index != self._fill_page:
+                return index
+        return None
+
+    def _least_recent_page(self, stamp: int) -> int | None:
+        """Oldest page not used during *stamp*, or None if all are in use."""
+        candidates = [
+            index for index, page in enumerate(self._pages) if page.last_used < stamp
+        ]
+        if not candidates:
+            return None
+        return min(candidates, key=lambda index: self._pages[index].last_used)
+
+    def _evict(self, index: int) -> list[Hashable]:
+        """Drop every group on page *index* and clear its pixels."""
+        page = self._pages[index]
+        evicted = list(page.groups)
+        for key in evicted:
+            del self._page_of[key]
+        page.reset()
+        if self._fill_page == index:
+            self._fill_page = None
+        self.evicted_page_count += 1
+
+        # Clear so stale pixels never sit in the padding next to a new sprite,
+        # where the linear-filtered shadow pass would pick them up.
+        assert self._texture is not None
+        size = self.page_size
+        self._resource_manager.queue.write_texture(
+            {"texture": self._texture, "mip_level": 0, "origin": (page.x, page.y, 0)},
+            memoryview(np.zeros((size, size, 4), dtype=np.uint8).tobytes()),
+            {"offset": 0, "bytes_per_row": size * 4, "rows_per_image": size},
+            (size, size, 1),
+        )
+        return evicted
+
+    def _place_group(
+        self, index: int, sprites: list[np.ndarray]
+    ) -> list[SpriteUV] | None:
+        """Shelf-pack *sprites* into page *index* and upload them.
+
+        All or nothing: if any sprite does not fit, the page's cursor is
+        restored and nothing is uploaded.
+        """
+        page = self._pages[index]
+        cursor = (page.shelf_x, page.shelf_y, page.shelf_h)
+        keys = [sprite_content_key(px) for px in sprites]
+        placed: dict[bytes, tuple[int, int]] = {}
+        for i in self._tallest_first(sprites, list(range(len(sprites)))):
+            key = keys[i]
+            if key in page.uv_by_content or key in placed:
+                continue
+            sp_h, sp_w = sprites[i].shape[:2]
+            pos = self._page_shelf_place(page, sp_w + PADDING, sp_h + PADDING)
+            if pos is None:
+                page.shelf_x, page.shelf_y, page.shelf_h = cursor
+                return None
+            placed[key] = pos
+
+        placements: list[tuple[int, int, np.ndarray]] = []
+        for i, key in enumerate(keys):
+            if key not in placed or key in page.uv_by_content:
+                continue
+            x, y = placed[key]
+            sp_h, sp_w = sprites[i].shape[:2]
+            placements.append((x, y, sprites[i]))
+            page.uv_by_content[key] = self._uv_for(x, y, sp_w, sp_h)
+        self._upload_placed(placements)
+        self.deduplicated_count += len(sprites) - len(placed)
+        return [page.uv_by_content[key] for key in keys]
+
+    def _page_shelf_place(
+        self, page: _AtlasPage, padded_w: int, padded_h: int
+    ) -> tuple[int, int] | None:
+        """Page-local :meth:`SpriteAtlas._shelf_place`; returns texture coords."""
+        size = self.page_size
+        if padded_w > size or padded_h > size:
+            return None
+        if (
+            page.shelf_h == 0
+            or page.shelf_x + padded_w > size
+            or padded_h > page.shelf_h
+        ):
+            page.shelf_y += page.shelf_h
+            page.shelf_x = 0
+            page.shelf_h = padded_h
+        if page.shelf_y + padded_h > size:
+            return None
+        x = page.x + page.shelf_x
+        y = page.y + page.shelf_y
+        page.shelf_x += padded_w
+        return x, y
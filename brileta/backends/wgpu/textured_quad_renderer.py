@@ -156,6 +156,28 @@ class WGPUTexturedQuadRenderer:
         # Queue only the texture and vertex count for this quad
         self.render_queue.append((texture, 6))
 
+    def add_textured_quads(
+        self, texture: wgpu.GPUTexture, vertices: np.ndarray
+    ) -> None:
+        """Queue a run of quads (6 vertices each) that all sample one texture.
+
+        Quads past the buffer's capacity are dropped. A run that follows a
+        draw of the same texture extends it, so it costs no extra draw call.
+        """
+        capacity = len(self.cpu_vertex_buffer) - self.vertex_count
+        count = min(len(vertices) - len(vertices) % 6, capacity - capacity % 6)
+        if count <= 0:
+            return
+
+        start = self.vertex_count
+        self.cpu_vertex_buffer[start : start + count] = vertices[:count]
+        self.vertex_count += count
+
+        if self.render_queue and self.render_queue[-1][0] is texture:
+            self.render_queue[-1] = (texture, self.render_queue[-1][1] + count)
+        else:
+            self.render_queue.append((texture, count))
+
     def _get_or_create_bind_group(self, texture: wgpu.GPUTexture) -> wgpu.GPUBindGroup:
         """Get or create a bind group for the given texture."""
         if texture not in self.texture_bind_groups:
@@ -58,6 +58,11 @@ DEFAULT_ZOOM_INDEX: int = 4
 # imperceptible. Expensive detail work is skipped at lower zoom stops.
 LOD_DETAIL_ZOOM_THRESHOLD: float = 0.8
 
+# Side length, in tiles, of the world-space chunks that cache the unlit
+# terrain layer. Scrolling copies cells out of built chunks; exploring or
+# editing tiles only rebuilds the chunks that changed.
+MAP_TERRAIN_CHUNK_SIZE: int = 32
+
 # Safety floor for dynamic console dimensions after DPI + zoom are applied.
 # If a requested TILE_ZOOM would shrink below this, the renderer reduces the
 # effective zoom until these minimums are met.
@@ -155,6 +160,9 @@ AUDIO_ENABLED = True
 # Debug flags for rendering troubleshooting
 DEBUG_DISABLE_BACKGROUND_CACHE = False  # Re-render background every frame
 DEBUG_DISABLE_LIGHT_OVERLAY = False  # Show only dark/unlit background
+# Recompute the content-hashing background cache key every frame and raise
+# if the revision-based key would have reused a stale buffer.
+DEBUG_VERIFY_RENDER_CACHE_KEYS = False
 
 # =============================================================================
 # BACKEND CONFIGURATION
@@ -467,6 +475,25 @@ TILESET_PATH = ASSETS_BASE_DIR / "tilesets" / "Taffer_20x20.png"
 TILESET_COLUMNS = 16
 TILESET_ROWS = 16
 
+# Generated actor sprites (trees, boulders, characters, critters) persist here
+# between runs, so reloading a previously seen world skips sprite generation.
+# Disabled under pytest so tests never read or write the user's cache.
+SPRITE_CACHE_ENABLED: bool = not IS_TEST_ENVIRONMENT
+SPRITE_CACHE_PATH = Path.home() / ".cache" / "brileta" / "sprite_cache.npz"
+
+# GPU budget for the actor sprite atlas: this many fixed-size square pages.
+# A world whose sprites fit the budget keeps them all resident; a bigger one
+# streams sprites in for actors near the camera and evicts the least recently
+# seen page when full, so atlas memory is bounded whatever the world size.
+SPRITE_ATLAS_PAGE_SIZE = 1024
+SPRITE_ATLAS_PAGE_COUNT = 16
+# Tiles beyond the visible viewport whose actors are kept resident, so sprites
+# are ready before they scroll into view.
+SPRITE_RESIDENCY_MARGIN_TILES = 16
+# Actors whose sprites are generated and uploaded per frame while streaming.
+# The rest keep their glyph until a later frame gets to them.
+SPRITE_STREAM_ACTORS_PER_FRAME = 24
+
 # =============================================================================
 # PROBABILITY DESCRIPTORS
 # =============================================================================
@@ -13,6 +13,7 @@ if TYPE_CHECKING:
     from brileta.game.action_plan import ActionPlan
     from brileta.game.actions.discovery import CombatIntentCache
     from brileta.game.items.item_core import Item
+    from brileta.game.session_recording import SessionRecorder
     from brileta.view.render.effects.atmospheric import AtmosphericLayerSystem
 
 from . import colors, config
@@ -88,6 +89,8 @@ _CONTROLLER_METRICS: list[MetricSpec] = [
     MetricSpec("time.logic.animation_ms", "Animation updates", 500),
     MetricSpec("time.logic.action_ms", "Action processing", 500),
     MetricSpec("time.logic.actor_snapshot_ms", "Actor position snapshot loop", 500),
+    MetricSpec("time.logic.lighting_ms", "Global and dynamic lighting updates", 500),
+    MetricSpec("time.logic.sound_ms", "Sound system and rain ambience", 500),
     MetricSpec("time.fov_ms", "FOV compute + explored merge", 500),
     # Sprite atlas generation (one-shot at map load, window=1 to keep the value).
     MetricSpec("time.sprites.generate_ms", "Sprite generation (CPU)", 1),
@@ -216,6 +219,9 @@ class Controller:
         self._atmospheric_cloud_baseline: float | None = None
         # Ambient rain audio recomputes only when spacing or player region changes.
         self._rain_last_ambient_mix_key: tuple[tuple[float, float], int] | None = None
+        # Optional session recorder (see brileta.game.session_recording); set
+        # before the first new_world() so the hooks can test it unconditionally.
+        self.session_recorder: SessionRecorder | None = None
 
         # Owns the live actor sprite atlas across the world's lifetime and
         # assigns UVs both at world gen and to late-spawned actors.
@@ -325,6 +331,8 @@ class Controller:
         # Set the global random state
         random.seed(seed)
         self._current_seed = seed
+        if self.session_recorder is not None:
+            self.session_recorder.record_new_world(seed)
 
         # Create new game world and set up lighting
         self.gw = GameWorld(
@@ -1078,8 +1086,7 @@ class Controller:
             )
 
             # If a tile is "visible" it should be added to "explored"
-            self.gw.game_map.explored |= self.gw.game_map.visible
-            self.gw.game_map.exploration_revision += 1
+            self.gw.game_map.mark_explored(self.gw.game_map.visible)
 
         # Auto-toggle torch based on ambient lighting (disable in sunlit outdoor areas)
         self._update_player_torch()
@@ -1175,7 +1182,7 @@ class Controller:
                     self._execute_player_action_immediately(autopilot_action)
                 else:
                     # Can't afford action - time passes but no movement
-                    self.turn_manager.on_player_action()
+                    self._pass_player_turn()
 
     def update_logic_step(self) -> None:
         """
@@ -1196,21 +1203,23 @@ class Controller:
                 # Ensures consistent animation timing regardless of FPS
                 self.animation_manager.update(self.fixed_timestep)
 
-            self._update_global_lighting(DeltaTime(self.fixed_timestep))
-
-            if self.gw.lighting_system is not None:
-                self.gw.lighting_system.update(self.fixed_timestep)
-
-            # Update sound system with player position
-            if self.gw.player:
-                self.sound_system.update(
-                    self.gw.player.x,
-                    self.gw.player.y,
-                    self.gw.actor_spatial_index,
-                    DeltaTime(self.fixed_timestep),
-                    game_map=self.gw.game_map,
-                )
-            self._update_rain_ambient_audio()
+            with record_time_live_variable("time.logic.lighting_ms"):
+                self._update_global_lighting(DeltaTime(self.fixed_timestep))
+
+                if self.gw.lighting_system is not None:
+                    self.gw.lighting_system.update(self.fixed_timestep)
+
+            with record_time_live_variable("time.logic.sound_ms"):
+                # Update sound system with player position
+                if self.gw.player:
+                    self.sound_system.update(
+                        self.gw.player.x,
+                        self.gw.player.y,
+                        self.gw.actor_spatial_index,
+                        DeltaTime(self.fixed_timestep),
+                        game_map=self.gw.game_map,
+                    )
+                self._update_rain_ambient_audio()
 
             # Update presentation manager (dispatches staggered combat feedback)
             self.presentation_manager.update(self.fixed_timestep)
@@ -1239,9 +1248,16 @@ class Controller:
         This is the core of the RAF system - player actions are never queued
         or delayed. They are processed instantly when detected.
 
+        Every player action passes through here (queued UI actions, held-key
+        movement, and autopilot steps of an active plan), so this is where an
+        attached session recorder captures player input.
+
         Args:
             action: The player's GameIntent to execute immediately
         """
+        if self.session_recorder is not None:
+            self.session_recorder.record_intent(action)
+
         # Handle wind-up actions specially (preserve existing PPIAS behavior)
         if action.animation_type == AnimationType.WIND_UP and action.windup_animation:
             self.animation_manager.add(action.windup_animation)
@@ -1288,6 +1304,12 @@ class Controller:
         # Refresh hovered actor in case actors moved under a stationary cursor
         self.update_hovered_actor()
 
+    def _pass_player_turn(self) -> None:
+        """Let time pass for a player action the player cannot afford yet."""
+        if self.session_recorder is not None:
+            self.session_recorder.record_passed_turn()
+        self.turn_manager.on_player_action()
+
     def update_hovered_actor(self) -> None:
         """Update the hovered actor from the cursor's world position.
 
@@ -0,0 +1,364 @@
+"""Organic edge-transition metadata for terrain tiles.
+
+The glyph shader feathers a tile's background into differing cardinal
+neighbours. Per tile it needs a mask of which neighbours to blend toward
+(``CARDINAL_DIRECTIONS`` bit order) and each neighbour's background colour.
+Both are a pure function of tile IDs, decorated background colours and which
+tiles are drawn, so :class:`~brileta.environment.map.GameMap` precomputes them
+per world tile with the native ``edge_transition_fill`` kernel and patches them
+around changed tiles. Views only gather, dropping bits toward neighbours they
+do not draw.
+
+The numpy functions at the bottom of this module are the readable reference
+the native kernel is tested against.
+"""
+
+from __future__ import annotations
+
+from collections.abc import Iterable
+from typing import NamedTuple
+
+import numpy as np
+
+from brileta.environment import tile_types
+from brileta.environment.tile_types import TileTypeID
+from brileta.types import Direction, WorldTilePos
+from brileta.util._native import edge_transition_fill as _c_edge_transition_fill
+
+# Cardinal boundary directions only (W, N, S, E). Organic edge blending uses
+# corner rounding in the shader, so diagonals are not transported separately.
+CARDINAL_DIRECTIONS: tuple[Direction, ...] = (
+    (-1, 0),
+    (0, -1),
+    (0, 1),
+    (1, 0),
+)
+
+# Architectural surfaces that organic terrain must not feather into.
+HARD_EDGE_TILE_IDS: tuple[int, ...] = (
+    int(TileTypeID.WALL),
+    int(TileTypeID.ROOF_THATCH),
+    int(TileTypeID.ROOF_SHINGLE),
+    int(TileTypeID.ROOF_TIN),
+)
+
+# Per-tile-ID lookup tables for the native kernel, padded to the full uint8
+# range so any tile byte indexes safely.
+_ALL_TILE_IDS = np.arange(len(TileTypeID), dtype=np.uint8)
+_BLEND_LUT = np.zeros(256, dtype=np.float32)
+_BLEND_LUT[: len(_ALL_TILE_IDS)] = tile_types.get_edge_blend_map(_ALL_TILE_IDS)
+_HARD_EDGE_LUT = np.zeros(256, dtype=np.uint8)
+_HARD_EDGE_LUT[list(HARD_EDGE_TILE_IDS)] = 1
+_SELF_DARKEN_LUT = np.zeros(256, dtype=np.uint8)
+_SELF_DARKEN_LUT[: len(_ALL_TILE_IDS)] = tile_types.get_edge_self_darken_map(
+    _ALL_TILE_IDS
+)
+
+
+class EdgeTransitionMaps(NamedTuple):
+    """Per-world-tile edge metadata, computed as if every tile were drawn."""
+
+    bg_rgb: np.ndarray  # (w, h, 3) uint8 decorated background colours
+    neighbor_mask: np.ndarray  # (w, h) uint8
+    neighbor_bg: np.ndarray  # (w, h, 4, 3) uint8
+
+
+def fill_edge_transitions(
+    tile_ids: np.ndarray,
+    bg_rgb: np.ndarray,
+    out_mask: np.ndarray,
+    out_bg: np.ndarray,
+    *,
+    drawn: np.ndarray | None = None,
+    region: tuple[int, int, int, int] | None = None,
+) -> None:
+    """Write edge metadata for the drawn tiles of a grid into the out arrays.
+
+    ``region`` is ``(x1, y1, x2, y2)`` (exclusive, clipped to the grid) and
+    defaults to the whole grid; neighbours are always read from the whole
+    grid, so a patched region matches a full fill. ``drawn`` of None treats
+    every tile as drawn.
+    """
+    width, height = tile_ids.shape
+    x1, y1, x2, y2 = region if region is not None else (0, 0, width, height)
+    _c_edge_transition_fill(
+        tile_ids.astype(np.uint8, copy=False),
+        np.ascontiguousarray(bg_rgb, dtype=np.uint8),
+        drawn,
+        _BLEND_LUT,
+        _HARD_EDGE_LUT,
+        _SELF_DARKEN_LUT,
+        out_mask,
+        out_bg,
+        x1,
+        y1,
+        x2,
+        y2,
+    )
+
+
+def _decorated_bg(
+    tiles: np.ndarray,
+    appearance_map: np.ndarray,
+    decoration_seed: int,
+    world_x: np.ndarray,
+    world_y: np.ndarray,
+) -> np.ndarray:
+    """Return ``(N, 3)`` background colours after per-tile terrain decoration."""
+    app = appearance_map[world_x, world_y]
+    tile_types.apply_terrain_decoration(
+        app["ch"],
+        app["fg"],
+        app["bg"],
+        tiles[world_x, world_y],
+        world_x,
+        world_y,
+        decoration_seed,
+    )
+    return app["bg"]
+
+
+def build_edge_transition_maps(
+    tiles: np.ndarray, appearance_map: np.ndarray, decoration_seed: int
+) -> EdgeTransitionMaps:
+    """Decorate every tile's background and compute its edge metadata."""
+    width, height = tiles.shape
+    world_x, world_y = (
+        axis.ravel() for axis in np.indices((width, height), dtype=np.int32)
+    )
+    bg_rgb = np.ascontiguousarray(
+        _decorated_bg(tiles, appearance_map, decoration_seed, world_x, world_y)
+    ).reshape(width, height, 3)
+    maps = EdgeTransitionMaps(
+        bg_rgb=bg_rgb,
+        neighbor_mask=np.zeros((width, height), dtype=np.uint8),
+        neighbor_bg=np.zeros((width, height, len(CARDINAL_DIRECTIONS), 3), np.uint8),
+    )
+    fill_edge_transitions(tiles, bg_rgb, maps.neighbor_mask, maps.neighbor_bg)
+    return maps
+
+
+def patch_edge_transition_maps(
+    maps: EdgeTransitionMaps,
+    tiles: np.ndarray,
+    appearance_map: np.ndarray,
+    decoration_seed: int,
+    changed: Iterable[WorldTilePos],
+) -> None:
+    """Refresh ``maps`` in place around tiles whose type changed.
+
+    A tile's metadata depends on itself and its cardinal neighbours, so each
+    change re-decorates that tile and refills its 3x3 neighbourhood.
+    """
+    for x, y in changed:
+        maps.bg_rgb[x, y] = _decorated_bg(
+            tiles,
+            appearance_map,
+            decoration_seed,
+            np.array([x], dtype=np.int32),
+            np.array([y], dtype=np.int32),
+        )[0]
+        fill_edge_transitions(
+            tiles,
+            maps.bg_rgb,
+            maps.neighbor_mask,
+            maps.neighbor_bg,
+            region=(x - 1, y - 1, x + 2, y + 2),
+        )
+
+
+def refresh_edge_transition_colors(
+    maps: EdgeTransitionMaps,
+    tiles: np.ndarray,
+    appearance_map: np.ndarray,
+    decoration_seed: int,
+    world_x: np.ndarray,
+    world_y: np.ndarray,
+) -> None:
+    """Refresh ``maps`` in place after the colours (not types) of tiles changed.
+
+    Re-decorates the given tiles in one batch, then refills the metadata of
+    their bounding box plus a one-tile halo so neighbours pick up the colours.
+    """
+    if len(world_x) == 0:
+        return
+    maps.bg_rgb[world_x, world_y] = _decorated_bg(
+        tiles,
+        appearance_map,
+        decoration_seed,
+        world_x.astype(np.int32),
+        world_y.astype(np.int32),
+    )
+    fill_edge_transitions(
+        tiles,
+        maps.bg_rgb,
+        maps.neighbor_mask,
+        maps.neighbor_bg,
+        region=(
+            int(world_x.min()) - 1,
+            int(world_y.min()) - 1,
+            int(world_x.max()) + 2,
+            int(world_y.max()) + 2,
+        ),
+    )
+
+
+def gather_edge_transitions(
+    maps: EdgeTransitionMaps,
+    tiles: np.ndarray,
+    drawn: np.ndarray,
+    world_x: np.ndarray,
+    world_y: np.ndarray,
+    drawn_origin: tuple[int, int] = (0, 0),
+) -> tuple[np.ndarray, np.ndarray]:
+    """Gather ``(neighbor_mask, neighbor_bg)`` for drawn tiles at world coords.
+
+    ``maps`` assumes every tile is drawn; this drops the bits and colour slots
+    pointing at neighbours ``drawn`` excludes, matching what a fill with that
+    drawn mask would produce. ``drawn`` covers the world rectangle starting at
+    ``drawn_origin``; neighbours outside it count as not drawn.
+    """
+    neighbor_mask = maps.neighbor_mask[world_x, world_y]
+    neighbor_bg = maps.neighbor_bg[world_x, world_y]
+    self_darkened = _SELF_DARKEN_LUT[tiles[world_x, world_y]] > 0
+    width, height = drawn.shape
+    for bit_index, (dx, dy) in enumerate(CARDINAL_DIRECTIONS):
+        nx = world_x + (dx - drawn_origin[0])
+        ny = world_y + (dy - drawn_origin[1])
+        in_bounds = (nx >= 0) & (nx < width) & (ny >= 0) & (ny < height)
+        hidden = ~in_bounds
+        hidden[in_bounds] = ~drawn[nx[in_bounds], ny[in_bounds]]
+        if not np.any(hidden):
+            continue
+        neighbor_mask[hidden] &= np.uint8(0xFF ^ (1 << bit_index))
+        neighbor_bg[hidden & ~self_darkened, bit_index] = 0
+    return neighbor_mask, neighbor_bg
+
+
+# ---------------------------------------------------------------------------
+# Numpy reference implementation
+# ---------------------------------------------------------------------------
+
+
+def _shift_boundary_valid_mask(shape: tuple[int, int], dx: int, dy: int) -> np.ndarray:
+    """Build a boolean mask marking cells whose ``(dx, dy)`` neighbor is in bounds.
+
+    After ``np.roll(arr, shift=(-dx, -dy), axis=(0, 1))``, the rolled array
+    wraps around at the edges.  This mask is ``False`` for cells whose shifted
+    neighbor originated from the opposite edge (i.e. is not a true neighbor).
+    """
+    mask = np.ones(shape, dtype=np.bool_)
+    if dx < 0:
+        mask[:-dx, :] = False
+    elif dx > 0:
+        mask[-dx:, :] = False
+    if dy < 0:
+        mask[:, :-dy] = False
+    elif dy > 0:
+        mask[:, -dy:] = False
+    return mask
+
+
+def _compute_tile_edge_transition_metadata(
+    tile_id_window: np.ndarray,
+    edge_blend_window: np.ndarray,
+    drawn_mask_window: np.ndarray,
+    bg_rgb_window: np.ndarray,
+) -> tuple[np.ndarray, np.ndarray]:
+    """Compute neighbor masks/colors for organic tile edge transitions.
+
+    The inputs are buffer-aligned windows in glyph-buffer tile coordinates:
+    `tile_id_window[x, y]`, `edge_blend_window[x, y]`, `drawn_mask_window[x, y]`,
+    and `bg_rgb_window[x, y, rgb]`.
+    The returned mask uses `CARDINAL_DIRECTIONS` bit ordering.
+    """
+    edge_neighbor_mask = np.zeros(tile_id_window.shape, dtype=np.uint8)
+    edge_neighbor_bg = np.zeros(
+        (*tile_id_window.shape, len(CARDINAL_DIRECTIONS), 3), dtype=np.uint8
+    )
+
+    for bit_index, (dx, dy) in enumerate(CARDINAL_DIRECTIONS):
+        shifted_ids = np.roll(tile_id_window, shift=(-dx, -dy), axis=(0, 1))
+        shifted_edge_blend = np.roll(edge_blend_window, shift=(-dx, -dy), axis=(0, 1))
+        shifted_drawn = np.roll(drawn_mask_window, shift=(-dx, -dy), axis=(0, 1))
+        shifted_bg = np.roll(bg_rgb_window, shift=(-dx, -dy), axis=(0, 1))
+
+        valid_neighbor = _shift_boundary_valid_mask(tile_id_window.shape, dx, dy)
+
+        # One-sided ownership prevents both tiles from cutting into each other.
+        # The tile with the higher edge_blend value owns the boundary so organic
+        # tiles feather into rigid ones regardless of enum ID ordering. When the
+        # blend values tie, the lower tile type ID wins for determinism.
+        owns_boundary = (edge_blend_window > shifted_edge_blend) | (
+            (edge_blend_window == shifted_edge_blend) & (tile_id_window < shifted_ids)
+        )
+        different_neighbor_mask = (
+            drawn_mask_window
+            & shifted_drawn
+            & valid_neighbor
+            & (shifted_ids != tile_id_window)
+            & owns_boundary
+        )
+        if not np.any(different_neighbor_mask):
+            continue
+
+        edge_neighbor_mask[different_neighbor_mask] |= np.uint8(1 << bit_index)
+        color_slice = edge_neighbor_bg[:, :, bit_index, :]
+        color_slice[different_neighbor_mask] = shifted_bg[different_neighbor_mask]
+
+    return edge_neighbor_mask, edge_neighbor_bg
+
+
+def _suppress_edge_blend_toward_hard_edges(
+    edge_neighbor_mask: np.ndarray, tile_id_window: np.ndarray
+) -> None:
+    """Clear edge-blend mask bits that point at architectural hard-edge tiles.
+
+    Organic terrain should feather into other natural terrain, but not into
+    building surfaces like walls/roofs. Those boundaries should stay crisp.
+    """
+    if not np.any(edge_neighbor_mask):
+        return
+
+    hard_edge_tiles = np.isin(tile_id_window, HARD_EDGE_TILE_IDS)
+    if not np.any(hard_edge_tiles):
+        return
+    source_is_hard_edge = hard_edge_tiles
+
+    for bit_index, (dx, dy) in enumerate(CARDINAL_DIRECTIONS):
+        shifted_hard_edges = np.roll(hard_edge_tiles, shift=(-dx, -dy), axis=(0, 1))
+
+        valid_neighbor = _shift_boundary_valid_mask(tile_id_window.shape, dx, dy)
+
+        direction_bit = np.uint8(1 << bit_index)
+        mask_points_to_hard_edge = (
+            valid_neighbor
+            & ~source_is_hard_edge
+            & shifted_hard_edges
+            & ((edge_neighbor_mask & direction_bit) != 0)
+        )
+        if not np.any(mask_points_to_hard_edge):
+            continue
+
+        edge_neighbor_mask[mask_points_to_hard_edge] &= np.uint8(0xFF ^ direction_bit)
+
+
+def _override_edge_neighbor_bg_with_self_darken(
+    edge_neighbor_bg: np.ndarray,
+    tile_id_window: np.ndarray,
+    bg_rgb_window: np.ndarray,
+) -> None:
+    """Replace edge blend target colors with a darkened self color when configured."""
+    edge_self_darken = tile_types.get_edge_self_darken_map(tile_id_window)
+    self_darken_mask = edge_self_darken > 0
+    if not np.any(self_darken_mask):
+        return
+
+    # Signed cast so negation produces a proper negative offset.
+    darken_amount = edge_self_darken[self_darken_mask].astype(np.int16)[:, np.newaxis]
+    darkened_bg = np.clip(
+        bg_rgb_window[self_darken_mask].astype(np.int16) - darken_amount, 0, 255
+    ).astype(np.uint8)
+    # Write every cardinal slot so the shader always darkens toward self-color
+    # for these materials, regardless of actual neighbor type.
+    edge_neighbor_bg[self_darken_mask] = darkened_bg[:, np.newaxis, :]
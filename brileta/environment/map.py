@@ -1,12 +1,15 @@
 from __future__ import annotations
 
+from collections.abc import Iterable
 from dataclasses import dataclass, field
 from typing import TYPE_CHECKING
 
 import numpy as np
 
 from brileta import colors
-from brileta.environment import tile_types
+from brileta.environment import edge_transitions, tile_types
+from brileta.environment.edge_transitions import EdgeTransitionMaps
+from brileta.environment.region_graph import RegionGraph, connect_breaches
 from brileta.environment.tile_types import TileTypeID
 from brileta.types import WorldTilePos
 from brileta.util.coordinates import Rect, TileCoord
@@ -16,6 +19,28 @@ if TYPE_CHECKING:
 
     from .generators import GeneratedMapData
 
+# Tile changes remembered for incremental consumers (see tiles_changed_since).
+# Older changes fall off and force those consumers into a full rebuild.
+_TILE_CHANGE_LOG_LIMIT = 256
+
+# Region appearance rewrites remembered for appearance_changed_since(); older
+# rewrites fall off and force those consumers into a full rebuild.
+_APPEARANCE_CHANGE_LOG_LIMIT = 64
+
+# Derived per-tile maps GameMap caches, by TileTypeProperties field, and the
+# attribute holding each. They are built together in one fused pass.
+_TILE_PROPERTY_CACHES: dict[str, str] = {
+    "walkable": "_walkable_map_cache",
+    "transparent": "_transparent_map_cache",
+    "hazard_cost": "_hazard_cost_map_cache",
+    "animation": "_animation_params_cache",
+    "shadow_height": "_shadow_heights_map_cache",
+    "emission": "_emission_map_cache",
+}
+
+# Side of the square tile blocks that each carry an exploration revision.
+EXPLORATION_CHUNK_SIZE = 16
+
 # Per-cell animation state for tiles with dynamic color/glyph effects.
 # Values range from 0-1000 and are used to modulate tile colors via random walk.
 TileAnimationState = np.dtype(
@@ -72,6 +97,46 @@ class MapRegion:
         )
 
 
+@dataclass
+class RegionTileIndex:
+    """Tiles grouped by region in CSR form.
+
+    The tiles of ``region_ids[i]`` are ``(xs[s:e], ys[s:e])`` with
+    ``s, e = offsets[i], offsets[i + 1]``. ``region_ids`` is sorted.
+    """
+
+    region_ids: np.ndarray  # (K,) region ids
+    offsets: np.ndarray  # (K + 1,) intp
+    xs: np.ndarray  # (N,) intp, grouped by region
+    ys: np.ndarray  # (N,) intp
+
+    @classmethod
+    def build(cls, tile_to_region_id: np.ndarray, mask: np.ndarray) -> RegionTileIndex:
+        """Index the tiles under ``mask`` that belong to a region."""
+        xs, ys = np.nonzero(mask & (tile_to_region_id >= 0))
+        owners = tile_to_region_id[xs, ys]
+        order = np.argsort(owners, kind="stable")
+        region_ids, starts = np.unique(owners[order], return_index=True)
+        return cls(
+            region_ids=region_ids,
+            offsets=np.append(starts, len(order)).astype(np.intp),
+            xs=xs[order],
+            ys=ys[order],
+        )
+
+    def counts(self) -> np.ndarray:
+        """Number of indexed tiles per entry of ``region_ids``."""
+        return np.diff(self.offsets)
+
+    def tiles_of(self, region_id: int) -> tuple[np.ndarray, np.ndarray]:
+        """Return ``(xs, ys)`` of one region's indexed tiles (empty if none)."""
+        i = int(np.searchsorted(self.region_ids, region_id))
+        if i == len(self.region_ids) or self.region_ids[i] != region_id:
+            return self.xs[:0], self.ys[:0]
+        start, end = self.offsets[i], self.offsets[i + 1]
+        return self.xs[start:end], self.ys[start:end]
+
+
 class GameMap:
     """The game map."""
 
@@ -82,6 +147,7 @@ class GameMap:
         self.height: TileCoord = height
         self.structural_revision: int = 0
         self.exploration_revision: int = 0
+        self.appearance_revision: int = 0
         self.gw: GameWorld | None = None
 
         # Directly use the generated tile map and region data.
@@ -99,41 +165,175 @@ class GameMap:
         self.explored = np.full(
             (width, height), fill_value=False, dtype=bool, order="F"
         )
+        # Bumped per EXPLORATION_CHUNK_SIZE block whenever mark_explored()
+        # reveals a tile in it, so render caches can key a window on a few
+        # integers instead of hashing the explored mask.
+        self.explored_chunk_revisions = np.zeros(
+            (
+                -(-width // EXPLORATION_CHUNK_SIZE),
+                -(-height // EXPLORATION_CHUNK_SIZE),
+            ),
+            dtype=np.int64,
+        )
 
         # Cached property arrays for performance.
         # These are populated on-demand by the respective properties.
         self._walkable_map_cache: np.ndarray | None = None
         self._transparent_map_cache: np.ndarray | None = None
+        self._hazard_cost_map_cache: np.ndarray | None = None
         self._dark_appearance_map_cache: np.ndarray | None = None
         self._light_appearance_map_cache: np.ndarray | None = None
+        # Floor tiles by region, rebuilt per structural revision. Lets a
+        # region's ground colour be rewritten without scanning the whole map.
+        self._region_floor_index: RegionTileIndex | None = None
+        self._region_floor_index_revision: int = -1
+        # (appearance_revision, rect) for each region appearance rewrite. The
+        # log answers appearance_changed_since() for revisions >= the start.
+        self._appearance_change_log: list[tuple[int, Rect]] = []
+        self._appearance_change_log_start: int = 0
         self._animation_params_cache: np.ndarray | None = None
         self._shadow_heights_map_cache: np.ndarray | None = None
+        self._emission_map_cache: np.ndarray | None = None
         self._sun_shadow_eligibility_grid_cache: np.ndarray | None = None
         self._sun_shadow_eligibility_grid_cache_revision: int = -1
         self._sun_shadow_eligibility_grid_cache_region_types: frozenset[str] | None = (
             None
         )
         self._sun_shadow_eligibility_grid_cache_tile_ids: frozenset[int] | None = None
+        # Edge-transition metadata keyed by is_light, with tile changes not yet
+        # patched into each.
+        self._edge_transition_maps_cache: dict[bool, EdgeTransitionMaps] = {}
+        self._edge_transition_pending: dict[bool, list[WorldTilePos]] = {}
+        # (structural_revision, position) for each reported tile change. The
+        # log answers tiles_changed_since() for revisions >= the start.
+        self._tile_change_log: list[tuple[int, WorldTilePos]] = []
+        self._tile_change_log_start: int = 0
+        # Connection states over self.regions, built on first use and synced
+        # from the tile change log.
+        self._region_graph: RegionGraph | None = None
+        # Bumped when invalidate_property_caches() adds region connections.
+        self.region_connections_revision: int = 0
 
         # Per-cell animation state for tiles that animate (color oscillation, flicker)
         self.animation_state = self._init_animation_state()
 
-    def invalidate_property_caches(self) -> None:
-        """Call this whenever `self.tiles` changes to clear cached property maps."""
-        self._walkable_map_cache = None
-        self._transparent_map_cache = None
+    def invalidate_property_caches(
+        self, changed_tiles: Iterable[WorldTilePos] | None = None
+    ) -> None:
+        """Call this whenever `self.tiles` changes to clear cached property maps.
+
+        Pass the changed positions when known so caches that support it
+        (edge transitions, the view's terrain chunks) patch around them
+        instead of rebuilding the whole map. Walkable tiles that now join two
+        unconnected regions (breached walls) are connected here, checking
+        only the changed positions when known and every tile otherwise.
+        """
+        changed = (
+            None
+            if changed_tiles is None
+            else [(int(x), int(y)) for x, y in changed_tiles]
+        )
+        self._refresh_tile_property_caches(changed)
         self._dark_appearance_map_cache = None
         self._light_appearance_map_cache = None
-        self._animation_params_cache = None
-        self._shadow_heights_map_cache = None
         self._invalidate_sun_shadow_eligibility_grid_cache()
         self.structural_revision += 1
+        if connect_breaches(self, changed):
+            self.region_connections_revision += 1
+
+        if changed is None:
+            self._invalidate_edge_transition_maps()
+            self._tile_change_log.clear()
+            self._tile_change_log_start = self.structural_revision
+            return
+
+        for pending in self._edge_transition_pending.values():
+            pending.extend(changed)
+        self._tile_change_log.extend((self.structural_revision, p) for p in changed)
+        overflow = len(self._tile_change_log) - _TILE_CHANGE_LOG_LIMIT
+        if overflow > 0:
+            self._tile_change_log_start = self._tile_change_log[overflow - 1][0]
+            del self._tile_change_log[:overflow]
+
+    def mark_explored(self, mask: np.ndarray | None = None) -> None:
+        """Add ``mask`` (the whole map if None) to ``explored``.
+
+        Always bumps ``exploration_revision``; bumps the chunk revisions of
+        blocks that actually gained explored tiles.
+        """
+        self.exploration_revision += 1
+        newly_explored = ~self.explored if mask is None else mask & ~self.explored
+        new_x, new_y = np.nonzero(newly_explored)
+        if len(new_x) == 0:
+            return
+        self.explored[new_x, new_y] = True
+        self.explored_chunk_revisions[
+            new_x // EXPLORATION_CHUNK_SIZE, new_y // EXPLORATION_CHUNK_SIZE
+        ] += 1
+
+    def explored_window_revision(self, x1: int, y1: int, x2: int, y2: int) -> int:
+        """Revision of the explored state inside a tile window (exclusive end).
+
+        Sums the monotonic revisions of the chunks the window touches, so it
+        changes whenever any tile in the window is newly explored. Only
+        comparable for the same window.
+        """
+        size = EXPLORATION_CHUNK_SIZE
+        return int(
+            self.explored_chunk_revisions[
+                x1 // size : (x2 - 1) // size + 1, y1 // size : (y2 - 1) // size + 1
+            ].sum()
+        )
+
+    def tiles_changed_since(self, revision: int) -> list[WorldTilePos] | None:
+        """Positions changed after structural ``revision``, or None if unknown.
+
+        None means the log no longer reaches back that far (or a change was
+        reported without positions), so the caller must rebuild everything.
+        """
+        if revision < self._tile_change_log_start:
+            return None
+        return [pos for rev, pos in self._tile_change_log if rev > revision]
+
+    def _build_tile_property_caches(self) -> dict[str, np.ndarray]:
+        """Fill every missing derived tile-property map in one fused pass."""
+        missing = [
+            name
+            for name, attr in _TILE_PROPERTY_CACHES.items()
+            if getattr(self, attr) is None
+        ]
+        maps = tile_types.build_tile_property_maps(self.tiles, missing)
+        for name, values in maps.items():
+            setattr(self, _TILE_PROPERTY_CACHES[name], values)
+        return maps
+
+    def _refresh_tile_property_caches(self, changed: list[WorldTilePos] | None) -> None:
+        """Patch the derived tile-property maps around changed tiles.
+
+        The maps are refilled in place over the bounding rect of ``changed``
+        when all of them are built; otherwise (or when the changes are
+        unknown) they are dropped and rebuilt on next use.
+        """
+        maps = {
+            name: getattr(self, attr) for name, attr in _TILE_PROPERTY_CACHES.items()
+        }
+        if changed is None or any(values is None for values in maps.values()):
+            for attr in _TILE_PROPERTY_CACHES.values():
+                setattr(self, attr, None)
+            return
+        if not changed:
+            return
+        xs = [x for x, _ in changed]
+        ys = [y for _, y in changed]
+        tile_types.fill_tile_property_maps(
+            self.tiles, maps, (min(xs), min(ys), max(xs) + 1, max(ys) + 1)
+        )
 
     @property
     def walkable(self) -> np.ndarray:
         """Boolean array of shape (width, height) where True means tile is walkable."""
         if self._walkable_map_cache is None:
-            self._walkable_map_cache = tile_types.get_walkable_map(self.tiles)
+            self._walkable_map_cache = self._build_tile_property_caches()["walkable"]
         return self._walkable_map_cache
 
     @property
@@ -141,9 +341,20 @@ class GameMap:
         """Boolean array of shape (width, height) where True means tile is transparent
         (for FOV)."""
         if self._transparent_map_cache is None:
-            self._transparent_map_cache = tile_types.get_transparent_map(self.tiles)
+            self._transparent_map_cache = self._build_tile_property_caches()[
+                "transparent"
+            ]
         return self._transparent_map_cache
 
+    @property
+    def hazard_costs(self) -> np.ndarray:
+        """int16 pathfinding cost per tile: 1 for safe tiles, higher for hazards."""
+        if self._hazard_cost_map_cache is None:
+            self._hazard_cost_map_cache = self._build_tile_property_caches()[
+                "hazard_cost"
+            ]
+        return self._hazard_cost_map_cache
+
     @property
     def dark_appearance_map(self) -> np.ndarray:
         """A map of 'dark' TileTypeAppearance structs derived from self.tiles."""
@@ -162,11 +373,33 @@ class GameMap:
             )
         return self._light_appearance_map_cache
 
+    @property
+    def region_floor_index(self) -> RegionTileIndex:
+        """Floor tiles grouped by region, cached per structural revision."""
+        if (
+            self._region_floor_index is None
+            or self._region_floor_index_revision != self.structural_revision
+        ):
+            self._region_floor_index = RegionTileIndex.build(
+                self.tile_to_region_id, self.tiles == TileTypeID.FLOOR
+            )
+            self._region_floor_index_revision = self.structural_revision
+        return self._region_floor_index
+
+    @property
+    def region_graph(self) -> RegionGraph:
+        """Region connectivity with per-connection state, synced to the tiles."""
+        if self._region_graph is None:
+            self._region_graph = RegionGraph(self)
+        else:
+            self._region_graph.sync()
+        return self._region_graph
+
     def _get_region_aware_appearance_map(self, is_light: bool) -> np.ndarray:
         """Get appearance map with region-aware background colors for certain tiles.
 
-        Uses vectorized numpy operations: iterates over regions (small dict)
-        instead of tiles (large grid).
+        Floor tiles are looked up through ``region_floor_index``, so the cost
+        is one gather per floor tile rather than one full-map mask per region.
         """
         # Start with the base appearance map from tile types
         if is_light:
@@ -181,21 +414,86 @@ class GameMap:
         # Floor tiles inherit ground color from their region.
         # Doors use standard tile colors to match surrounding walls.
         if self.regions:
-            # Mask for tiles that need regional coloring
-            special_mask = self.tiles == TileTypeID.FLOOR
+            index = self.region_floor_index
+            # One ground colour per indexed region; ids without a MapRegion
+            # keep their tile colour.
+            region_colors = np.zeros((len(index.region_ids), 3), dtype=np.uint8)
+            has_region = np.zeros(len(index.region_ids), dtype=bool)
+            for i, region_id in enumerate(index.region_ids.tolist()):
+                region = self.regions.get(region_id)
+                if region is not None:
+                    region_colors[i] = self._get_region_ground_color(region, is_light)
+                    has_region[i] = True
+
+            owner = np.repeat(np.arange(len(index.region_ids)), index.counts())
+            keep = has_region[owner]
+            appearance_map["bg"][index.xs[keep], index.ys[keep]] = region_colors[
+                owner[keep]
+            ]
+
+        return appearance_map
 
-            # Apply colors per-region (iterate small dict, not large grid)
-            for region_id, region in self.regions.items():
-                # Combine tile type mask with region membership mask
-                region_mask = (self.tile_to_region_id == region_id) & special_mask
-                if not np.any(region_mask):
-                    continue
+    def refresh_region_appearance(self, region_id: int) -> Rect | None:
+        """Rewrite one region's ground colour after its properties changed.
 
-                # Compute color once per region, apply to all matching tiles
-                ground_bg_color = self._get_region_ground_color(region, is_light)
-                appearance_map["bg"][region_mask] = ground_bg_color
+        Patches only that region's floor tiles in the cached dark and light
+        appearance maps (and the edge metadata derived from them), instead of
+        dropping both maps like ``invalidate_appearance_caches()``. Returns
+        the bounding rect of the rewritten tiles, also reported through
+        ``appearance_changed_since()``, or None when no colour changed.
+        """
+        # Sun shadow eligibility reads sky exposure directly.
+        self._invalidate_sun_shadow_eligibility_grid_cache()
+        region = self.regions.get(region_id)
+        if region is None:
+            return None
+        xs, ys = self.region_floor_index.tiles_of(region_id)
+        if len(xs) == 0:
+            return None
 
-        return appearance_map
+        changed = False
+        for is_light, appearance_map in (
+            (False, self._dark_appearance_map_cache),
+            (True, self._light_appearance_map_cache),
+        ):
+            if appearance_map is None:
+                continue
+            color = np.array(self._get_region_ground_color(region, is_light))
+            # Floor bg is undecorated here, so one tile stands for the region.
+            if np.array_equal(appearance_map["bg"][xs[0], ys[0]], color):
+                continue
+            changed = True
+            appearance_map["bg"][xs, ys] = color
+            maps = self._edge_transition_maps_cache.get(is_light)
+            if maps is not None:
+                edge_transitions.refresh_edge_transition_colors(
+                    maps, self.tiles, appearance_map, self.decoration_seed, xs, ys
+                )
+        if not changed:
+            return None
+
+        rect = Rect.from_bounds(
+            int(xs.min()), int(ys.min()), int(xs.max()) + 1, int(ys.max()) + 1
+        )
+        self.appearance_revision += 1
+        self._appearance_change_log.append((self.appearance_revision, rect))
+        overflow = len(self._appearance_change_log) - _APPEARANCE_CHANGE_LOG_LIMIT
+        if overflow > 0:
+            self._appearance_change_log_start = self._appearance_change_log[
+                overflow - 1
+            ][0]
+            del self._appearance_change_log[:overflow]
+        return rect
+
+    def appearance_changed_since(self, revision: int) -> list[Rect] | None:
+        """Rects rewritten after appearance ``revision``, or None if unknown.
+
+        None means the log no longer reaches back that far (or the appearance
+        maps were dropped wholesale), so the caller must rebuild everything.
+        """
+        if revision < self._appearance_change_log_start:
+            return None
+        return [rect for rev, rect in self._appearance_change_log if rev > revision]
 
     def _get_region_ground_color(
         self, region: MapRegion, is_light: bool
@@ -228,6 +526,42 @@ class GameMap:
         self._dark_appearance_map_cache = None
         self._light_appearance_map_cache = None
         self._invalidate_sun_shadow_eligibility_grid_cache()
+        self._invalidate_edge_transition_maps()
+        self.appearance_revision += 1
+        self._appearance_change_log.clear()
+        self._appearance_change_log_start = self.appearance_revision
+
+    def get_edge_transition_maps(self, is_light: bool = False) -> EdgeTransitionMaps:
+        """Per-tile organic edge metadata from the decorated dark/light colours.
+
+        Computed for the whole map on first use as if every tile were drawn,
+        then patched around positions reported to invalidate_property_caches().
+        Views gather from it with
+        :func:`~brileta.environment.edge_transitions.gather_edge_transitions`.
+        """
+        appearance_map = (
+            self.light_appearance_map if is_light else self.dark_appearance_map
+        )
+        maps = self._edge_transition_maps_cache.get(is_light)
+        if maps is None:
+            maps = edge_transitions.build_edge_transition_maps(
+                self.tiles, appearance_map, self.decoration_seed
+            )
+            self._edge_transition_maps_cache[is_light] = maps
+            self._edge_transition_pending[is_light] = []
+            return maps
+
+        pending = self._edge_transition_pending[is_light]
+        if pending:
+            edge_transitions.patch_edge_transition_maps(
+                maps, self.tiles, appearance_map, self.decoration_seed, pending
+            )
+            pending.clear()
+        return maps
+
+    def _invalidate_edge_transition_maps(self) -> None:
+        self._edge_transition_maps_cache.clear()
+        self._edge_transition_pending.clear()
 
     def _invalidate_sun_shadow_eligibility_grid_cache(self) -> None:
         """Clear the cached per-tile eligibility mask for sun-projected shadows."""
@@ -295,7 +629,9 @@ class GameMap:
     def animation_params(self) -> np.ndarray:
         """A map of TileAnimationParams structs derived from self.tiles."""
         if self._animation_params_cache is None:
-            self._animation_params_cache = tile_types.get_animation_map(self.tiles)
+            self._animation_params_cache = self._build_tile_property_caches()[
+                "animation"
+            ]
         return self._animation_params_cache
 
     @property
@@ -308,11 +644,21 @@ class GameMap:
         Used by the lighting system for height-aware shadow casting.
         """
         if self._shadow_heights_map_cache is None:
-            self._shadow_heights_map_cache = tile_types.get_shadow_height_map(
-                self.tiles
-            )
+            self._shadow_heights_map_cache = self._build_tile_property_caches()[
+                "shadow_height"
+            ]
         return self._shadow_heights_map_cache
 
+    @property
+    def emission_map(self) -> np.ndarray:
+        """A map of TileEmissionParams structs derived from self.tiles.
+
+        Read every frame by the GPU lighting pass for light-emitting tiles.
+        """
+        if self._emission_map_cache is None:
+            self._emission_map_cache = self._build_tile_property_caches()["emission"]
+        return self._emission_map_cache
+
     def _init_animation_state(self) -> np.ndarray:
         """Initialize animation state array with random values.
 
@@ -0,0 +1,275 @@
+"""Region connectivity kept in step with tile edits.
+
+``GameMap.regions`` and ``MapRegion.connections`` describe which regions
+touch and through which tile. :class:`RegionGraph` adds the state of each
+connection (open, closed door, blocked) and keeps it current as tiles
+change, so region-derived caches can react to the connections that
+actually changed instead of to every ``structural_revision`` bump.
+
+The graph is published in CSR form for native consumers: region ``u``'s
+connections are ``neighbors[offsets[u]:offsets[u + 1]]``, with the
+connection tile and state of each edge in parallel arrays. Node ids are
+region ids, so ids without a region have no edges.
+
+Revisions are values of the graph's own ``revision`` counter:
+
+- ``edge_revisions[e]``: when edge ``e``'s state last changed or it appeared
+- ``region_revisions[r]``: when any edge into or out of region ``r`` changed
+- ``topology_revision``: when the edge list itself last changed, which
+  invalidates edge indices held by consumers
+"""
+
+from __future__ import annotations
+
+import itertools
+from collections.abc import Iterable
+from enum import IntEnum
+from typing import TYPE_CHECKING
+
+import numpy as np
+
+from brileta.environment.tile_types import TileTypeID
+from brileta.types import WorldTilePos
+
+if TYPE_CHECKING:
+    from .map import GameMap
+
+_NEIGHBOR_OFFSETS = ((0, 0), (-1, 0), (1, 0), (0, -1), (0, 1))
+
+
+def connect_breaches(
+    game_map: GameMap, positions: Iterable[WorldTilePos] | None = None
+) -> bool:
+    """Connect regions joined by a walkable tile, e.g. a breached wall.
+
+    A walkable tile whose own region and 4-neighbour regions include two
+    regions without a connection becomes their connection tile, recorded in
+    both regions' ``MapRegion.connections``. Checks ``positions``, or every
+    tile when None. Returns True if any connection was added.
+    """
+    gm = game_map
+    if not gm.regions:
+        return False
+    if positions is None:
+        xs, ys = np.nonzero(gm.walkable)
+    else:
+        coords = np.array(list(positions), dtype=np.intp).reshape(-1, 2)
+        xs, ys = coords[:, 0], coords[:, 1]
+        inside = (xs >= 0) & (xs < gm.width) & (ys >= 0) & (ys < gm.height)
+        xs, ys = xs[inside], ys[inside]
+        walkable = gm.walkable[xs, ys]
+        xs, ys = xs[walkable], ys[walkable]
+    if len(xs) == 0:
+        return False
+
+    # Region id at each tile and its neighbours; -1 off-map or unknown.
+    known = np.zeros(max(gm.regions) + 1, dtype=np.bool_)
+    known[list(gm.regions)] = True
+    columns = []
+    for dx, dy in _NEIGHBOR_OFFSETS:
+        nx, ny = xs + dx, ys + dy
+        on_map = (nx >= 0) & (nx < gm.width) & (ny >= 0) & (ny < gm.height)
+        ids = np.full(len(xs), -1, dtype=np.int64)
+        ids[on_map] = gm.tile_to_region_id[nx[on_map], ny[on_map]]
+        in_range = (ids >= 0) & (ids < len(known))
+        ids[~in_range] = -1
+        ids[in_range] = np.where(known[ids[in_range]], ids[in_range], -1)
+        columns.append(ids)
+
+    # Every (low, high) region pair meeting at a tile, with that tile.
+    pairs: list[np.ndarray] = []
+    for i, j in itertools.combinations(range(len(columns)), 2):
+        a, b = columns[i], columns[j]
+        hit = np.flatnonzero((a >= 0) & (b >= 0) & (a != b))
+        low, high = np.minimum(a[hit], b[hit]), np.maximum(a[hit], b[hit])
+        pairs.append(np.stack([low, high, xs[hit], ys[hit]], axis=1))
+    candidates = np.concatenate(pairs)
+    _, first = np.unique(candidates[:, :2], axis=0, return_index=True)
+
+    added = False
+    for low, high, x, y in candidates[np.sort(first)].tolist():
+        if high not in gm.regions[low].connections:
+            gm.regions[low].connections[high] = (x, y)
+            gm.regions[high].connections[low] = (x, y)
+            added = True
+    return added
+
+
+class ConnectionState(IntEnum):
+    """What a connection tile currently lets through."""
+
+    OPEN = 0  # open door, archway, or a breached wall
+    CLOSED = 1  # closed door
+    BLOCKED = 2  # impassable, e.g. a wall built over the doorway
+
+
+class RegionGraph:
+    """Per-connection state and revisions for a map's region graph.
+
+    Obtain it from ``GameMap.region_graph``, which syncs it with pending
+    tile changes first; syncing only reads the map. Door toggles reported
+    through ``invalidate_property_caches(changed_tiles=...)`` touch only the
+    edges at those tiles. Breaches are connected by
+    ``invalidate_property_caches`` itself (see :func:`connect_breaches`),
+    which bumps ``GameMap.region_connections_revision`` so the next sync
+    rebuilds the edge list. Unreported changes rescan every connection but
+    still bump only the edges whose state differs.
+    """
+
+    def __init__(self, game_map: GameMap) -> None:
+        self._game_map = game_map
+        self.revision = 0
+        self.topology_revision = 0
+        self.offsets = np.zeros(1, dtype=np.int32)
+        self.neighbors = np.zeros(0, dtype=np.int32)
+        self.sources = np.zeros(0, dtype=np.int32)
+        self.door_xs = np.zeros(0, dtype=np.intp)
+        self.door_ys = np.zeros(0, dtype=np.intp)
+        self.states = np.zeros(0, dtype=np.uint8)
+        self.edge_revisions = np.zeros(0, dtype=np.int64)
+        self.region_revisions = np.zeros(0, dtype=np.int64)
+        # (source, neighbor, door x, door y) per edge, in CSR order.
+        self._edge_keys: list[tuple[int, int, int, int]] = []
+        self._edges_at: dict[WorldTilePos, list[int]] = {}
+        self._regions: dict | None = None
+        self._region_count = -1
+        self._connections_revision = -1
+        self._map_revision = -1
+        self._rebuild()
+
+    @property
+    def node_count(self) -> int:
+        """Number of CSR rows (one past the largest region id)."""
+        return len(self.offsets) - 1
+
+    def edge_index(self, source: int, neighbor: int) -> int | None:
+        """CSR index of the connection from ``source`` to ``neighbor``."""
+        if not 0 <= source < self.node_count:
+            return None
+        start, end = int(self.offsets[source]), int(self.offsets[source + 1])
+        hits = np.flatnonzero(self.neighbors[start:end] == neighbor)
+        return start + int(hits[0]) if len(hits) else None
+
+    def connection_state(self, source: int, neighbor: int) -> ConnectionState | None:
+        """State of the connection from ``source`` to ``neighbor``, if any."""
+        edge = self.edge_index(source, neighbor)
+        return None if edge is None else ConnectionState(int(self.states[edge]))
+
+    def edges_at(self, pos: WorldTilePos) -> list[int]:
+        """CSR indices of the connections through tile ``pos``."""
+        return self._edges_at.get(pos, [])
+
+    def sync(self) -> None:
+        """Apply tile changes made since the last sync."""
+        gm = self._game_map
+        if (
+            gm.regions is not self._regions
+            or len(gm.regions) != self._region_count
+            or gm.region_connections_revision != self._connections_revision
+        ):
+            self._rebuild()
+            return
+        if gm.structural_revision == self._map_revision:
+            return
+        changed = gm.tiles_changed_since(self._map_revision)
+        self._map_revision = gm.structural_revision
+        if changed is None:
+            self._rebuild()
+            return
+
+        touched = [e for pos in set(changed) for e in self._edges_at.get(pos, ())]
+        if touched:
+            edges = np.array(touched, dtype=np.intp)
+            states = self._classify(self.door_xs[edges], self.door_ys[edges])
+            moved = states != self.states[edges]
+            self._bump(edges[moved], states[moved])
+
+    def _classify(self, xs: np.ndarray, ys: np.ndarray) -> np.ndarray:
+        """Connection state of each tile in ``(xs, ys)``."""
+        gm = self._game_map
+        states = np.where(
+            gm.transparent[xs, ys], ConnectionState.OPEN, ConnectionState.BLOCKED
+        ).astype(np.uint8)
+        states[gm.tiles[xs, ys] == TileTypeID.DOOR_CLOSED] = ConnectionState.CLOSED
+        return states
+
+    def _bump(self, edges: np.ndarray, states: np.ndarray) -> None:
+        """Record new states for ``edges`` under a fresh revision."""
+        if len(edges) == 0:
+            return
+        self.revision += 1
+        self.states[edges] = states
+        self.edge_revisions[edges] = self.revision
+        self.region_revisions[self.sources[edges]] = self.revision
+        self.region_revisions[self.neighbors[edges]] = self.revision
+
+    def _rebuild(self) -> None:
+        """Rebuild the edge list, keeping revisions of unchanged edges."""
+        gm = self._game_map
+        regions = gm.regions
+        keys = [
+            (source, neighbor, int(pos[0]), int(pos[1]))
+            for source in sorted(regions)
+            for neighbor, pos in regions[source].connections.items()
+            if neighbor in regions
+        ]
+        self._regions = regions
+        self._region_count = len(regions)
+        self._connections_revision = gm.region_connections_revision
+        self._map_revision = gm.structural_revision
+
+        if keys == self._edge_keys:
+            # Same topology: only edge states can have moved.
+            states = self._classify(self.door_xs, self.door_ys)
+            moved = np.flatnonzero(states != self.states)
+            self._bump(moved, states[moved])
+            return
+
+        key_array = np.array(keys, dtype=np.intp).reshape(-1, 4)
+        sources = key_array[:, 0].astype(np.int32)
+        door_xs = np.ascontiguousarray(key_array[:, 2])
+        door_ys = np.ascontiguousarray(key_array[:, 3])
+        states = self._classify(door_xs, door_ys)
+        node_count = max(regions, default=-1) + 1
+        offsets = np.zeros(node_count + 1, dtype=np.int32)
+        np.cumsum(np.bincount(sources, minlength=node_count), out=offsets[1:])
+
+        # Edges that survive with the same state keep their revision; the
+        # rest, and regions they touch, move to the new revision.
+        self.revision += 1
+        self.topology_revision = self.revision
+        old = {
+            key: (int(state), int(rev))
+            for key, state, rev in zip(
+                self._edge_keys, self.states, self.edge_revisions, strict=True
+            )
+        }
+        edge_revisions = np.full(len(keys), self.revision, dtype=np.int64)
+        for e, key in enumerate(keys):
+            previous = old.get(key)
+            if previous is not None and previous[0] == states[e]:
+                edge_revisions[e] = previous[1]
+        region_revisions = np.full(node_count, self.revision, dtype=np.int64)
+        kept = min(node_count, len(self.region_revisions))
+        region_revisions[:kept] = self.region_revisions[:kept]
+        fresh = edge_revisions == self.revision
+        region_revisions[sources[fresh]] = self.revision
+        region_revisions[key_array[fresh, 1]] = self.revision
+        dropped = set(self._edge_keys) - set(keys)
+        for source, neighbor, _, _ in dropped:
+            for region_id in (source, neighbor):
+                if region_id < node_count:
+                    region_revisions[region_id] = self.revision
+
+        self._edge_keys = keys
+        self.offsets = offsets
+        self.neighbors = key_array[:, 1].astype(np.int32)
+        self.sources = sources
+        self.door_xs = door_xs
+        self.door_ys = door_ys
+        self.states = states
+        self.edge_revisions = edge_revisions
+        self.region_revisions = region_revisions
+        self._edges_at = {}
+        for e, (_, _, x, y) in enumerate(keys):
+            self._edges_at.setdefault((x, y), []).append(e)
@@ -12,6 +12,7 @@ This module defines:
   systems like FOV calculation and rendering.
 """
 
+from collections.abc import Iterable
 from enum import IntEnum, auto
 from typing import NamedTuple
 
@@ -19,8 +20,9 @@ import numpy as np
 
 from brileta import colors
 from brileta.game.enums import ImpactMaterial
+from brileta.util._native import terrain_decoration as _c_terrain_decoration
+from brileta.util._native import tile_property_fill as _c_tile_property_fill
 from brileta.util.dice import Dice
-from brileta.util.rng import derive_spatial_seed_array
 
 # --- Pathfinding Cost Constants ---
 # Used by pathfinding to make AI avoid hazardous tiles.
@@ -960,6 +962,29 @@ TERRAIN_GLYPH_POOLS: dict[int, TerrainGlyphPool] = {
 }
 
 
+def _build_terrain_pool_table() -> tuple[np.ndarray, np.ndarray]:
+    """Flatten TERRAIN_GLYPH_POOLS into the native decoration kernel's tables.
+
+    Returns ``(table, glyphs)``: table is (len(TileTypeID), 4) int32 rows of
+    (glyph_start, glyph_count, bg_jitter, fg_jitter) indexed by tile type id,
+    with glyph_count 0 for types without a pool; glyphs holds every pool's
+    codes back to back.
+    """
+    table = np.zeros((len(TileTypeID), 4), dtype=np.int32)
+    glyph_runs: list[np.ndarray] = []
+    start = 0
+    for tid, pool in TERRAIN_GLYPH_POOLS.items():
+        count = len(pool.glyph_codes)
+        table[tid] = (start, count, pool.bg_jitter, pool.fg_jitter)
+        glyph_runs.append(pool.glyph_codes)
+        start += count
+    glyphs = np.concatenate(glyph_runs) if glyph_runs else np.zeros(0, np.int32)
+    return table, np.ascontiguousarray(glyphs, dtype=np.int32)
+
+
+_TERRAIN_POOL_TABLE, _TERRAIN_POOL_GLYPHS = _build_terrain_pool_table()
+
+
 def _decoration_property_array(
     field: str,
     default: float,
@@ -1030,41 +1055,112 @@ def apply_terrain_decoration(
         world_y: World y coordinates. Shape: (N,).
         decoration_seed: Per-map seed for deterministic decoration.
     """
-    # Spatial hash: deterministic per-tile value from world position and seed.
-    h = derive_spatial_seed_array(world_x, world_y, map_seed=decoration_seed)
-
-    for tid, glyph_pool in TERRAIN_GLYPH_POOLS.items():
-        mask = tile_ids == tid
-        if not np.any(mask):
-            continue
-
-        tile_hash = h[mask]
-
-        # Select glyph from pool using hash (low bits).
-        codes = glyph_pool.glyph_codes
-        chars[mask] = codes[np.abs(tile_hash % len(codes)).astype(np.intp)]
-
-        # BG brightness jitter: same offset to all RGB channels (shifts
-        # lightness without shifting hue). Uses hash bits 8-15.
-        bg_jitter_range = 2 * glyph_pool.bg_jitter + 1
-        bg_brightness = (tile_hash >> 8) % bg_jitter_range - glyph_pool.bg_jitter
-        bg_offset = np.column_stack([bg_brightness, bg_brightness, bg_brightness])
-
-        bg_rgb[mask] = np.clip(
-            bg_rgb[mask].astype(np.int16) + bg_offset, 0, 255
-        ).astype(np.uint8)
-
-        # FG jitter: when fg_jitter > 0, fg gets its own independent offset
-        # from hash bits 16-23. This creates bidirectional contrast - some
-        # glyphs lighter than bg, some darker. When 0, fg is locked to the
-        # same offset as bg (preserving the base fg-bg gap).
-        if glyph_pool.fg_jitter > 0:
-            fg_jitter_range = 2 * glyph_pool.fg_jitter + 1
-            fg_brightness = (tile_hash >> 16) % fg_jitter_range - glyph_pool.fg_jitter
-            fg_offset = np.column_stack([fg_brightness, fg_brightness, fg_brightness])
-        else:
-            fg_offset = bg_offset
-
-        fg_rgb[mask] = np.clip(
-            fg_rgb[mask].astype(np.int16) + fg_offset, 0, 255
-        ).astype(np.uint8)
+    # One native pass: each tile hashes its position inline (the
+    # derive_spatial_seed_array formula), picks a glyph from its type's pool
+    # with the low bits, and jitters bg by bits 8-15 and fg by bits 16-23 (or
+    # by the bg offset when the pool's fg_jitter is 0). No per-pool masks or
+    # temporaries; output is bit-identical to the per-pool numpy version.
+    _c_terrain_decoration(
+        chars,
+        fg_rgb,
+        bg_rgb,
+        tile_ids,
+        world_x,
+        world_y,
+        _TERRAIN_POOL_TABLE,
+        _TERRAIN_POOL_GLYPHS,
+        decoration_seed,
+    )
+
+
+# --- Fused per-tile-type property record ---
+#
+# Every per-tile map that GameMap caches or a renderer derives alongside
+# others is one field of this packed record, so a single native pass over the
+# tile grid can fill all of them (or just a dirty rect) by reading each tile's
+# record once. Field dtypes match the get_*_map() getters, so the fused output
+# is byte-identical to theirs.
+TileTypeProperties = np.dtype(
+    [
+        ("walkable", bool),
+        ("transparent", bool),
+        ("shadow_height", np.uint8),
+        ("hazard_cost", np.int16),
+        ("animation", TileAnimationParams),
+        ("emission", TileEmissionParams),
+        ("sub_tile_jitter", np.float32),
+        ("sub_tile_pattern", np.uint8),
+        ("edge_blend", np.float32),
+    ]
+)
+
+TILE_PROPERTY_FIELDS: tuple[str, ...] = tuple(TileTypeProperties.names or ())
+
+# One record per TileTypeID (enum order), generated from the registrations
+# and decoration defs via the per-property arrays above.
+_tile_type_properties = np.zeros(len(TileTypeID), dtype=TileTypeProperties)
+for _name, _source in (
+    ("walkable", _tile_type_properties_walkable),
+    ("transparent", _tile_type_properties_transparent),
+    ("shadow_height", _tile_type_properties_shadow_height),
+    ("hazard_cost", _tile_type_properties_hazard_cost),
+    ("animation", _tile_type_properties_animation),
+    ("emission", _tile_type_properties_emission),
+    ("sub_tile_jitter", _tile_type_properties_sub_tile_jitter),
+    ("sub_tile_pattern", _tile_type_properties_sub_tile_pattern),
+    ("edge_blend", _tile_type_properties_edge_blend),
+):
+    _tile_type_properties[_name] = _source
+del _name, _source
+
+
+def build_tile_property_maps(
+    tile_type_ids_map: np.ndarray, fields: Iterable[str] = TILE_PROPERTY_FIELDS
+) -> dict[str, np.ndarray]:
+    """Derive several per-tile property maps from TileTypeIDs in one pass.
+
+    Each returned map equals the matching ``get_*_map()`` result (e.g.
+    ``"walkable"`` -> ``get_walkable_map``) byte for byte and keeps the
+    input's memory order.
+
+    Args:
+        tile_type_ids_map: A 2D numpy array of TileTypeID values.
+        fields: Names from ``TILE_PROPERTY_FIELDS`` to derive.
+
+    Returns:
+        A dict of field name to 2D array matching the input shape.
+    """
+    order = "F" if tile_type_ids_map.flags.f_contiguous else "C"
+    maps = {
+        name: np.empty(
+            tile_type_ids_map.shape, dtype=TileTypeProperties[name], order=order
+        )
+        for name in fields
+    }
+    fill_tile_property_maps(tile_type_ids_map, maps)
+    return maps
+
+
+def fill_tile_property_maps(
+    tile_type_ids_map: np.ndarray,
+    maps: dict[str, np.ndarray],
+    region: tuple[int, int, int, int] | None = None,
+) -> None:
+    """Refill derived property maps in place from TileTypeIDs.
+
+    ``maps`` is keyed by ``TILE_PROPERTY_FIELDS`` names, like the result of
+    :func:`build_tile_property_maps`. ``region`` is ``(x1, y1, x2, y2)``
+    (exclusive, clipped to the grid) and defaults to the whole grid, so a
+    dirty rect can be patched after tiles change.
+    """
+    width, height = tile_type_ids_map.shape
+    x1, y1, x2, y2 = region if region is not None else (0, 0, width, height)
+    _c_tile_property_fill(
+        tile_type_ids_map.astype(np.uint8, copy=False),
+        _tile_type_properties,
+        [(out, TileTypeProperties.fields[name][1]) for name, out in maps.items()],
+        x1,
+        y1,
+        x2,
+        y2,
+    )
@@ -18,14 +18,21 @@ DO NOT USE FOR:
 - Error handling or exception propagation
 
 The event bus is fire-and-forget: publish an event without expecting return values
-or confirmations. All handlers execute immediately (synchronously). If you need a
-return value or confirmation, use direct method calls.
+or confirmations. If you need a return value or confirmation, use direct method calls.
+
+By default every handler executes immediately (synchronously). The app switches
+the global bus into queued mode, where event types with a QueuePolicy (visual
+effects, sounds, floating text, screen shake) are buffered per type and
+dispatched when the app drains the queue once per frame, after coalescing.
+Other event types stay synchronous. Tests get a synchronous bus from
+reset_event_bus_for_testing().
 """
 
 import logging
-from collections.abc import Callable
+from collections import deque
+from collections.abc import Callable, Sequence
 from contextlib import suppress
-from dataclasses import dataclass
+from dataclasses import dataclass, field
 from enum import Enum, auto
 from typing import Any
 
@@ -181,11 +188,91 @@ class CombatEndedEvent(GameEvent):
     reason: CombatEndReason
 
 
+type Coalescer = Callable[[list[GameEvent]], list[GameEvent]]
+
+
+@dataclass(frozen=True)
+class QueuePolicy:
+    """How the queued bus buffers one event type between drains.
+
+    Attributes:
+        capacity: Ring-buffer size; the oldest pending event is dropped when
+            a publish would exceed it.
+        coalesce: Optional reducer applied to the pending batch (in publish
+            order) before dispatch, e.g. to merge or cap events.
+    """
+
+    capacity: int = 256
+    coalesce: Coalescer | None = field(default=None, compare=False)
+
+
+def merge_screen_shakes(events: list[GameEvent]) -> list[GameEvent]:
+    """Collapse a batch of screen shakes into one with the strongest values.
+
+    Matches ScreenShake.trigger(), which keeps the max intensity and duration
+    of overlapping shakes.
+    """
+    shakes = [e for e in events if isinstance(e, ScreenShakeEvent)]
+    if len(shakes) <= 1:
+        return events
+    return [
+        ScreenShakeEvent(
+            intensity=max(e.intensity for e in shakes),
+            duration=DeltaTime(max(e.duration for e in shakes)),
+        )
+    ]
+
+
+def cap_floating_text_per_tile(limit: int) -> Coalescer:
+    """Return a coalescer keeping only the newest ``limit`` texts per tile."""
+
+    def coalesce(events: list[GameEvent]) -> list[GameEvent]:
+        kept: list[GameEvent] = []
+        per_tile: dict[tuple[int, int], int] = {}
+        # Walk newest first so the latest texts (e.g. a death skull) survive.
+        for event in reversed(events):
+            if isinstance(event, FloatingTextEvent):
+                tile = (event.world_x, event.world_y)
+                if per_tile.get(tile, 0) >= limit:
+                    continue
+                per_tile[tile] = per_tile.get(tile, 0) + 1
+            kept.append(event)
+        kept.reverse()
+        return kept
+
+    return coalesce
+
+
+# Presentation-only event types the app defers to the per-frame drain.
+DEFAULT_QUEUE_POLICIES: dict[type[GameEvent], QueuePolicy] = {
+    EffectEvent: QueuePolicy(),
+    SoundEvent: QueuePolicy(),
+    FloatingTextEvent: QueuePolicy(coalesce=cap_floating_text_per_tile(3)),
+    ScreenShakeEvent: QueuePolicy(coalesce=merge_screen_shakes),
+}
+
+
 class EventBus:
-    """Simple event bus for publish/subscribe pattern."""
+    """Simple event bus for publish/subscribe pattern.
 
-    def __init__(self) -> None:
+    In synchronous mode (the default) publish() dispatches immediately. In
+    queued mode, event types with a QueuePolicy are appended to per-type ring
+    buffers instead and dispatched by drain(); types without a policy are
+    still dispatched immediately.
+    """
+
+    # Drain passes per call, so events published by handlers during a drain
+    # are delivered in the same frame without letting a feedback loop spin.
+    MAX_DRAIN_PASSES = 4
+
+    def __init__(self, queued: bool = False) -> None:
         self._handlers: dict[type, list[Callable]] = {}
+        self._batch_handlers: dict[type, list[Callable]] = {}
+        self.queued = queued
+        self._policies: dict[type, QueuePolicy] = {}
+        self._queues: dict[type, deque[GameEvent]] = {}
+        # Types with pending events, in order of their first publish.
+        self._pending_types: dict[type, None] = {}
 
     def subscribe(self, event_type: type, handler: Callable) -> None:
         """Subscribe a handler to an event type."""
@@ -193,22 +280,94 @@ class EventBus:
             self._handlers[event_type] = []
         self._handlers[event_type].append(handler)
 
+    def subscribe_batch(
+        self, event_type: type, handler: Callable[[list[GameEvent]], None]
+    ) -> None:
+        """Subscribe a handler that receives each drained batch as one list.
+
+        In synchronous mode (or for types without a policy) the handler is
+        called with a single-element list per publish.
+        """
+        self._batch_handlers.setdefault(event_type, []).append(handler)
+
     def unsubscribe(self, event_type: type, handler: Callable) -> None:
         """Unsubscribe a handler from an event type."""
-        if event_type in self._handlers:
-            with suppress(ValueError):
-                self._handlers[event_type].remove(handler)
+        for handlers in (self._handlers, self._batch_handlers):
+            if event_type in handlers:
+                with suppress(ValueError):
+                    handlers[event_type].remove(handler)
+
+    def set_queue_policy(self, event_type: type, policy: QueuePolicy | None) -> None:
+        """Declare (or with None, remove) how an event type is queued."""
+        if policy is None:
+            self._policies.pop(event_type, None)
+            self._pending_types.pop(event_type, None)
+            pending = self._queues.pop(event_type, None)
+            # Flush what was buffered so nothing is silently lost.
+            if pending:
+                self._dispatch(event_type, list(pending))
+            return
+        self._policies[event_type] = policy
+        self._queues[event_type] = deque(
+            self._queues.get(event_type, ()), maxlen=policy.capacity
+        )
 
     def publish(self, event: GameEvent) -> None:
-        """Publish an event to all subscribed handlers."""
+        """Publish an event, queueing it if the bus is queued and has a policy."""
         event_type = type(event)
-        if event_type in self._handlers:
-            # Copy the handler list to allow safe subscribe/unsubscribe during dispatch
-            for handler in list(self._handlers[event_type]):
+        if self.queued and event_type in self._policies:
+            self._queues[event_type].append(event)
+            self._pending_types[event_type] = None
+            return
+        self._dispatch(event_type, [event])
+
+    def drain(self) -> int:
+        """Dispatch all queued events, coalesced per type.
+
+        Types are dispatched in order of their first publish since the last
+        drain; events within a type keep publish order. Returns the number of
+        events dispatched after coalescing.
+        """
+        dispatched = 0
+        for _ in range(self.MAX_DRAIN_PASSES):
+            if not self._pending_types:
+                break
+            pending_types = list(self._pending_types)
+            self._pending_types.clear()
+            for event_type in pending_types:
+                queue = self._queues.get(event_type)
+                if not queue:
+                    continue
+                events = list(queue)
+                queue.clear()
+                coalesce = self._policies[event_type].coalesce
+                if coalesce is not None:
+                    events = coalesce(events)
+                dispatched += len(events)
+                self._dispatch(event_type, events)
+        return dispatched
+
+    def _dispatch(self, event_type: type, events: Sequence[GameEvent]) -> None:
+        """Run batch handlers on the whole list, then per-event handlers."""
+        if not events:
+            return
+        # Copy the handler lists to allow safe subscribe/unsubscribe during dispatch
+        batch_handlers = self._batch_handlers.get(event_type)
+        if batch_handlers:
+            batch = list(events)
+            for handler in list(batch_handlers):
                 try:
-                    handler(event)
+                    handler(batch)
                 except Exception:
                     logger.exception(f"Error handling event {event_type.__name__}")
+        handlers = self._handlers.get(event_type)
+        if handlers:
+            for event in events:
+                for handler in list(handlers):
+                    try:
+                        handler(event)
+                    except Exception:
+                        logger.exception(f"Error handling event {event_type.__name__}")
 
 
 # Global event bus instance
@@ -223,6 +382,13 @@ def subscribe_to_event(event_type: type, handler: Callable) -> None:
     _global_event_bus.subscribe(event_type, handler)
 
 
+def subscribe_to_event_batch(
+    event_type: type, handler: Callable[[list[GameEvent]], None]
+) -> None:
+    """Subscribe to drained batches of an event type globally."""
+    _global_event_bus.subscribe_batch(event_type, handler)
+
+
 def unsubscribe_from_event(event_type: type, handler: Callable) -> None:
     """Unsubscribe from an event type globally."""
     _global_event_bus.unsubscribe(event_type, handler)
@@ -233,7 +399,25 @@ def publish_event(event: GameEvent) -> None:
     _global_event_bus.publish(event)
 
 
+def enable_event_queue(
+    policies: dict[type[GameEvent], QueuePolicy] | None = None,
+) -> None:
+    """Switch the global bus to queued mode with the given per-type policies.
+
+    Queued events are only delivered by drain_event_queue(), so the caller
+    must drain once per frame.
+    """
+    _global_event_bus.queued = True
+    for event_type, policy in (policies or DEFAULT_QUEUE_POLICIES).items():
+        _global_event_bus.set_queue_policy(event_type, policy)
+
+
+def drain_event_queue() -> int:
+    """Dispatch everything the global bus has queued. Returns events dispatched."""
+    return _global_event_bus.drain()
+
+
 def reset_event_bus_for_testing() -> None:
-    """Reset the global event bus. Use only in tests."""
+    """Reset the global event bus to a fresh synchronous one. Use only in tests."""
     global _global_event_bus
     _global_event_bus = EventBus()
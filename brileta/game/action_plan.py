@@ -32,6 +32,7 @@ if TYPE_CHECKING:
     from brileta.game.actors import Actor, Character
     from brileta.game.items.item_core import Item
     from brileta.util.coordinates import WorldTilePos
+    from brileta.util.pathfinding import RepairablePath
 
 
 @dataclass
@@ -193,6 +194,9 @@ class ActivePlan:
             Peek at [0] for next position. Pop only after move succeeds.
         cached_hierarchical_path: For cross-region paths, the sequence of
             region IDs to traverse. None for same-region paths.
+        path_repair: For ApproachStep, the incremental planner that repairs
+            cached_path after a blocked move. Created on the first failure
+            and kept while the target and stop distance stay the same.
     """
 
     plan: ActionPlan
@@ -200,6 +204,7 @@ class ActivePlan:
     current_step_index: int = 0
     cached_path: deque[WorldTilePos] | None = None
     cached_hierarchical_path: list[int] | None = None
+    path_repair: RepairablePath | None = None
 
     def get_current_step(self) -> Step | None:
         """Return the current step, or None if the plan is complete.
@@ -220,6 +225,7 @@ class ActivePlan:
         self.current_step_index += 1
         # Clear cached path when advancing - new step may need different path
         self.cached_path = None
+        self.path_repair = None
 
     def is_complete(self) -> bool:
         """Return True if all steps have been executed.
@@ -244,6 +250,7 @@ class ActivePlan:
                 self.current_step_index = index
                 self.cached_path = None
                 self.cached_hierarchical_path = None
+                self.path_repair = None
                 return True
 
         return False
@@ -3,6 +3,8 @@ from __future__ import annotations
 from dataclasses import dataclass
 from typing import TYPE_CHECKING
 
+import numpy as np
+
 from brileta import config
 from brileta.constants.combat import CombatConstants as Combat
 from brileta.game import ranges
@@ -37,7 +39,7 @@ class ActionContextBuilder:
             actor.x, actor.y, radius=config.ACTION_CONTEXT_RADIUS
         )
 
-        nearby: list[Character] = []
+        candidates: list[Character] = []
         for other in potential_actors:
             if other is actor or not isinstance(other, Character):
                 continue
@@ -47,9 +49,25 @@ class ActionContextBuilder:
                 0 <= other.x < gm.width
                 and 0 <= other.y < gm.height
                 and gm.visible[other.x, other.y]
-                and ranges.has_line_of_sight(gm, actor.x, actor.y, other.x, other.y)
             ):
-                nearby.append(other)
+                candidates.append(other)
+
+        # One native line-of-sight call covers every visible candidate.
+        nearby: list[Character] = []
+        if candidates:
+            count = len(candidates)
+            has_los = ranges.has_line_of_sight_batch(
+                gm,
+                np.full(count, actor.x),
+                np.full(count, actor.y),
+                np.fromiter((other.x for other in candidates), np.int32, count),
+                np.fromiter((other.y for other in candidates), np.int32, count),
+            )
+            nearby = [
+                other
+                for other, visible in zip(candidates, has_los.tolist(), strict=True)
+                if visible
+            ]
 
         items_on_ground = controller.gw.get_pickable_items_at_location(actor.x, actor.y)
         in_combat = any(
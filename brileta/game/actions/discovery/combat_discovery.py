@@ -449,15 +449,6 @@ class CombatActionDiscovery:
 
         DEPRECATED: used by the old state machine, will be removed in Task 3.
         """
-        options: list[ActionOption] = []
-        active_weapon = actor.inventory.get_active_item()
-        equipped_weapons = [active_weapon] if active_weapon else []
-
-        if not equipped_weapons:
-            from brileta.game.items.item_types import FISTS_TYPE
-
-            equipped_weapons = [FISTS_TYPE.create()]
-
         gm = controller.gw.game_map
         if (
             target == actor
@@ -468,7 +459,24 @@ class CombatActionDiscovery:
             or not gm.visible[target.x, target.y]
             or not ranges.has_line_of_sight(gm, actor.x, actor.y, target.x, target.y)
         ):
-            return options
+            return []
+        return self._combat_options_for_seen_target(controller, actor, target)
+
+    def _combat_options_for_seen_target(
+        self,
+        controller: Controller,
+        actor: Character,
+        target: Character,
+    ) -> list[ActionOption]:
+        """Combat options for a living target already known to be in sight."""
+        options: list[ActionOption] = []
+        active_weapon = actor.inventory.get_active_item()
+        equipped_weapons = [active_weapon] if active_weapon else []
+
+        if not equipped_weapons:
+            from brileta.game.items.item_types import FISTS_TYPE
+
+            equipped_weapons = [FISTS_TYPE.create()]
 
         distance = ranges.calculate_distance(actor.x, actor.y, target.x, target.y)
 
@@ -572,7 +580,7 @@ class CombatActionDiscovery:
         context = self.context_builder.build_context(controller, actor)
 
         options: list[ActionOption] = []
-        # Note: The weapon filtering is handled by get_combat_options_for_target(),
+        # Note: The weapon filtering is handled by _combat_options_for_seen_target(),
         # but we keep this check for the empty fallback case.
         active_weapon = actor.inventory.get_active_item()
         equipped_weapons = [active_weapon] if active_weapon else []
@@ -582,16 +590,14 @@ class CombatActionDiscovery:
 
             equipped_weapons = [FISTS_TYPE.create()]
 
+        # build_context already kept only living characters that are visible
+        # and in line of sight (one batched LOS call), so skip the recheck.
         for target in context.nearby_actors:
-            if (
-                target == actor
-                or not isinstance(target, Character)
-                or not target.health.is_alive()
-            ):
+            if target == actor or not target.stats:
                 continue
 
             options.extend(
-                self.get_combat_options_for_target(controller, actor, target, context)
+                self._combat_options_for_seen_target(controller, actor, target)
             )
 
         return options
@@ -1,5 +1,7 @@
 from __future__ import annotations
 
+import numpy as np
+
 from brileta import colors
 from brileta.constants.combat import CombatConstants as Combat
 from brileta.events import EffectEvent, MessageEvent, publish_event
@@ -79,22 +81,18 @@ class WeaponAreaEffectExecutor(ActionExecutor[AreaEffectIntent]):
     ) -> DistanceByTile:
         game_map = intent.controller.gw.game_map
         tiles: dict[WorldTilePos, int] = {}
-        for dx in range(-effect.size, effect.size + 1):
-            for dy in range(-effect.size, effect.size + 1):
+        size = effect.size
+        los = self._los_box(intent, effect, intent.target_x, intent.target_y)
+        for dx in range(-size, size + 1):
+            for dy in range(-size, size + 1):
                 tx = intent.target_x + dx
                 ty = intent.target_y + dy
                 if not (0 <= tx < game_map.width and 0 <= ty < game_map.height):
                     continue
                 distance = max(abs(dx), abs(dy))
-                if distance > effect.size:
+                if distance > size:
                     continue
-                if effect.requires_line_of_sight and not ranges.has_line_of_sight(
-                    game_map,
-                    intent.attacker.x,
-                    intent.attacker.y,
-                    tx,
-                    ty,
-                ):
+                if los is not None and not los[dx + size, dy + size]:
                     continue
                 if not effect.penetrates_walls and not game_map.transparent[tx, ty]:
                     continue
@@ -112,18 +110,23 @@ class WeaponAreaEffectExecutor(ActionExecutor[AreaEffectIntent]):
             intent.target_x,
             intent.target_y,
         )
-        for i, (tx, ty) in enumerate(line[1 : effect.size + 1], start=1):
+        points = line[1 : effect.size + 1]
+        los = None
+        if effect.requires_line_of_sight and points:
+            xs, ys = zip(*points, strict=True)
+            los = ranges.has_line_of_sight_batch(
+                game_map,
+                np.full(len(points), intent.attacker.x),
+                np.full(len(points), intent.attacker.y),
+                np.array(xs),
+                np.array(ys),
+            )
+        for i, (tx, ty) in enumerate(points, start=1):
             if not (0 <= tx < game_map.width and 0 <= ty < game_map.height):
                 break
             if not effect.penetrates_walls and not game_map.transparent[tx, ty]:
                 break
-            if effect.requires_line_of_sight and not ranges.has_line_of_sight(
-                game_map,
-                intent.attacker.x,
-                intent.attacker.y,
-                tx,
-                ty,
-            ):
+            if los is not None and not los[i - 1]:
                 continue
             tiles[(tx, ty)] = i
         return tiles
@@ -140,15 +143,17 @@ class WeaponAreaEffectExecutor(ActionExecutor[AreaEffectIntent]):
         dir_x /= length
         dir_y /= length
         cos_limit = Combat.CONE_SPREAD_COSINE
+        size = effect.size
+        los = self._los_box(intent, effect, intent.attacker.x, intent.attacker.y)
 
-        for dx in range(-effect.size, effect.size + 1):
-            for dy in range(-effect.size, effect.size + 1):
+        for dx in range(-size, size + 1):
+            for dy in range(-size, size + 1):
                 tx = intent.attacker.x + dx
                 ty = intent.attacker.y + dy
                 if not (0 <= tx < game_map.width and 0 <= ty < game_map.height):
                     continue
                 distance = (dx**2 + dy**2) ** 0.5
-                if distance == 0 or distance > effect.size:
+                if distance == 0 or distance > size:
                     continue
                 dot = dx * dir_x + dy * dir_y
                 if dot <= 0:
@@ -156,19 +161,35 @@ class WeaponAreaEffectExecutor(ActionExecutor[AreaEffectIntent]):
                 cos_angle = dot / distance
                 if cos_angle < cos_limit:
                     continue
-                if effect.requires_line_of_sight and not ranges.has_line_of_sight(
-                    game_map,
-                    intent.attacker.x,
-                    intent.attacker.y,
-                    tx,
-                    ty,
-                ):
+                if los is not None and not los[dx + size, dy + size]:
                     continue
                 if not effect.penetrates_walls and not game_map.transparent[tx, ty]:
                     continue
                 tiles[(tx, ty)] = round(distance)
         return tiles
 
+    @staticmethod
+    def _los_box(
+        intent: AreaEffectIntent, effect: AreaEffect, center_x: int, center_y: int
+    ) -> np.ndarray | None:
+        """Attacker line of sight to the effect's (2*size+1)^2 box, or None.
+
+        Indexed ``[dx + size, dy + size]`` relative to ``(center_x, center_y)``;
+        None when the effect ignores line of sight.
+        """
+        if not effect.requires_line_of_sight:
+            return None
+        side = 2 * effect.size + 1
+        return ranges.line_of_sight_mask(
+            intent.controller.gw.game_map,
+            intent.attacker.x,
+            intent.attacker.y,
+            center_x - effect.size,
+            center_y - effect.size,
+            side,
+            side,
+        )
+
     def _apply_damage(
         self, intent: AreaEffectIntent, tiles: DistanceByTile, effect: AreaEffect
     ) -> list[tuple[Character, int]]:
@@ -31,7 +31,7 @@ class OpenDoorExecutor(ActionExecutor[OpenDoorIntent]):
         game_map = intent.controller.gw.game_map
         if game_map.tiles[intent.x, intent.y] == TileTypeID.DOOR_CLOSED:
             game_map.tiles[intent.x, intent.y] = TileTypeID.DOOR_OPEN
-            game_map.invalidate_property_caches()
+            game_map.invalidate_property_caches(changed_tiles=[(intent.x, intent.y)])
 
             _notify_door_action(intent.controller, intent.x, intent.y)
 
@@ -46,7 +46,7 @@ class CloseDoorExecutor(ActionExecutor[CloseDoorIntent]):
         game_map = intent.controller.gw.game_map
         if game_map.tiles[intent.x, intent.y] == TileTypeID.DOOR_OPEN:
             game_map.tiles[intent.x, intent.y] = TileTypeID.DOOR_CLOSED
-            game_map.invalidate_property_caches()
+            game_map.invalidate_property_caches(changed_tiles=[(intent.x, intent.y)])
 
             _notify_door_action(intent.controller, intent.x, intent.y)
 
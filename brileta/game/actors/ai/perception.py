@@ -15,6 +15,8 @@ from __future__ import annotations
 from dataclasses import dataclass
 from typing import TYPE_CHECKING
 
+import numpy as np
+
 from brileta.game import ranges
 
 if TYPE_CHECKING:
@@ -80,8 +82,7 @@ class PerceptionComponent:
         """
         from brileta.game.actors.core import Character
 
-        perceived: list[PerceivedActor] = []
-
+        in_range: list[tuple[Actor, int]] = []
         for other in candidates:
             if other is actor:
                 continue
@@ -93,12 +94,26 @@ class PerceptionComponent:
             distance = ranges.calculate_distance(actor.x, actor.y, other.x, other.y)
             if distance >= self.awareness_radius:
                 continue
+            in_range.append((other, distance))
+
+        if not in_range:
+            return []
+
+        # Line-of-sight check: Bresenham ray must pass through only
+        # transparent tiles between perceiver and target. One native call
+        # covers every in-range candidate.
+        count = len(in_range)
+        visible = ranges.has_line_of_sight_batch(
+            game_map,
+            np.full(count, actor.x),
+            np.full(count, actor.y),
+            np.fromiter((other.x for other, _ in in_range), np.int32, count),
+            np.fromiter((other.y for other, _ in in_range), np.int32, count),
+        )
 
-            # Line-of-sight check: Bresenham ray must pass through only
-            # transparent tiles between perceiver and target.
-            if not ranges.has_line_of_sight(
-                game_map, actor.x, actor.y, other.x, other.y
-            ):
+        perceived: list[PerceivedActor] = []
+        for (other, distance), has_los in zip(in_range, visible.tolist(), strict=True):
+            if not has_los:
                 continue
 
             # Perception strength: 1.0 at distance 0, linear falloff with
@@ -30,7 +30,7 @@ BARK_DURATION = 1.1
 BARK_COOLDOWN_SECONDS = 0.25
 
 # Bark dialogue is drawn as dark ink on the parchment bubble (see
-# floating_text.BUBBLE_FILL); a light color would wash out on the cream.
+# text_atlas.BUBBLE_FILL); a light color would wash out on the cream.
 BARK_INK: colors.Color = (56, 42, 28)
 
 BARKS_BY_DISPOSITION: dict[str, tuple[str, ...]] = {
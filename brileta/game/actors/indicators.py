@@ -32,7 +32,7 @@ class IndicatorKind(Enum):
 
 # Glyph and color drawn for each kind. "!" reads as urgent/notable; "?" reads as
 # uncertain/searching. Colors are darkened/saturated so they stay legible on the
-# parchment bubble (see floating_text.BUBBLE_FILL) - bright red/yellow wash out
+# parchment bubble (see text_atlas.BUBBLE_FILL) - bright red/yellow wash out
 # on the cream fill.
 INDICATOR_STYLES: dict[IndicatorKind, tuple[str, colors.Color]] = {
     IndicatorKind.ATTACK: ("!", (200, 30, 30)),  # deep red
@@ -142,6 +142,9 @@ class GameWorld:
 
         # Generator-specific decoration placement caches.
         self.buildings: list[Building] = []
+        # Bump whenever `buildings` is replaced or a building's visual fields
+        # change, so roof render caches can skip per-building identity keys.
+        self.buildings_revision = 0
         self.streets: list[Rect] = []
         # Public feature tiles anchored NPCs may briefly visit on a mid-workday
         # errand. Filled during settlement routine assignment; empty otherwise.
@@ -182,7 +185,7 @@ class GameWorld:
         # "remembered/dimmed." Other map types (dungeons, wilderness) start
         # unexplored and reveal as the player moves through them.
         if self.generator_type == GeneratorType.SETTLEMENT:
-            self.game_map.explored[:] = True
+            self.game_map.mark_explored()
 
         # Populate NPCs using generator-appropriate method
         if self.generator_type == GeneratorType.SETTLEMENT:
@@ -326,9 +329,8 @@ class GameWorld:
             # Invalidate lighting cache since global lighting conditions changed
             if self.lighting_system:
                 self.lighting_system.on_global_light_changed()
-            # Invalidate appearance caches since region properties changed
-            if self.game_map:
-                self.game_map.invalidate_appearance_caches()
+            # Rewrite only this region's ground colour in the appearance maps
+            self.game_map.refresh_region_appearance(region.id)
             return True
         return False
 
@@ -411,6 +413,7 @@ class GameWorld:
 
             # Store settlement data for NPC placement
             self.buildings = map_data.buildings
+            self.buildings_revision += 1
             self.streets = map_data.streets
             self.tree_positions = map_data.tree_positions
             self.boulder_positions = map_data.boulder_positions
@@ -1,6 +1,9 @@
+import numpy as np
+
 from brileta.environment.map import GameMap
 from brileta.game.items.item_core import Item
 from brileta.game.items.item_types import WeaponProperty
+from brileta.util._native import line_of_sight, los_batch, los_mask
 
 
 def get_range_category(distance: int, weapon: Item) -> str:
@@ -46,13 +49,51 @@ def has_line_of_sight(
 ) -> bool:
     """Check if there's clear line of sight between two points.
 
-    Uses Bresenham's line algorithm to walk the grid between start and end,
-    checking that all intermediate tiles are transparent.
+    Walks the get_line() Bresenham points between start and end (natively)
+    and checks that all intermediate tiles are transparent.
     """
-    line_points = get_line(start_x, start_y, end_x, end_y)
-
-    # Check all points except start and end for transparency
-    return all(game_map.transparent[x, y] for x, y in line_points[1:-1])
+    return line_of_sight(game_map.transparent, start_x, start_y, end_x, end_y)
+
+
+def line_of_sight_mask(
+    game_map: GameMap,
+    origin_x: int,
+    origin_y: int,
+    box_x: int,
+    box_y: int,
+    width: int,
+    height: int,
+) -> np.ndarray:
+    """Line of sight from an origin to every tile of a box, in one native call.
+
+    Returns a ``(width, height)`` bool array indexed ``[x - box_x, y - box_y]``
+    holding has_line_of_sight(origin, tile) for each tile; tiles outside the
+    map are False.
+    """
+    out = np.zeros((width, height), dtype=np.bool_)
+    los_mask(game_map.transparent, origin_x, origin_y, box_x, box_y, out)
+    return out
+
+
+def has_line_of_sight_batch(
+    game_map: GameMap,
+    start_x: np.ndarray,
+    start_y: np.ndarray,
+    end_x: np.ndarray,
+    end_y: np.ndarray,
+) -> np.ndarray:
+    """Vectorized has_line_of_sight() over arrays of (start, end) pairs."""
+    src_x = np.ascontiguousarray(start_x, dtype=np.int32)
+    out = np.zeros(src_x.shape, dtype=np.bool_)
+    los_batch(
+        game_map.transparent,
+        src_x,
+        np.ascontiguousarray(start_y, dtype=np.int32),
+        np.ascontiguousarray(end_x, dtype=np.int32),
+        np.ascontiguousarray(end_y, dtype=np.int32),
+        out,
+    )
+    return out
 
 
 def get_line(
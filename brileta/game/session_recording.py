@@ -0,0 +1,403 @@
+"""Recording of play sessions for deterministic headless replay.
+
+A :class:`SessionRecorder` attached to a ``Controller`` captures what a
+replay needs to re-drive the same simulation:
+
+- the world seed, and any seed passed to ``Controller.new_world()`` later
+- every player intent executed by
+  ``Controller._execute_player_action_immediately()``, which all player
+  input reaches: queued UI actions, held-key movement and the autopilot
+  steps of an active plan
+- player turns that passed without an action because the player could not
+  afford one
+- the fixed-timestep boundaries from ``App.update_game_logic()``: for each
+  visual frame, the player actions it executed and how many logic steps ran
+
+Intents are stored as their class path plus attributes, with actors
+referenced by ``actor_id`` and items by their holder and where the holder
+keeps them (stored index, ready slot, or outfit), so a recording is plain
+JSON. :mod:`brileta.testing.replay` drives a recording headlessly and checks
+it against per-tick :class:`StateHasher` digests.
+
+Recording executed intents rather than raw input keeps a replay independent
+of the wall-clock key repeat and presentation pacing that decide when live
+input turns into an action.
+
+An intent that cannot be encoded never interrupts play: it is logged and the
+recording is marked unreplayable.
+"""
+
+from __future__ import annotations
+
+import hashlib
+import importlib
+import json
+import logging
+from dataclasses import dataclass, field
+from enum import Enum
+from pathlib import Path
+from typing import TYPE_CHECKING, Any
+
+from brileta.game.actors.components import CharacterInventory, InventoryComponent
+from brileta.game.actors.core import Actor
+from brileta.game.items.item_core import Item
+from brileta.types import ActorId, RandomSeed, WorldTileDimensions
+
+if TYPE_CHECKING:
+    from brileta.controller import Controller
+    from brileta.game.actions.base import GameIntent
+    from brileta.game.game_world import GameWorld
+
+logger = logging.getLogger(__name__)
+
+# Bumped whenever the JSON layout changes incompatibly.
+RECORDING_FORMAT_VERSION = 2
+
+# Intent attributes that are re-bound on replay rather than recorded.
+_UNRECORDED_INTENT_FIELDS = frozenset({"controller"})
+
+
+@dataclass
+class RecordedFrame:
+    """One visual frame: the player actions it ran and its logic steps.
+
+    ``intents`` are encoded intents in execution order; a None entry is a
+    player turn that passed without an action.
+    """
+
+    logic_steps: int = 0
+    intents: list[dict[str, Any] | None] = field(default_factory=list)
+    paused: bool = False
+    # Seed of a world regenerated just before this frame, if any.
+    new_world_seed: RandomSeed = None
+
+    def to_dict(self) -> dict[str, Any]:
+        data: dict[str, Any] = {"steps": self.logic_steps}
+        if self.intents:
+            data["intents"] = self.intents
+        if self.paused:
+            data["paused"] = True
+        if self.new_world_seed is not None:
+            data["new_world"] = self.new_world_seed
+        return data
+
+    @classmethod
+    def from_dict(cls, data: dict[str, Any]) -> RecordedFrame:
+        return cls(
+            logic_steps=int(data["steps"]),
+            intents=list(data.get("intents", [])),
+            paused=bool(data.get("paused", False)),
+            new_world_seed=data.get("new_world"),
+        )
+
+
+@dataclass
+class SessionRecording:
+    """A recorded session: the world it started from and every frame after.
+
+    ``tick_hashes`` holds the expected state digest after each logic step.
+    It is filled by blessing a replay, since live sessions pace autopilot and
+    NPC reactions on wall-clock time that a replay does not reproduce.
+
+    ``unreplayable`` explains why the session cannot be replayed faithfully
+    (an input that could not be recorded), or is None.
+    """
+
+    seed: RandomSeed
+    map_size: WorldTileDimensions
+    frames: list[RecordedFrame] = field(default_factory=list)
+    tick_hashes: list[str] = field(default_factory=list)
+    unreplayable: str | None = None
+
+    @property
+    def tick_count(self) -> int:
+        """Total logic steps across all frames."""
+        return sum(frame.logic_steps for frame in self.frames)
+
+    def to_dict(self) -> dict[str, Any]:
+        data: dict[str, Any] = {
+            "version": RECORDING_FORMAT_VERSION,
+            "seed": self.seed,
+            "map_size": list(self.map_size),
+            "frames": [frame.to_dict() for frame in self.frames],
+            "tick_hashes": self.tick_hashes,
+        }
+        if self.unreplayable is not None:
+            data["unreplayable"] = self.unreplayable
+        return data
+
+    @classmethod
+    def from_dict(cls, data: dict[str, Any]) -> SessionRecording:
+        version = data.get("version")
+        if version != RECORDING_FORMAT_VERSION:
+            raise ValueError(f"Unsupported session recording version: {version!r}")
+        width, height = data["map_size"]
+        return cls(
+            seed=data["seed"],
+            map_size=(int(width), int(height)),
+            frames=[RecordedFrame.from_dict(frame) for frame in data["frames"]],
+            tick_hashes=list(data.get("tick_hashes", [])),
+            unreplayable=data.get("unreplayable"),
+        )
+
+    def save(self, path: Path | str) -> None:
+        Path(path).write_text(json.dumps(self.to_dict(), separators=(",", ":")))
+
+    @classmethod
+    def load(cls, path: Path | str) -> SessionRecording:
+        return cls.from_dict(json.loads(Path(path).read_text()))
+
+
+class SessionRecorder:
+    """Captures a live session from the hooks in Controller and App.
+
+    Constructing a recorder attaches it to the controller; the session starts
+    from the controller's current world.
+    """
+
+    def __init__(self, controller: Controller) -> None:
+        game_map = controller.gw.game_map
+        self.recording = SessionRecording(
+            seed=controller._current_seed,
+            map_size=(game_map.width, game_map.height),
+        )
+        self._controller = controller
+        # Actions executed outside App.update_game_logic() (no frame open)
+        # run at the start of the next frame on replay.
+        self._pending_intents: list[dict[str, Any] | None] = []
+        self._pending_new_world_seed: RandomSeed = None
+        self._frame_open = False
+        controller.session_recorder = self
+
+    def detach(self) -> SessionRecording:
+        """Stop recording and return the recording."""
+        if self._controller.session_recorder is self:
+            self._controller.session_recorder = None
+        return self.recording
+
+    def record_intent(self, intent: GameIntent) -> None:
+        """Record a player intent as it is executed.
+
+        Called from gameplay, so an intent that cannot be encoded is logged and
+        marks the recording unreplayable instead of raising.
+        """
+        try:
+            self._current_intents().append(encode_intent(intent))
+        except (TypeError, ValueError) as exc:
+            reason = f"{type(intent).__name__} could not be recorded: {exc}"
+            logger.warning("Session recording is no longer replayable: %s", reason)
+            if self.recording.unreplayable is None:
+                self.recording.unreplayable = reason
+
+    def record_passed_turn(self) -> None:
+        """Record a player turn that passed without an action."""
+        self._current_intents().append(None)
+
+    def _current_intents(self) -> list[dict[str, Any] | None]:
+        if self._frame_open:
+            return self.recording.frames[-1].intents
+        return self._pending_intents
+
+    def record_new_world(self, seed: RandomSeed) -> None:
+        """Record a world regeneration; pending actions in the old world drop."""
+        self._pending_intents.clear()
+        self._pending_new_world_seed = seed
+
+    def begin_frame(self) -> None:
+        """Open a frame, starting with any actions run since the previous one."""
+        self.recording.frames.append(
+            RecordedFrame(
+                intents=self._pending_intents,
+                paused=self._controller.paused,
+                new_world_seed=self._pending_new_world_seed,
+            )
+        )
+        self._pending_intents = []
+        self._pending_new_world_seed = None
+        self._frame_open = True
+
+    def end_frame(self, logic_steps: int) -> None:
+        """Close the current frame after its fixed logic steps ran."""
+        if self.recording.frames:
+            self.recording.frames[-1].logic_steps = logic_steps
+        self._frame_open = False
+
+
+class StateHasher:
+    """Digest of the semantic simulation state, taken after each logic step.
+
+    Covers every actor's id, position, health and energy, the tile grid and
+    the mode stack. The tile grid is re-hashed only when the map's
+    structural revision moves.
+    """
+
+    def __init__(self) -> None:
+        self._tiles_key: tuple[int, int] | None = None
+        self._tiles_digest = b""
+
+    def __call__(self, controller: Controller) -> str:
+        gw = controller.gw
+        game_map = gw.game_map
+        tiles_key = (id(game_map), game_map.structural_revision)
+        if tiles_key != self._tiles_key:
+            self._tiles_key = tiles_key
+            self._tiles_digest = hashlib.blake2b(
+                game_map.tiles.tobytes(), digest_size=16
+            ).digest()
+
+        actors = []
+        for actor in sorted(gw.actors, key=lambda a: a.actor_id):
+            health = actor.health
+            energy = actor.energy
+            actors.append(
+                (
+                    int(actor.actor_id),
+                    actor.x,
+                    actor.y,
+                    None if health is None else health.hp,
+                    None if energy is None else energy.accumulated_energy,
+                )
+            )
+        modes = tuple(type(mode).__name__ for mode in controller.mode_stack)
+        digest = hashlib.blake2b(self._tiles_digest, digest_size=8)
+        digest.update(repr((actors, modes)).encode())
+        return digest.hexdigest()
+
+
+def encode_intent(intent: GameIntent) -> dict[str, Any]:
+    """Serialize ``intent`` to JSON-compatible data.
+
+    Raises:
+        TypeError: If an attribute holds a value with no recorded form.
+    """
+    gw = intent.controller.gw
+    cls = type(intent)
+    return {
+        "type": _class_path(cls),
+        "fields": {
+            name: _encode_value(value, gw)
+            for name, value in vars(intent).items()
+            if name not in _UNRECORDED_INTENT_FIELDS
+        },
+    }
+
+
+def decode_intent(data: dict[str, Any], controller: Controller) -> GameIntent:
+    """Rebuild an intent recorded by :func:`encode_intent` in ``controller``'s world.
+
+    The intent's attributes are restored directly rather than re-running its
+    constructor, so derived attributes come back exactly as recorded.
+    """
+    cls = _resolve_class_path(data["type"])
+    intent = cls.__new__(cls)
+    intent.controller = controller
+    for name, value in data["fields"].items():
+        setattr(intent, name, _decode_value(value, controller.gw))
+    return intent
+
+
+def _class_path(cls: type) -> str:
+    return f"{cls.__module__}:{cls.__qualname__}"
+
+
+def _resolve_class_path(path: str) -> Any:
+    module_name, qualname = path.split(":")
+    obj: Any = importlib.import_module(module_name)
+    for part in qualname.split("."):
+        obj = getattr(obj, part)
+    return obj
+
+
+def _encode_value(value: object, gw: GameWorld) -> Any:
+    if value is None or isinstance(value, bool):
+        return value
+    if isinstance(value, Enum):
+        return {"enum": _class_path(type(value)), "name": value.name}
+    if isinstance(value, int | float | str):
+        return value
+    if isinstance(value, Actor):
+        return {"actor": int(value.actor_id)}
+    if isinstance(value, Item):
+        return _locate_item(value, gw)
+    if isinstance(value, InventoryComponent) and value.actor is not None:
+        return {"inventory": int(value.actor.actor_id)}
+    if isinstance(value, list):
+        return [_encode_value(v, gw) for v in value]
+    if isinstance(value, tuple):
+        return {"tuple": [_encode_value(v, gw) for v in value]}
+    raise TypeError(f"Cannot record intent field of type {type(value).__name__}")
+
+
+def _decode_value(value: Any, gw: GameWorld) -> Any:
+    if isinstance(value, list):
+        return [_decode_value(v, gw) for v in value]
+    if not isinstance(value, dict):
+        return value
+    if "enum" in value:
+        return _resolve_class_path(value["enum"])[value["name"]]
+    if "actor" in value:
+        return _lookup_actor(gw, value["actor"])
+    if "item" in value:
+        holder_id, index = value["item"]
+        return _lookup_inventory(gw, holder_id).get_items()[index]
+    if "ready_slot" in value:
+        holder_id, slot = value["ready_slot"]
+        item = _lookup_character_inventory(gw, holder_id).ready_slots[slot]
+        if item is None:
+            raise ValueError(f"Recorded ready slot {slot} of {holder_id} is empty")
+        return item
+    if "outfit" in value:
+        outfit = _lookup_character_inventory(gw, value["outfit"]).equipped_outfit
+        if outfit is None:
+            raise ValueError(f"Recorded actor {value['outfit']} wears no outfit")
+        return outfit[0]
+    if "inventory" in value:
+        return _lookup_inventory(gw, value["inventory"])
+    if "tuple" in value:
+        return tuple(_decode_value(v, gw) for v in value["tuple"])
+    raise ValueError(f"Unrecognized recorded value: {value!r}")
+
+
+def _locate_item(item: Item, gw: GameWorld) -> dict[str, Any]:
+    """Reference to a held item by its holder and where the holder keeps it.
+
+    Stored items are ``{"item": [holder, index in get_items()]}``; equipped ones
+    are ``{"ready_slot": [holder, slot]}`` or ``{"outfit": holder}``.
+    """
+    for actor in gw.actors:
+        inventory = actor.inventory
+        if inventory is None:
+            continue
+        holder = int(actor.actor_id)
+        for index, held in enumerate(inventory.get_items()):
+            if held is item:
+                return {"item": [holder, index]}
+        if isinstance(inventory, CharacterInventory):
+            for slot, held in enumerate(inventory.ready_slots):
+                if held is item:
+                    return {"ready_slot": [holder, slot]}
+            outfit = inventory.equipped_outfit
+            if outfit is not None and outfit[0] is item:
+                return {"outfit": holder}
+    raise TypeError(f"Cannot record item {item.name!r}: no actor holds it")
+
+
+def _lookup_actor(gw: GameWorld, actor_id: int) -> Actor:
+    actor = gw.get_actor_by_id(ActorId(actor_id))
+    if actor is None:
+        raise ValueError(f"Recorded actor {actor_id} does not exist in this world")
+    return actor
+
+
+def _lookup_inventory(gw: GameWorld, actor_id: int) -> InventoryComponent:
+    inventory = _lookup_actor(gw, actor_id).inventory
+    if inventory is None:
+        raise ValueError(f"Recorded actor {actor_id} has no inventory")
+    return inventory
+
+
+def _lookup_character_inventory(gw: GameWorld, actor_id: int) -> CharacterInventory:
+    inventory = _lookup_inventory(gw, actor_id)
+    if not isinstance(inventory, CharacterInventory):
+        raise ValueError(f"Recorded actor {actor_id} has no equipment slots")
+    return inventory
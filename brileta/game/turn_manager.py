@@ -39,7 +39,7 @@ from brileta.game.action_router import ActionRouter
 from brileta.game.actions.base import GameActionResult, GameIntent
 from brileta.game.enums import ActionBlockReason
 from brileta.game.ranges import calculate_distance
-from brileta.types import DIRECTIONS, ActorId, FixedTimestep
+from brileta.types import ActorId, FixedTimestep
 from brileta.util import rng
 from brileta.util.coordinates import WorldTilePos
 
@@ -681,34 +681,22 @@ class TurnManager:
                     local_path, plan.cached_hierarchical_path = hierarchical
                     plan.cached_path = deque(local_path)
 
-            # If still no path and we have a stop_distance, try adjacent tiles.
-            # The target tile is likely occupied (e.g., by an enemy we're approaching).
+            # If still no path and we have a stop_distance, settle for any
+            # reachable tile within it. The target tile is likely occupied
+            # (e.g., by an enemy we're approaching), so one goal-region
+            # search finds the cheapest tile in range.
             if not plan.cached_path and step.stop_distance > 0:
-                from brileta.util.pathfinding import probe_step
-
-                best_path: list[WorldTilePos] | None = None
-                for dx, dy in DIRECTIONS:
-                    tx = target_pos[0] + dx
-                    ty = target_pos[1] + dy
-                    if (
-                        probe_step(gm, self.controller.gw, tx, ty, exclude_actor=actor)
-                        is not None
-                    ):
-                        continue
-                    candidate = find_local_path(
-                        gm,
-                        asi,
-                        actor,
-                        start_pos,
-                        (tx, ty),
-                        can_open_doors=actor_can_open_doors,
-                    )
-                    if candidate and (
-                        best_path is None or len(candidate) < len(best_path)
-                    ):
-                        best_path = candidate
-                if best_path is not None:
-                    plan.cached_path = deque(best_path)
+                nearby = find_local_path(
+                    gm,
+                    asi,
+                    actor,
+                    start_pos,
+                    target_pos,
+                    can_open_doors=actor_can_open_doors,
+                    stop_distance=step.stop_distance,
+                )
+                if nearby:
+                    plan.cached_path = deque(nearby)
 
         if not plan.cached_path:
             # Can't reach target - cancel plan
@@ -790,7 +778,8 @@ class TurnManager:
         Updates the plan state based on whether the action succeeded:
         - Move success: Pop the path entry the actor moved to.
         - Door open success: Keep the path entry (actor didn't move yet).
-        - Failure: Invalidate path for recalculation on next turn.
+        - Failure: Repair a same-region path around whatever changed;
+          invalidate a cross-region path for recalculation on next turn.
 
         Args:
             actor: The character who attempted the action.
@@ -827,11 +816,55 @@ class TurnManager:
                 plan.advance()
                 if plan.is_complete():
                     self._cancel_plan(actor)
+        elif plan.cached_hierarchical_path is None:
+            # Move failed (blocked), usually by an actor briefly standing on
+            # the next tile. Repair the path incrementally instead of letting
+            # the next turn search the whole route again.
+            plan.cached_path = self._repair_approach_path(actor, plan, step)
         else:
-            # Move failed (blocked) - invalidate path for recalculation
+            # Cross-region move failed - invalidate path for recalculation
             plan.cached_path = None
             plan.cached_hierarchical_path = None
 
+    def _repair_approach_path(
+        self,
+        actor: Character,
+        plan: ActivePlan,
+        step: ApproachStep,
+    ) -> deque[WorldTilePos] | None:
+        """Repair the plan's path after a blocked move.
+
+        Reuses ``plan.path_repair`` while it still targets the same tile with
+        the same stop distance, so only tiles whose cost changed since the
+        last repair (actor occupancy, door toggles) are re-searched.
+
+        Returns:
+            The repaired path, or None to fall back to a fresh search on the
+            next turn (no target, or nothing reachable).
+        """
+        from brileta.util.pathfinding import RepairablePath
+
+        target_pos = plan.context.resolve_target_pos()
+        if target_pos is None:
+            return None
+
+        repair = plan.path_repair
+        if repair is None or not repair.matches(
+            target_pos, step.stop_distance, actor.can_open_doors
+        ):
+            repair = RepairablePath(
+                self.controller.gw.game_map,
+                self.controller.gw.actor_spatial_index,
+                actor,
+                target_pos,
+                stop_distance=step.stop_distance,
+                can_open_doors=actor.can_open_doors,
+            )
+            plan.path_repair = repair
+
+        path = repair.repair((actor.x, actor.y))
+        return deque(path) if path else None
+
     def _try_hierarchical_path(
         self,
         actor: Character,
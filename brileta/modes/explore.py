@@ -213,7 +213,7 @@ class ExploreMode(Mode):
                 self.controller._execute_player_action_immediately(intent)
             else:
                 # Player tried to move but can't afford it - time passes anyway
-                self.controller.turn_manager.on_player_action()
+                self.controller._pass_player_turn()
 
     def render_world_under_actors(self) -> None:
         """Render hover/selection outlines behind actors.
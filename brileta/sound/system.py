@@ -8,11 +8,9 @@ from dataclasses import dataclass
 from pathlib import Path
 from typing import TYPE_CHECKING
 
-from brileta.environment.tile_types import TileTypeID
 from brileta.events import SoundEvent, subscribe_to_event
 from brileta.types import DeltaTime, FloatRange, SoundId, WorldTileCoord, saturate
 from brileta.util import rng
-from brileta.util.pathfinding import find_region_path
 from brileta.util.spatial import SpatialIndex
 
 from .audio_backend import AudioBackend, AudioChannel, LoadedSound
@@ -23,6 +21,11 @@ from .definitions import (
     get_sound_definition,
 )
 from .loader import AudioLoader
+from .occlusion import (
+    CLOSED_DOOR_OCCLUSION,  # noqa: F401 (re-exported)
+    OPEN_DOOR_OCCLUSION,  # noqa: F401 (re-exported)
+    RegionOcclusionField,
+)
 
 if TYPE_CHECKING:
     from brileta.environment.map import GameMap
@@ -33,11 +36,6 @@ logger = logging.getLogger(__name__)
 
 _rng = rng.get("audio.system")
 
-# Volume multipliers applied per wall/door boundary between emitter and listener.
-# These compound multiplicatively: two open doors = 0.6 * 0.6 = 0.36x.
-OPEN_DOOR_OCCLUSION = 0.6  # Each open door reduces volume to 60%
-CLOSED_DOOR_OCCLUSION = 0.15  # Each closed door reduces volume to 15%
-
 # How often (in ticks) to re-query the spatial index for nearby actors.
 # The spatial query scans a large radius and is expensive on big maps.
 # Throttling to every N ticks is safe because sound emitter positions
@@ -124,11 +122,10 @@ class SoundSystem:
         self._delayed_sounds: list[tuple[float, SoundEvent]] = []
 
         # Occlusion: region-based sound attenuation through walls/doors.
-        # Cache is keyed on (emitter_region_id, listener_region_id) and
-        # invalidated when structural_revision changes (door open/close).
+        # The field holds the best multiplier from the listener's region to
+        # every region and refreshes itself on region or door changes.
         self._current_game_map: GameMap | None = None
-        self._occlusion_cache: dict[tuple[int, int], float] = {}
-        self._occlusion_cache_revision: int = -1
+        self._occlusion_field = RegionOcclusionField()
         # Non-positional loops (rain, wind, etc.) mixed directly without
         # distance attenuation or occlusion.
         self._ambient_loops: dict[SoundId, AmbientLoop] = {}
@@ -404,9 +401,9 @@ class SoundSystem:
     ) -> float:
         """Calculate how much walls and doors attenuate sound between emitter and listener.
 
-        Uses the MapRegion connectivity graph to find the path sound must travel
-        through doors. Each door boundary applies a volume multiplier depending
-        on whether the door is open or closed.
+        Uses the MapRegion connectivity graph to find the least-occluded route
+        sound can take through doors. Each door boundary applies a volume
+        multiplier depending on whether the door is open or closed.
 
         Args:
             emitter_x: X tile position of the sound source.
@@ -444,57 +441,11 @@ class SoundSystem:
         if listener_region_id == emitter_region_id:
             return 1.0
 
-        # Invalidate cache if map structure changed (door opened/closed)
-        if game_map.structural_revision != self._occlusion_cache_revision:
-            self._occlusion_cache.clear()
-            self._occlusion_cache_revision = game_map.structural_revision
-
-        cache_key = (emitter_region_id, listener_region_id)
-        cached = self._occlusion_cache.get(cache_key)
-        if cached is not None:
-            return cached
-
-        # Find a path through connected regions (BFS through door graph)
-        region_path = find_region_path(game_map, emitter_region_id, listener_region_id)
-        if region_path is None:
-            # No connected route - completely blocked by walls
-            self._occlusion_cache[cache_key] = 0.0
-            return 0.0
-
-        # Walk the path and accumulate occlusion from each door boundary
-        occlusion = 1.0
-        for i in range(len(region_path) - 1):
-            from_region_id = region_path[i]
-            to_region_id = region_path[i + 1]
-
-            from_region = game_map.regions.get(from_region_id)
-            if from_region is None:
-                occlusion = 0.0
-                break
-
-            door_pos = from_region.connections.get(to_region_id)
-            if door_pos is None:
-                # No connection stored - treat as wall
-                occlusion = 0.0
-                break
-
-            door_x, door_y = door_pos
-            tile = game_map.tiles[door_x, door_y]
-            if tile == TileTypeID.DOOR_OPEN:
-                occlusion *= OPEN_DOOR_OCCLUSION
-            elif tile == TileTypeID.DOOR_CLOSED:
-                occlusion *= CLOSED_DOOR_OCCLUSION
-            else:
-                # Not a door tile (e.g. wall, or archway converted to floor)
-                # Treat open archways as open doors
-                if game_map.transparent[door_x, door_y]:
-                    occlusion *= OPEN_DOOR_OCCLUSION
-                else:
-                    occlusion = 0.0
-                    break
-
-        self._occlusion_cache[cache_key] = occlusion
-        return occlusion
+        # Best route through the region graph; recomputed only on listener
+        # region or connection tile changes, otherwise an array lookup.
+        return self._occlusion_field.occlusion(
+            game_map, listener_region_id, emitter_region_id
+        )
 
     def _ensure_sound_playing(
         self, emitter: SoundEmitter, sound_def: SoundDefinition, volume: float
@@ -577,6 +577,9 @@ def _generate_blocky(canvas: np.ndarray, size: int, rng: np.random.Generator) ->
     darken_rim(canvas, darken=(18, 18, 15))
 
 
+# Part of the sprite-cache key; bump when boulder output pixels change.
+BOULDER_SPRITE_GENERATOR_VERSION = 1
+
 # Mapping from archetype to generator function.
 _GENERATORS = {
     BoulderArchetype.ROUNDED: _generate_rounded,
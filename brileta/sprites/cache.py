@@ -0,0 +1,272 @@
+"""Content-keyed cache of generated sprites, optionally persisted to disk.
+
+Every procedural sprite family is a pure function of a small key: which
+generator ran, the archetype/preset it was asked for, the seed, the base size,
+and the generator's version. :class:`SpriteCache` memoizes generator output on
+that key so a world reload (or a late spawn of an actor generated earlier)
+skips generation entirely, and can save/load the whole table as one compressed
+file so warm startups skip it too.
+
+Entries are frame lists: trees and boulders store one frame, characters and
+critters store their full pose set. Cached arrays are shared with callers and
+must be treated as read-only.
+
+On-disk layout is a single ``.npz`` with the keys, per-entry frame counts,
+per-frame shapes, and every frame's pixels concatenated into one flat buffer.
+One flat array compresses far better and loads far faster than one npz member
+per sprite. A file that fails to parse (truncated, older format) is ignored
+with a warning and rewritten on the next save.
+"""
+
+from __future__ import annotations
+
+import hashlib
+import logging
+import zipfile
+from collections.abc import Callable, Sequence
+from pathlib import Path
+from typing import NamedTuple
+
+import numpy as np
+
+logger = logging.getLogger(__name__)
+
+# Bump when the npz layout below changes; older files are discarded on load.
+_FILE_FORMAT_VERSION = 1
+
+# Cap on cached entries. The table is ordered least- to most-recently used, so
+# going over the cap drops sprites from worlds nobody has loaded lately.
+DEFAULT_MAX_ENTRIES = 20_000
+
+
+class SpriteCacheKey(NamedTuple):
+    """Everything that determines a generated sprite's pixels."""
+
+    generator: str
+    archetype: str
+    seed: int
+    size: int
+    version: int
+
+    def encode(self) -> str:
+        """Stable string form used as the on-disk key."""
+        return (
+            f"{self.generator}|{self.archetype}|{self.seed}|{self.size}|{self.version}"
+        )
+
+    @classmethod
+    def decode(cls, text: str) -> SpriteCacheKey:
+        generator, archetype, seed, size, version = text.split("|")
+        return cls(generator, archetype, int(seed), int(size), int(version))
+
+
+def archetype_tag(value: object) -> str:
+    """Short stable tag for an archetype-like value (enum, preset, profile).
+
+    Enums use their value and named presets their name. Anything else (a
+    frozen dataclass of weights, say) is identified by a digest of its repr,
+    which is deterministic for the frozen value types used here.
+    """
+    if value is None:
+        return "default"
+    enum_value = getattr(value, "value", None)
+    if isinstance(enum_value, str):
+        return enum_value
+    name = getattr(value, "name", None)
+    if isinstance(name, str):
+        return name
+    return hashlib.blake2b(repr(value).encode(), digest_size=8).hexdigest()
+
+
+class SpriteCache:
+    """LRU-ordered memo of generated sprite frames, keyed by SpriteCacheKey.
+
+    ``path`` is where :meth:`load` and :meth:`save` read and write; None keeps
+    the cache in memory only (tests, or persistence disabled in config).
+    Storing or loading past ``max_entries`` evicts the least recently used
+    entries.
+    """
+
+    def __init__(
+        self,
+        path: Path | None = None,
+        max_entries: int = DEFAULT_MAX_ENTRIES,
+    ) -> None:
+        self.path = path
+        self.max_entries = max_entries
+        self._entries: dict[SpriteCacheKey, list[np.ndarray]] = {}
+        self._loaded = False
+        self._dirty = False
+        self.hits = 0
+        self.misses = 0
+
+    def __len__(self) -> int:
+        return len(self._entries)
+
+    def __contains__(self, key: SpriteCacheKey) -> bool:
+        return key in self._entries
+
+    @property
+    def dirty(self) -> bool:
+        """True when entries were added since the last load or save."""
+        return self._dirty
+
+    def get(self, key: SpriteCacheKey) -> list[np.ndarray] | None:
+        """Return cached frames for *key* (marking it recently used), or None."""
+        frames = self._entries.pop(key, None)
+        if frames is None:
+            self.misses += 1
+            return None
+        self._entries[key] = frames
+        self.hits += 1
+        return frames
+
+    def put(self, key: SpriteCacheKey, frames: Sequence[np.ndarray]) -> None:
+        """Store *frames* under *key* as the most recently used entry."""
+        self._entries.pop(key, None)
+        self._entries[key] = list(frames)
+        self._dirty = True
+        self._evict_over_limit()
+
+    def _evict_over_limit(self) -> None:
+        """Drop least recently used entries until at most ``max_entries`` remain."""
+        while len(self._entries) > self.max_entries:
+            del self._entries[next(iter(self._entries))]
+
+    def get_or_generate(
+        self,
+        key: SpriteCacheKey,
+        generate: Callable[[], list[np.ndarray]],
+    ) -> list[np.ndarray]:
+        """Return cached frames for *key*, generating and storing on a miss."""
+        frames = self.get(key)
+        if frames is None:
+            self.put(key, generate())
+            frames = self._entries[key]
+        return frames
+
+    def get_or_generate_many[T](
+        self,
+        keys: Sequence[SpriteCacheKey],
+        items: Sequence[T],
+        generate_misses: Callable[[list[T]], list[list[np.ndarray]]],
+    ) -> list[list[np.ndarray]]:
+        """Batch form of :meth:`get_or_generate`, preserving input order.
+
+        Looks every key up first and hands only the missing items to
+        *generate_misses* in one call, so a caller can fan the misses out to
+        ``parallel_map`` instead of paying per-item dispatch. Duplicate keys in
+        one batch are generated once.
+        """
+        results: list[list[np.ndarray] | None] = [self.get(k) for k in keys]
+        miss_index: dict[SpriteCacheKey, int] = {}
+        miss_items: list[T] = []
+        for i, frames in enumerate(results):
+            if frames is None and keys[i] not in miss_index:
+                miss_index[keys[i]] = len(miss_items)
+                miss_items.append(items[i])
+
+        if miss_items:
+            generated = generate_misses(miss_items)
+            # A batch bigger than max_entries can evict its own earlier misses,
+            # so hand back the stored lists rather than looking them up again.
+            stored: dict[SpriteCacheKey, list[np.ndarray]] = {}
+            for key, slot in miss_index.items():
+                self.put(key, generated[slot])
+                stored[key] = self._entries[key]
+            for i, frames in enumerate(results):
+                if frames is None:
+                    results[i] = stored[keys[i]]
+
+        return [frames for frames in results if frames is not None]
+
+    # ------------------------------------------------------------------
+    # Persistence
+    # ------------------------------------------------------------------
+
+    def load(self) -> None:
+        """Merge entries from :attr:`path` into the cache (once per instance).
+
+        Entries already in memory win over file entries with the same key.
+        Missing or unreadable files leave the cache as it was.
+        """
+        if self._loaded or self.path is None:
+            return
+        self._loaded = True
+        if not self.path.exists():
+            return
+
+        try:
+            with np.load(self.path, allow_pickle=False) as data:
+                if int(data["format"]) != _FILE_FORMAT_VERSION:
+                    logger.info("Ignoring sprite cache with old file format.")
+                    return
+                keys = data["keys"]
+                frame_counts = data["frame_counts"]
+                shapes = data["shapes"]
+                pixels = data["pixels"]
+        except (OSError, ValueError, KeyError, EOFError, zipfile.BadZipFile) as exc:
+            logger.warning("Ignoring unreadable sprite cache %s: %s", self.path, exc)
+            return
+
+        loaded: dict[SpriteCacheKey, list[np.ndarray]] = {}
+        frame = 0
+        offset = 0
+        for text, count in zip(keys.tolist(), frame_counts.tolist(), strict=True):
+            frames: list[np.ndarray] = []
+            for _ in range(count):
+                h, w = int(shapes[frame, 0]), int(shapes[frame, 1])
+                n = h * w * 4
+                frames.append(pixels[offset : offset + n].reshape(h, w, 4))
+                offset += n
+                frame += 1
+            loaded[SpriteCacheKey.decode(text)] = frames
+
+        # File entries are older than anything generated this session, so they
+        # go first in LRU order.
+        loaded.update(self._entries)
+        self._entries = loaded
+        self._evict_over_limit()
+        logger.debug("Loaded %d cached sprites from %s", len(loaded), self.path)
+
+    def save(self) -> None:
+        """Write the newest ``max_entries`` entries to :attr:`path` atomically.
+
+        No-op without a path or when nothing changed since the last load/save.
+        Write failures are logged, not raised: the cache is an optimization.
+        """
+        if self.path is None or not self._dirty:
+            return
+
+        # put() and load() already enforce the cap; slicing guards against a
+        # max_entries lowered after the entries were stored.
+        keep = list(self._entries.items())[-self.max_entries :]
+        keys = np.array([key.encode() for key, _ in keep], dtype=np.str_)
+        frame_counts = np.array([len(frames) for _, frames in keep], dtype=np.int32)
+        flat_frames = [px for _, frames in keep for px in frames]
+        shapes = np.array([px.shape[:2] for px in flat_frames], dtype=np.int32).reshape(
+            -1, 2
+        )
+        pixels = (
+            np.concatenate([np.ascontiguousarray(px).reshape(-1) for px in flat_frames])
+            if flat_frames
+            else np.zeros(0, dtype=np.uint8)
+        )
+
+        tmp_path = self.path.with_name(self.path.name + ".tmp")
+        try:
+            self.path.parent.mkdir(parents=True, exist_ok=True)
+            with tmp_path.open("wb") as f:
+                np.savez_compressed(
+                    f,
+                    format=np.int32(_FILE_FORMAT_VERSION),
+                    keys=keys,
+                    frame_counts=frame_counts,
+                    shapes=shapes,
+                    pixels=pixels,
+                )
+            tmp_path.replace(self.path)
+        except OSError as exc:
+            logger.warning("Could not write sprite cache %s: %s", self.path, exc)
+            return
+        self._dirty = False
@@ -12,6 +12,7 @@ from .appearance import (
     CHARACTER_FRAMES_PER_FACING,
     CHARACTER_POSE_COUNT,
     CHARACTER_POSES,
+    CHARACTER_SPRITE_GENERATOR_VERSION,
     CLOTHING_PALETTES,
     FEM_PRESENTATION,
     HAIR_PALETTES,
@@ -35,6 +36,7 @@ from .renderer import (
     CARICATURE_TEMPLATES,
     draw_character_pose,
     generate_character_pose_set,
+    generate_character_pose_sets,
     generate_character_sprite,
     roll_character_appearance,
 )
@@ -45,6 +47,7 @@ __all__ = [
     "CHARACTER_FRAMES_PER_FACING",
     "CHARACTER_POSES",
     "CHARACTER_POSE_COUNT",
+    "CHARACTER_SPRITE_GENERATOR_VERSION",
     "CLOTHING_PALETTES",
     "CLOTHING_STYLE_NAMES",
     "FEM_PRESENTATION",
@@ -65,6 +68,7 @@ __all__ = [
     "character_sprite_seed",
     "draw_character_pose",
     "generate_character_pose_set",
+    "generate_character_pose_sets",
     "generate_character_sprite",
     "roll_character_appearance",
 ]
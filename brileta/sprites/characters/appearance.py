@@ -45,6 +45,10 @@ HUMANOID_GLYPHS: frozenset[str] = frozenset({"@", "T", "B", "R"})
 
 _CHARACTER_SPRITE_SEED_SALT: SpatialSeed = 0xC4A2AC
 
+# Part of the sprite-cache key; bump when a layer change alters the pose-set
+# pixels an existing seed produces.
+CHARACTER_SPRITE_GENERATOR_VERSION = 1
+
 
 def character_sprite_seed(
     actor_id: int,
@@ -21,6 +21,7 @@ from dataclasses import dataclass
 import numpy as np
 
 from brileta.sprites.primitives import Palette3
+from brileta.util._native import sprite_render_mask as _c_render_mask
 
 # Digit -> palette tone index. '1' is the darkest ramp entry.
 _CHAR_TO_TONE: dict[str, int] = {"1": 0, "2": 1, "3": 2}
@@ -84,40 +85,24 @@ def render_mask(
     (nearest-neighbor, so the silhouette stays crisp and gap-free at any head
     radius). Opaque cells are written as fully opaque palette-toned pixels.
     ``mirror`` flips the mask horizontally for per-character variety on
-    front/back facings.
+    front/back facings. Rasterization runs natively (``sprite_render_mask``).
     """
-    rows, cols = mask.tones.shape
-    left = hx + hr * mask.x0_f
-    right = hx + hr * mask.x1_f
-    top = hy + hr * mask.y0_f
-    bottom = hy + hr * mask.y1_f
-
-    h, w = canvas.shape[:2]
-    px_start = max(0, int(np.floor(left)))
-    px_end = min(w, int(np.ceil(right)))
-    py_start = max(0, int(np.floor(top)))
-    py_end = min(h, int(np.ceil(bottom)))
-    span_x = right - left
-    span_y = bottom - top
-    if span_x <= 0 or span_y <= 0:
-        return
-
-    for py in range(py_start, py_end):
-        # +0.5 samples the pixel center so rounding is symmetric.
-        v = (py + 0.5 - top) / span_y
-        row = int(v * rows)
-        if row < 0 or row >= rows:
-            continue
-        for px in range(px_start, px_end):
-            u = (px + 0.5 - left) / span_x
-            col = int(u * cols)
-            if col < 0 or col >= cols:
-                continue
-            tone = int(mask.tones[row, cols - 1 - col if mirror else col])
-            if tone < 0:
-                continue
-            r, g, b = palette[tone]
-            canvas[py, px, 0] = r
-            canvas[py, px, 1] = g
-            canvas[py, px, 2] = b
-            canvas[py, px, 3] = 255
+    (r0, g0, b0), (r1, g1, b1), (r2, g2, b2) = palette
+    _c_render_mask(
+        canvas,
+        mask.tones,
+        hx + hr * mask.x0_f,
+        hy + hr * mask.y0_f,
+        hx + hr * mask.x1_f,
+        hy + hr * mask.y1_f,
+        mirror,
+        r0,
+        g0,
+        b0,
+        r1,
+        g1,
+        b1,
+        r2,
+        g2,
+        b2,
+    )
@@ -2,13 +2,16 @@
 
 from __future__ import annotations
 
-from collections.abc import Callable
+from collections.abc import Callable, Sequence
 from dataclasses import dataclass
 
 import numpy as np
 
-from brileta.sprites.primitives import darken_rim
+from brileta.sprites.primitives import finish_pose
 from brileta.types import Facing
+from brileta.util._native import (
+    sprite_draw_character_poses as _c_draw_character_poses,
+)
 
 from .appearance import (
     CHARACTER_POSES,
@@ -28,8 +31,20 @@ from .body import (
     _layer_legs,
     _layer_neck,
 )
-from .clothing import _layer_collar, _layer_torso
-from .hair import _layer_hair
+from .clothing import (
+    CLOTHING_STYLE_NAMES,
+    ClothingDrawFn,
+    _draw_armor_torso,
+    _draw_bare_torso,
+    _draw_robe_torso,
+    _draw_shirt_torso,
+    _layer_collar,
+    _layer_torso,
+)
+from .clothing_masks import COLLAR_MASKS
+from .hair import HAIR_IDX_LONG, HAIR_IDX_TALL, HAIR_STYLES, _layer_hair
+from .hair_masks import MASK_SETS
+from .masks import PixelMask
 
 
 @dataclass(frozen=True)
@@ -148,20 +163,26 @@ def roll_character_appearance(
     )
 
 
-def _render_pose(appearance: CharacterAppearance, pose: Pose) -> np.ndarray:
-    """Render one pose from a rolled appearance."""
+def _render_pose_reference(appearance: CharacterAppearance, pose: Pose) -> np.ndarray:
+    """Render one pose through the Python layer pipeline.
+
+    This is the reference the native compositor (``_render_pose_sets``) must
+    match pixel for pixel; sprite generation itself goes through the native path.
+    """
     canvas_size = appearance.body_params.canvas_size
     canvas = np.zeros((canvas_size, canvas_size, 4), dtype=np.uint8)
     _draw_character(canvas, appearance, pose)
     # Snap the soft anti-aliased silhouette to a hard 1-bit edge. Every layer
     # stamps with alpha falloff, which leaves a mushy computed-looking rim; a
     # clean opaque/transparent cut is what reads as deliberate pixel art.
-    _harden_alpha(canvas)
     # Side profile drawing is authored left-facing. Materialize EAST-facing
     # sprites by mirroring here so runtime only needs UV selection.
-    if pose.facing is Facing.EAST:
-        canvas = np.ascontiguousarray(canvas[:, ::-1, :])
-    darken_rim(canvas, (35, 35, 25))
+    finish_pose(
+        canvas,
+        _ALPHA_SNAP_THRESHOLD,
+        _RIM_DARKEN,
+        mirror=pose.facing is Facing.EAST,
+    )
     return canvas
 
 
@@ -169,12 +190,194 @@ def _render_pose(appearance: CharacterAppearance, pose: Pose) -> np.ndarray:
 # transparent. Chosen just under the faint-overlay band (~145) so intentional
 # semi-transparent shading strokes survive as solid pixels.
 _ALPHA_SNAP_THRESHOLD: int = 110
+_RIM_DARKEN: tuple[int, int, int] = (35, 35, 25)
 
 
-def _harden_alpha(canvas: np.ndarray) -> None:
-    """Binarize the alpha channel in-place for crisp pixel-art edges."""
-    alpha = canvas[:, :, 3]
-    canvas[:, :, 3] = np.where(alpha >= _ALPHA_SNAP_THRESHOLD, 255, 0).astype(np.uint8)
+# ---------------------------------------------------------------------------
+# Native compositor packing
+# ---------------------------------------------------------------------------
+#
+# ``sprite_draw_character_poses`` runs the same layer pipeline as
+# ``_draw_character`` in C. Appearances, poses and pixel masks are flattened
+# into float64 records whose field order must match the enums in
+# ``_native_sprites.c``.
+
+_NATIVE_MASK_KEYS: tuple[str, ...] = ("north", "side", "south")
+_NATIVE_NO_MASKS: tuple[int, int, int] = (-1, -1, -1)
+_NATIVE_FACINGS: dict[Facing, int] = {
+    Facing.SOUTH: 0,
+    Facing.NORTH: 1,
+    Facing.EAST: 2,
+    Facing.WEST: 3,
+}
+_NATIVE_TORSO_KINDS: dict[ClothingDrawFn, int] = {
+    _draw_bare_torso: 0,
+    _draw_shirt_torso: 1,
+    _draw_armor_torso: 2,
+    _draw_robe_torso: 3,
+}
+_NATIVE_COLLAR_KINDS: dict[str, int] = {"shirt": 0, "armor": 1, "robe": 2}
+_NATIVE_APPEARANCE_RECORD_LEN = 76
+
+# The native hair layer stamps every non-bald style from its mask set and draws
+# only the bald overlays otherwise, so each non-bald style needs masks.
+assert set(MASK_SETS) == set(range(1, len(HAIR_STYLES)))
+assert set(_NATIVE_COLLAR_KINDS) == set(COLLAR_MASKS)
+
+
+def _pack_native_masks(
+    mask_sets: Sequence[dict[str, PixelMask]],
+) -> tuple[np.ndarray, np.ndarray, list[tuple[int, int, int]]]:
+    """Flatten mask sets into one tone buffer plus per-mask placement records.
+
+    Returns the concatenated int8 tones, a ``(n_masks, 7)`` float64 array of
+    ``(offset, rows, cols, x0_f, y0_f, x1_f, y1_f)`` and, per mask set, its
+    north/side/south slot indices into that array.
+    """
+    tones: list[np.ndarray] = []
+    boxes: list[tuple[float, ...]] = []
+    slots: list[tuple[int, int, int]] = []
+    offset = 0
+    for mask_set in mask_sets:
+        set_slots: list[int] = []
+        for key in _NATIVE_MASK_KEYS:
+            mask = mask_set[key]
+            rows, cols = mask.tones.shape
+            set_slots.append(len(boxes))
+            boxes.append(
+                (offset, rows, cols, mask.x0_f, mask.y0_f, mask.x1_f, mask.y1_f)
+            )
+            tones.append(mask.tones.ravel())
+            offset += rows * cols
+        slots.append((set_slots[0], set_slots[1], set_slots[2]))
+    return (
+        np.ascontiguousarray(np.concatenate(tones), dtype=np.int8),
+        np.array(boxes, dtype=np.float64),
+        slots,
+    )
+
+
+_NATIVE_MASK_TONES, _NATIVE_MASK_BOXES, _native_mask_slots = _pack_native_masks(
+    [*MASK_SETS.values(), *COLLAR_MASKS.values()]
+)
+_NATIVE_HAIR_MASK_SLOTS: dict[int, tuple[int, int, int]] = dict(
+    zip(MASK_SETS, _native_mask_slots[: len(MASK_SETS)], strict=True)
+)
+_NATIVE_COLLAR_MASK_SLOTS: dict[str, tuple[int, int, int]] = dict(
+    zip(COLLAR_MASKS, _native_mask_slots[len(MASK_SETS) :], strict=True)
+)
+
+
+def _native_appearance_record(appearance: CharacterAppearance) -> list[float]:
+    """Flatten one appearance into the native compositor's record layout."""
+    params = appearance.body_params
+    collar_name = CLOTHING_STYLE_NAMES[appearance.clothing_style_idx]
+    record = [
+        params.canvas_size,
+        params.head_radius,
+        params.head_top_pad,
+        params.torso_rx,
+        params.torso_ry,
+        params.torso_cy_factor,
+        params.belly_rx,
+        params.belly_ry,
+        params.belly_cy_offset,
+        params.shoulder_width,
+        params.arm_thickness,
+        params.leg_spacing,
+        params.leg_w1,
+        params.leg_w2,
+        params.neck_rx,
+        params.neck_ry,
+        params.neck_gap,
+        params.hand_radius,
+        params.arm_shoulder_factor,
+        params.arm_end_torso_factor,
+        params.arm_end_belly_factor,
+        params.arm_shoulder_anchor_torso_factor,
+        params.arm_shoulder_anchor_shoulder_width_factor,
+        params.arm_hand_inset,
+        params.arm_hand_drop,
+        params.arm_hand_alpha,
+        params.neck_y_offset,
+        params.arm_end_from_belly,
+        params.leg_from_torso,
+        _NATIVE_TORSO_KINDS[appearance.clothing_fn],
+        _NATIVE_COLLAR_KINDS.get(collar_name, -1),
+        appearance.covers_legs,
+        appearance.hair_style_idx == HAIR_IDX_LONG,
+        appearance.hair_style_idx == HAIR_IDX_TALL,
+        *_NATIVE_HAIR_MASK_SLOTS.get(appearance.hair_style_idx, _NATIVE_NO_MASKS),
+        *_NATIVE_COLLAR_MASK_SLOTS.get(collar_name, _NATIVE_NO_MASKS),
+    ]
+    for palette in (
+        appearance.skin_pal,
+        appearance.hair_pal,
+        appearance.cloth_pal,
+        appearance.pants_pal,
+    ):
+        for rgb in palette:
+            record.extend(rgb)
+    return record
+
+
+def _native_pose_record(pose: Pose) -> tuple[float, ...]:
+    """Flatten one pose into the native compositor's record layout."""
+    return (
+        _NATIVE_FACINGS[pose.facing],
+        pose.left_leg_dx,
+        pose.left_leg_dy,
+        pose.right_leg_dx,
+        pose.right_leg_dy,
+        pose.left_arm_dy,
+        pose.right_arm_dy,
+        pose.body_dy,
+    )
+
+
+def _render_pose_sets(
+    appearances: Sequence[CharacterAppearance],
+    poses: Sequence[Pose],
+) -> list[np.ndarray]:
+    """Render every pose of every appearance in one native call.
+
+    Returns one ``(len(poses), S, S, 4)`` array per appearance, where ``S`` is
+    that appearance's canvas size. Pixels match ``_render_pose_reference``.
+    """
+    canvases = [
+        np.empty(
+            (
+                len(poses),
+                appearance.body_params.canvas_size,
+                appearance.body_params.canvas_size,
+                4,
+            ),
+            dtype=np.uint8,
+        )
+        for appearance in appearances
+    ]
+    records = np.array(
+        [_native_appearance_record(appearance) for appearance in appearances],
+        dtype=np.float64,
+    ).reshape(len(appearances), _NATIVE_APPEARANCE_RECORD_LEN)
+    pose_records = np.array(
+        [_native_pose_record(pose) for pose in poses], dtype=np.float64
+    ).reshape(len(poses), 8)
+    _c_draw_character_poses(
+        canvases,
+        records,
+        pose_records,
+        _NATIVE_MASK_TONES,
+        _NATIVE_MASK_BOXES,
+        _ALPHA_SNAP_THRESHOLD,
+        *_RIM_DARKEN,
+    )
+    return canvases
+
+
+def _render_pose(appearance: CharacterAppearance, pose: Pose) -> np.ndarray:
+    """Render one pose from a rolled appearance."""
+    return _render_pose_sets([appearance], [pose])[0][0]
 
 
 def draw_character_pose(appearance: CharacterAppearance, pose: Pose) -> np.ndarray:
@@ -216,7 +419,31 @@ def generate_character_pose_set(
         size,
         presentation_profile=presentation_profile,
     )
-    return [_render_pose(appearance, pose) for pose in CHARACTER_POSES]
+    return list(_render_pose_sets([appearance], CHARACTER_POSES)[0])
+
+
+def generate_character_pose_sets(
+    seeds: Sequence[int],
+    size: int = 20,
+    *,
+    presentation_profiles: Sequence[CharacterPresentationProfile | None] | None = None,
+) -> list[list[np.ndarray]]:
+    """Generate full pose sets for a batch of seeds in one call.
+
+    Equivalent to calling :func:`generate_character_pose_set` per seed (same
+    pixels, same order), but composites every pose of every seed in a single
+    native call with the GIL released.
+    """
+    profiles = (
+        list(presentation_profiles)
+        if presentation_profiles is not None
+        else [None] * len(seeds)
+    )
+    appearances = [
+        roll_character_appearance(seed, size, presentation_profile=profile)
+        for seed, profile in zip(seeds, profiles, strict=True)
+    ]
+    return [list(poses) for poses in _render_pose_sets(appearances, CHARACTER_POSES)]
 
 
 def generate_character_sprite(seed: int, size: int = 20) -> np.ndarray:
@@ -39,6 +39,9 @@ from brileta.util._native import (
 from brileta.util._native import (
     sprite_fill_triangle as _c_fill_triangle,
 )
+from brileta.util._native import (
+    sprite_finish_pose as _c_finish_pose,
+)
 from brileta.util._native import (
     sprite_generate_deciduous_canopy as _c_generate_deciduous_canopy,
 )
@@ -71,6 +74,7 @@ __all__ = [
     "draw_tapered_trunk",
     "draw_thick_line",
     "fill_triangle",
+    "finish_pose",
     "generate_deciduous_canopy",
     "nibble_boulder",
     "nibble_canopy",
@@ -582,6 +586,23 @@ def darken_rim(
     _c_darken_rim(canvas, darken[0], darken[1], darken[2])
 
 
+def finish_pose(
+    canvas: np.ndarray,
+    alpha_threshold: int,
+    darken: tuple[int, int, int],
+    *,
+    mirror: bool = False,
+) -> None:
+    """Finish one freshly drawn pose canvas in-place.
+
+    Snaps alpha to a hard 1-bit edge (``>= alpha_threshold`` becomes opaque,
+    everything else transparent), mirrors horizontally when *mirror* is set,
+    then applies :func:`darken_rim` with *darken*. One native pass instead of
+    three numpy passes and a mirrored copy.
+    """
+    _c_finish_pose(canvas, alpha_threshold, mirror, darken[0], darken[1], darken[2])
+
+
 def nibble_canopy(
     canvas: np.ndarray,
     seed: int,
@@ -27,7 +27,7 @@ cycle; no per-layer animation system is needed. SIT/LIE are likewise just new
 from __future__ import annotations
 
 import enum
-from collections.abc import Callable
+from collections.abc import Callable, Sequence
 from dataclasses import dataclass
 
 import numpy as np
@@ -37,9 +37,9 @@ from brileta.sprites.characters.appearance import _hue_shift_ramp
 from brileta.sprites.primitives import (
     Palette3,
     PaletteBrush,
-    darken_rim,
     draw_thick_line,
     fill_triangle,
+    finish_pose,
     stamp_ellipse,
     stamp_fuzzy_circle,
 )
@@ -52,6 +52,10 @@ from brileta.util import rng as brileta_rng
 
 _QUADRUPED_SPRITE_SEED_SALT: SpatialSeed = 0xD09B17
 
+# Part of the sprite-cache key; bump when a drawing change alters the pose-set
+# pixels an existing seed produces.
+QUADRUPED_SPRITE_GENERATOR_VERSION = 1
+
 
 def quadruped_sprite_seed(
     actor_id: int,
@@ -921,22 +925,18 @@ def _draw_quadruped(
 _ALPHA_SNAP_THRESHOLD: int = 110
 
 
-def _harden_alpha(canvas: np.ndarray) -> None:
-    """Binarize the alpha channel in-place for crisp pixel-art edges."""
-    alpha = canvas[:, :, 3]
-    canvas[:, :, 3] = np.where(alpha >= _ALPHA_SNAP_THRESHOLD, 255, 0).astype(np.uint8)
-
-
 def _render_pose(appearance: QuadrupedAppearance, pose: QuadrupedPose) -> np.ndarray:
     """Render one pose from a rolled appearance."""
     size = appearance.params.canvas_size
     canvas = np.zeros((size, size, 4), dtype=np.uint8)
     _draw_quadruped(canvas, appearance.params, pose)
-    _harden_alpha(canvas)
     # Side profiles are authored WEST-facing; EAST is a horizontal mirror.
-    if pose.facing is Facing.EAST:
-        canvas = np.ascontiguousarray(canvas[:, ::-1, :])
-    darken_rim(canvas, (30, 28, 20))
+    finish_pose(
+        canvas,
+        _ALPHA_SNAP_THRESHOLD,
+        (30, 28, 20),
+        mirror=pose.facing is Facing.EAST,
+    )
     return canvas
 
 
@@ -971,12 +971,30 @@ def generate_quadruped_pose_set(
     return [_render_pose(appearance, pose) for pose in QUADRUPED_POSES]
 
 
+def generate_quadruped_pose_sets(
+    seeds: Sequence[int],
+    presets: Sequence[QuadrupedPreset],
+    size: int = 20,
+) -> list[list[np.ndarray]]:
+    """Generate full pose sets for a batch of (seed, preset) pairs in one call.
+
+    Same pixels and order as calling :func:`generate_quadruped_pose_set` per
+    pair, fanned out through ``parallel_map``.
+    """
+    from brileta.util.parallel import parallel_map
+
+    return parallel_map(
+        generate_quadruped_pose_set, list(seeds), list(presets), [size] * len(seeds)
+    )
+
+
 __all__ = [
     "DOG_PRESET",
     "QUADRUPED_DIRECTIONAL_POSE_COUNT",
     "QUADRUPED_FRAMES_PER_FACING",
     "QUADRUPED_POSES",
     "QUADRUPED_POSE_COUNT",
+    "QUADRUPED_SPRITE_GENERATOR_VERSION",
     "CoatPattern",
     "EarKind",
     "QuadrupedAppearance",
@@ -987,6 +1005,7 @@ __all__ = [
     "TailKind",
     "draw_quadruped_pose",
     "generate_quadruped_pose_set",
+    "generate_quadruped_pose_sets",
     "quadruped_sprite_seed",
     "roll_quadruped_appearance",
 ]
@@ -635,6 +635,10 @@ def _generate_sapling(canvas: np.ndarray, size: int, rng: np.random.Generator) -
 _TREE_SPRITE_SEED_SALT: SpatialSeed = 0x5CEAE
 _HEIGHT_JITTER_SALT: SpatialSeed = 0x48544A54
 
+# Bump whenever a generator change alters the pixels an existing seed produces,
+# so persisted sprite-cache entries from the old generator stop matching.
+TREE_SPRITE_GENERATOR_VERSION = 1
+
 # Mapping from archetype to generator function.
 _GENERATORS = {
     TreeArchetype.DECIDUOUS: _generate_deciduous,
@@ -1,5 +1,6 @@
 """Testing utilities for driving Brileta headlessly (no window, no GPU)."""
 
+from brileta.testing.replay import ReplayDivergence, ReplayResult, replay_session
 from brileta.testing.sim_harness import SimHarness
 
-__all__ = ["SimHarness"]
+__all__ = ["ReplayDivergence", "ReplayResult", "SimHarness", "replay_session"]
@@ -0,0 +1,163 @@
+"""Headless replay of recorded play sessions.
+
+:func:`replay_session` boots a :class:`~brileta.testing.SimHarness` from a
+:class:`~brileta.game.session_recording.SessionRecording` and re-drives it
+frame by frame: execute the frame's recorded player actions through
+``Controller._execute_player_action_immediately()``, then run
+``update_logic_step()`` once per recorded logic step. Player input is not
+regenerated (no held keys, no autopilot), since the recorded actions
+already are its result. After every step the
+world is reduced to a :class:`~brileta.game.session_recording.StateHasher`
+digest and checked against the recording's ``tick_hashes``; the first
+mismatch raises :class:`ReplayDivergence` naming the tick.
+
+Like the harness pump, presentation timing is cleared before each step, so
+autopilot and NPC reactions advance per step instead of per wall-clock
+``duration_ms``. A replay is therefore deterministic, but not a bit-exact
+copy of the live run it was recorded from; ``tick_hashes`` are blessed from
+a replay (see ``scripts/benchmark_replay.py --bless``).
+
+Every ``time.*`` metric recorded during the replay is collected into
+:attr:`ReplayResult.phase_timings`, which makes a long recorded session a
+repeatable per-phase performance benchmark as well as a correctness test.
+"""
+
+from __future__ import annotations
+
+from dataclasses import dataclass, field
+from time import perf_counter
+
+import numpy as np
+
+from brileta.game.session_recording import (
+    SessionRecording,
+    StateHasher,
+    decode_intent,
+)
+from brileta.testing.sim_harness import SimHarness
+from brileta.util.live_vars import live_variable_registry
+
+# Timing name for the once-per-frame player input phase, which has no
+# registered metric of its own.
+_INPUT_PHASE = "replay.input_ms"
+
+
+class ReplayDivergence(AssertionError):
+    """A replayed tick's state hash differs from the recorded one."""
+
+    def __init__(self, tick: int, frame: int, expected: str, actual: str) -> None:
+        super().__init__(
+            f"Replay diverged at tick {tick} (frame {frame}): "
+            f"expected {expected}, got {actual}"
+        )
+        self.tick = tick
+        self.frame = frame
+        self.expected = expected
+        self.actual = actual
+
+
+@dataclass(frozen=True)
+class PhaseTiming:
+    """Summary of one timed phase across a whole replay."""
+
+    samples: int
+    total_ms: float
+    mean_ms: float
+    p95_ms: float
+
+    @classmethod
+    def from_samples(cls, samples: list[float]) -> PhaseTiming:
+        values = np.asarray(samples, dtype=np.float64)
+        return cls(
+            samples=len(values),
+            total_ms=float(values.sum()),
+            mean_ms=float(values.mean()),
+            p95_ms=float(np.percentile(values, 95)),
+        )
+
+
+@dataclass
+class ReplayResult:
+    """Outcome of :func:`replay_session`."""
+
+    tick_hashes: list[str]
+    frames: int
+    wall_ms: float
+    phase_timings: dict[str, PhaseTiming] = field(default_factory=dict)
+
+
+def replay_session(recording: SessionRecording, *, verify: bool = True) -> ReplayResult:
+    """Replay ``recording`` headlessly and return its hashes and phase timings.
+
+    Args:
+        recording: The session to replay.
+        verify: Check each tick against ``recording.tick_hashes``. Ticks beyond
+            the recorded hashes are not checked, so a recording without hashes
+            replays unverified.
+
+    Raises:
+        ReplayDivergence: At the first tick whose state hash differs.
+        ValueError: If the recording is marked unreplayable.
+    """
+    if recording.unreplayable is not None:
+        raise ValueError(f"Session cannot be replayed: {recording.unreplayable}")
+    # The replay's controller registers its own live variables; isolate them
+    # so replays can run back to back or beside a live controller.
+    with live_variable_registry.isolated_registrations():
+        return _replay(recording, verify)
+
+
+def _replay(recording: SessionRecording, verify: bool) -> ReplayResult:
+    harness = SimHarness(seed=recording.seed, map_size=recording.map_size)
+    controller = harness.controller
+    turn_manager = controller.turn_manager
+    hasher = StateHasher()
+    expected = recording.tick_hashes if verify else []
+    hashes: list[str] = []
+    input_samples: list[float] = []
+
+    start = perf_counter()
+    with live_variable_registry.capture_metrics() as samples:
+        for frame_index, frame in enumerate(recording.frames):
+            if frame.new_world_seed is not None:
+                # The headless frame manager can't regenerate in place, so a
+                # recorded new_world() reboots the harness on the new seed.
+                harness = SimHarness(
+                    seed=frame.new_world_seed, map_size=recording.map_size
+                )
+                controller = harness.controller
+                turn_manager = controller.turn_manager
+            controller.paused = frame.paused
+
+            turn_manager.clear_presentation_timing()
+            input_start = perf_counter()
+            for data in frame.intents:
+                if data is None:
+                    controller._pass_player_turn()
+                else:
+                    controller._execute_player_action_immediately(
+                        decode_intent(data, controller)
+                    )
+            input_samples.append((perf_counter() - input_start) * 1000)
+
+            for _ in range(frame.logic_steps):
+                turn_manager.clear_presentation_timing()
+                controller.update_logic_step()
+                tick = len(hashes)
+                digest = hasher(controller)
+                hashes.append(digest)
+                if tick < len(expected) and expected[tick] != digest:
+                    raise ReplayDivergence(tick, frame_index, expected[tick], digest)
+    wall_ms = (perf_counter() - start) * 1000
+
+    samples[_INPUT_PHASE] = input_samples
+    return ReplayResult(
+        tick_hashes=hashes,
+        frames=len(recording.frames),
+        wall_ms=wall_ms,
+        phase_timings={
+            name: PhaseTiming.from_samples(values)
+            for name, values in sorted(samples.items())
+            if values
+        },
+    )
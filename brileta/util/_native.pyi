@@ -43,6 +43,24 @@ class _NoiseState:
         self, x: float, y: float, z: float
     ) -> tuple[float, float, float]: ...
 
+class IncrementalPlanner:
+    target: tuple[int, int]
+    distance: int
+    expansions: int
+    def __init__(
+        self,
+        cost: object,
+        start_x: int,
+        start_y: int,
+        target_x: int,
+        target_y: int,
+        distance: int = 0,
+    ) -> None: ...
+    def set_start(self, x: int, y: int) -> None: ...
+    def update_costs(self, updates: object) -> int: ...
+    def compute_path(self) -> list[tuple[int, int]]: ...
+    def get_cost(self, x: int, y: int) -> int: ...
+
 class WFCContradictionError(Exception): ...
 
 def astar(
@@ -52,6 +70,20 @@ def astar(
     goal_x: int,
     goal_y: int,
 ) -> list[tuple[int, int]]: ...
+def astar_within(
+    cost: object,
+    start_x: int,
+    start_y: int,
+    target_x: int,
+    target_y: int,
+    distance: int,
+) -> list[tuple[int, int]]: ...
+def astar_goals(
+    cost: object,
+    start_x: int,
+    start_y: int,
+    goals: object,
+) -> list[tuple[int, int]]: ...
 def fov(
     transparent: object,
     visible: object,
@@ -233,6 +265,43 @@ def sprite_nibble_boulder(
     seed: int,
     nibble_prob: float,
 ) -> None: ...
+def sprite_render_mask(
+    canvas: object,
+    tones: object,
+    left: float,
+    top: float,
+    right: float,
+    bottom: float,
+    mirror: bool,
+    r0: int,
+    g0: int,
+    b0: int,
+    r1: int,
+    g1: int,
+    b1: int,
+    r2: int,
+    g2: int,
+    b2: int,
+) -> None: ...
+def sprite_finish_pose(
+    canvas: object,
+    alpha_threshold: int,
+    mirror: bool,
+    darken_r: int,
+    darken_g: int,
+    darken_b: int,
+) -> None: ...
+def sprite_draw_character_poses(
+    canvases: object,
+    appearances: object,
+    poses: object,
+    mask_tones: object,
+    mask_boxes: object,
+    alpha_threshold: int,
+    darken_r: int,
+    darken_g: int,
+    darken_b: int,
+) -> None: ...
 
 # Glyph vertex encoding (from _native_glyph_vertices.c)
 
@@ -244,3 +313,168 @@ def build_glyph_vertices(
     tile_w: float,
     tile_h: float,
 ) -> int: ...
+
+# Sprite atlas batch packing (from _native_atlas.c)
+
+def atlas_pack_blit(
+    sprites: object,
+    order: object,
+    atlas: object,
+    cursor: object,
+    positions: object,
+    padding: int,
+) -> int: ...
+
+# Screen-renderer quad vertex writers (from _native_quad_vertices.c)
+
+def write_quad_batch(
+    out: object,
+    x: object,
+    y: object,
+    w: object,
+    h: object,
+    uv_coords: object,
+    colors: object,
+    world_pos: object | None,
+    actor_light_scale: object | None,
+    flags: object | None,
+    tile_bg: object | None,
+) -> int: ...
+def write_parallelogram_batch(
+    out: object,
+    corners: object,
+    uv_coords: object,
+    base_colors: object,
+    tip_colors: object,
+    flags: object,
+    vertex_colors: object | None,
+) -> int: ...
+def write_glyph_shadow_batch(
+    out: object,
+    uv_coords: object,
+    screen_x: object,
+    screen_y: object,
+    lengths: object,
+    dir_x: float,
+    dir_y: float,
+    tile_w: float,
+    tile_h: float,
+    scale_x: float,
+    scale_y: float,
+    alpha: float,
+    fade_tip: bool,
+    horizontal_threshold: float,
+) -> int: ...
+
+# Terrain edge-transition metadata (from _native_edges.c)
+
+def edge_transition_fill(
+    tiles: object,
+    bg_rgb: object,
+    drawn: object | None,
+    blend_lut: object,
+    hard_lut: object,
+    darken_lut: object,
+    out_mask: object,
+    out_bg: object,
+    x1: int,
+    y1: int,
+    x2: int,
+    y2: int,
+) -> None: ...
+
+# Projected shadow clipping and receiver dimming (from _native_shadows.c)
+
+def clip_shadow_lengths(
+    shadow_heights: object,
+    tile_x: object,
+    tile_y: object,
+    lengths: object,
+    dir_x: float,
+    dir_y: float,
+) -> None: ...
+def accumulate_shadow_dimming(
+    shadows: object,
+    self_index: object,
+    receivers: object,
+    scales: object,
+    fade_tip: bool,
+) -> None: ...
+
+# Bresenham line-of-sight queries (from _native_los.c)
+
+def line_of_sight(
+    transparent: object,
+    x0: int,
+    y0: int,
+    x1: int,
+    y1: int,
+) -> bool: ...
+def los_mask(
+    transparent: object,
+    origin_x: int,
+    origin_y: int,
+    box_x: int,
+    box_y: int,
+    out: object,
+) -> None: ...
+def los_batch(
+    transparent: object,
+    src_x: object,
+    src_y: object,
+    dst_x: object,
+    dst_y: object,
+    out: object,
+) -> None: ...
+
+# Terrain tile animation random walk (from _native_tile_animation.c)
+
+def tile_animation_walk(
+    visible: object,
+    animates: object,
+    fg_values: object,
+    bg_values: object,
+    left: int,
+    top: int,
+    right: int,
+    bottom: int,
+    percent: int,
+    step: int,
+    seed: int,
+) -> int: ...
+
+# Fused tile-property lookup (from _native_tile_properties.c)
+
+def tile_property_fill(
+    tiles: object,
+    lut: object,
+    outputs: list[tuple[object, int]],
+    x1: int,
+    y1: int,
+    x2: int,
+    y2: int,
+) -> None: ...
+
+# Per-tile terrain decoration (from _native_terrain_decoration.c)
+
+def terrain_decoration(
+    chars: object,
+    fg_rgb: object,
+    bg_rgb: object,
+    tile_ids: object,
+    world_x: object,
+    world_y: object,
+    pool_table: object,
+    pool_glyphs: object,
+    seed: int,
+) -> None: ...
+
+# Region-graph traversals (from _native_region_graph.c)
+
+def region_max_product(
+    offsets: object,
+    neighbors: object,
+    factors: object,
+    source: int,
+    out: object,
+) -> None: ...
@@ -1,6 +1,6 @@
 from __future__ import annotations
 
-from collections.abc import Callable, Sequence
+from collections.abc import Callable, Iterator, Sequence
 from contextlib import contextmanager, nullcontext, suppress
 from dataclasses import dataclass
 from time import perf_counter
@@ -93,6 +93,11 @@ class LiveVariableRegistry:
         self._variables: dict[str, LiveVariable] = {}
         self._watched_variables: set[str] = set()
         self.strict: bool = True
+        # Open capture_metrics() blocks, each collecting every sample by name.
+        self._metric_captures: list[dict[str, list[float]]] = []
+        # Open isolated_registrations() blocks; while any is open, register()
+        # may replace an existing variable.
+        self._isolation_depth = 0
 
     def register(
         self,
@@ -108,7 +113,7 @@ class LiveVariableRegistry:
         value_range: FloatRange | None = None,
     ) -> None:
         """Register a new live variable."""
-        if name in self._variables:
+        if name in self._variables and not self._isolation_depth:
             raise ValueError(f"Live variable '{name}' already registered")
         self._variables[name] = LiveVariable(
             name=name,
@@ -196,6 +201,9 @@ class LiveVariableRegistry:
         Raises:
             KeyError: If the metric name is not registered or has no stats tracker.
         """
+        # Captures see every sample, even for metrics a test fixture cleared.
+        for capture in self._metric_captures:
+            capture.setdefault(name, []).append(value)
         var = self.get_variable(name)
         if var is None:
             raise KeyError(f"Metric '{name}' is not registered")
@@ -203,6 +211,40 @@ class LiveVariableRegistry:
             raise KeyError(f"Variable '{name}' is not a metric (has no stats tracker)")
         var.record_value(value)
 
+    @contextmanager
+    def capture_metrics(self) -> Iterator[dict[str, list[float]]]:
+        """Collect every metric sample recorded inside the block, by name.
+
+        Unlike the per-metric stats, which keep only the last few samples, a
+        capture keeps all of them, so a replay can report whole-run timings.
+        """
+        samples: dict[str, list[float]] = {}
+        self._metric_captures.append(samples)
+        try:
+            yield samples
+        finally:
+            self._metric_captures.remove(samples)
+
+    @contextmanager
+    def isolated_registrations(self) -> Iterator[None]:
+        """Let the block's registrations shadow existing ones, then drop them.
+
+        For booting a throwaway ``Controller`` (a headless replay) while
+        another one's per-instance variables are still registered. On exit the
+        registry and its watch list are restored to their state on entry.
+        """
+        saved_variables = dict(self._variables)
+        saved_watched = set(self._watched_variables)
+        self._isolation_depth += 1
+        try:
+            yield
+        finally:
+            self._isolation_depth -= 1
+            self._variables.clear()
+            self._variables.update(saved_variables)
+            self._watched_variables.clear()
+            self._watched_variables.update(saved_watched)
+
     # ------------------------------------------------------------------
     # Watch Management
     # ------------------------------------------------------------------
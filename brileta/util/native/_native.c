@@ -11,6 +11,8 @@
 
 /* Pathfinding entry points provided by _native_pathfinding.c. */
 PyObject *brileta_native_astar(PyObject *self, PyObject *args);
+PyObject *brileta_native_astar_within(PyObject *self, PyObject *args);
+PyObject *brileta_native_astar_goals(PyObject *self, PyObject *args);
 /* FOV entry point provided by _native_fov.c. */
 PyObject *brileta_native_fov(PyObject *self, PyObject *args);
 /* WFC entry point provided by _native_wfc.c. */
@@ -21,6 +23,8 @@ void brileta_native_init_popcount_table(void);
 int brileta_native_init_noise_type(PyObject *module);
 /* SpatialHashGrid type registration provided by _native_spatial.c. */
 int brileta_native_init_spatial_type(PyObject *module);
+/* IncrementalPlanner type registration provided by _native_path_repair.c. */
+int brileta_native_init_path_repair_type(PyObject *module);
 
 /* Sprite drawing primitives provided by _native_sprites.c. */
 PyObject *brileta_native_sprite_alpha_blend(PyObject *self, PyObject *args);
@@ -38,8 +42,34 @@ PyObject *brileta_native_sprite_paste_sprite(PyObject *self, PyObject *args);
 PyObject *brileta_native_sprite_darken_rim(PyObject *self, PyObject *args);
 PyObject *brileta_native_sprite_nibble_canopy(PyObject *self, PyObject *args);
 PyObject *brileta_native_sprite_nibble_boulder(PyObject *self, PyObject *args);
+PyObject *brileta_native_sprite_render_mask(PyObject *self, PyObject *args);
+PyObject *brileta_native_sprite_finish_pose(PyObject *self, PyObject *args);
+PyObject *brileta_native_sprite_draw_character_poses(PyObject *self, PyObject *args);
 /* Glyph vertex encoding provided by _native_glyph_vertices.c. */
 PyObject *brileta_native_build_glyph_vertices(PyObject *self, PyObject *args);
+/* Sprite atlas batch packing provided by _native_atlas.c. */
+PyObject *brileta_native_atlas_pack_blit(PyObject *self, PyObject *args);
+/* Screen-renderer quad vertex writers provided by _native_quad_vertices.c. */
+PyObject *brileta_native_write_quad_batch(PyObject *self, PyObject *args);
+PyObject *brileta_native_write_parallelogram_batch(PyObject *self, PyObject *args);
+PyObject *brileta_native_write_glyph_shadow_batch(PyObject *self, PyObject *args);
+/* Terrain edge-transition metadata provided by _native_edges.c. */
+PyObject *brileta_native_edge_transition_fill(PyObject *self, PyObject *args);
+/* Projected shadow wall clipping provided by _native_shadows.c. */
+PyObject *brileta_native_clip_shadow_lengths(PyObject *self, PyObject *args);
+PyObject *brileta_native_accumulate_shadow_dimming(PyObject *self, PyObject *args);
+/* Bresenham line-of-sight queries provided by _native_los.c. */
+PyObject *brileta_native_line_of_sight(PyObject *self, PyObject *args);
+PyObject *brileta_native_los_mask(PyObject *self, PyObject *args);
+PyObject *brileta_native_los_batch(PyObject *self, PyObject *args);
+/* Terrain tile animation random walk provided by _native_tile_animation.c. */
+PyObject *brileta_native_tile_animation_walk(PyObject *self, PyObject *args);
+/* Fused tile-property lookup provided by _native_tile_properties.c. */
+PyObject *brileta_native_tile_property_fill(PyObject *self, PyObject *args);
+/* Per-tile terrain glyph and color decoration provided by _native_terrain_decoration.c. */
+PyObject *brileta_native_terrain_decoration(PyObject *self, PyObject *args);
+/* Max-product region-graph Dijkstra provided by _native_region_graph.c. */
+PyObject *brileta_native_region_max_product(PyObject *self, PyObject *args);
 
 /* Shared native WFC contradiction exception type. */
 PyObject *brileta_native_wfc_contradiction_error = NULL;
@@ -52,6 +82,20 @@ static PyMethodDef methods[] = {
      "A* pathfinding on a 2D int16 cost grid with octile diagonal costs.\n"
      "cost: numpy int16 array shape (width, height), 0=blocked.\n"
      "Returns path excluding start, or empty list if no path."},
+    {"astar_within",
+     brileta_native_astar_within,
+     METH_VARARGS,
+     "astar_within(cost, start_x, start_y, target_x, target_y, distance) -> list[(x,y)]\n\n"
+     "A* to the nearest passable tile within Chebyshev distance of the target.\n"
+     "The target itself may be blocked or off the grid.\n"
+     "Returns path excluding start, or empty list if no path or start qualifies."},
+    {"astar_goals",
+     brileta_native_astar_goals,
+     METH_VARARGS,
+     "astar_goals(cost, start_x, start_y, goals) -> list[(x,y)]\n\n"
+     "A* to the nearest tile of a goal set: (x, y) pairs or a bool mask\n"
+     "shaped like cost.  Returns path excluding start, or empty list if no\n"
+     "path or start is a goal."},
     {"fov",
      brileta_native_fov,
      METH_VARARGS,
@@ -142,12 +186,124 @@ static PyMethodDef methods[] = {
      METH_VARARGS,
      "sprite_nibble_boulder(canvas, seed, nibble_prob) -> None\n\n"
      "Remove random edge pixels from upper half of boulder."},
+    {"sprite_render_mask",
+     brileta_native_sprite_render_mask,
+     METH_VARARGS,
+     "sprite_render_mask(canvas, tones, left, top, right, bottom, mirror, r0, g0, b0, r1, g1, "
+     "b1, r2, g2, b2) -> None\n\n"
+     "Rasterize a head-anchored pixel mask with nearest-cell sampling."},
+    {"sprite_finish_pose",
+     brileta_native_sprite_finish_pose,
+     METH_VARARGS,
+     "sprite_finish_pose(canvas, alpha_threshold, mirror, darken_r, darken_g, darken_b) -> None\n\n"
+     "Snap alpha, optionally mirror, and darken the rim of one pose canvas."},
+    {"sprite_draw_character_poses",
+     brileta_native_sprite_draw_character_poses,
+     METH_VARARGS,
+     "sprite_draw_character_poses(canvases, appearances, poses, mask_tones, mask_boxes, "
+     "alpha_threshold, darken_r, darken_g, darken_b) -> None\n\n"
+     "Draw and finish every pose of every character appearance in one call."},
     {"build_glyph_vertices",
      brileta_native_build_glyph_vertices,
      METH_VARARGS,
      "build_glyph_vertices(glyph_data, output, uv_map, cp437_map, tile_w, tile_h) -> int\n\n"
      "Encode a GlyphBuffer into interleaved triangle vertices for the GPU.\n"
      "Returns the number of vertices written."},
+    {"atlas_pack_blit",
+     brileta_native_atlas_pack_blit,
+     METH_VARARGS,
+     "atlas_pack_blit(sprites, order, atlas, cursor, positions, padding) -> int\n\n"
+     "Shelf-pack sprites in the given order into an (H, W, 4) uint8 atlas buffer,\n"
+     "blitting each with its bottom-row edge extension. cursor is the int32\n"
+     "(x, y, shelf_h) shelf state, updated in place; positions receives each\n"
+     "packed sprite's (x, y), or (-1, -1) if it did not fit.\n"
+     "Returns the number of sprites placed."},
+    {"write_quad_batch",
+     brileta_native_write_quad_batch,
+     METH_VARARGS,
+     "write_quad_batch(out, x, y, w, h, uv_coords, colors, world_pos, actor_light_scale, "
+     "flags, tile_bg) -> int\n\n"
+     "Write 6 screen-renderer vertices per axis-aligned quad into out in one pass.\n"
+     "Optional per-quad fields may be None for the add_quad() defaults.\n"
+     "Returns the number of quads written (clamped to out's capacity)."},
+    {"write_parallelogram_batch",
+     brileta_native_write_parallelogram_batch,
+     METH_VARARGS,
+     "write_parallelogram_batch(out, corners, uv_coords, base_colors, tip_colors, flags, "
+     "vertex_colors) -> int\n\n"
+     "Write 6 screen-renderer vertices per projected parallelogram into out.\n"
+     "Returns the number of quads written (clamped to out's capacity)."},
+    {"write_glyph_shadow_batch",
+     brileta_native_write_glyph_shadow_batch,
+     METH_VARARGS,
+     "write_glyph_shadow_batch(out, uv_coords, screen_x, screen_y, lengths, dir_x, dir_y, "
+     "tile_w, tile_h, scale_x, scale_y, alpha, fade_tip, horizontal_threshold) -> int\n\n"
+     "Build projected glyph-shadow parallelograms and write their vertices into out.\n"
+     "Shadows with a non-positive length are skipped; returns the number written."},
+    {"edge_transition_fill",
+     brileta_native_edge_transition_fill,
+     METH_VARARGS,
+     "edge_transition_fill(tiles, bg_rgb, drawn, blend_lut, hard_lut, darken_lut, "
+     "out_mask, out_bg, x1, y1, x2, y2) -> None\n\n"
+     "Compute organic edge neighbour masks and colours for the drawn tiles in\n"
+     "[x1, x2) x [y1, y2), reading neighbours from the whole (w, h) grid.\n"
+     "drawn may be None to treat every tile as drawn."},
+    {"clip_shadow_lengths",
+     brileta_native_clip_shadow_lengths,
+     METH_VARARGS,
+     "clip_shadow_lengths(shadow_heights, tile_x, tile_y, lengths, dir_x, dir_y) -> None\n\n"
+     "Shorten projected shadow lengths (in tiles, in place) at the first tall\n"
+     "blocker or map edge along the shadow direction."},
+    {"accumulate_shadow_dimming",
+     brileta_native_accumulate_shadow_dimming,
+     METH_VARARGS,
+     "accumulate_shadow_dimming(shadows, self_index, receivers, scales, fade_tip) -> None\n\n"
+     "Multiply projected actor-shadow attenuation into per-receiver light scales.\n"
+     "shadows rows are (cx, cy, visual_scale, shadow_height, dir_x, dir_y, length,\n"
+     "alpha); receivers rows are (cx, cy, visual_scale). Receivers are bucketed by\n"
+     "tile so each shadow only tests receivers near its capsule."},
+    {"line_of_sight",
+     brileta_native_line_of_sight,
+     METH_VARARGS,
+     "line_of_sight(transparent, x0, y0, x1, y1) -> bool\n\n"
+     "True when every Bresenham point strictly between the endpoints is transparent."},
+    {"los_mask",
+     brileta_native_los_mask,
+     METH_VARARGS,
+     "los_mask(transparent, origin_x, origin_y, box_x, box_y, out) -> None\n\n"
+     "Write line of sight from the origin to every tile of a box into out, indexed\n"
+     "[x - box_x, y - box_y]. Tiles outside the map are False."},
+    {"los_batch",
+     brileta_native_los_batch,
+     METH_VARARGS,
+     "los_batch(transparent, src_x, src_y, dst_x, dst_y, out) -> None\n\n"
+     "Write line of sight for each (src, dst) pair into out."},
+    {"tile_animation_walk",
+     brileta_native_tile_animation_walk,
+     METH_VARARGS,
+     "tile_animation_walk(visible, animates, fg_values, bg_values, left, top, right, bottom,\n"
+     "                    percent, step, seed) -> int\n\n"
+     "Random-walk the fg/bg modulation values of percent% of the visible animated\n"
+     "tiles in the inclusive bounds, in place. Returns the number of tiles updated."},
+    {"tile_property_fill",
+     brileta_native_tile_property_fill,
+     METH_VARARGS,
+     "tile_property_fill(tiles, lut, outputs, x1, y1, x2, y2) -> None\n\n"
+     "Copy each tile's record fields from lut into the (array, offset) outputs\n"
+     "for the window [x1, x2) x [y1, y2)."},
+    {"terrain_decoration",
+     brileta_native_terrain_decoration,
+     METH_VARARGS,
+     "terrain_decoration(chars, fg_rgb, bg_rgb, tile_ids, world_x, world_y, pool_table,\n"
+     "                   pool_glyphs, seed) -> None\n\n"
+     "Pick each tile's glyph from its type's pool by spatial hash and jitter its\n"
+     "fg/bg brightness, in place. Tiles whose type has no pool are untouched."},
+    {"region_max_product",
+     brileta_native_region_max_product,
+     METH_VARARGS,
+     "region_max_product(offsets, neighbors, factors, source, out) -> None\n\n"
+     "Best product of edge factors (each in [0, 1]) from source to every node of\n"
+     "a CSR graph, written into out (0.0 where unreachable)."},
     {NULL, NULL, 0, NULL}};
 
 static struct PyModuleDef module = {
@@ -188,5 +344,11 @@ PyMODINIT_FUNC PyInit__native(void) {
         return NULL;
     }
 
+    /* Register the IncrementalPlanner type (D* Lite path repair). */
+    if (brileta_native_init_path_repair_type(m) < 0) {
+        Py_DECREF(m);
+        return NULL;
+    }
+
     return m;
 }
@@ -0,0 +1,195 @@
+/*
+ * Batch sprite-atlas packer and blitter for SpriteAtlas.pack_all().
+ *
+ * Replaces the per-sprite Python loop (shelf placement, numpy slice blit, and
+ * bottom-row edge extension) with one pass over all sprites.  Sprite buffers
+ * are acquired with the GIL held; placement and the row memcpys run with the
+ * GIL released.
+ *
+ * Placement is byte-for-byte the shelf packer in SpriteAtlas._shelf_place, so
+ * the resulting positions (and therefore UVs) are identical to the Python path.
+ */
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#include <stdint.h>
+#include <string.h>
+
+typedef struct {
+    const uint8_t *px; /* (h, w, 4) C-contiguous RGBA */
+    int w;
+    int h;
+} SpriteRef;
+
+/*
+ * Advance the shelf cursor {x, y, h} for one padded sprite.  Mirrors
+ * SpriteAtlas._shelf_place: reject a sprite larger than the atlas without
+ * moving the cursor, start a new shelf when the sprite overflows the row or is
+ * taller than the current shelf, and fail when out of vertical space.
+ */
+static int shelf_place(
+    int32_t *cursor, int padded_w, int padded_h, int atlas_w, int atlas_h, int *out_x, int *out_y) {
+    /* Rows of an oversize sprite would run past the atlas stride (and end). */
+    if (padded_w > atlas_w || padded_h > atlas_h)
+        return 0;
+    if (cursor[2] == 0 || cursor[0] + padded_w > atlas_w || padded_h > cursor[2]) {
+        cursor[1] += cursor[2];
+        cursor[0] = 0;
+        cursor[2] = padded_h;
+    }
+    if (cursor[1] + padded_h > atlas_h)
+        return 0;
+    *out_x = cursor[0];
+    *out_y = cursor[1];
+    cursor[0] += padded_w;
+    return 1;
+}
+
+/* ── Core pack + blit loop (GIL-free) ── */
+
+static int pack_blit(const SpriteRef *sprites,
+                     const int32_t *order,
+                     int n_order,
+                     uint8_t *atlas,
+                     int atlas_w,
+                     int atlas_h,
+                     int32_t *cursor,
+                     int32_t *positions,
+                     int padding) {
+    const size_t atlas_stride = (size_t)atlas_w * 4;
+    int placed = 0;
+
+    for (int k = 0; k < n_order; k++) {
+        int i = order[k];
+        const SpriteRef *s = &sprites[i];
+        int x, y;
+        if (!shelf_place(cursor, s->w + padding, s->h + padding, atlas_w, atlas_h, &x, &y)) {
+            positions[i * 2] = -1;
+            positions[i * 2 + 1] = -1;
+            continue;
+        }
+        positions[i * 2] = x;
+        positions[i * 2 + 1] = y;
+
+        const size_t row_bytes = (size_t)s->w * 4;
+        uint8_t *dst = atlas + (size_t)y * atlas_stride + (size_t)x * 4;
+        for (int row = 0; row < s->h; row++)
+            memcpy(dst + (size_t)row * atlas_stride, s->px + (size_t)row * row_bytes, row_bytes);
+
+        /* Bottom-row edge extension for the linear-filtered shadow pass. */
+        if (s->h > 0 && y + s->h < atlas_h)
+            memcpy(dst + (size_t)s->h * atlas_stride,
+                   s->px + (size_t)(s->h - 1) * row_bytes,
+                   row_bytes);
+        placed++;
+    }
+    return placed;
+}
+
+/* ── Python wrapper ── */
+
+PyObject *brileta_native_atlas_pack_blit(PyObject *self, PyObject *args) {
+    PyObject *sprites_obj, *order_obj, *atlas_obj, *cursor_obj, *positions_obj;
+    int padding;
+
+    if (!PyArg_ParseTuple(args,
+                          "OOOOOi",
+                          &sprites_obj,   /* sequence of (h, w, 4) uint8 arrays */
+                          &order_obj,     /* int32 sprite indices, pack order   */
+                          &atlas_obj,     /* (H, W, 4) uint8 atlas buffer       */
+                          &cursor_obj,    /* int32[3] shelf cursor, in/out      */
+                          &positions_obj, /* int32 (N, 2) output positions      */
+                          &padding))
+        return NULL;
+
+    PyObject *seq = PySequence_Fast(sprites_obj, "sprites must be a sequence of arrays");
+    if (!seq)
+        return NULL;
+    Py_ssize_t n = PySequence_Fast_GET_SIZE(seq);
+
+    Py_buffer atlas_buf = {0}, order_buf = {0}, cursor_buf = {0}, positions_buf = {0};
+    Py_buffer *sprite_bufs = NULL;
+    SpriteRef *refs = NULL;
+    Py_ssize_t acquired = 0;
+    PyObject *result = NULL;
+
+    if (PyObject_GetBuffer(atlas_obj, &atlas_buf, PyBUF_C_CONTIGUOUS | PyBUF_WRITABLE) < 0)
+        goto done;
+    if (atlas_buf.ndim != 3 || atlas_buf.shape[2] != 4 || atlas_buf.itemsize != 1) {
+        PyErr_SetString(PyExc_TypeError, "atlas must be a contiguous (H, W, 4) uint8 array");
+        goto done;
+    }
+    if (PyObject_GetBuffer(order_obj, &order_buf, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) < 0)
+        goto done;
+    if (PyObject_GetBuffer(
+            cursor_obj, &cursor_buf, PyBUF_C_CONTIGUOUS | PyBUF_WRITABLE | PyBUF_FORMAT) < 0)
+        goto done;
+    if (PyObject_GetBuffer(
+            positions_obj, &positions_buf, PyBUF_C_CONTIGUOUS | PyBUF_WRITABLE | PyBUF_FORMAT) < 0)
+        goto done;
+    if (order_buf.itemsize != 4 || cursor_buf.itemsize != 4 || positions_buf.itemsize != 4 ||
+        cursor_buf.len != 3 * 4 || positions_buf.len < (Py_ssize_t)(n * 2 * 4)) {
+        PyErr_SetString(PyExc_TypeError,
+                        "order, cursor (3,) and positions (N, 2) must be int32 arrays");
+        goto done;
+    }
+
+    Py_ssize_t n_order = order_buf.len / 4;
+    const int32_t *order = (const int32_t *)order_buf.buf;
+    for (Py_ssize_t k = 0; k < n_order; k++) {
+        if (order[k] < 0 || order[k] >= n) {
+            PyErr_SetString(PyExc_IndexError, "order index out of range");
+            goto done;
+        }
+    }
+
+    sprite_bufs = PyMem_Calloc((size_t)(n > 0 ? n : 1), sizeof(Py_buffer));
+    refs = PyMem_Calloc((size_t)(n > 0 ? n : 1), sizeof(SpriteRef));
+    if (!sprite_bufs || !refs) {
+        PyErr_NoMemory();
+        goto done;
+    }
+    for (Py_ssize_t i = 0; i < n; i++) {
+        Py_buffer *b = &sprite_bufs[i];
+        if (PyObject_GetBuffer(PySequence_Fast_GET_ITEM(seq, i), b, PyBUF_C_CONTIGUOUS) < 0)
+            goto done;
+        acquired++;
+        if (b->ndim != 3 || b->shape[2] != 4 || b->itemsize != 1) {
+            PyErr_SetString(PyExc_TypeError, "sprites must be contiguous (H, W, 4) uint8 arrays");
+            goto done;
+        }
+        refs[i].px = (const uint8_t *)b->buf;
+        refs[i].h = (int)b->shape[0];
+        refs[i].w = (int)b->shape[1];
+    }
+
+    int placed;
+    uint8_t *atlas = (uint8_t *)atlas_buf.buf;
+    int atlas_h = (int)atlas_buf.shape[0];
+    int atlas_w = (int)atlas_buf.shape[1];
+    int32_t *cursor = (int32_t *)cursor_buf.buf;
+    int32_t *positions = (int32_t *)positions_buf.buf;
+    /* clang-format off */
+    Py_BEGIN_ALLOW_THREADS
+    placed = pack_blit(
+        refs, order, (int)n_order, atlas, atlas_w, atlas_h, cursor, positions, padding);
+    Py_END_ALLOW_THREADS
+    /* clang-format on */
+    result = PyLong_FromLong(placed);
+
+done:
+    for (Py_ssize_t i = 0; i < acquired; i++)
+        PyBuffer_Release(&sprite_bufs[i]);
+    PyMem_Free(sprite_bufs);
+    PyMem_Free(refs);
+    if (positions_buf.obj)
+        PyBuffer_Release(&positions_buf);
+    if (cursor_buf.obj)
+        PyBuffer_Release(&cursor_buf);
+    if (order_buf.obj)
+        PyBuffer_Release(&order_buf);
+    if (atlas_buf.obj)
+        PyBuffer_Release(&atlas_buf);
+    Py_DECREF(seq);
+    return result;
+}
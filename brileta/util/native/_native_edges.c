@@ -0,0 +1,224 @@
+/*
+ * Organic terrain edge-transition metadata for the glyph shader.
+ *
+ * For every drawn tile in a rectangle, decides which cardinal neighbours it
+ * feathers into and which background colour each boundary blends toward.
+ * This is the per-tile form of the numpy reference in
+ * brileta.environment.edge_transitions, fused into one pass:
+ *
+ *   1. A boundary is owned by the tile with the higher edge_blend amplitude;
+ *      ties go to the lower tile ID. Only the owner records the neighbour.
+ *   2. Mask bits pointing from a soft tile at a hard-edge tile (walls, roofs)
+ *      are cleared, but the neighbour colour slot is kept.
+ *   3. Tiles with an edge_self_darken amount replace all four colour slots
+ *      with their own background darkened by that amount.
+ *
+ * Neighbours are read from the whole array, so patching a small rectangle of
+ * a map-sized cache sees the same neighbours as a full rebuild.
+ */
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#include <stdint.h>
+#include <string.h>
+
+/* W, N, S, E - bit order of the edge_neighbor_mask field. */
+static const int EDGE_DIRS[4][2] = {{-1, 0}, {0, -1}, {0, 1}, {1, 0}};
+
+typedef struct {
+    const uint8_t *tiles; /* (w, h) tile IDs, strided */
+    Py_ssize_t tile_sx, tile_sy;
+    const uint8_t *drawn; /* (w, h) bool, strided; NULL = every tile drawn */
+    Py_ssize_t drawn_sx, drawn_sy;
+    const uint8_t *bg;     /* (w, h, 3) C-contiguous */
+    const float *blend;    /* [256] edge_blend per tile ID */
+    const uint8_t *hard;   /* [256] 1 for hard-edge tile IDs */
+    const uint8_t *darken; /* [256] edge_self_darken per tile ID */
+    uint8_t *out_mask;     /* (w, h) C-contiguous */
+    uint8_t *out_bg;       /* (w, h, 4, 3) C-contiguous */
+    int width, height;
+} EdgeGrid;
+
+static inline uint8_t tile_at(const EdgeGrid *g, int x, int y) {
+    return g->tiles[x * g->tile_sx + y * g->tile_sy];
+}
+
+static inline int drawn_at(const EdgeGrid *g, int x, int y) {
+    return g->drawn == NULL || g->drawn[x * g->drawn_sx + y * g->drawn_sy] != 0;
+}
+
+static void fill_rect(const EdgeGrid *g, int x1, int y1, int x2, int y2) {
+    for (int x = x1; x < x2; x++) {
+        for (int y = y1; y < y2; y++) {
+            size_t cell = (size_t)x * (size_t)g->height + (size_t)y;
+            uint8_t *slots = g->out_bg + cell * 12;
+            uint8_t mask = 0;
+            memset(slots, 0, 12);
+
+            if (drawn_at(g, x, y)) {
+                uint8_t id = tile_at(g, x, y);
+                float blend = g->blend[id];
+                int soft = !g->hard[id];
+
+                for (int k = 0; k < 4; k++) {
+                    int nx = x + EDGE_DIRS[k][0];
+                    int ny = y + EDGE_DIRS[k][1];
+                    if (nx < 0 || nx >= g->width || ny < 0 || ny >= g->height)
+                        continue;
+                    if (!drawn_at(g, nx, ny))
+                        continue;
+                    uint8_t nid = tile_at(g, nx, ny);
+                    if (nid == id)
+                        continue;
+                    float nblend = g->blend[nid];
+                    if (!(blend > nblend || (blend == nblend && id < nid)))
+                        continue;
+                    size_t ncell = (size_t)nx * (size_t)g->height + (size_t)ny;
+                    memcpy(slots + k * 3, g->bg + ncell * 3, 3);
+                    if (soft && g->hard[nid])
+                        continue;
+                    mask |= (uint8_t)(1u << k);
+                }
+
+                uint8_t amount = g->darken[id];
+                if (amount > 0) {
+                    const uint8_t *self_bg = g->bg + cell * 3;
+                    for (int k = 0; k < 4; k++)
+                        for (int c = 0; c < 3; c++)
+                            slots[k * 3 + c] =
+                                (uint8_t)(self_bg[c] > amount ? self_bg[c] - amount : 0);
+                }
+            }
+            g->out_mask[cell] = mask;
+        }
+    }
+}
+
+/* ── Python wrapper ── */
+
+static int is_byte_grid(const Py_buffer *b, int width, int height) {
+    return b->ndim == 2 && b->itemsize == 1 && (int)b->shape[0] == width &&
+           (int)b->shape[1] == height;
+}
+
+PyObject *brileta_native_edge_transition_fill(PyObject *self, PyObject *args) {
+    PyObject *tiles_obj, *bg_obj, *drawn_obj, *blend_obj, *hard_obj, *darken_obj;
+    PyObject *mask_obj, *out_bg_obj;
+    int x1, y1, x2, y2;
+
+    if (!PyArg_ParseTuple(args,
+                          "OOOOOOOOiiii",
+                          &tiles_obj,  /* (w, h) uint8 tile IDs, any layout     */
+                          &bg_obj,     /* (w, h, 3) uint8 background colours     */
+                          &drawn_obj,  /* (w, h) bool or None (all drawn)        */
+                          &blend_obj,  /* float32[256] edge_blend by tile ID     */
+                          &hard_obj,   /* uint8[256] hard-edge flag by tile ID   */
+                          &darken_obj, /* uint8[256] self-darken by tile ID      */
+                          &mask_obj,   /* (w, h) uint8 out edge_neighbor_mask    */
+                          &out_bg_obj, /* (w, h, 4, 3) uint8 out edge_neighbor_bg */
+                          &x1,
+                          &y1,
+                          &x2,
+                          &y2))
+        return NULL;
+
+    Py_buffer tiles_buf = {0}, bg_buf = {0}, drawn_buf = {0}, blend_buf = {0};
+    Py_buffer hard_buf = {0}, darken_buf = {0}, mask_buf = {0}, out_bg_buf = {0};
+    PyObject *result = NULL;
+
+    if (PyObject_GetBuffer(tiles_obj, &tiles_buf, PyBUF_STRIDES) < 0)
+        goto done;
+    if (tiles_buf.ndim != 2 || tiles_buf.itemsize != 1) {
+        PyErr_SetString(PyExc_TypeError, "tiles must be a 2D uint8 array");
+        goto done;
+    }
+    int width = (int)tiles_buf.shape[0];
+    int height = (int)tiles_buf.shape[1];
+
+    if (PyObject_GetBuffer(bg_obj, &bg_buf, PyBUF_C_CONTIGUOUS) < 0)
+        goto done;
+    if (PyObject_GetBuffer(mask_obj, &mask_buf, PyBUF_C_CONTIGUOUS | PyBUF_WRITABLE) < 0)
+        goto done;
+    if (PyObject_GetBuffer(out_bg_obj, &out_bg_buf, PyBUF_C_CONTIGUOUS | PyBUF_WRITABLE) < 0)
+        goto done;
+    if (bg_buf.len != (Py_ssize_t)width * height * 3 || !is_byte_grid(&mask_buf, width, height) ||
+        out_bg_buf.len != (Py_ssize_t)width * height * 12) {
+        PyErr_SetString(PyExc_ValueError,
+                        "bg (w, h, 3), mask (w, h) and out_bg (w, h, 4, 3) must match tiles");
+        goto done;
+    }
+    if (drawn_obj != Py_None) {
+        if (PyObject_GetBuffer(drawn_obj, &drawn_buf, PyBUF_STRIDES) < 0)
+            goto done;
+        if (!is_byte_grid(&drawn_buf, width, height)) {
+            PyErr_SetString(PyExc_ValueError, "drawn must be a (w, h) bool array");
+            goto done;
+        }
+    }
+
+    if (PyObject_GetBuffer(blend_obj, &blend_buf, PyBUF_C_CONTIGUOUS) < 0)
+        goto done;
+    if (PyObject_GetBuffer(hard_obj, &hard_buf, PyBUF_C_CONTIGUOUS) < 0)
+        goto done;
+    if (PyObject_GetBuffer(darken_obj, &darken_buf, PyBUF_C_CONTIGUOUS) < 0)
+        goto done;
+    if (blend_buf.len != 256 * 4 || hard_buf.len != 256 || darken_buf.len != 256) {
+        PyErr_SetString(PyExc_ValueError,
+                        "blend (float32), hard and darken (uint8) tables need 256 entries");
+        goto done;
+    }
+
+    if (x1 < 0)
+        x1 = 0;
+    if (y1 < 0)
+        y1 = 0;
+    if (x2 > width)
+        x2 = width;
+    if (y2 > height)
+        y2 = height;
+
+    EdgeGrid grid = {
+        .tiles = (const uint8_t *)tiles_buf.buf,
+        .tile_sx = tiles_buf.strides[0],
+        .tile_sy = tiles_buf.strides[1],
+        .drawn = drawn_buf.obj ? (const uint8_t *)drawn_buf.buf : NULL,
+        .drawn_sx = drawn_buf.obj ? drawn_buf.strides[0] : 0,
+        .drawn_sy = drawn_buf.obj ? drawn_buf.strides[1] : 0,
+        .bg = (const uint8_t *)bg_buf.buf,
+        .blend = (const float *)blend_buf.buf,
+        .hard = (const uint8_t *)hard_buf.buf,
+        .darken = (const uint8_t *)darken_buf.buf,
+        .out_mask = (uint8_t *)mask_buf.buf,
+        .out_bg = (uint8_t *)out_bg_buf.buf,
+        .width = width,
+        .height = height,
+    };
+    if (x1 < x2 && y1 < y2) {
+        /* clang-format off */
+        Py_BEGIN_ALLOW_THREADS
+        fill_rect(&grid, x1, y1, x2, y2);
+        Py_END_ALLOW_THREADS
+        /* clang-format on */
+    }
+    result = Py_None;
+    Py_INCREF(result);
+
+done:
+    if (out_bg_buf.obj)
+        PyBuffer_Release(&out_bg_buf);
+    if (mask_buf.obj)
+        PyBuffer_Release(&mask_buf);
+    if (darken_buf.obj)
+        PyBuffer_Release(&darken_buf);
+    if (hard_buf.obj)
+        PyBuffer_Release(&hard_buf);
+    if (blend_buf.obj)
+        PyBuffer_Release(&blend_buf);
+    if (drawn_buf.obj)
+        PyBuffer_Release(&drawn_buf);
+    if (bg_buf.obj)
+        PyBuffer_Release(&bg_buf);
+    if (tiles_buf.obj)
+        PyBuffer_Release(&tiles_buf);
+    return result;
+}
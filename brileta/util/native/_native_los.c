@@ -0,0 +1,224 @@
+/*
+ * Bresenham line-of-sight queries for brileta.game.ranges.
+ *
+ * Every query walks exactly the points ranges.get_line() produces from the
+ * source to the destination and applies has_line_of_sight()'s rule: each
+ * point strictly between the endpoints must be transparent.  The endpoints
+ * themselves are never tested, so a wall can always "see" its neighbours.
+ * An intermediate point outside the map blocks the line.
+ *
+ * Lines are walked independently rather than sharing prefixes: area-effect
+ * boxes are at most a few hundred tiles, and a short integer walk per tile
+ * is already far below the cost of the surrounding Python.
+ */
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+typedef struct {
+    const uint8_t *cells; /* (w, h) transparency, strided */
+    Py_ssize_t stride_x, stride_y;
+    int width, height;
+} TransparencyGrid;
+
+static inline int grid_transparent(const TransparencyGrid *g, int x, int y) {
+    if (x < 0 || x >= g->width || y < 0 || y >= g->height)
+        return 0;
+    return g->cells[x * g->stride_x + y * g->stride_y] != 0;
+}
+
+/* Mirrors ranges.get_line(): step first, then test the point unless it is the end. */
+static int line_clear(const TransparencyGrid *g, int x0, int y0, int x1, int y1) {
+    int dx = abs(x1 - x0);
+    int dy = abs(y1 - y0);
+    int step_x = x0 < x1 ? 1 : -1;
+    int step_y = y0 < y1 ? 1 : -1;
+    int err = dx - dy;
+    int x = x0, y = y0;
+
+    while (x != x1 || y != y1) {
+        int e2 = 2 * err;
+        if (e2 > -dy) {
+            err -= dy;
+            x += step_x;
+        }
+        if (e2 < dx) {
+            err += dx;
+            y += step_y;
+        }
+        if (x == x1 && y == y1)
+            break;
+        if (!grid_transparent(g, x, y))
+            return 0;
+    }
+    return 1;
+}
+
+/* Acquire a (w, h) one-byte transparency buffer. Returns 0 on success. */
+static int get_grid(PyObject *obj, Py_buffer *buf, TransparencyGrid *grid) {
+    if (PyObject_GetBuffer(obj, buf, PyBUF_STRIDES) < 0)
+        return -1;
+    if (buf->ndim != 2 || buf->itemsize != 1) {
+        PyErr_SetString(PyExc_TypeError, "transparent must be a 2D bool array");
+        return -1;
+    }
+    grid->cells = (const uint8_t *)buf->buf;
+    grid->stride_x = buf->strides[0];
+    grid->stride_y = buf->strides[1];
+    grid->width = (int)buf->shape[0];
+    grid->height = (int)buf->shape[1];
+    return 0;
+}
+
+PyObject *brileta_native_line_of_sight(PyObject *self, PyObject *args) {
+    PyObject *transparent_obj;
+    int x0, y0, x1, y1;
+
+    if (!PyArg_ParseTuple(args, "Oiiii", &transparent_obj, &x0, &y0, &x1, &y1))
+        return NULL;
+
+    Py_buffer transparent_buf = {0};
+    TransparencyGrid grid;
+    if (get_grid(transparent_obj, &transparent_buf, &grid) < 0) {
+        if (transparent_buf.obj)
+            PyBuffer_Release(&transparent_buf);
+        return NULL;
+    }
+
+    int clear = line_clear(&grid, x0, y0, x1, y1);
+    PyBuffer_Release(&transparent_buf);
+    return PyBool_FromLong(clear);
+}
+
+PyObject *brileta_native_los_mask(PyObject *self, PyObject *args) {
+    PyObject *transparent_obj, *out_obj;
+    int origin_x, origin_y, box_x, box_y;
+
+    if (!PyArg_ParseTuple(args,
+                          "OiiiiO",
+                          &transparent_obj, /* (w, h) bool transparency, any layout */
+                          &origin_x,
+                          &origin_y,
+                          &box_x, /* world tile of out[0, 0] */
+                          &box_y,
+                          &out_obj)) /* (bw, bh) bool, C-contiguous, written */
+        return NULL;
+
+    Py_buffer transparent_buf = {0}, out_buf = {0};
+    PyObject *result = NULL;
+    TransparencyGrid grid;
+
+    if (get_grid(transparent_obj, &transparent_buf, &grid) < 0)
+        goto done;
+    if (PyObject_GetBuffer(out_obj, &out_buf, PyBUF_C_CONTIGUOUS | PyBUF_WRITABLE | PyBUF_ND) <
+        0)
+        goto done;
+    if (out_buf.ndim != 2 || out_buf.itemsize != 1) {
+        PyErr_SetString(PyExc_TypeError, "out must be a 2D bool array");
+        goto done;
+    }
+
+    Py_ssize_t box_w = out_buf.shape[0];
+    Py_ssize_t box_h = out_buf.shape[1];
+    uint8_t *out = (uint8_t *)out_buf.buf;
+
+    /* clang-format off */
+    Py_BEGIN_ALLOW_THREADS
+    for (Py_ssize_t i = 0; i < box_w; i++) {
+        int tx = box_x + (int)i;
+        for (Py_ssize_t j = 0; j < box_h; j++) {
+            int ty = box_y + (int)j;
+            int inside = tx >= 0 && tx < grid.width && ty >= 0 && ty < grid.height;
+            out[i * box_h + j] =
+                (uint8_t)(inside && line_clear(&grid, origin_x, origin_y, tx, ty));
+        }
+    }
+    Py_END_ALLOW_THREADS
+    /* clang-format on */
+
+    result = Py_None;
+    Py_INCREF(result);
+
+done:
+    if (out_buf.obj)
+        PyBuffer_Release(&out_buf);
+    if (transparent_buf.obj)
+        PyBuffer_Release(&transparent_buf);
+    return result;
+}
+
+PyObject *brileta_native_los_batch(PyObject *self, PyObject *args) {
+    PyObject *transparent_obj, *sx_obj, *sy_obj, *dx_obj, *dy_obj, *out_obj;
+
+    if (!PyArg_ParseTuple(args,
+                          "OOOOOO",
+                          &transparent_obj, /* (w, h) bool transparency, any layout */
+                          &sx_obj,          /* (N,) int32 source x                  */
+                          &sy_obj,          /* (N,) int32 source y                  */
+                          &dx_obj,          /* (N,) int32 destination x             */
+                          &dy_obj,          /* (N,) int32 destination y             */
+                          &out_obj))        /* (N,) bool, written                   */
+        return NULL;
+
+    Py_buffer transparent_buf = {0}, sx_buf = {0}, sy_buf = {0}, dx_buf = {0}, dy_buf = {0},
+              out_buf = {0};
+    PyObject *result = NULL;
+    TransparencyGrid grid;
+
+    if (get_grid(transparent_obj, &transparent_buf, &grid) < 0)
+        goto done;
+    if (PyObject_GetBuffer(sx_obj, &sx_buf, PyBUF_C_CONTIGUOUS) < 0)
+        goto done;
+    if (PyObject_GetBuffer(sy_obj, &sy_buf, PyBUF_C_CONTIGUOUS) < 0)
+        goto done;
+    if (PyObject_GetBuffer(dx_obj, &dx_buf, PyBUF_C_CONTIGUOUS) < 0)
+        goto done;
+    if (PyObject_GetBuffer(dy_obj, &dy_buf, PyBUF_C_CONTIGUOUS) < 0)
+        goto done;
+    if (PyObject_GetBuffer(out_obj, &out_buf, PyBUF_C_CONTIGUOUS | PyBUF_WRITABLE) < 0)
+        goto done;
+    if (sx_buf.itemsize != 4 || sy_buf.itemsize != 4 || dx_buf.itemsize != 4 ||
+        dy_buf.itemsize != 4 || out_buf.itemsize != 1) {
+        PyErr_SetString(PyExc_TypeError, "coordinates must be int32 and out must be bool");
+        goto done;
+    }
+    Py_ssize_t n = out_buf.len;
+    if (sx_buf.len / 4 != n || sy_buf.len / 4 != n || dx_buf.len / 4 != n ||
+        dy_buf.len / 4 != n) {
+        PyErr_SetString(PyExc_ValueError, "coordinate arrays and out must have equal length");
+        goto done;
+    }
+
+    const int32_t *src_x = (const int32_t *)sx_buf.buf;
+    const int32_t *src_y = (const int32_t *)sy_buf.buf;
+    const int32_t *dst_x = (const int32_t *)dx_buf.buf;
+    const int32_t *dst_y = (const int32_t *)dy_buf.buf;
+    uint8_t *out = (uint8_t *)out_buf.buf;
+
+    /* clang-format off */
+    Py_BEGIN_ALLOW_THREADS
+    for (Py_ssize_t i = 0; i < n; i++)
+        out[i] = (uint8_t)line_clear(&grid, src_x[i], src_y[i], dst_x[i], dst_y[i]);
+    Py_END_ALLOW_THREADS
+    /* clang-format on */
+
+    result = Py_None;
+    Py_INCREF(result);
+
+done:
+    if (out_buf.obj)
+        PyBuffer_Release(&out_buf);
+    if (dy_buf.obj)
+        PyBuffer_Release(&dy_buf);
+    if (dx_buf.obj)
+        PyBuffer_Release(&dx_buf);
+    if (sy_buf.obj)
+        PyBuffer_Release(&sy_buf);
+    if (sx_buf.obj)
+        PyBuffer_Release(&sx_buf);
+    if (transparent_buf.obj)
+        PyBuffer_Release(&transparent_buf);
+    return result;
+}
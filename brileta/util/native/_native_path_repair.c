@@ -0,0 +1,584 @@
+/*
+ * Incremental path repair (D* Lite) for brileta.util.pathfinding.
+ *
+ * Exposes an IncrementalPlanner type that owns a copy of an int16 cost grid
+ * and the g/rhs state of a D* Lite search.  The search runs backwards from a
+ * goal box (every tile within Chebyshev `distance` of a target) toward the
+ * current start, so the start may move between calls without invalidating
+ * anything, and a cost change only disturbs the vertices whose distance to
+ * the goal actually changed.  Repairing a path after a few tiles change is
+ * therefore proportional to the change, not to the size of the route.
+ *
+ * Costs and moves match astar() in _native_pathfinding.c: 8-connected,
+ * entering a tile costs its weight (times sqrt(2) on a diagonal), and a
+ * weight of 0 blocks the tile (a blocked start has no path).  The heuristic
+ * is the unweighted octile distance, which is consistent because every
+ * passable weight is >= 1, so repaired paths are optimal rather than within
+ * A*'s 1% heuristic slack.
+ *
+ * Reference: S. Koenig and M. Likhachev, "D* Lite", AAAI 2002.
+ */
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#include <limits.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const double SQRT2 = 1.4142135623730951;
+static const int DX[8] = {-1, 1, 0, 0, -1, -1, 1, 1};
+static const int DY[8] = {0, 0, -1, 1, -1, 1, -1, 1};
+
+/* ------------------------------------------------------------------ */
+/* Two-key indexed min-heap                                           */
+/* ------------------------------------------------------------------ */
+
+typedef struct {
+    double k1, k2;
+    int idx;
+} PlannerKey;
+
+static inline int key_less(double a1, double a2, double b1, double b2) {
+    return a1 < b1 || (a1 == b1 && a2 < b2);
+}
+
+/* ------------------------------------------------------------------ */
+/* Planner object                                                     */
+/* ------------------------------------------------------------------ */
+
+typedef struct {
+    PyObject_HEAD int w, h;
+    short *cost;
+    double *g;
+    double *rhs;
+    int *heap_pos; /* -1 = not queued */
+    PlannerKey *heap;
+    int heap_size, heap_cap;
+    int tx, ty, distance;
+    int gx1, gy1, gx2, gy2; /* goal box clipped to the grid; empty if x1 > x2 */
+    int sx, sy;             /* current start */
+    int last_x, last_y;     /* start when km was last advanced */
+    double km;
+    Py_ssize_t expansions; /* vertices popped by the last compute_path() */
+} IncrementalPlannerObject;
+
+static void planner_free(IncrementalPlannerObject *self) {
+    free(self->cost);
+    free(self->g);
+    free(self->rhs);
+    free(self->heap_pos);
+    free(self->heap);
+    self->cost = NULL;
+    self->g = NULL;
+    self->rhs = NULL;
+    self->heap_pos = NULL;
+    self->heap = NULL;
+    self->heap_size = self->heap_cap = 0;
+}
+
+static inline int is_goal(const IncrementalPlannerObject *self, int x, int y) {
+    return x >= self->gx1 && x <= self->gx2 && y >= self->gy1 && y <= self->gy2;
+}
+
+/* Octile distance from (x, y) to the current start. */
+static inline double start_h(const IncrementalPlannerObject *self, int x, int y) {
+    int dx = abs(x - self->sx);
+    int dy = abs(y - self->sy);
+    int lo = dx < dy ? dx : dy;
+    int hi = dx < dy ? dy : dx;
+    return (double)hi + (SQRT2 - 1.0) * (double)lo;
+}
+
+static inline void calc_key(const IncrementalPlannerObject *self, int idx, double *k1,
+                            double *k2) {
+    double m = self->g[idx] < self->rhs[idx] ? self->g[idx] : self->rhs[idx];
+    *k1 = m + start_h(self, idx / self->h, idx % self->h) + self->km;
+    *k2 = m;
+}
+
+static inline void heap_swap(IncrementalPlannerObject *self, int a, int b) {
+    PlannerKey tmp = self->heap[a];
+    self->heap[a] = self->heap[b];
+    self->heap[b] = tmp;
+    self->heap_pos[self->heap[a].idx] = a;
+    self->heap_pos[self->heap[b].idx] = b;
+}
+
+static void heap_sift_up(IncrementalPlannerObject *self, int i) {
+    while (i > 0) {
+        int parent = (i - 1) / 2;
+        PlannerKey *c = &self->heap[i], *p = &self->heap[parent];
+        if (!key_less(c->k1, c->k2, p->k1, p->k2))
+            break;
+        heap_swap(self, i, parent);
+        i = parent;
+    }
+}
+
+static void heap_sift_down(IncrementalPlannerObject *self, int i) {
+    for (;;) {
+        int smallest = i;
+        int l = 2 * i + 1, r = 2 * i + 2;
+        PlannerKey *heap = self->heap;
+        if (l < self->heap_size &&
+            key_less(heap[l].k1, heap[l].k2, heap[smallest].k1, heap[smallest].k2))
+            smallest = l;
+        if (r < self->heap_size &&
+            key_less(heap[r].k1, heap[r].k2, heap[smallest].k1, heap[smallest].k2))
+            smallest = r;
+        if (smallest == i)
+            break;
+        heap_swap(self, i, smallest);
+        i = smallest;
+    }
+}
+
+/* Insert idx or move it to a new key.  Returns -1 on allocation failure. */
+static int heap_set(IncrementalPlannerObject *self, int idx, double k1, double k2) {
+    int pos = self->heap_pos[idx];
+    if (pos >= 0) {
+        PlannerKey *e = &self->heap[pos];
+        int up = key_less(k1, k2, e->k1, e->k2);
+        e->k1 = k1;
+        e->k2 = k2;
+        if (up)
+            heap_sift_up(self, pos);
+        else
+            heap_sift_down(self, pos);
+        return 0;
+    }
+    if (self->heap_size == self->heap_cap) {
+        int new_cap = self->heap_cap ? self->heap_cap * 2 : 256;
+        PlannerKey *grown = (PlannerKey *)realloc(self->heap, sizeof(PlannerKey) * new_cap);
+        if (!grown)
+            return -1;
+        self->heap = grown;
+        self->heap_cap = new_cap;
+    }
+    pos = self->heap_size++;
+    self->heap[pos].k1 = k1;
+    self->heap[pos].k2 = k2;
+    self->heap[pos].idx = idx;
+    self->heap_pos[idx] = pos;
+    heap_sift_up(self, pos);
+    return 0;
+}
+
+static void heap_remove(IncrementalPlannerObject *self, int idx) {
+    int pos = self->heap_pos[idx];
+    if (pos < 0)
+        return;
+    int last = --self->heap_size;
+    if (pos != last) {
+        heap_swap(self, pos, last);
+        self->heap_pos[idx] = -1;
+        heap_sift_up(self, pos);
+        heap_sift_down(self, pos);
+    } else {
+        self->heap_pos[idx] = -1;
+    }
+}
+
+/* ------------------------------------------------------------------ */
+/* D* Lite                                                            */
+/* ------------------------------------------------------------------ */
+
+/* One-step lookahead: cheapest move from idx to a neighbour plus its g. */
+static double lookahead(const IncrementalPlannerObject *self, int idx, int *best_idx) {
+    int x = idx / self->h, y = idx % self->h;
+    double best = INFINITY;
+    *best_idx = -1;
+    for (int d = 0; d < 8; d++) {
+        int nx = x + DX[d], ny = y + DY[d];
+        if (nx < 0 || nx >= self->w || ny < 0 || ny >= self->h)
+            continue;
+        int ni = nx * self->h + ny;
+        short nc = self->cost[ni];
+        if (nc <= 0)
+            continue;
+        double v = (double)nc * (d < 4 ? 1.0 : SQRT2) + self->g[ni];
+        if (v < best) {
+            best = v;
+            *best_idx = ni;
+        }
+    }
+    return best;
+}
+
+/* Recompute rhs for a non-goal vertex and fix its queue membership. */
+static int update_vertex(IncrementalPlannerObject *self, int idx) {
+    if (!is_goal(self, idx / self->h, idx % self->h)) {
+        int unused;
+        self->rhs[idx] = lookahead(self, idx, &unused);
+    }
+    if (self->g[idx] != self->rhs[idx]) {
+        double k1, k2;
+        calc_key(self, idx, &k1, &k2);
+        return heap_set(self, idx, k1, k2);
+    }
+    heap_remove(self, idx);
+    return 0;
+}
+
+/* Update every vertex that can step onto idx (its 8 neighbours). */
+static int update_predecessors(IncrementalPlannerObject *self, int idx) {
+    if (self->cost[idx] <= 0)
+        return 0; /* blocked: nothing can step onto it */
+    int x = idx / self->h, y = idx % self->h;
+    for (int d = 0; d < 8; d++) {
+        int nx = x + DX[d], ny = y + DY[d];
+        if (nx < 0 || nx >= self->w || ny < 0 || ny >= self->h)
+            continue;
+        if (update_vertex(self, nx * self->h + ny) < 0)
+            return -1;
+    }
+    return 0;
+}
+
+static int compute_shortest_path(IncrementalPlannerObject *self) {
+    int start = self->sx * self->h + self->sy;
+    self->expansions = 0;
+    while (self->heap_size > 0) {
+        double sk1, sk2;
+        calc_key(self, start, &sk1, &sk2);
+        PlannerKey top = self->heap[0];
+        if (!key_less(top.k1, top.k2, sk1, sk2) && self->rhs[start] <= self->g[start])
+            break;
+
+        int u = top.idx;
+        double k1, k2;
+        calc_key(self, u, &k1, &k2);
+        self->expansions++;
+        if (key_less(top.k1, top.k2, k1, k2)) {
+            /* Stale key from an older start: requeue with the current one. */
+            if (heap_set(self, u, k1, k2) < 0)
+                return -1;
+        } else if (self->g[u] > self->rhs[u]) {
+            /* Overconsistent: settle it and relax its predecessors. */
+            self->g[u] = self->rhs[u];
+            heap_remove(self, u);
+            if (update_predecessors(self, u) < 0)
+                return -1;
+        } else {
+            /* Underconsistent: the old route through u got more expensive. */
+            self->g[u] = INFINITY;
+            if (update_vertex(self, u) < 0 || update_predecessors(self, u) < 0)
+                return -1;
+        }
+    }
+    return 0;
+}
+
+/* ------------------------------------------------------------------ */
+/* Python methods                                                     */
+/* ------------------------------------------------------------------ */
+
+static int IncrementalPlanner_init(IncrementalPlannerObject *self, PyObject *args,
+                                   PyObject *kwds) {
+    static char *kwlist[] = {"cost", "start_x", "start_y", "target_x", "target_y", "distance",
+                             NULL};
+    PyObject *cost_obj;
+    int sx, sy, tx, ty, distance = 0;
+
+    if (!PyArg_ParseTupleAndKeywords(args,
+                                     kwds,
+                                     "Oiiii|i",
+                                     kwlist,
+                                     &cost_obj, /* (w, h) int16 cost grid, copied */
+                                     &sx,
+                                     &sy,
+                                     &tx, /* goal box centre, may be off the grid */
+                                     &ty,
+                                     &distance))
+        return -1;
+
+    Py_buffer buf = {0};
+    int rc = -1;
+    planner_free(self);
+
+    if (PyObject_GetBuffer(cost_obj, &buf, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) < 0)
+        goto done;
+    if (buf.ndim != 2 || strcmp(buf.format, "h") != 0) {
+        PyErr_SetString(PyExc_TypeError, "cost must be a 2D int16 C-contiguous array");
+        goto done;
+    }
+    int w = (int)buf.shape[0];
+    int h = (int)buf.shape[1];
+    if (sx < 0 || sx >= w || sy < 0 || sy >= h) {
+        PyErr_SetString(PyExc_ValueError, "start is out of bounds");
+        goto done;
+    }
+    if (distance < 0) {
+        PyErr_SetString(PyExc_ValueError, "distance must be non-negative");
+        goto done;
+    }
+
+    size_t size = (size_t)w * h;
+    self->cost = (short *)malloc(sizeof(short) * size);
+    self->g = (double *)malloc(sizeof(double) * size);
+    self->rhs = (double *)malloc(sizeof(double) * size);
+    self->heap_pos = (int *)malloc(sizeof(int) * size);
+    if (!self->cost || !self->g || !self->rhs || !self->heap_pos) {
+        PyErr_NoMemory();
+        goto done;
+    }
+    memcpy(self->cost, buf.buf, sizeof(short) * size);
+    for (size_t i = 0; i < size; i++)
+        self->g[i] = self->rhs[i] = INFINITY;
+    memset(self->heap_pos, 0xFF, sizeof(int) * size);
+
+    self->w = w;
+    self->h = h;
+    self->tx = tx;
+    self->ty = ty;
+    self->distance = distance;
+    self->gx1 = tx - distance < 0 ? 0 : tx - distance;
+    self->gy1 = ty - distance < 0 ? 0 : ty - distance;
+    self->gx2 = tx + distance >= w ? w - 1 : tx + distance;
+    self->gy2 = ty + distance >= h ? h - 1 : ty + distance;
+    self->sx = self->last_x = sx;
+    self->sy = self->last_y = sy;
+    self->km = 0.0;
+    self->expansions = 0;
+
+    /* Every goal tile is a source with rhs 0. */
+    for (int x = self->gx1; x <= self->gx2; x++) {
+        for (int y = self->gy1; y <= self->gy2; y++) {
+            int idx = x * h + y;
+            self->rhs[idx] = 0.0;
+            if (heap_set(self, idx, start_h(self, x, y), 0.0) < 0) {
+                PyErr_NoMemory();
+                goto done;
+            }
+        }
+    }
+    rc = 0;
+
+done:
+    if (buf.obj)
+        PyBuffer_Release(&buf);
+    if (rc < 0)
+        planner_free(self);
+    return rc;
+}
+
+static void IncrementalPlanner_dealloc(IncrementalPlannerObject *self) {
+    planner_free(self);
+    Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+static int planner_ready(IncrementalPlannerObject *self) {
+    if (self->cost == NULL) {
+        PyErr_SetString(PyExc_RuntimeError, "IncrementalPlanner is not initialized");
+        return 0;
+    }
+    return 1;
+}
+
+static PyObject *IncrementalPlanner_set_start(IncrementalPlannerObject *self, PyObject *args) {
+    int x, y;
+    if (!PyArg_ParseTuple(args, "ii", &x, &y))
+        return NULL;
+    if (!planner_ready(self))
+        return NULL;
+    if (x < 0 || x >= self->w || y < 0 || y >= self->h) {
+        PyErr_SetString(PyExc_ValueError, "start is out of bounds");
+        return NULL;
+    }
+    self->sx = x;
+    self->sy = y;
+    /* Queued keys were computed against the old start; km keeps them lower
+       bounds of the new ones (the heuristic moved by at most this much). */
+    self->km += start_h(self, self->last_x, self->last_y);
+    self->last_x = x;
+    self->last_y = y;
+    Py_RETURN_NONE;
+}
+
+static PyObject *IncrementalPlanner_update_costs(IncrementalPlannerObject *self,
+                                                 PyObject *updates_obj) {
+    if (!planner_ready(self))
+        return NULL;
+    PyObject *seq = PySequence_Fast(updates_obj, "updates must be a sequence of (x, y, cost)");
+    if (seq == NULL)
+        return NULL;
+
+    Py_ssize_t n = PySequence_Fast_GET_SIZE(seq);
+    Py_ssize_t changed = 0;
+    for (Py_ssize_t i = 0; i < n; i++) {
+        int x, y, c;
+        if (!PyArg_ParseTuple(PySequence_Fast_GET_ITEM(seq, i), "iii", &x, &y, &c))
+            goto fail;
+        if (x < 0 || x >= self->w || y < 0 || y >= self->h) {
+            PyErr_Format(PyExc_ValueError, "tile (%d, %d) is out of bounds", x, y);
+            goto fail;
+        }
+        if (c < 0 || c > SHRT_MAX) {
+            PyErr_Format(PyExc_ValueError, "cost %d is outside the int16 range", c);
+            goto fail;
+        }
+        int idx = x * self->h + y;
+        if (self->cost[idx] == (short)c)
+            continue;
+        /* Every move onto idx changed cost: its neighbours look again. */
+        self->cost[idx] = (short)c;
+        for (int d = 0; d < 8; d++) {
+            int nx = x + DX[d], ny = y + DY[d];
+            if (nx < 0 || nx >= self->w || ny < 0 || ny >= self->h)
+                continue;
+            if (update_vertex(self, nx * self->h + ny) < 0)
+                goto nomem;
+        }
+        changed++;
+    }
+    Py_DECREF(seq);
+    return PyLong_FromSsize_t(changed);
+
+nomem:
+    PyErr_NoMemory();
+fail:
+    Py_DECREF(seq);
+    return NULL;
+}
+
+static PyObject *IncrementalPlanner_compute_path(IncrementalPlannerObject *self,
+                                                 PyObject *Py_UNUSED(ignored)) {
+    if (!planner_ready(self))
+        return NULL;
+    if (compute_shortest_path(self) < 0)
+        return PyErr_NoMemory();
+
+    PyObject *result = PyList_New(0);
+    if (!result)
+        return NULL;
+
+    /* The search may stop with the start itself still queued, so its
+       reachability is rhs (one lookahead over settled neighbours), not g. */
+    int idx = self->sx * self->h + self->sy;
+    if (is_goal(self, self->sx, self->sy) || self->cost[idx] <= 0 || self->rhs[idx] == INFINITY)
+        return result;
+
+    /* Follow the cheapest lookahead; g strictly decreases along it. */
+    int limit = self->w * self->h;
+    for (int steps = 0; steps < limit; steps++) {
+        int next;
+        if (lookahead(self, idx, &next) == INFINITY)
+            break;
+        idx = next;
+        PyObject *tup = Py_BuildValue("(ii)", idx / self->h, idx % self->h);
+        if (!tup || PyList_Append(result, tup) < 0) {
+            Py_XDECREF(tup);
+            Py_DECREF(result);
+            return NULL;
+        }
+        Py_DECREF(tup);
+        if (is_goal(self, idx / self->h, idx % self->h))
+            return result;
+    }
+    /* Unreachable with consistent g values; report no path defensively. */
+    Py_DECREF(result);
+    return PyList_New(0);
+}
+
+static PyObject *IncrementalPlanner_get_cost(IncrementalPlannerObject *self, PyObject *args) {
+    int x, y;
+    if (!PyArg_ParseTuple(args, "ii", &x, &y))
+        return NULL;
+    if (!planner_ready(self))
+        return NULL;
+    if (x < 0 || x >= self->w || y < 0 || y >= self->h) {
+        PyErr_SetString(PyExc_ValueError, "tile is out of bounds");
+        return NULL;
+    }
+    return PyLong_FromLong(self->cost[x * self->h + y]);
+}
+
+static PyMethodDef IncrementalPlanner_methods[] = {
+    {"set_start",
+     (PyCFunction)IncrementalPlanner_set_start,
+     METH_VARARGS,
+     "set_start(x, y) -> None\n\n"
+     "Move the start.  Search state is kept; nothing is recomputed."},
+    {"update_costs",
+     (PyCFunction)IncrementalPlanner_update_costs,
+     METH_O,
+     "update_costs(updates) -> int\n\n"
+     "Apply (x, y, cost) tile weight changes and return how many differed.\n"
+     "Only the neighbours of changed tiles are touched until compute_path()."},
+    {"compute_path",
+     (PyCFunction)IncrementalPlanner_compute_path,
+     METH_NOARGS,
+     "compute_path() -> list[(x,y)]\n\n"
+     "Repair the search and return the path from the start to the goal box,\n"
+     "excluding the start.  Empty if unreachable or the start is in the box."},
+    {"get_cost",
+     (PyCFunction)IncrementalPlanner_get_cost,
+     METH_VARARGS,
+     "get_cost(x, y) -> int\n\nCurrent weight of a tile in the planner's grid."},
+    {NULL, NULL, 0, NULL}};
+
+static PyObject *IncrementalPlanner_get_target(IncrementalPlannerObject *self, void *closure) {
+    (void)closure;
+    return Py_BuildValue("(ii)", self->tx, self->ty);
+}
+
+static PyObject *IncrementalPlanner_get_distance(IncrementalPlannerObject *self,
+                                                 void *closure) {
+    (void)closure;
+    return PyLong_FromLong(self->distance);
+}
+
+static PyObject *IncrementalPlanner_get_expansions(IncrementalPlannerObject *self,
+                                                   void *closure) {
+    (void)closure;
+    return PyLong_FromSsize_t(self->expansions);
+}
+
+static PyGetSetDef IncrementalPlanner_getset[] = {
+    {"target",
+     (getter)IncrementalPlanner_get_target,
+     NULL,
+     "Centre of the goal box (read-only).",
+     NULL},
+    {"distance",
+     (getter)IncrementalPlanner_get_distance,
+     NULL,
+     "Chebyshev radius of the goal box (read-only).",
+     NULL},
+    {"expansions",
+     (getter)IncrementalPlanner_get_expansions,
+     NULL,
+     "Vertices popped by the last compute_path() (read-only).",
+     NULL},
+    {NULL, NULL, NULL, NULL, NULL}};
+
+static PyTypeObject IncrementalPlannerType = {
+    .ob_base = PyVarObject_HEAD_INIT(NULL, 0).tp_name = "brileta.util._native.IncrementalPlanner",
+    .tp_doc = "IncrementalPlanner(cost, start_x, start_y, target_x, target_y, distance=0)\n\n"
+              "D* Lite planner to every tile within Chebyshev distance of a target.\n"
+              "Keeps its search state so paths are repaired after cost changes.",
+    .tp_basicsize = sizeof(IncrementalPlannerObject),
+    .tp_itemsize = 0,
+    .tp_flags = Py_TPFLAGS_DEFAULT,
+    .tp_new = PyType_GenericNew,
+    .tp_init = (initproc)IncrementalPlanner_init,
+    .tp_dealloc = (destructor)IncrementalPlanner_dealloc,
+    .tp_methods = IncrementalPlanner_methods,
+    .tp_getset = IncrementalPlanner_getset,
+};
+
+/* ------------------------------------------------------------------ */
+/* Module-level registration (called from _native.c PyInit__native)   */
+/* ------------------------------------------------------------------ */
+
+int brileta_native_init_path_repair_type(PyObject *module) {
+    if (PyType_Ready(&IncrementalPlannerType) < 0)
+        return -1;
+
+    if (PyModule_AddObjectRef(module, "IncrementalPlanner", (PyObject *)&IncrementalPlannerType) <
+        0)
+        return -1;
+
+    return 0;
+}
@@ -1,8 +1,11 @@
 /*
  * Native A* pathfinding implementation for brileta.
  *
- * This file implements the `astar` callable that is exported by the shared
- * `brileta.util._native` extension module.
+ * This file implements the `astar`, `astar_within` and `astar_goals` callables
+ * exported by the shared `brileta.util._native` extension module.  All three
+ * share one search that stops at the first settled tile of a goal region, so
+ * "reach any of these tiles" or "get within k of the target" is one search
+ * rather than one per candidate end tile.
  */
 
 #define PY_SSIZE_T_CLEAN
@@ -141,30 +144,77 @@ static inline double octile_h_from_deltas(int dx, int dy) {
 }
 
 /*
- * Run A* on a flat cost grid.
+ * The set of acceptable end tiles for one search.
+ *
+ * Every goal lies inside the inclusive box (x1, y1)-(x2, y2).  With no mask,
+ * every tile of the box is a goal (a single target, or "within Chebyshev
+ * distance k of the target"); with a mask, only flagged tiles are.
+ *
+ * The heuristic is the octile distance to the nearest goal.  With a short
+ * goal list it is the exact minimum over those points; otherwise it is the
+ * octile distance to the box, which never exceeds it, so both are admissible.
+ */
+#define GOAL_POINT_HEURISTIC_LIMIT 32
+
+typedef struct {
+    int x1, y1, x2, y2;
+    const char *mask; /* flat w*h goal flags, or NULL */
+    int points[2 * GOAL_POINT_HEURISTIC_LIMIT];
+    int n_points; /* 0 = use the box distance */
+} GoalRegion;
+
+static inline int goal_contains(const GoalRegion *goal, int x, int y, int idx) {
+    if (x < goal->x1 || x > goal->x2 || y < goal->y1 || y > goal->y2)
+        return 0;
+    return goal->mask == NULL || goal->mask[idx];
+}
+
+static inline double goal_heuristic(const GoalRegion *goal, const int *box_dx,
+                                    const int *box_dy, int x, int y) {
+    if (goal->n_points == 0)
+        return octile_h_from_deltas(box_dx[x], box_dy[y]);
+    double best = 1e30;
+    for (int i = 0; i < goal->n_points; i++) {
+        int dx = abs(x - goal->points[2 * i]);
+        int dy = abs(y - goal->points[2 * i + 1]);
+        double d = octile_h_from_deltas(dx, dy);
+        if (d < best)
+            best = d;
+    }
+    return best;
+}
+
+/*
+ * Run A* on a flat cost grid until the first goal tile is settled.
  *
  * cost:   flat int16 array of size w*h, indexed as cost[x * h + y].
  *         0 = impassable, positive = traversal weight.
  * w, h:   grid dimensions (width, height).
  * sx, sy: start position.
- * gx, gy: goal position.
+ * goal:   acceptable end tiles (see GoalRegion).
  * out_path: output buffer for flat indices (caller allocates, size >= w*h).
  * out_len:  output path length (excluding start).
  *
  * Returns 0 on success, -1 on allocation failure.
- * If no path exists, *out_len = 0.
+ * If no path exists, or the start already satisfies the goal, *out_len = 0.
  */
-static int astar_search(
-    const short *cost, int w, int h, int sx, int sy, int gx, int gy, int *out_path, int *out_len) {
+static int astar_search(const short *cost,
+                        int w,
+                        int h,
+                        int sx,
+                        int sy,
+                        const GoalRegion *goal,
+                        int *out_path,
+                        int *out_len) {
     int size = w * h;
     int start_idx = sx * h + sy;
-    int goal_idx = gx * h + gy;
+    int goal_idx = -1;
     int rc = -1; /* default: OOM */
 
     *out_len = 0;
 
-    /* Quick exit: start or goal is blocked. */
-    if (cost[start_idx] == 0 || cost[goal_idx] == 0)
+    /* Quick exit: start is blocked, or already a goal. */
+    if (cost[start_idx] == 0 || goal_contains(goal, sx, sy, start_idx))
         return 0;
 
     /* All pointers NULL-initialized for single cleanup path. */
@@ -172,8 +222,8 @@ static int astar_search(
     int *came_from = NULL;
     char *closed = NULL;
     int *heap_pos = NULL;
-    int *goal_dx = NULL;
-    int *goal_dy = NULL;
+    int *box_dx = NULL;
+    int *box_dy = NULL;
     MinHeap heap = {NULL, 0, 0};
 
     /* Allocate working arrays. */
@@ -181,10 +231,10 @@ static int astar_search(
     came_from = (int *)malloc(sizeof(int) * size);
     closed = (char *)calloc(size, 1);
     heap_pos = (int *)malloc(sizeof(int) * size);
-    goal_dx = (int *)malloc(sizeof(int) * w);
-    goal_dy = (int *)malloc(sizeof(int) * h);
+    box_dx = (int *)malloc(sizeof(int) * w);
+    box_dy = (int *)malloc(sizeof(int) * h);
 
-    if (!g_score || !came_from || !closed || !heap_pos || !goal_dx || !goal_dy)
+    if (!g_score || !came_from || !closed || !heap_pos || !box_dx || !box_dy)
         goto cleanup;
 
     /* Initialize g_score to infinity. */
@@ -198,39 +248,33 @@ static int astar_search(
      * targets; mandated by C23).
      */
     memset(heap_pos, 0xFF, sizeof(int) * size);
-    for (int x = 0; x < w; x++) {
-        int dx = x - gx;
-        goal_dx[x] = dx < 0 ? -dx : dx;
-    }
-    for (int y = 0; y < h; y++) {
-        int dy = y - gy;
-        goal_dy[y] = dy < 0 ? -dy : dy;
-    }
+    for (int x = 0; x < w; x++)
+        box_dx[x] = x < goal->x1 ? goal->x1 - x : (x > goal->x2 ? x - goal->x2 : 0);
+    for (int y = 0; y < h; y++)
+        box_dy[y] = y < goal->y1 ? goal->y1 - y : (y > goal->y2 ? y - goal->y2 : 0);
 
     int initial_cap = size < 256 ? size : 256;
     if (heap_init(&heap, initial_cap) < 0)
         goto cleanup;
     if (heap_push_or_decrease(&heap,
                               heap_pos,
-                              HEURISTIC_WEIGHT * octile_h_from_deltas(goal_dx[sx], goal_dy[sy]),
+                              HEURISTIC_WEIGHT * goal_heuristic(goal, box_dx, box_dy, sx, sy),
                               start_idx) < 0)
         goto cleanup;
 
-    int found = 0;
-
     while (heap.size > 0) {
         HeapEntry top = heap_pop(&heap, heap_pos);
         int ci = top.idx;
+        int cx = ci / h;
+        int cy = ci % h;
 
-        if (ci == goal_idx) {
-            found = 1;
+        if (goal_contains(goal, cx, cy, ci)) {
+            goal_idx = ci;
             break;
         }
         closed[ci] = 1;
 
         double cg = g_score[ci];
-        int cx = ci / h;
-        int cy = ci % h;
 
         for (int d = 0; d < 8; d++) {
             int nx = cx + DX[d];
@@ -252,14 +296,14 @@ static int astar_search(
                 g_score[ni] = tent_g;
                 came_from[ni] = ci;
                 double f =
-                    tent_g + HEURISTIC_WEIGHT * octile_h_from_deltas(goal_dx[nx], goal_dy[ny]);
+                    tent_g + HEURISTIC_WEIGHT * goal_heuristic(goal, box_dx, box_dy, nx, ny);
                 if (heap_push_or_decrease(&heap, heap_pos, f, ni) < 0)
                     goto cleanup;
             }
         }
     }
 
-    if (found) {
+    if (goal_idx >= 0) {
         /* Reconstruct path (excluding start). */
         int len = 0;
         int node = goal_idx;
@@ -284,8 +328,8 @@ cleanup:
     free(came_from);
     free(closed);
     free(heap_pos);
-    free(goal_dx);
-    free(goal_dy);
+    free(box_dx);
+    free(box_dy);
     return rc;
 }
 
@@ -293,6 +337,57 @@ cleanup:
 /* Python interface                                                   */
 /* ------------------------------------------------------------------ */
 
+/* Acquire the (width, height) C-contiguous int16 cost grid. */
+static int get_cost_grid(PyObject *cost_obj, Py_buffer *buf) {
+    if (PyObject_GetBuffer(cost_obj, buf, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) < 0)
+        return -1;
+    if (buf->ndim != 2 || strcmp(buf->format, "h") != 0) {
+        PyErr_SetString(PyExc_TypeError, "cost must be a 2D int16 C-contiguous array");
+        return -1;
+    }
+    return 0;
+}
+
+/* Search from (sx, sy) to goal and return the path as a list of (x, y) tuples. */
+static PyObject *search_to_list(const short *cost, int w, int h, int sx, int sy,
+                                const GoalRegion *goal) {
+    int *path_buf = (int *)malloc(sizeof(int) * w * h);
+    if (!path_buf)
+        return PyErr_NoMemory();
+
+    int path_len;
+    int rc;
+    /* clang-format off */
+    Py_BEGIN_ALLOW_THREADS
+    rc = astar_search(cost, w, h, sx, sy, goal, path_buf, &path_len);
+    Py_END_ALLOW_THREADS
+    /* clang-format on */
+
+    if (rc < 0) {
+        free(path_buf);
+        return PyErr_NoMemory();
+    }
+
+    PyObject *result = PyList_New(path_len);
+    if (!result) {
+        free(path_buf);
+        return NULL;
+    }
+    for (int i = 0; i < path_len; i++) {
+        int idx = path_buf[i];
+        PyObject *tup = Py_BuildValue("(ii)", idx / h, idx % h);
+        if (!tup) {
+            Py_DECREF(result);
+            free(path_buf);
+            return NULL;
+        }
+        PyList_SET_ITEM(result, i, tup);
+    }
+
+    free(path_buf);
+    return result;
+}
+
 /*
  * astar(cost_array, start_x, start_y, goal_x, goal_y) -> list[tuple[int,int]]
  *
@@ -306,74 +401,173 @@ PyObject *brileta_native_astar(PyObject *self, PyObject *args) {
     if (!PyArg_ParseTuple(args, "Oiiii", &cost_obj, &sx, &sy, &gx, &gy))
         return NULL;
 
-    /* Get buffer from numpy array. */
-    Py_buffer buf;
-    if (PyObject_GetBuffer(cost_obj, &buf, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) < 0)
-        return NULL;
-
-    /* Validate format: must be int16 ('h'). */
-    if (buf.ndim != 2 || strcmp(buf.format, "h") != 0) {
-        PyBuffer_Release(&buf);
-        PyErr_SetString(PyExc_TypeError, "cost must be a 2D int16 C-contiguous array");
-        return NULL;
-    }
+    Py_buffer buf = {0};
+    PyObject *result = NULL;
+    if (get_cost_grid(cost_obj, &buf) < 0)
+        goto done;
 
     int w = (int)buf.shape[0];
     int h = (int)buf.shape[1];
-    const short *cost = (const short *)buf.buf;
 
-    /* Bounds check. */
     if (sx < 0 || sx >= w || sy < 0 || sy >= h || gx < 0 || gx >= w || gy < 0 || gy >= h) {
-        PyBuffer_Release(&buf);
         PyErr_SetString(PyExc_ValueError, "start or goal is out of bounds");
-        return NULL;
+        goto done;
     }
 
-    /* Same start and goal. */
-    if (sx == gx && sy == gy) {
-        PyBuffer_Release(&buf);
-        return PyList_New(0);
+    /* A blocked goal can never be reached. */
+    if (((const short *)buf.buf)[gx * h + gy] == 0) {
+        result = PyList_New(0);
+        goto done;
     }
 
-    /* Allocate output buffer. */
-    int *path_buf = (int *)malloc(sizeof(int) * w * h);
-    if (!path_buf) {
+    GoalRegion goal = {gx, gy, gx, gy, NULL, {0}, 0};
+    result = search_to_list((const short *)buf.buf, w, h, sx, sy, &goal);
+
+done:
+    if (buf.obj)
         PyBuffer_Release(&buf);
-        return PyErr_NoMemory();
+    return result;
+}
+
+/*
+ * astar_within(cost_array, start_x, start_y, target_x, target_y, distance)
+ *     -> list[tuple[int,int]]
+ *
+ * Path to the cheapest-to-reach passable tile within Chebyshev `distance` of
+ * the target.  The target itself may lie outside the grid or be blocked.
+ */
+PyObject *brileta_native_astar_within(PyObject *self, PyObject *args) {
+    PyObject *cost_obj;
+    int sx, sy, tx, ty, distance;
+
+    if (!PyArg_ParseTuple(args, "Oiiiii", &cost_obj, &sx, &sy, &tx, &ty, &distance))
+        return NULL;
+
+    Py_buffer buf = {0};
+    PyObject *result = NULL;
+    if (get_cost_grid(cost_obj, &buf) < 0)
+        goto done;
+
+    int w = (int)buf.shape[0];
+    int h = (int)buf.shape[1];
+
+    if (sx < 0 || sx >= w || sy < 0 || sy >= h) {
+        PyErr_SetString(PyExc_ValueError, "start is out of bounds");
+        goto done;
+    }
+    if (distance < 0) {
+        PyErr_SetString(PyExc_ValueError, "distance must be non-negative");
+        goto done;
     }
 
-    int path_len;
-    int rc;
-    Py_BEGIN_ALLOW_THREADS rc = astar_search(cost, w, h, sx, sy, gx, gy, path_buf, &path_len);
-    Py_END_ALLOW_THREADS
+    GoalRegion goal = {tx - distance, ty - distance, tx + distance, ty + distance, NULL, {0}, 0};
+    result = search_to_list((const short *)buf.buf, w, h, sx, sy, &goal);
 
+done:
+    if (buf.obj)
         PyBuffer_Release(&buf);
+    return result;
+}
 
-    if (rc < 0) {
-        free(path_buf);
-        return PyErr_NoMemory();
-    }
+/*
+ * astar_goals(cost_array, start_x, start_y, goals) -> list[tuple[int,int]]
+ *
+ * Path to the cheapest-to-reach tile of a goal set, given either as a
+ * sequence of (x, y) pairs or as a bool mask shaped like the cost grid.
+ * Out-of-bounds goal pairs are ignored.
+ */
+PyObject *brileta_native_astar_goals(PyObject *self, PyObject *args) {
+    PyObject *cost_obj, *goals_obj;
+    int sx, sy;
 
-    /* Build Python list of (x, y) tuples. */
-    PyObject *result = PyList_New(path_len);
-    if (!result) {
-        free(path_buf);
+    if (!PyArg_ParseTuple(args, "OiiO", &cost_obj, &sx, &sy, &goals_obj))
         return NULL;
+
+    Py_buffer buf = {0}, mask_buf = {0};
+    PyObject *goals_seq = NULL;
+    char *owned_mask = NULL;
+    PyObject *result = NULL;
+    GoalRegion goal = {0, 0, -1, -1, NULL, {0}, 0};
+
+    if (get_cost_grid(cost_obj, &buf) < 0)
+        goto done;
+
+    int w = (int)buf.shape[0];
+    int h = (int)buf.shape[1];
+
+    if (sx < 0 || sx >= w || sy < 0 || sy >= h) {
+        PyErr_SetString(PyExc_ValueError, "start is out of bounds");
+        goto done;
     }
 
-    for (int i = 0; i < path_len; i++) {
-        int idx = path_buf[i];
-        int x = idx / h;
-        int y = idx % h;
-        PyObject *tup = Py_BuildValue("(ii)", x, y);
-        if (!tup) {
-            Py_DECREF(result);
-            free(path_buf);
-            return NULL;
+    const char *mask;
+    if (PyObject_CheckBuffer(goals_obj)) {
+        if (PyObject_GetBuffer(goals_obj, &mask_buf, PyBUF_C_CONTIGUOUS) < 0)
+            goto done;
+        if (mask_buf.ndim != 2 || mask_buf.itemsize != 1 || mask_buf.shape[0] != w ||
+            mask_buf.shape[1] != h) {
+            PyErr_SetString(PyExc_ValueError,
+                            "goal mask must be a C-contiguous bool array shaped like cost");
+            goto done;
         }
-        PyList_SET_ITEM(result, i, tup);
+        mask = (const char *)mask_buf.buf;
+    } else {
+        goals_seq = PySequence_Fast(goals_obj, "goals must be a bool mask or (x, y) pairs");
+        if (goals_seq == NULL)
+            goto done;
+        owned_mask = (char *)calloc((size_t)w * h, 1);
+        if (!owned_mask) {
+            PyErr_NoMemory();
+            goto done;
+        }
+        Py_ssize_t n = PySequence_Fast_GET_SIZE(goals_seq);
+        for (Py_ssize_t i = 0; i < n; i++) {
+            int gx, gy;
+            if (!PyArg_ParseTuple(PySequence_Fast_GET_ITEM(goals_seq, i), "ii", &gx, &gy))
+                goto done;
+            if (gx >= 0 && gx < w && gy >= 0 && gy < h)
+                owned_mask[gx * h + gy] = 1;
+        }
+        mask = owned_mask;
     }
 
-    free(path_buf);
+    /* Bounding box and, for short lists, the points for the exact heuristic. */
+    int count = 0;
+    goal.x1 = w;
+    goal.y1 = h;
+    for (int x = 0; x < w; x++) {
+        for (int y = 0; y < h; y++) {
+            if (!mask[x * h + y])
+                continue;
+            if (x < goal.x1)
+                goal.x1 = x;
+            if (x > goal.x2)
+                goal.x2 = x;
+            if (y < goal.y1)
+                goal.y1 = y;
+            if (y > goal.y2)
+                goal.y2 = y;
+            if (count < GOAL_POINT_HEURISTIC_LIMIT) {
+                goal.points[2 * count] = x;
+                goal.points[2 * count + 1] = y;
+            }
+            count++;
+        }
+    }
+    if (count == 0) {
+        result = PyList_New(0);
+        goto done;
+    }
+    goal.n_points = count <= GOAL_POINT_HEURISTIC_LIMIT ? count : 0;
+    goal.mask = mask;
+    result = search_to_list((const short *)buf.buf, w, h, sx, sy, &goal);
+
+done:
+    free(owned_mask);
+    Py_XDECREF(goals_seq);
+    if (mask_buf.obj)
+        PyBuffer_Release(&mask_buf);
+    if (buf.obj)
+        PyBuffer_Release(&buf);
     return result;
 }
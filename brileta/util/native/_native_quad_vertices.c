@@ -0,0 +1,511 @@
+/*
+ * Single-pass quad vertex writers for the WGPU screen renderer.
+ *
+ * Replaces the per-field numpy assignments in
+ * WGPUScreenRenderer.add_quad_batch() and add_parallelogram_batch().  Each of
+ * those was a strided pass over the wide interleaved vertex record; here every
+ * quad reads its SoA inputs once and writes its 6 vertices sequentially.
+ *
+ * All inputs are C-contiguous float32 (flags: uint32) arrays prepared by the
+ * Python wrappers.  Optional per-quad fields are passed as None and replaced
+ * with the same defaults add_quad() uses.  The GIL is released during the
+ * write pass.
+ *
+ * write_glyph_shadow_batch() goes one step further and also builds the
+ * projected glyph-shadow corners, so a whole batch of terrain glyph shadows is
+ * a single call.  Its geometry inputs are float64 so the corners round to
+ * float32 exactly as the scalar draw_actor_shadow() path does.
+ */
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+/* ── Vertex layout (must match screen_renderer.VERTEX_DTYPE) ── */
+
+typedef struct {
+    float position[2];       /* Screen (x, y)                               */
+    float uv[2];             /* Atlas (u, v)                                */
+    float uv_local[2];       /* (u, v) local to the quad, 0..1              */
+    float color[4];          /* RGBA as 0.0-1.0                             */
+    float world_pos[2];      /* World tile position for actor lighting      */
+    float actor_light_scale; /* Shadow receiver dimming scale               */
+    uint32_t flags;          /* Per-quad shader behavior bitmask            */
+    float tile_bg[3];        /* Tile background RGB for actor contrast      */
+} QuadVertex;
+
+_Static_assert(sizeof(QuadVertex) == 68, "QuadVertex size must match VERTEX_DTYPE (68 bytes)");
+
+/* Local UV patterns, one per vertex of the two triangles. */
+static const float QUAD_LOCAL_UV[6][2] = {
+    {0.0f, 0.0f}, {1.0f, 0.0f}, {0.0f, 1.0f}, {1.0f, 0.0f}, {0.0f, 1.0f}, {1.0f, 1.0f}};
+static const float PARALLELOGRAM_LOCAL_UV[6][2] = {
+    {0.0f, 1.0f}, {1.0f, 1.0f}, {0.0f, 0.0f}, {1.0f, 1.0f}, {0.0f, 0.0f}, {1.0f, 0.0f}};
+
+/*
+ * Acquire a contiguous buffer holding at least n * per_item elements of
+ * the given itemsize.  A None object leaves buf->obj NULL and is reported as
+ * absent (returns 0 with *data NULL) when optional is set.
+ * Returns 0 on success, -1 on error (exception set).
+ */
+static int get_sized_field(PyObject *obj,
+                           Py_buffer *buf,
+                           Py_ssize_t n,
+                           Py_ssize_t per_item,
+                           Py_ssize_t itemsize,
+                           int optional,
+                           const char *name,
+                           const void **data) {
+    *data = NULL;
+    if (obj == Py_None) {
+        if (optional)
+            return 0;
+        PyErr_Format(PyExc_TypeError, "%s must not be None", name);
+        return -1;
+    }
+    if (PyObject_GetBuffer(obj, buf, PyBUF_C_CONTIGUOUS) < 0)
+        return -1;
+    if (buf->itemsize != itemsize || buf->len < n * per_item * itemsize) {
+        PyErr_Format(PyExc_ValueError,
+                     "%s must be a contiguous %zd-byte array with %zd values per quad",
+                     name,
+                     itemsize,
+                     per_item);
+        return -1;
+    }
+    *data = buf->buf;
+    return 0;
+}
+
+/* get_sized_field() for the common 4-byte (float32 / uint32) case. */
+static int get_field(PyObject *obj,
+                     Py_buffer *buf,
+                     Py_ssize_t n,
+                     Py_ssize_t per_item,
+                     int optional,
+                     const char *name,
+                     const void **data) {
+    return get_sized_field(obj, buf, n, per_item, 4, optional, name, data);
+}
+
+static void release_fields(Py_buffer *bufs, int count) {
+    for (int i = 0; i < count; i++) {
+        if (bufs[i].obj)
+            PyBuffer_Release(&bufs[i]);
+    }
+}
+
+/*
+ * Acquire the output vertex slice and return its capacity in quads.
+ * Returns -1 on error (exception set).
+ */
+static Py_ssize_t get_output(PyObject *obj, Py_buffer *buf) {
+    if (PyObject_GetBuffer(obj, buf, PyBUF_C_CONTIGUOUS | PyBUF_WRITABLE) < 0)
+        return -1;
+    if (buf->itemsize != (Py_ssize_t)sizeof(QuadVertex)) {
+        PyErr_Format(PyExc_TypeError,
+                     "output itemsize %zd does not match QuadVertex (%zu)",
+                     buf->itemsize,
+                     sizeof(QuadVertex));
+        PyBuffer_Release(buf);
+        return -1;
+    }
+    return buf->len / (Py_ssize_t)sizeof(QuadVertex) / 6;
+}
+
+/* ── Axis-aligned quads ── */
+
+static void write_quads(QuadVertex *out,
+                        Py_ssize_t n,
+                        const float *x,
+                        const float *y,
+                        const float *w,
+                        const float *h,
+                        const float *uvs,
+                        const float *colors,
+                        const float *world_pos,
+                        const float *light_scale,
+                        const uint32_t *flags,
+                        const float *tile_bg) {
+    for (Py_ssize_t i = 0; i < n; i++) {
+        QuadVertex *v = &out[i * 6];
+        const float *uv = &uvs[i * 4];
+        float x1 = x[i], y1 = y[i];
+        float x2 = x1 + w[i], y2 = y1 + h[i];
+
+        /* Build vertex 0 fully, then copy the shared fields to 1-5. */
+        memcpy(v[0].color, &colors[i * 4], sizeof(v[0].color));
+        if (world_pos) {
+            v[0].world_pos[0] = world_pos[i * 2];
+            v[0].world_pos[1] = world_pos[i * 2 + 1];
+        } else {
+            v[0].world_pos[0] = -1.0f;
+            v[0].world_pos[1] = -1.0f;
+        }
+        v[0].actor_light_scale = light_scale ? light_scale[i] : 1.0f;
+        v[0].flags = flags ? flags[i] : 0u;
+        if (tile_bg)
+            memcpy(v[0].tile_bg, &tile_bg[i * 3], sizeof(v[0].tile_bg));
+        else
+            memset(v[0].tile_bg, 0, sizeof(v[0].tile_bg));
+        for (int k = 1; k < 6; k++)
+            memcpy(&v[k], &v[0], sizeof(QuadVertex));
+
+        /* Two triangles: TL, TR, BL, TR, BL, BR. */
+        const float px[6] = {x1, x2, x1, x2, x1, x2};
+        const float py[6] = {y1, y1, y2, y1, y2, y2};
+        const float pu[6] = {uv[0], uv[2], uv[0], uv[2], uv[0], uv[2]};
+        const float pv[6] = {uv[1], uv[1], uv[3], uv[1], uv[3], uv[3]};
+        for (int k = 0; k < 6; k++) {
+            v[k].position[0] = px[k];
+            v[k].position[1] = py[k];
+            v[k].uv[0] = pu[k];
+            v[k].uv[1] = pv[k];
+            v[k].uv_local[0] = QUAD_LOCAL_UV[k][0];
+            v[k].uv_local[1] = QUAD_LOCAL_UV[k][1];
+        }
+    }
+}
+
+/*
+ * write_quad_batch(out, x, y, w, h, uv_coords, colors,
+ *                  world_pos, actor_light_scale, flags, tile_bg) -> int
+ */
+PyObject *brileta_native_write_quad_batch(PyObject *self, PyObject *args) {
+    PyObject *out_obj, *x_obj, *y_obj, *w_obj, *h_obj, *uv_obj, *color_obj;
+    PyObject *world_obj, *scale_obj, *flags_obj, *bg_obj;
+
+    if (!PyArg_ParseTuple(args,
+                          "OOOOOOOOOOO",
+                          &out_obj,   /* VERTEX_DTYPE slice, >= N*6 vertices   */
+                          &x_obj,     /* (N,) float32 quad left               */
+                          &y_obj,     /* (N,) float32 quad top                */
+                          &w_obj,     /* (N,) float32 width                   */
+                          &h_obj,     /* (N,) float32 height                  */
+                          &uv_obj,    /* (N, 4) float32 u1, v1, u2, v2        */
+                          &color_obj, /* (N, 4) float32 RGBA                  */
+                          &world_obj, /* (N, 2) float32 or None               */
+                          &scale_obj, /* (N,) float32 or None                 */
+                          &flags_obj, /* (N,) uint32 or None                  */
+                          &bg_obj))   /* (N, 3) float32 or None               */
+        return NULL;
+
+    Py_buffer out_buf;
+    Py_ssize_t capacity = get_output(out_obj, &out_buf);
+    if (capacity < 0)
+        return NULL;
+
+    Py_ssize_t n = PyObject_Length(x_obj);
+    if (n < 0) {
+        PyBuffer_Release(&out_buf);
+        return NULL;
+    }
+    if (n > capacity)
+        n = capacity;
+
+    Py_buffer bufs[10];
+    memset(bufs, 0, sizeof(bufs));
+    const void *p[10];
+    if (get_field(x_obj, &bufs[0], n, 1, 0, "x", &p[0]) < 0 ||
+        get_field(y_obj, &bufs[1], n, 1, 0, "y", &p[1]) < 0 ||
+        get_field(w_obj, &bufs[2], n, 1, 0, "w", &p[2]) < 0 ||
+        get_field(h_obj, &bufs[3], n, 1, 0, "h", &p[3]) < 0 ||
+        get_field(uv_obj, &bufs[4], n, 4, 0, "uv_coords", &p[4]) < 0 ||
+        get_field(color_obj, &bufs[5], n, 4, 0, "colors", &p[5]) < 0 ||
+        get_field(world_obj, &bufs[6], n, 2, 1, "world_pos", &p[6]) < 0 ||
+        get_field(scale_obj, &bufs[7], n, 1, 1, "actor_light_scale", &p[7]) < 0 ||
+        get_field(flags_obj, &bufs[8], n, 1, 1, "flags", &p[8]) < 0 ||
+        get_field(bg_obj, &bufs[9], n, 3, 1, "tile_bg", &p[9]) < 0) {
+        release_fields(bufs, 10);
+        PyBuffer_Release(&out_buf);
+        return NULL;
+    }
+
+    QuadVertex *out = (QuadVertex *)out_buf.buf;
+    /* clang-format off */
+    Py_BEGIN_ALLOW_THREADS
+    write_quads(out, n, p[0], p[1], p[2], p[3], p[4], p[5], p[6], p[7], p[8], p[9]);
+    Py_END_ALLOW_THREADS
+    /* clang-format on */
+
+    release_fields(bufs, 10);
+    PyBuffer_Release(&out_buf);
+    return PyLong_FromSsize_t(n);
+}
+
+/* ── Projected parallelograms (shadows) ── */
+
+/*
+ * Write one parallelogram's 6 vertices.  corners is (BL, BR, TL, TR) as 8
+ * floats; colors holds one RGBA pointer per corner in the same order.
+ */
+static inline void write_parallelogram(QuadVertex *v,
+                                       const float *c,
+                                       const float *uv,
+                                       const float *const colors[4],
+                                       uint32_t flags) {
+    /* Corner order in the two triangles: BL, BR, TL, BR, TL, TR. */
+    static const int CORNER[6] = {0, 1, 2, 1, 2, 3};
+    float u1 = uv[0], v1 = uv[1], u2 = uv[2], v2 = uv[3];
+    /* Base edge gets the texture bottom (v2), tip edge the top (v1). */
+    const float pu[6] = {u1, u2, u1, u2, u1, u2};
+    const float pv[6] = {v2, v2, v1, v2, v1, v1};
+
+    for (int k = 0; k < 6; k++) {
+        int corner = CORNER[k];
+        v[k].position[0] = c[corner * 2];
+        v[k].position[1] = c[corner * 2 + 1];
+        v[k].uv[0] = pu[k];
+        v[k].uv[1] = pv[k];
+        v[k].uv_local[0] = PARALLELOGRAM_LOCAL_UV[k][0];
+        v[k].uv_local[1] = PARALLELOGRAM_LOCAL_UV[k][1];
+        memcpy(v[k].color, colors[corner], sizeof(v[k].color));
+        v[k].world_pos[0] = -1.0f;
+        v[k].world_pos[1] = -1.0f;
+        v[k].actor_light_scale = 1.0f;
+        v[k].flags = flags;
+        memset(v[k].tile_bg, 0, sizeof(v[k].tile_bg));
+    }
+}
+
+static void write_parallelograms(QuadVertex *out,
+                                 Py_ssize_t n,
+                                 const float *corners,
+                                 const float *uvs,
+                                 const float *base_colors,
+                                 const float *tip_colors,
+                                 const uint32_t *flags,
+                                 const float *vertex_colors) {
+    for (Py_ssize_t i = 0; i < n; i++) {
+        const float *colors[4];
+        for (int corner = 0; corner < 4; corner++) {
+            if (vertex_colors)
+                colors[corner] = &vertex_colors[(i * 4 + corner) * 4];
+            else
+                colors[corner] = corner < 2 ? &base_colors[i * 4] : &tip_colors[i * 4];
+        }
+        write_parallelogram(&out[i * 6], &corners[i * 8], &uvs[i * 4], colors, flags[i]);
+    }
+}
+
+/*
+ * write_parallelogram_batch(out, corners, uv_coords, base_colors, tip_colors,
+ *                           flags, vertex_colors) -> int
+ */
+PyObject *brileta_native_write_parallelogram_batch(PyObject *self, PyObject *args) {
+    PyObject *out_obj, *corners_obj, *uv_obj, *base_obj, *tip_obj, *flags_obj, *vc_obj;
+
+    if (!PyArg_ParseTuple(args,
+                          "OOOOOOO",
+                          &out_obj,     /* VERTEX_DTYPE slice, >= N*6 vertices  */
+                          &corners_obj, /* (N, 4, 2) float32 BL, BR, TL, TR     */
+                          &uv_obj,      /* (N, 4) float32 u1, v1, u2, v2       */
+                          &base_obj,    /* (N, 4) float32 RGBA                 */
+                          &tip_obj,     /* (N, 4) float32 RGBA                 */
+                          &flags_obj,   /* (N,) uint32                         */
+                          &vc_obj))     /* (N, 4, 4) float32 or None           */
+        return NULL;
+
+    Py_buffer out_buf;
+    Py_ssize_t capacity = get_output(out_obj, &out_buf);
+    if (capacity < 0)
+        return NULL;
+
+    Py_ssize_t n = PyObject_Length(corners_obj);
+    if (n < 0) {
+        PyBuffer_Release(&out_buf);
+        return NULL;
+    }
+    if (n > capacity)
+        n = capacity;
+
+    Py_buffer bufs[6];
+    memset(bufs, 0, sizeof(bufs));
+    const void *p[6];
+    if (get_field(corners_obj, &bufs[0], n, 8, 0, "corners", &p[0]) < 0 ||
+        get_field(uv_obj, &bufs[1], n, 4, 0, "uv_coords", &p[1]) < 0 ||
+        get_field(base_obj, &bufs[2], n, 4, 0, "base_colors", &p[2]) < 0 ||
+        get_field(tip_obj, &bufs[3], n, 4, 0, "tip_colors", &p[3]) < 0 ||
+        get_field(flags_obj, &bufs[4], n, 1, 0, "flags", &p[4]) < 0 ||
+        get_field(vc_obj, &bufs[5], n, 16, 1, "vertex_colors", &p[5]) < 0) {
+        release_fields(bufs, 6);
+        PyBuffer_Release(&out_buf);
+        return NULL;
+    }
+
+    QuadVertex *out = (QuadVertex *)out_buf.buf;
+    /* clang-format off */
+    Py_BEGIN_ALLOW_THREADS
+    write_parallelograms(out, n, p[0], p[1], p[2], p[3], p[4], p[5]);
+    Py_END_ALLOW_THREADS
+    /* clang-format on */
+
+    release_fields(bufs, 6);
+    PyBuffer_Release(&out_buf);
+    return PyLong_FromSsize_t(n);
+}
+
+/* ── Projected glyph shadows ── */
+
+typedef struct {
+    double dir_x, dir_y;   /* Unit shadow direction                        */
+    double tile_w, tile_h; /* Unscaled tile size in pixels                 */
+    double scale_x, scale_y;
+    double horizontal_threshold; /* |dir_y| below this uses the side band  */
+    float alpha;                 /* Base alpha, already clamped to [0, 1]  */
+    int fade_tip;
+} GlyphShadowParams;
+
+/*
+ * Build each glyph shadow's corners exactly as
+ * WGPUGraphicsContext._draw_shadow_with_uv() does for a centred glyph, then
+ * write its parallelogram.  Quads with a non-positive length are skipped, so
+ * the output is compacted.  Returns the number of quads written.
+ */
+static Py_ssize_t write_glyph_shadows(QuadVertex *out,
+                                      Py_ssize_t n,
+                                      Py_ssize_t capacity,
+                                      const float *uvs,
+                                      const double *screen_x,
+                                      const double *screen_y,
+                                      const double *lengths,
+                                      const GlyphShadowParams *p) {
+    const float base[4] = {0.0f, 0.0f, 0.0f, p->alpha};
+    const float tip[4] = {0.0f, 0.0f, 0.0f, p->fade_tip ? 0.0f : p->alpha};
+    const int horizontal = fabs(p->dir_y) < p->horizontal_threshold;
+    const double scaled_w = p->tile_w * p->scale_x;
+    const double scaled_h = p->tile_h * p->scale_y;
+    const double offset_x = (p->tile_w - scaled_w) / 2;
+    const double offset_y = (p->tile_h - scaled_h) / 2;
+    Py_ssize_t written = 0;
+
+    for (Py_ssize_t i = 0; i < n && written < capacity; i++) {
+        double length = lengths[i];
+        if (!(length > 0.0))
+            continue;
+
+        double glyph_x = screen_x[i] + offset_x;
+        double glyph_y = screen_y[i] + offset_y;
+        const float *uv = &uvs[i * 4];
+        float corners[8];
+        float band_uv[4];
+        const float *colors[4] = {base, base, tip, tip};
+
+        if (horizontal) {
+            /* Side band anchored to the glyph base, mirrored horizontally. */
+            double band_bottom = glyph_y + scaled_h;
+            double band_top = band_bottom - scaled_w * 0.5;
+            double edge_overlap = scaled_w * 0.4;
+            double left, right;
+            if (p->dir_x >= 0.0) {
+                left = glyph_x + scaled_w - edge_overlap;
+                right = left + length;
+                colors[1] = tip;
+                colors[2] = base;
+            } else {
+                right = glyph_x + edge_overlap;
+                left = right - length;
+                colors[0] = tip;
+                colors[1] = base;
+                colors[2] = tip;
+                colors[3] = base;
+            }
+            corners[0] = (float)left;
+            corners[1] = (float)band_bottom;
+            corners[2] = (float)right;
+            corners[3] = (float)band_bottom;
+            corners[4] = (float)left;
+            corners[5] = (float)band_top;
+            corners[6] = (float)right;
+            corners[7] = (float)band_top;
+            band_uv[0] = uv[2];
+            band_uv[1] = uv[1];
+            band_uv[2] = uv[0];
+            band_uv[3] = uv[3];
+            uv = band_uv;
+        } else {
+            double bottom = glyph_y + scaled_h;
+            double right = glyph_x + scaled_w;
+            corners[0] = (float)glyph_x;
+            corners[1] = (float)bottom;
+            corners[2] = (float)right;
+            corners[3] = (float)bottom;
+            corners[4] = (float)(glyph_x + p->dir_x * length);
+            corners[5] = (float)(bottom + p->dir_y * length);
+            corners[6] = (float)(right + p->dir_x * length);
+            corners[7] = (float)(bottom + p->dir_y * length);
+        }
+
+        write_parallelogram(&out[written * 6], corners, uv, colors, 0u);
+        written++;
+    }
+    return written;
+}
+
+/*
+ * write_glyph_shadow_batch(out, uv_coords, screen_x, screen_y, lengths,
+ *                          dir_x, dir_y, tile_w, tile_h, scale_x, scale_y,
+ *                          alpha, fade_tip, horizontal_threshold) -> int
+ */
+PyObject *brileta_native_write_glyph_shadow_batch(PyObject *self, PyObject *args) {
+    PyObject *out_obj, *uv_obj, *sx_obj, *sy_obj, *len_obj;
+    GlyphShadowParams params;
+    double alpha;
+
+    if (!PyArg_ParseTuple(args,
+                          "OOOOOdddddddpd",
+                          &out_obj, /* VERTEX_DTYPE slice                     */
+                          &uv_obj,  /* (N, 4) float32 glyph u1, v1, u2, v2     */
+                          &sx_obj,  /* (N,) float64 tile screen x              */
+                          &sy_obj,  /* (N,) float64 tile screen y              */
+                          &len_obj, /* (N,) float64 shadow length in pixels    */
+                          &params.dir_x,  /* unit shadow direction             */
+                          &params.dir_y,
+                          &params.tile_w, /* unscaled tile size in pixels      */
+                          &params.tile_h,
+                          &params.scale_x, /* glyph scale                      */
+                          &params.scale_y,
+                          &alpha, /* base alpha                                */
+                          &params.fade_tip,
+                          &params.horizontal_threshold))
+        return NULL;
+
+    params.alpha = (float)(alpha < 0.0 ? 0.0 : (alpha > 1.0 ? 1.0 : alpha));
+
+    Py_buffer out_buf;
+    Py_ssize_t capacity = get_output(out_obj, &out_buf);
+    if (capacity < 0)
+        return NULL;
+
+    Py_ssize_t n = PyObject_Length(uv_obj);
+    if (n < 0) {
+        PyBuffer_Release(&out_buf);
+        return NULL;
+    }
+
+    Py_buffer bufs[4];
+    memset(bufs, 0, sizeof(bufs));
+    const void *p[4];
+    if (get_field(uv_obj, &bufs[0], n, 4, 0, "uv_coords", &p[0]) < 0 ||
+        get_sized_field(sx_obj, &bufs[1], n, 1, 8, 0, "screen_x", &p[1]) < 0 ||
+        get_sized_field(sy_obj, &bufs[2], n, 1, 8, 0, "screen_y", &p[2]) < 0 ||
+        get_sized_field(len_obj, &bufs[3], n, 1, 8, 0, "lengths", &p[3]) < 0) {
+        release_fields(bufs, 4);
+        PyBuffer_Release(&out_buf);
+        return NULL;
+    }
+
+    QuadVertex *out = (QuadVertex *)out_buf.buf;
+    Py_ssize_t written;
+    /* clang-format off */
+    Py_BEGIN_ALLOW_THREADS
+    written = write_glyph_shadows(out, n, capacity, p[0], p[1], p[2], p[3], &params);
+    Py_END_ALLOW_THREADS
+    /* clang-format on */
+
+    release_fields(bufs, 4);
+    PyBuffer_Release(&out_buf);
+    return PyLong_FromSsize_t(written);
+}
@@ -0,0 +1,196 @@
+/*
+ * Region-graph traversals for brileta.
+ *
+ * The region graph arrives in CSR form: node n's out-edges are
+ * neighbors[offsets[n]:offsets[n + 1]], with one weight per edge.  Nodes are
+ * region ids, so ids without a region are simply nodes with no edges.
+ *
+ * region_max_product() is a single-source Dijkstra that maximizes the
+ * product of edge factors instead of minimizing a sum.  With every factor in
+ * [0, 1] a longer path can never beat its own prefix, which is the same
+ * monotonicity that makes ordinary Dijkstra correct, so each node is settled
+ * once at its best product.  Sound occlusion uses it with door attenuation
+ * factors to get the least-occluded route from the listener to every region.
+ */
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+typedef struct {
+    double value;
+    int32_t node;
+} ProductEntry;
+
+/* Binary max-heap on value; stale entries are skipped when popped. */
+typedef struct {
+    ProductEntry *data;
+    Py_ssize_t size, cap;
+} ProductHeap;
+
+static int product_heap_push(ProductHeap *heap, double value, int32_t node) {
+    if (heap->size == heap->cap) {
+        Py_ssize_t new_cap = heap->cap ? heap->cap * 2 : 64;
+        ProductEntry *grown =
+            (ProductEntry *)realloc(heap->data, sizeof(ProductEntry) * (size_t)new_cap);
+        if (!grown)
+            return -1;
+        heap->data = grown;
+        heap->cap = new_cap;
+    }
+    Py_ssize_t i = heap->size++;
+    while (i > 0) {
+        Py_ssize_t parent = (i - 1) / 2;
+        if (heap->data[parent].value >= value)
+            break;
+        heap->data[i] = heap->data[parent];
+        i = parent;
+    }
+    heap->data[i].value = value;
+    heap->data[i].node = node;
+    return 0;
+}
+
+static ProductEntry product_heap_pop(ProductHeap *heap) {
+    ProductEntry top = heap->data[0];
+    ProductEntry last = heap->data[--heap->size];
+    Py_ssize_t i = 0;
+    for (;;) {
+        Py_ssize_t child = 2 * i + 1;
+        if (child >= heap->size)
+            break;
+        if (child + 1 < heap->size && heap->data[child + 1].value > heap->data[child].value)
+            child++;
+        if (heap->data[child].value <= last.value)
+            break;
+        heap->data[i] = heap->data[child];
+        i = child;
+    }
+    if (heap->size > 0)
+        heap->data[i] = last;
+    return top;
+}
+
+static int get_vector(PyObject *obj, Py_buffer *buf, Py_ssize_t itemsize, int writable,
+                      const char *name, const char *kind) {
+    int flags = PyBUF_C_CONTIGUOUS | (writable ? PyBUF_WRITABLE : 0);
+    if (PyObject_GetBuffer(obj, buf, flags) < 0)
+        return -1;
+    if (buf->ndim != 1 || buf->itemsize != itemsize) {
+        PyErr_Format(PyExc_TypeError, "%s must be a 1D %s array", name, kind);
+        return -1;
+    }
+    return 0;
+}
+
+PyObject *brileta_native_region_max_product(PyObject *self, PyObject *args) {
+    PyObject *offsets_obj, *neighbors_obj, *factors_obj, *out_obj;
+    int source;
+
+    if (!PyArg_ParseTuple(args,
+                          "OOOiO",
+                          &offsets_obj,   /* (n + 1,) int32 CSR row offsets          */
+                          &neighbors_obj, /* (m,) int32 edge targets                 */
+                          &factors_obj,   /* (m,) float64 edge factors in [0, 1]     */
+                          &source,        /* node whose products are 1.0            */
+                          &out_obj))      /* (n,) float64, best product per node     */
+        return NULL;
+
+    Py_buffer offsets_buf = {0}, neighbors_buf = {0}, factors_buf = {0}, out_buf = {0};
+    ProductHeap heap = {NULL, 0, 0};
+    PyObject *result = NULL;
+
+    if (get_vector(offsets_obj, &offsets_buf, 4, 0, "offsets", "int32") < 0)
+        goto done;
+    if (get_vector(neighbors_obj, &neighbors_buf, 4, 0, "neighbors", "int32") < 0)
+        goto done;
+    if (get_vector(factors_obj, &factors_buf, 8, 0, "factors", "float64") < 0)
+        goto done;
+    if (get_vector(out_obj, &out_buf, 8, 1, "out", "float64") < 0)
+        goto done;
+
+    Py_ssize_t n = out_buf.shape[0];
+    Py_ssize_t m = neighbors_buf.shape[0];
+    const int32_t *offsets = (const int32_t *)offsets_buf.buf;
+    const int32_t *neighbors = (const int32_t *)neighbors_buf.buf;
+    const double *factors = (const double *)factors_buf.buf;
+    double *out = (double *)out_buf.buf;
+
+    if (offsets_buf.shape[0] != n + 1 || factors_buf.shape[0] != m) {
+        PyErr_SetString(PyExc_ValueError,
+                        "offsets must have len(out) + 1 entries and factors one per edge");
+        goto done;
+    }
+    if (offsets[0] != 0 || offsets[n] != m) {
+        PyErr_SetString(PyExc_ValueError, "offsets must run from 0 to len(neighbors)");
+        goto done;
+    }
+    for (Py_ssize_t i = 0; i < n; i++) {
+        if (offsets[i + 1] < offsets[i]) {
+            PyErr_SetString(PyExc_ValueError, "offsets must be non-decreasing");
+            goto done;
+        }
+    }
+    for (Py_ssize_t e = 0; e < m; e++) {
+        if (neighbors[e] < 0 || neighbors[e] >= n) {
+            PyErr_SetString(PyExc_ValueError, "edge target is out of range");
+            goto done;
+        }
+        if (!(factors[e] >= 0.0 && factors[e] <= 1.0)) {
+            PyErr_SetString(PyExc_ValueError, "edge factors must lie in [0, 1]");
+            goto done;
+        }
+    }
+    if (source < 0 || source >= n) {
+        PyErr_SetString(PyExc_ValueError, "source is out of range");
+        goto done;
+    }
+
+    int oom = 0;
+    /* clang-format off */
+    Py_BEGIN_ALLOW_THREADS
+    for (Py_ssize_t i = 0; i < n; i++)
+        out[i] = 0.0;
+    out[source] = 1.0;
+    if (product_heap_push(&heap, 1.0, source) < 0)
+        oom = 1;
+    while (!oom && heap.size > 0) {
+        ProductEntry top = product_heap_pop(&heap);
+        if (top.value < out[top.node])
+            continue; /* superseded by a better product */
+        for (int32_t e = offsets[top.node]; e < offsets[top.node + 1]; e++) {
+            double value = top.value * factors[e];
+            int32_t next = neighbors[e];
+            if (value > out[next]) {
+                out[next] = value;
+                if (product_heap_push(&heap, value, next) < 0) {
+                    oom = 1;
+                    break;
+                }
+            }
+        }
+    }
+    Py_END_ALLOW_THREADS
+    /* clang-format on */
+
+    if (oom) {
+        PyErr_NoMemory();
+        goto done;
+    }
+
+    result = Py_None;
+    Py_INCREF(result);
+
+done:
+    free(heap.data);
+    if (out_buf.obj)
+        PyBuffer_Release(&out_buf);
+    if (factors_buf.obj)
+        PyBuffer_Release(&factors_buf);
+    if (neighbors_buf.obj)
+        PyBuffer_Release(&neighbors_buf);
+    if (offsets_buf.obj)
+        PyBuffer_Release(&offsets_buf);
+    return result;
+}
@@ -0,0 +1,376 @@
+/*
+ * Projected shadow helpers for ShadowRenderer.
+ *
+ * Wall clipping: batch form of ShadowRenderer._clip_shadow_length_by_walls(): each shadow is
+ * marched from its tile centre along the shadow direction, one tile per step,
+ * for up to min(8, ceil(length)) steps.  The first sample that leaves the map
+ * or lands on a tall blocker (shadow height > 2) clamps the length to
+ * step - 0.5.  Low-profile casters (height 1-2) never clip.
+ *
+ * Lengths are in tiles and are rewritten in place.
+ *
+ * Receiver dimming: see accumulate_shadow_dimming() below.
+ */
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+#define CLIP_MAX_STEPS 8
+#define CLIP_BLOCKER_HEIGHT 2
+
+typedef struct {
+    const uint8_t *heights; /* (w, h) shadow heights, strided */
+    Py_ssize_t sx, sy;
+    int width, height;
+} HeightGrid;
+
+static double clip_one(const HeightGrid *g, int x, int y, double length, double dx, double dy) {
+    if (!(length > 0.0))
+        return 0.0;
+    if (fabs(dx) <= 1e-6 && fabs(dy) <= 1e-6)
+        return 0.0;
+
+    double ceil_len = ceil(length);
+    int max_steps = ceil_len < CLIP_MAX_STEPS ? (int)ceil_len : CLIP_MAX_STEPS;
+    double origin_x = (double)x + 0.5;
+    double origin_y = (double)y + 0.5;
+
+    for (int step = 1; step <= max_steps; step++) {
+        double sample_x = floor(origin_x + dx * (double)step);
+        double sample_y = floor(origin_y + dy * (double)step);
+        int blocked = sample_x < 0.0 || sample_x >= (double)g->width || sample_y < 0.0 ||
+                      sample_y >= (double)g->height;
+        if (!blocked) {
+            Py_ssize_t off = (Py_ssize_t)sample_x * g->sx + (Py_ssize_t)sample_y * g->sy;
+            blocked = g->heights[off] > CLIP_BLOCKER_HEIGHT;
+        }
+        if (blocked) {
+            double clipped = (double)step - 0.5;
+            if (length < clipped)
+                clipped = length;
+            return clipped > 0.0 ? clipped : 0.0;
+        }
+    }
+    return length;
+}
+
+/* ── Python wrapper ── */
+
+PyObject *brileta_native_clip_shadow_lengths(PyObject *self, PyObject *args) {
+    PyObject *heights_obj, *x_obj, *y_obj, *len_obj;
+    double dir_x, dir_y;
+
+    if (!PyArg_ParseTuple(args,
+                          "OOOOdd",
+                          &heights_obj, /* (w, h) uint8 shadow heights, any layout */
+                          &x_obj,       /* (N,) int32 caster tile x               */
+                          &y_obj,       /* (N,) int32 caster tile y               */
+                          &len_obj,     /* (N,) float64 lengths in tiles, in/out  */
+                          &dir_x,
+                          &dir_y))
+        return NULL;
+
+    Py_buffer heights_buf = {0}, x_buf = {0}, y_buf = {0}, len_buf = {0};
+    PyObject *result = NULL;
+
+    if (PyObject_GetBuffer(heights_obj, &heights_buf, PyBUF_STRIDES) < 0)
+        goto done;
+    if (heights_buf.ndim != 2 || heights_buf.itemsize != 1) {
+        PyErr_SetString(PyExc_TypeError, "shadow_heights must be a 2D uint8 array");
+        goto done;
+    }
+    if (PyObject_GetBuffer(x_obj, &x_buf, PyBUF_C_CONTIGUOUS) < 0)
+        goto done;
+    if (PyObject_GetBuffer(y_obj, &y_buf, PyBUF_C_CONTIGUOUS) < 0)
+        goto done;
+    if (PyObject_GetBuffer(len_obj, &len_buf, PyBUF_C_CONTIGUOUS | PyBUF_WRITABLE) < 0)
+        goto done;
+    if (x_buf.itemsize != 4 || y_buf.itemsize != 4 || len_buf.itemsize != 8) {
+        PyErr_SetString(PyExc_TypeError,
+                        "tile_x and tile_y must be int32, lengths must be float64");
+        goto done;
+    }
+    Py_ssize_t n = len_buf.len / 8;
+    if (x_buf.len / 4 != n || y_buf.len / 4 != n) {
+        PyErr_SetString(PyExc_ValueError, "tile_x, tile_y and lengths must have equal length");
+        goto done;
+    }
+
+    HeightGrid grid = {
+        .heights = (const uint8_t *)heights_buf.buf,
+        .sx = heights_buf.strides[0],
+        .sy = heights_buf.strides[1],
+        .width = (int)heights_buf.shape[0],
+        .height = (int)heights_buf.shape[1],
+    };
+    const int32_t *xs = (const int32_t *)x_buf.buf;
+    const int32_t *ys = (const int32_t *)y_buf.buf;
+    double *lengths = (double *)len_buf.buf;
+
+    /* clang-format off */
+    Py_BEGIN_ALLOW_THREADS
+    for (Py_ssize_t i = 0; i < n; i++)
+        lengths[i] = clip_one(&grid, xs[i], ys[i], lengths[i], dir_x, dir_y);
+    Py_END_ALLOW_THREADS
+    /* clang-format on */
+
+    result = Py_None;
+    Py_INCREF(result);
+
+done:
+    if (len_buf.obj)
+        PyBuffer_Release(&len_buf);
+    if (y_buf.obj)
+        PyBuffer_Release(&y_buf);
+    if (x_buf.obj)
+        PyBuffer_Release(&x_buf);
+    if (heights_buf.obj)
+        PyBuffer_Release(&heights_buf);
+    return result;
+}
+
+/* ── Actor shadow receiver dimming ── */
+
+/*
+ * Receiver dimming for ShadowRenderer._apply_receiver_dimming().
+ *
+ * Each shadow row is (centre_x, centre_y, visual_scale, shadow_height, dir_x,
+ * dir_y, length, alpha) for one caster under one light; receivers are
+ * (centre_x, centre_y, visual_scale).  Receivers are bucketed into a coarse
+ * tile grid once, and each shadow only visits buckets overlapping its capsule
+ * (the shadow axis widened by the largest possible lateral limit).  Shadows
+ * are applied in row order, so every receiver sees the same multiply-and-clamp
+ * sequence as testing it against each shadow in turn.
+ */
+
+#define DIM_SHADOW_FIELDS 8
+#define DIM_RECEIVER_FIELDS 3
+#define DIM_BUCKET_TILES 4
+
+static inline double max_d(double a, double b) { return a > b ? a : b; }
+static inline double min_d(double a, double b) { return a < b ? a : b; }
+
+typedef struct {
+    const double *receivers;
+    Py_ssize_t count;
+    double origin_x, origin_y; /* world position of bucket (0, 0) */
+    double cell;               /* bucket size in tiles             */
+    Py_ssize_t cols, rows;
+    Py_ssize_t *start; /* [cols * rows + 1] CSR offsets   */
+    Py_ssize_t *order; /* [count] receiver indices        */
+} ReceiverBuckets;
+
+static inline Py_ssize_t bucket_col(const ReceiverBuckets *b, double x) {
+    Py_ssize_t c = (Py_ssize_t)floor((x - b->origin_x) / b->cell);
+    return c < 0 ? 0 : (c >= b->cols ? b->cols - 1 : c);
+}
+
+static inline Py_ssize_t bucket_row(const ReceiverBuckets *b, double y) {
+    Py_ssize_t r = (Py_ssize_t)floor((y - b->origin_y) / b->cell);
+    return r < 0 ? 0 : (r >= b->rows ? b->rows - 1 : r);
+}
+
+/* Fill start/order (already allocated) with a counting sort by bucket. */
+static void build_buckets(ReceiverBuckets *b) {
+    Py_ssize_t cells = b->cols * b->rows;
+    memset(b->start, 0, (size_t)(cells + 1) * sizeof(Py_ssize_t));
+    for (Py_ssize_t i = 0; i < b->count; i++) {
+        const double *r = &b->receivers[i * DIM_RECEIVER_FIELDS];
+        b->start[bucket_row(b, r[1]) * b->cols + bucket_col(b, r[0]) + 1]++;
+    }
+    for (Py_ssize_t c = 0; c < cells; c++)
+        b->start[c + 1] += b->start[c];
+    /* Use the begin offsets as fill cursors, then shift them back. */
+    for (Py_ssize_t i = 0; i < b->count; i++) {
+        const double *r = &b->receivers[i * DIM_RECEIVER_FIELDS];
+        Py_ssize_t cell = bucket_row(b, r[1]) * b->cols + bucket_col(b, r[0]);
+        b->order[b->start[cell]++] = i;
+    }
+    for (Py_ssize_t c = cells; c > 0; c--)
+        b->start[c] = b->start[c - 1];
+    b->start[0] = 0;
+}
+
+static void apply_shadow(const ReceiverBuckets *b,
+                         const double *s,
+                         int32_t self_index,
+                         double max_receiver_radius,
+                         int fade_tip,
+                         double *scales) {
+    double cx = s[0], cy = s[1], dx = s[4], dy = s[5], length = s[6], alpha = s[7];
+    if (length <= 0.0 || alpha <= 0.0)
+        return;
+    if (dx * dx + dy * dy <= 1e-12)
+        return;
+    double height_factor = min_d(1.0, max_d(0.0, s[3]) / 4.0);
+    if (height_factor <= 0.0)
+        return;
+    double half_width = 0.18 + 0.22 * max_d(0.5, s[2]);
+
+    /* Any dimmed receiver centre lies within `reach` of the shadow axis. */
+    double reach = half_width + max_receiver_radius;
+    double tip_x = cx + dx * length, tip_y = cy + dy * length;
+    Py_ssize_t c0 = bucket_col(b, min_d(cx, tip_x) - reach);
+    Py_ssize_t c1 = bucket_col(b, max_d(cx, tip_x) + reach);
+    Py_ssize_t r0 = bucket_row(b, min_d(cy, tip_y) - reach);
+    Py_ssize_t r1 = bucket_row(b, max_d(cy, tip_y) + reach);
+
+    for (Py_ssize_t row = r0; row <= r1; row++) {
+        for (Py_ssize_t col = c0; col <= c1; col++) {
+            Py_ssize_t cell = row * b->cols + col;
+            for (Py_ssize_t k = b->start[cell]; k < b->start[cell + 1]; k++) {
+                Py_ssize_t ri = b->order[k];
+                if (ri == self_index)
+                    continue;
+                const double *r = &b->receivers[ri * DIM_RECEIVER_FIELDS];
+                double radius = 0.2 + 0.18 * max_d(0.5, r[2]);
+                double rel_x = r[0] - cx;
+                double rel_y = r[1] - cy;
+
+                double along = rel_x * dx + rel_y * dy;
+                if (along <= 0.0 || along >= length)
+                    continue;
+                double from_axis = fabs(rel_x * dy - rel_y * dx);
+                double lateral_limit = half_width + radius;
+                if (from_axis >= lateral_limit)
+                    continue;
+
+                double lateral = 1.0 - from_axis / lateral_limit;
+                double tip = fade_tip ? 1.0 - along / length : 1.0;
+                double attenuation = alpha * height_factor * lateral * tip;
+                if (attenuation <= 0.0)
+                    continue;
+                scales[ri] = max_d(0.05, scales[ri] * (1.0 - min_d(0.95, attenuation)));
+            }
+        }
+    }
+}
+
+/*
+ * accumulate_shadow_dimming(shadows, self_index, receivers, scales, fade_tip) -> None
+ */
+PyObject *brileta_native_accumulate_shadow_dimming(PyObject *self, PyObject *args) {
+    PyObject *shadows_obj, *self_obj, *receivers_obj, *scales_obj;
+    int fade_tip;
+
+    if (!PyArg_ParseTuple(args,
+                          "OOOOp",
+                          &shadows_obj,   /* (N, 8) float64 shadow rows            */
+                          &self_obj,      /* (N,) int32 caster's receiver index/-1 */
+                          &receivers_obj, /* (R, 3) float64 receiver rows          */
+                          &scales_obj,    /* (R,) float32 light scales, in/out     */
+                          &fade_tip))
+        return NULL;
+
+    Py_buffer shadows_buf = {0}, self_buf = {0}, receivers_buf = {0}, scales_buf = {0};
+    Py_ssize_t *start = NULL, *order = NULL;
+    double *acc = NULL;
+    PyObject *result = NULL;
+
+    if (PyObject_GetBuffer(shadows_obj, &shadows_buf, PyBUF_C_CONTIGUOUS) < 0)
+        goto done;
+    if (PyObject_GetBuffer(self_obj, &self_buf, PyBUF_C_CONTIGUOUS) < 0)
+        goto done;
+    if (PyObject_GetBuffer(receivers_obj, &receivers_buf, PyBUF_C_CONTIGUOUS) < 0)
+        goto done;
+    if (PyObject_GetBuffer(scales_obj, &scales_buf, PyBUF_C_CONTIGUOUS | PyBUF_WRITABLE) < 0)
+        goto done;
+    if (shadows_buf.itemsize != 8 || receivers_buf.itemsize != 8 || self_buf.itemsize != 4 ||
+        scales_buf.itemsize != 4) {
+        PyErr_SetString(PyExc_TypeError,
+                        "shadows and receivers must be float64, self_index int32, "
+                        "scales float32");
+        goto done;
+    }
+    Py_ssize_t n_shadows = shadows_buf.len / (8 * DIM_SHADOW_FIELDS);
+    Py_ssize_t n_receivers = receivers_buf.len / (8 * DIM_RECEIVER_FIELDS);
+    if (shadows_buf.len != n_shadows * 8 * DIM_SHADOW_FIELDS || self_buf.len != n_shadows * 4 ||
+        receivers_buf.len != n_receivers * 8 * DIM_RECEIVER_FIELDS ||
+        scales_buf.len != n_receivers * 4) {
+        PyErr_SetString(PyExc_ValueError,
+                        "expected shadows (N, 8), self_index (N,), receivers (R, 3), "
+                        "scales (R,)");
+        goto done;
+    }
+    if (n_shadows == 0 || n_receivers == 0) {
+        result = Py_None;
+        Py_INCREF(result);
+        goto done;
+    }
+
+    const double *receivers = (const double *)receivers_buf.buf;
+    double min_x = receivers[0], max_x = receivers[0];
+    double min_y = receivers[1], max_y = receivers[1];
+    double max_radius = 0.0;
+    for (Py_ssize_t i = 0; i < n_receivers; i++) {
+        const double *r = &receivers[i * DIM_RECEIVER_FIELDS];
+        min_x = min_d(min_x, r[0]);
+        max_x = max_d(max_x, r[0]);
+        min_y = min_d(min_y, r[1]);
+        max_y = max_d(max_y, r[1]);
+        max_radius = max_d(max_radius, 0.2 + 0.18 * max_d(0.5, r[2]));
+    }
+
+    /* Grow buckets for sparse receiver sets so the grid stays O(R). */
+    ReceiverBuckets buckets = {
+        .receivers = receivers,
+        .count = n_receivers,
+        .origin_x = min_x,
+        .origin_y = min_y,
+        .cell = DIM_BUCKET_TILES,
+    };
+    for (;;) {
+        buckets.cols = (Py_ssize_t)((max_x - min_x) / buckets.cell) + 1;
+        buckets.rows = (Py_ssize_t)((max_y - min_y) / buckets.cell) + 1;
+        if (buckets.cols * buckets.rows <= 4 * n_receivers + 64)
+            break;
+        buckets.cell *= 2.0;
+    }
+
+    start = PyMem_Malloc((size_t)(buckets.cols * buckets.rows + 1) * sizeof(Py_ssize_t));
+    order = PyMem_Malloc((size_t)n_receivers * sizeof(Py_ssize_t));
+    acc = PyMem_Malloc((size_t)n_receivers * sizeof(double));
+    if (!start || !order || !acc) {
+        PyErr_NoMemory();
+        goto done;
+    }
+    buckets.start = start;
+    buckets.order = order;
+
+    const double *shadows = (const double *)shadows_buf.buf;
+    const int32_t *self_index = (const int32_t *)self_buf.buf;
+    float *scales = (float *)scales_buf.buf;
+
+    /* clang-format off */
+    Py_BEGIN_ALLOW_THREADS
+    build_buckets(&buckets);
+    for (Py_ssize_t i = 0; i < n_receivers; i++)
+        acc[i] = (double)scales[i];
+    for (Py_ssize_t s = 0; s < n_shadows; s++)
+        apply_shadow(&buckets, &shadows[s * DIM_SHADOW_FIELDS], self_index[s], max_radius,
+                     fade_tip, acc);
+    for (Py_ssize_t i = 0; i < n_receivers; i++)
+        scales[i] = (float)acc[i];
+    Py_END_ALLOW_THREADS
+    /* clang-format on */
+
+    result = Py_None;
+    Py_INCREF(result);
+
+done:
+    PyMem_Free(acc);
+    PyMem_Free(order);
+    PyMem_Free(start);
+    if (scales_buf.obj)
+        PyBuffer_Release(&scales_buf);
+    if (receivers_buf.obj)
+        PyBuffer_Release(&receivers_buf);
+    if (self_buf.obj)
+        PyBuffer_Release(&self_buf);
+    if (shadows_buf.obj)
+        PyBuffer_Release(&shadows_buf);
+    return result;
+}
@@ -3,7 +3,8 @@
  *
  * This file implements fast C versions of the Python drawing functions in
  * brileta/sprites/primitives.py, plus the rim-darkening and silhouette
- * nibbling post-processing used by tree and boulder sprite generators.
+ * nibbling post-processing used by tree and boulder sprite generators, and
+ * the humanoid character layer compositor built on those primitives.
  *
  * All canvas parameters are (height, width, 4) uint8 RGBA buffers accessed
  * via the Python buffer protocol (same pattern as _native_fov.c).
@@ -24,6 +25,9 @@
  *   sprite_darken_rim
  *   sprite_nibble_canopy
  *   sprite_nibble_boulder
+ *   sprite_render_mask
+ *   sprite_finish_pose
+ *   sprite_draw_character_poses
  */
 
 #define PY_SSIZE_T_CLEAN
@@ -288,6 +292,50 @@ PyObject *brileta_native_sprite_draw_line(PyObject *self, PyObject *args) {
 /* draw_thick_line: parallel Bresenham lines                            */
 /* ------------------------------------------------------------------ */
 
+static void c_draw_thick_line(uint8_t *data,
+                              int h,
+                              int w,
+                              double fx0,
+                              double fy0,
+                              double fx1,
+                              double fy1,
+                              int r,
+                              int g,
+                              int b,
+                              int a,
+                              int thickness) {
+    if (thickness <= 1) {
+        int ix0 = (int)round(fx0), iy0 = (int)round(fy0);
+        int ix1 = (int)round(fx1), iy1 = (int)round(fy1);
+        c_draw_line(data, h, w, ix0, iy0, ix1, iy1, r, g, b, a);
+        return;
+    }
+
+    double dx = fx1 - fx0;
+    double dy = fy1 - fy0;
+    double length = sqrt(dx * dx + dy * dy);
+    if (length < 0.01) {
+        c_alpha_blend(data, h, w, (int)round(fx0), (int)round(fy0), r, g, b, a);
+        return;
+    }
+
+    /* Unit perpendicular vector. */
+    double px = -dy / length;
+    double py = dx / length;
+    double half = thickness / 2.0;
+
+    for (int i = 0; i < thickness; i++) {
+        double offset = -half + 0.5 + i;
+        double ox = px * offset;
+        double oy = py * offset;
+        int ix0 = (int)round(fx0 + ox);
+        int iy0 = (int)round(fy0 + oy);
+        int ix1 = (int)round(fx1 + ox);
+        int iy1 = (int)round(fy1 + oy);
+        c_draw_line(data, h, w, ix0, iy0, ix1, iy1, r, g, b, a);
+    }
+}
+
 /*
  * sprite_draw_thick_line(canvas, x0, y0, x1, y1, r, g, b, a, thickness)
  */
@@ -306,34 +354,7 @@ PyObject *brileta_native_sprite_draw_thick_line(PyObject *self, PyObject *args)
     if (get_canvas_buffer(canvas_obj, &buf, &h, &w, &data) < 0)
         return NULL;
 
-    if (thickness <= 1) {
-        int ix0 = (int)round(fx0), iy0 = (int)round(fy0);
-        int ix1 = (int)round(fx1), iy1 = (int)round(fy1);
-        c_draw_line(data, h, w, ix0, iy0, ix1, iy1, r, g, b, a);
-    } else {
-        double dx = fx1 - fx0;
-        double dy = fy1 - fy0;
-        double length = sqrt(dx * dx + dy * dy);
-        if (length < 0.01) {
-            c_alpha_blend(data, h, w, (int)round(fx0), (int)round(fy0), r, g, b, a);
-        } else {
-            /* Unit perpendicular vector. */
-            double px = -dy / length;
-            double py = dx / length;
-            double half = thickness / 2.0;
-
-            for (int i = 0; i < thickness; i++) {
-                double offset = -half + 0.5 + i;
-                double ox = px * offset;
-                double oy = py * offset;
-                int ix0 = (int)round(fx0 + ox);
-                int iy0 = (int)round(fy0 + oy);
-                int ix1 = (int)round(fx1 + ox);
-                int iy1 = (int)round(fy1 + oy);
-                c_draw_line(data, h, w, ix0, iy0, ix1, iy1, r, g, b, a);
-            }
-        }
-    }
+    c_draw_thick_line(data, h, w, fx0, fy0, fx1, fy1, r, g, b, a, thickness);
 
     PyBuffer_Release(&buf);
     Py_RETURN_NONE;
@@ -344,61 +365,37 @@ PyObject *brileta_native_sprite_draw_thick_line(PyObject *self, PyObject *args)
 /* ------------------------------------------------------------------ */
 
 /*
- * sprite_draw_tapered_trunk(canvas, cx, y_bottom, y_top,
- *                           w_bottom, w_top, r, g, b, a, root_flare)
+ * Composite a vertically tapered column.  Returns 0 on success, -1 when a
+ * scratch allocation fails.  Touches only raw C buffers, so callers may run
+ * it with the GIL released.
  */
-PyObject *brileta_native_sprite_draw_tapered_trunk(PyObject *self, PyObject *args) {
-    PyObject *canvas_obj;
-    double cx, w_bottom, w_top;
-    int y_bottom, y_top, r, g, b, a, root_flare;
-
-    if (!PyArg_ParseTuple(args,
-                          "Odiiddiiiii",
-                          &canvas_obj,
-                          &cx,
-                          &y_bottom,
-                          &y_top,
-                          &w_bottom,
-                          &w_top,
-                          &r,
-                          &g,
-                          &b,
-                          &a,
-                          &root_flare))
-        return NULL;
-
-    Py_buffer buf;
-    int h, w;
-    uint8_t *data;
-    if (get_canvas_buffer(canvas_obj, &buf, &h, &w, &data) < 0)
-        return NULL;
-
+static int c_draw_tapered_trunk(uint8_t *data,
+                                int h,
+                                int w,
+                                double cx,
+                                int y_bottom,
+                                int y_top,
+                                double w_bottom,
+                                double w_top,
+                                int r,
+                                int g,
+                                int b,
+                                int a,
+                                int root_flare) {
     int height = y_bottom - y_top + 1;
-    if (height <= 0) {
-        PyBuffer_Release(&buf);
-        Py_RETURN_NONE;
-    }
+    if (height <= 0)
+        return 0;
 
     int draw_y_min = clampi(y_top, 0, h - 1);
     int draw_y_max = clampi(y_bottom, 0, h - 1);
-    if (draw_y_min > draw_y_max) {
-        PyBuffer_Release(&buf);
-        Py_RETURN_NONE;
-    }
-
-    /* Release the GIL for the computation-heavy section.  All data has
-     * been extracted from Python objects; only raw C buffers are touched. */
-    int oom = 0;
-
-    Py_BEGIN_ALLOW_THREADS
+    if (draw_y_min > draw_y_max)
+        return 0;
 
-        /* Pre-compute half-widths for all rows. */
-        float inv_height = 1.0f / (float)(height - 1 > 0 ? height - 1 : 1);
+    /* Pre-compute half-widths for all rows. */
+    float inv_height = 1.0f / (float)(height - 1 > 0 ? height - 1 : 1);
     float *half_w = (float *)malloc(sizeof(float) * height);
-    if (!half_w) {
-        oom = 1;
-        goto trunk_done;
-    }
+    if (!half_w)
+        return -1;
 
     for (int i = 0; i < height; i++) {
         float t = (float)i * inv_height; /* 0 at top, 1 at bottom */
@@ -428,55 +425,91 @@ PyObject *brileta_native_sprite_draw_tapered_trunk(PyObject *self, PyObject *arg
     int x_max = clampi((int)ceil(cx + max_hw + 0.5), 0, w - 1);
     if (x_min > x_max) {
         free(half_w);
-        goto trunk_done;
+        return 0;
     }
 
     /* Composite row by row. Build per-pixel source alpha and call
      * c_composite_over for each row to match Python's vectorized path. */
-    {
-        int n_cols = x_max - x_min + 1;
-        int n_rows = draw_y_max - draw_y_min + 1;
-        float *src_a = (float *)calloc((size_t)n_rows * (size_t)n_cols, sizeof(float));
-        if (!src_a) {
-            free(half_w);
-            oom = 1;
-            goto trunk_done;
-        }
+    int n_cols = x_max - x_min + 1;
+    int n_rows = draw_y_max - draw_y_min + 1;
+    float *src_a = (float *)calloc((size_t)n_rows * (size_t)n_cols, sizeof(float));
+    if (!src_a) {
+        free(half_w);
+        return -1;
+    }
 
-        for (int row = draw_y_min; row <= draw_y_max; row++) {
-            int li = row - y_top;
-            float hw = half_w[li];
-            int ri = row - draw_y_min;
+    for (int row = draw_y_min; row <= draw_y_max; row++) {
+        int li = row - y_top;
+        float hw = half_w[li];
+        int ri = row - draw_y_min;
 
-            for (int col = x_min; col <= x_max; col++) {
-                float dist = fabsf((float)col - (float)cx);
-                int ci = col - x_min;
+        for (int col = x_min; col <= x_max; col++) {
+            float dist = fabsf((float)col - (float)cx);
+            int ci = col - x_min;
 
-                if (dist > hw + 0.5f)
-                    continue; /* outside */
+            if (dist > hw + 0.5f)
+                continue; /* outside */
 
-                float alpha_f;
-                if (dist > hw - 0.5f) {
-                    /* Edge pixel: anti-alias. */
-                    float edge = maxf(0.0f, 1.0f - (dist - hw + 0.5f));
-                    alpha_f = floorf((float)a * edge) / 255.0f;
-                } else {
-                    alpha_f = (float)a / 255.0f;
-                }
-                src_a[ri * n_cols + ci] = alpha_f;
+            float alpha_f;
+            if (dist > hw - 0.5f) {
+                /* Edge pixel: anti-alias. */
+                float edge = maxf(0.0f, 1.0f - (dist - hw + 0.5f));
+                alpha_f = floorf((float)a * edge) / 255.0f;
+            } else {
+                alpha_f = (float)a / 255.0f;
             }
+            src_a[ri * n_cols + ci] = alpha_f;
         }
-
-        c_composite_over(data, w, draw_y_min, draw_y_max, x_min, x_max, src_a, r, g, b);
-        free(src_a);
-        free(half_w);
     }
 
-trunk_done:
+    c_composite_over(data, w, draw_y_min, draw_y_max, x_min, x_max, src_a, r, g, b);
+    free(src_a);
+    free(half_w);
+    return 0;
+}
+
+/*
+ * sprite_draw_tapered_trunk(canvas, cx, y_bottom, y_top,
+ *                           w_bottom, w_top, r, g, b, a, root_flare)
+ */
+PyObject *brileta_native_sprite_draw_tapered_trunk(PyObject *self, PyObject *args) {
+    PyObject *canvas_obj;
+    double cx, w_bottom, w_top;
+    int y_bottom, y_top, r, g, b, a, root_flare;
+
+    if (!PyArg_ParseTuple(args,
+                          "Odiiddiiiii",
+                          &canvas_obj,
+                          &cx,
+                          &y_bottom,
+                          &y_top,
+                          &w_bottom,
+                          &w_top,
+                          &r,
+                          &g,
+                          &b,
+                          &a,
+                          &root_flare))
+        return NULL;
+
+    Py_buffer buf;
+    int h, w;
+    uint8_t *data;
+    if (get_canvas_buffer(canvas_obj, &buf, &h, &w, &data) < 0)
+        return NULL;
+
+    /* Release the GIL for the computation-heavy section.  All data has
+     * been extracted from Python objects; only raw C buffers are touched. */
+    int rc;
+    /* clang-format off */
+    Py_BEGIN_ALLOW_THREADS
+    rc = c_draw_tapered_trunk(
+        data, h, w, cx, y_bottom, y_top, w_bottom, w_top, r, g, b, a, root_flare);
     Py_END_ALLOW_THREADS
+    /* clang-format on */
 
-        PyBuffer_Release(&buf);
-    if (oom)
+    PyBuffer_Release(&buf);
+    if (rc < 0)
         return PyErr_NoMemory();
     Py_RETURN_NONE;
 }
@@ -646,49 +679,29 @@ static void batch_stamp_from_specs(uint8_t *data,
 /* stamp_fuzzy_circle                                                   */
 /* ------------------------------------------------------------------ */
 
-/*
- * sprite_stamp_fuzzy_circle(canvas, cx, cy, radius, r, g, b, a,
- *                           falloff, hardness)
- */
-PyObject *brileta_native_sprite_stamp_fuzzy_circle(PyObject *self, PyObject *args) {
-    PyObject *canvas_obj;
-    double cx, cy, radius, falloff, hardness;
-    int r, g, b, a;
-
-    if (!PyArg_ParseTuple(args,
-                          "Odddiiiidd",
-                          &canvas_obj,
-                          &cx,
-                          &cy,
-                          &radius,
-                          &r,
-                          &g,
-                          &b,
-                          &a,
-                          &falloff,
-                          &hardness))
-        return NULL;
-
-    Py_buffer buf;
-    int h, w;
-    uint8_t *data;
-    if (get_canvas_buffer(canvas_obj, &buf, &h, &w, &data) < 0)
-        return NULL;
-
+/* Stamp one soft circle in place.  Touches only raw C buffers. */
+static void c_stamp_fuzzy_circle(uint8_t *data,
+                                 int h,
+                                 int w,
+                                 double cx,
+                                 double cy,
+                                 double radius,
+                                 int r,
+                                 int g,
+                                 int b,
+                                 int a,
+                                 double falloff,
+                                 double hardness) {
     int r_ceil = (int)ceil(radius) + 1;
     int y_min = clampi((int)cy - r_ceil, 0, h - 1);
     int y_max = clampi((int)cy + r_ceil, 0, h - 1);
     int x_min = clampi((int)cx - r_ceil, 0, w - 1);
     int x_max = clampi((int)cx + r_ceil, 0, w - 1);
-    if (y_min > y_max || x_min > x_max) {
-        PyBuffer_Release(&buf);
-        Py_RETURN_NONE;
-    }
-
-    Py_BEGIN_ALLOW_THREADS
+    if (y_min > y_max || x_min > x_max)
+        return;
 
-        /* Alpha profile parameters. */
-        float hc = clampf((float)hardness, 0.0f, 1.0f);
+    /* Alpha profile parameters. */
+    float hc = clampf((float)hardness, 0.0f, 1.0f);
     float inner_fraction = 0.3f + 0.55f * hc;
     float ef = (float)falloff + 2.5f * hc;
     float inner_r = (float)radius * inner_fraction;
@@ -731,33 +744,23 @@ PyObject *brileta_native_sprite_stamp_fuzzy_circle(PyObject *self, PyObject *arg
             px[3] = (uint8_t)clampi((int)(out_a * 255.0f), 0, 255);
         }
     }
-
-    Py_END_ALLOW_THREADS
-
-        PyBuffer_Release(&buf);
-    Py_RETURN_NONE;
 }
 
-/* ------------------------------------------------------------------ */
-/* stamp_ellipse                                                        */
-/* ------------------------------------------------------------------ */
-
 /*
- * sprite_stamp_ellipse(canvas, cx, cy, rx, ry, r, g, b, a,
- *                      falloff, hardness)
+ * sprite_stamp_fuzzy_circle(canvas, cx, cy, radius, r, g, b, a,
+ *                           falloff, hardness)
  */
-PyObject *brileta_native_sprite_stamp_ellipse(PyObject *self, PyObject *args) {
+PyObject *brileta_native_sprite_stamp_fuzzy_circle(PyObject *self, PyObject *args) {
     PyObject *canvas_obj;
-    double cx, cy, rx, ry, falloff, hardness;
+    double cx, cy, radius, falloff, hardness;
     int r, g, b, a;
 
     if (!PyArg_ParseTuple(args,
-                          "Oddddiiiidd",
+                          "Odddiiiidd",
                           &canvas_obj,
                           &cx,
                           &cy,
-                          &rx,
-                          &ry,
+                          &radius,
                           &r,
                           &g,
                           &b,
@@ -766,29 +769,53 @@ PyObject *brileta_native_sprite_stamp_ellipse(PyObject *self, PyObject *args) {
                           &hardness))
         return NULL;
 
-    if (rx <= 0.0 || ry <= 0.0)
-        Py_RETURN_NONE;
-
     Py_buffer buf;
     int h, w;
     uint8_t *data;
     if (get_canvas_buffer(canvas_obj, &buf, &h, &w, &data) < 0)
         return NULL;
 
+    /* clang-format off */
+    Py_BEGIN_ALLOW_THREADS
+    c_stamp_fuzzy_circle(data, h, w, cx, cy, radius, r, g, b, a, falloff, hardness);
+    Py_END_ALLOW_THREADS
+    /* clang-format on */
+
+    PyBuffer_Release(&buf);
+    Py_RETURN_NONE;
+}
+
+/* ------------------------------------------------------------------ */
+/* stamp_ellipse                                                        */
+/* ------------------------------------------------------------------ */
+
+/* Stamp one soft ellipse in place.  Touches only raw C buffers. */
+static void c_stamp_ellipse(uint8_t *data,
+                            int h,
+                            int w,
+                            double cx,
+                            double cy,
+                            double rx,
+                            double ry,
+                            int r,
+                            int g,
+                            int b,
+                            int a,
+                            double falloff,
+                            double hardness) {
+    if (rx <= 0.0 || ry <= 0.0)
+        return;
+
     int rx_ceil = (int)ceil(rx) + 1;
     int ry_ceil = (int)ceil(ry) + 1;
     int y_min = clampi((int)cy - ry_ceil, 0, h - 1);
     int y_max = clampi((int)cy + ry_ceil, 0, h - 1);
     int x_min = clampi((int)cx - rx_ceil, 0, w - 1);
     int x_max = clampi((int)cx + rx_ceil, 0, w - 1);
-    if (y_min > y_max || x_min > x_max) {
-        PyBuffer_Release(&buf);
-        Py_RETURN_NONE;
-    }
-
-    Py_BEGIN_ALLOW_THREADS
+    if (y_min > y_max || x_min > x_max)
+        return;
 
-        float hc = clampf((float)hardness, 0.0f, 1.0f);
+    float hc = clampf((float)hardness, 0.0f, 1.0f);
     float inner_fraction = 0.3f + 0.55f * hc;
     float ef = (float)falloff + 2.5f * hc;
     float outer_fraction = maxf(1e-6f, 1.0f - inner_fraction);
@@ -820,41 +847,79 @@ PyObject *brileta_native_sprite_stamp_ellipse(PyObject *self, PyObject *args) {
             px[3] = (uint8_t)clampi((int)(out_a * 255.0f), 0, 255);
         }
     }
-
-    Py_END_ALLOW_THREADS
-
-        PyBuffer_Release(&buf);
-    Py_RETURN_NONE;
 }
 
-/* ------------------------------------------------------------------ */
-/* batch_stamp_ellipses / batch_stamp_circles                           */
-/* ------------------------------------------------------------------ */
-
 /*
- * Parse a Python list of (cx, cy, rx, ry) tuples into an EllipseSpec array.
- * Returns 0 on success, -1 on error (exception set).
- * Caller must free *specs_out on success.
+ * sprite_stamp_ellipse(canvas, cx, cy, rx, ry, r, g, b, a,
+ *                      falloff, hardness)
  */
-static int parse_ellipse_specs(PyObject *list, int *n_out, EllipseSpec **specs_out) {
-    Py_ssize_t n = PyList_Size(list);
-    if (n <= 0) {
-        *n_out = 0;
-        *specs_out = NULL;
-        return 0;
-    }
-
-    EllipseSpec *specs = (EllipseSpec *)malloc(sizeof(EllipseSpec) * n);
-    if (!specs) {
-        PyErr_NoMemory();
-        return -1;
-    }
+PyObject *brileta_native_sprite_stamp_ellipse(PyObject *self, PyObject *args) {
+    PyObject *canvas_obj;
+    double cx, cy, rx, ry, falloff, hardness;
+    int r, g, b, a;
 
-    int count = 0;
-    for (Py_ssize_t i = 0; i < n; i++) {
-        PyObject *item = PyList_GET_ITEM(list, i);
-        double ecx, ecy, erx, ery;
-        if (!PyArg_ParseTuple(item, "dddd", &ecx, &ecy, &erx, &ery)) {
+    if (!PyArg_ParseTuple(args,
+                          "Oddddiiiidd",
+                          &canvas_obj,
+                          &cx,
+                          &cy,
+                          &rx,
+                          &ry,
+                          &r,
+                          &g,
+                          &b,
+                          &a,
+                          &falloff,
+                          &hardness))
+        return NULL;
+
+    if (rx <= 0.0 || ry <= 0.0)
+        Py_RETURN_NONE;
+
+    Py_buffer buf;
+    int h, w;
+    uint8_t *data;
+    if (get_canvas_buffer(canvas_obj, &buf, &h, &w, &data) < 0)
+        return NULL;
+
+    /* clang-format off */
+    Py_BEGIN_ALLOW_THREADS
+    c_stamp_ellipse(data, h, w, cx, cy, rx, ry, r, g, b, a, falloff, hardness);
+    Py_END_ALLOW_THREADS
+    /* clang-format on */
+
+    PyBuffer_Release(&buf);
+    Py_RETURN_NONE;
+}
+
+/* ------------------------------------------------------------------ */
+/* batch_stamp_ellipses / batch_stamp_circles                           */
+/* ------------------------------------------------------------------ */
+
+/*
+ * Parse a Python list of (cx, cy, rx, ry) tuples into an EllipseSpec array.
+ * Returns 0 on success, -1 on error (exception set).
+ * Caller must free *specs_out on success.
+ */
+static int parse_ellipse_specs(PyObject *list, int *n_out, EllipseSpec **specs_out) {
+    Py_ssize_t n = PyList_Size(list);
+    if (n <= 0) {
+        *n_out = 0;
+        *specs_out = NULL;
+        return 0;
+    }
+
+    EllipseSpec *specs = (EllipseSpec *)malloc(sizeof(EllipseSpec) * n);
+    if (!specs) {
+        PyErr_NoMemory();
+        return -1;
+    }
+
+    int count = 0;
+    for (Py_ssize_t i = 0; i < n; i++) {
+        PyObject *item = PyList_GET_ITEM(list, i);
+        double ecx, ecy, erx, ery;
+        if (!PyArg_ParseTuple(item, "dddd", &ecx, &ecy, &erx, &ery)) {
             free(specs);
             return -1;
         }
@@ -1524,6 +1589,35 @@ static int compute_rim_mask(const uint8_t *data, int h, int w, uint8_t *rim) {
 /* darken_rim: darken 1px silhouette rim pixels                         */
 /* ------------------------------------------------------------------ */
 
+/*
+ * Darken rim pixels in place.  Two passes: first identify rim pixels, then
+ * darken, because darkening while scanning would affect neighbor alpha
+ * checks.  Returns -1 on allocation failure (no exception set; safe to call
+ * without the GIL), 0 otherwise.
+ */
+static int c_darken_rim(uint8_t *data, int h, int w, int dr, int dg, int db) {
+    size_t n_pixels = (size_t)h * (size_t)w;
+    uint8_t *rim = (uint8_t *)calloc(n_pixels, 1);
+    if (!rim)
+        return -1;
+
+    if (compute_rim_mask(data, h, w, rim) > 0) {
+        for (int row = 0; row < h; row++) {
+            for (int col = 0; col < w; col++) {
+                if (!rim[row * w + col])
+                    continue;
+                uint8_t *px = PX(data, row, col, w);
+                px[0] = (uint8_t)clampi((int)px[0] - dr, 0, 255);
+                px[1] = (uint8_t)clampi((int)px[1] - dg, 0, 255);
+                px[2] = (uint8_t)clampi((int)px[2] - db, 0, 255);
+            }
+        }
+    }
+
+    free(rim);
+    return 0;
+}
+
 /*
  * sprite_darken_rim(canvas, darken_r, darken_g, darken_b)
  *
@@ -1543,47 +1637,15 @@ PyObject *brileta_native_sprite_darken_rim(PyObject *self, PyObject *args) {
     if (get_canvas_buffer(canvas_obj, &buf, &h, &w, &data) < 0)
         return NULL;
 
-    int oom = 0;
-
+    int rc;
+    /* clang-format off */
     Py_BEGIN_ALLOW_THREADS
-
-        /*
-         * Two-pass approach: first identify rim pixels, then darken.
-         * We need two passes because darkening while scanning would affect
-         * neighbor alpha checks.
-         */
-        size_t n_pixels = (size_t)h * (size_t)w;
-    uint8_t *rim = (uint8_t *)calloc(n_pixels, 1);
-    if (!rim) {
-        oom = 1;
-        goto rim_done;
-    }
-
-    int rim_count = compute_rim_mask(data, h, w, rim);
-    if (rim_count == 0) {
-        free(rim);
-        goto rim_done;
-    }
-
-    /* Darken rim pixels. */
-    for (int row = 0; row < h; row++) {
-        for (int col = 0; col < w; col++) {
-            if (!rim[row * w + col])
-                continue;
-            uint8_t *px = PX(data, row, col, w);
-            px[0] = (uint8_t)clampi((int)px[0] - dr, 0, 255);
-            px[1] = (uint8_t)clampi((int)px[1] - dg, 0, 255);
-            px[2] = (uint8_t)clampi((int)px[2] - db, 0, 255);
-        }
-    }
-
-    free(rim);
-
-rim_done:
+    rc = c_darken_rim(data, h, w, dr, dg, db);
     Py_END_ALLOW_THREADS
+    /* clang-format on */
 
-        PyBuffer_Release(&buf);
-    if (oom)
+    PyBuffer_Release(&buf);
+    if (rc < 0)
         return PyErr_NoMemory();
     Py_RETURN_NONE;
 }
@@ -1888,3 +1950,1430 @@ nibble_boulder_done:
         return PyErr_NoMemory();
     Py_RETURN_NONE;
 }
+
+/* ------------------------------------------------------------------ */
+/* render_mask: head-anchored pixel-mask rasterization                  */
+/* ------------------------------------------------------------------ */
+
+/*
+ * Rasterize a (rows, cols) tone grid into the canvas box [left, right) x
+ * [top, bottom).  `pal` holds the three palette tones as nine ints.
+ */
+static void c_render_mask(uint8_t *data,
+                          int h,
+                          int w,
+                          const int8_t *tones,
+                          int rows,
+                          int cols,
+                          double left,
+                          double top,
+                          double right,
+                          double bottom,
+                          int mirror,
+                          const int *pal) {
+    double span_x = right - left;
+    double span_y = bottom - top;
+    if (span_x <= 0.0 || span_y <= 0.0)
+        return;
+
+    int px_start = (int)floor(left);
+    int px_end = (int)ceil(right);
+    int py_start = (int)floor(top);
+    int py_end = (int)ceil(bottom);
+    if (px_start < 0)
+        px_start = 0;
+    if (px_end > w)
+        px_end = w;
+    if (py_start < 0)
+        py_start = 0;
+    if (py_end > h)
+        py_end = h;
+
+    for (int py = py_start; py < py_end; py++) {
+        /* +0.5 samples the pixel center so rounding is symmetric. */
+        double v = ((double)py + 0.5 - top) / span_y;
+        int row = (int)(v * rows);
+        if (row < 0 || row >= rows)
+            continue;
+        for (int px = px_start; px < px_end; px++) {
+            double u = ((double)px + 0.5 - left) / span_x;
+            int col = (int)(u * cols);
+            if (col < 0 || col >= cols)
+                continue;
+            int tone = tones[row * cols + (mirror ? cols - 1 - col : col)];
+            if (tone < 0 || tone > 2)
+                continue;
+            uint8_t *dst = PX(data, py, px, w);
+            dst[0] = (uint8_t)pal[tone * 3];
+            dst[1] = (uint8_t)pal[tone * 3 + 1];
+            dst[2] = (uint8_t)pal[tone * 3 + 2];
+            dst[3] = 255;
+        }
+    }
+}
+
+/*
+ * sprite_render_mask(canvas, tones, left, top, right, bottom, mirror,
+ *                    r0, g0, b0, r1, g1, b1, r2, g2, b2)
+ *
+ * Native twin of brileta.sprites.characters.masks.render_mask.  `tones` is
+ * a (rows, cols) int8 grid (-1 transparent, else palette tone 0/1/2); the
+ * placement box is given in canvas pixels.  Each canvas pixel in the box
+ * samples the nearest mask cell at its pixel center and opaque cells are
+ * written as fully opaque palette pixels.  The sampling arithmetic is done
+ * in double precision in the same order as the Python loop, so the output
+ * is pixel-identical.
+ */
+PyObject *brileta_native_sprite_render_mask(PyObject *self, PyObject *args) {
+    PyObject *canvas_obj, *tones_obj;
+    double left, top, right, bottom;
+    int mirror;
+    int pal[9];
+
+    if (!PyArg_ParseTuple(args,
+                          "OOddddpiiiiiiiii",
+                          &canvas_obj,
+                          &tones_obj,
+                          &left,
+                          &top,
+                          &right,
+                          &bottom,
+                          &mirror,
+                          &pal[0],
+                          &pal[1],
+                          &pal[2],
+                          &pal[3],
+                          &pal[4],
+                          &pal[5],
+                          &pal[6],
+                          &pal[7],
+                          &pal[8]))
+        return NULL;
+
+    Py_buffer buf, tones_buf;
+    int h, w;
+    uint8_t *data;
+    if (get_canvas_buffer(canvas_obj, &buf, &h, &w, &data) < 0)
+        return NULL;
+    if (PyObject_GetBuffer(tones_obj, &tones_buf, PyBUF_C_CONTIGUOUS) < 0) {
+        PyBuffer_Release(&buf);
+        return NULL;
+    }
+    if (tones_buf.ndim != 2 || tones_buf.itemsize != 1) {
+        PyBuffer_Release(&tones_buf);
+        PyBuffer_Release(&buf);
+        PyErr_SetString(PyExc_TypeError, "tones must be a contiguous (rows, cols) int8 array");
+        return NULL;
+    }
+
+    c_render_mask(data,
+                  h,
+                  w,
+                  (const int8_t *)tones_buf.buf,
+                  (int)tones_buf.shape[0],
+                  (int)tones_buf.shape[1],
+                  left,
+                  top,
+                  right,
+                  bottom,
+                  mirror,
+                  pal);
+
+    PyBuffer_Release(&tones_buf);
+    PyBuffer_Release(&buf);
+    Py_RETURN_NONE;
+}
+
+/* ------------------------------------------------------------------ */
+/* finish_pose: alpha snap + mirror + rim darkening                     */
+/* ------------------------------------------------------------------ */
+
+/*
+ * Alpha snap, optional horizontal mirror and rim darkening for one pose.
+ * Returns 0 on success, -1 when the rim scratch allocation fails.
+ */
+static int c_finish_pose(
+    uint8_t *data, int h, int w, int threshold, int mirror, int dr, int dg, int db) {
+    size_t n_pixels = (size_t)h * (size_t)w;
+    for (size_t i = 0; i < n_pixels; i++)
+        data[i * 4 + 3] = data[i * 4 + 3] >= threshold ? 255 : 0;
+
+    if (mirror) {
+        for (int row = 0; row < h; row++) {
+            for (int a = 0, b = w - 1; a < b; a++, b--) {
+                uint32_t tmp;
+                memcpy(&tmp, PX(data, row, a, w), 4);
+                memcpy(PX(data, row, a, w), PX(data, row, b, w), 4);
+                memcpy(PX(data, row, b, w), &tmp, 4);
+            }
+        }
+    }
+
+    return c_darken_rim(data, h, w, dr, dg, db);
+}
+
+/*
+ * sprite_finish_pose(canvas, alpha_threshold, mirror, darken_r, darken_g,
+ *                    darken_b)
+ *
+ * Post-process one freshly drawn character/critter pose in place: binarize
+ * alpha (>= threshold becomes 255, else 0, RGB untouched), optionally mirror
+ * the canvas horizontally, then darken the silhouette rim exactly like
+ * sprite_darken_rim.  Replaces three numpy passes and a copy per pose.
+ */
+PyObject *brileta_native_sprite_finish_pose(PyObject *self, PyObject *args) {
+    PyObject *canvas_obj;
+    int threshold, mirror, dr, dg, db;
+
+    if (!PyArg_ParseTuple(args, "Oipiii", &canvas_obj, &threshold, &mirror, &dr, &dg, &db))
+        return NULL;
+
+    Py_buffer buf;
+    int h, w;
+    uint8_t *data;
+    if (get_canvas_buffer(canvas_obj, &buf, &h, &w, &data) < 0)
+        return NULL;
+
+    int rc;
+    /* clang-format off */
+    Py_BEGIN_ALLOW_THREADS
+    rc = c_finish_pose(data, h, w, threshold, mirror, dr, dg, db);
+    Py_END_ALLOW_THREADS
+    /* clang-format on */
+
+    PyBuffer_Release(&buf);
+    if (rc < 0)
+        return PyErr_NoMemory();
+    Py_RETURN_NONE;
+}
+
+/* ------------------------------------------------------------------ */
+/* draw_character_poses: native character layer compositor              */
+/* ------------------------------------------------------------------ */
+
+/*
+ * Native twin of the character layer pipeline in brileta/sprites/characters/
+ * (renderer._CHARACTER_LAYER_PIPELINE plus renderer._render_pose).  Each
+ * layer below mirrors the Python layer of the same name and stamps with the
+ * same primitives.  Geometry is computed in double precision with the same
+ * operations in the same order as the Python code, so the output is
+ * pixel-identical to it; keep the two in lockstep when a layer changes.
+ *
+ * The geometry must round exactly like Python floats, so stop the compiler
+ * from contracting a * b + c into an FMA (clang does so by default on arm64,
+ * GCC on any FMA target).
+ */
+#if defined(__clang__)
+#pragma STDC FP_CONTRACT OFF
+#elif defined(__GNUC__)
+#pragma GCC optimize("fp-contract=off")
+#endif
+
+/* Per-actor float64 record, packed by renderer._native_appearance_record. */
+enum {
+    CHAR_CANVAS_SIZE,
+    CHAR_HEAD_RADIUS,
+    CHAR_HEAD_TOP_PAD,
+    CHAR_TORSO_RX,
+    CHAR_TORSO_RY,
+    CHAR_TORSO_CY_FACTOR,
+    CHAR_BELLY_RX,
+    CHAR_BELLY_RY,
+    CHAR_BELLY_CY_OFFSET,
+    CHAR_SHOULDER_WIDTH,
+    CHAR_ARM_THICKNESS,
+    CHAR_LEG_SPACING,
+    CHAR_LEG_W1,
+    CHAR_LEG_W2,
+    CHAR_NECK_RX,
+    CHAR_NECK_RY,
+    CHAR_NECK_GAP,
+    CHAR_HAND_RADIUS,
+    CHAR_ARM_SHOULDER_FACTOR,
+    CHAR_ARM_END_TORSO_FACTOR,
+    CHAR_ARM_END_BELLY_FACTOR,
+    CHAR_ARM_SHOULDER_ANCHOR_TORSO_FACTOR,
+    CHAR_ARM_SHOULDER_ANCHOR_SHOULDER_WIDTH_FACTOR,
+    CHAR_ARM_HAND_INSET,
+    CHAR_ARM_HAND_DROP,
+    CHAR_ARM_HAND_ALPHA,
+    CHAR_NECK_Y_OFFSET,
+    CHAR_ARM_END_FROM_BELLY,
+    CHAR_LEG_FROM_TORSO,
+    CHAR_TORSO_KIND,
+    CHAR_COLLAR_KIND,
+    CHAR_COVERS_LEGS,
+    CHAR_HAIR_IS_LONG,
+    CHAR_HAIR_IS_TALL,
+    CHAR_HAIR_MASK,                       /* 3 mask slots: north, side, south */
+    CHAR_COLLAR_MASK = CHAR_HAIR_MASK + 3, /* 3 mask slots: north, side, south */
+    CHAR_SKIN_PAL = CHAR_COLLAR_MASK + 3, /* 3 tones x RGB */
+    CHAR_HAIR_PAL = CHAR_SKIN_PAL + 9,
+    CHAR_CLOTH_PAL = CHAR_HAIR_PAL + 9,
+    CHAR_PANTS_PAL = CHAR_CLOTH_PAL + 9,
+    CHAR_RECORD_LEN = CHAR_PANTS_PAL + 9,
+};
+
+/* Per-pose float64 record: facing then the Pose offsets. */
+enum {
+    POSE_FACING,
+    POSE_LEFT_LEG_DX,
+    POSE_LEFT_LEG_DY,
+    POSE_RIGHT_LEG_DX,
+    POSE_RIGHT_LEG_DY,
+    POSE_LEFT_ARM_DY,
+    POSE_RIGHT_ARM_DY,
+    POSE_BODY_DY,
+    POSE_RECORD_LEN,
+};
+
+/* Per-mask float64 record: tone-grid location plus head-relative box. */
+enum {
+    MASK_OFFSET,
+    MASK_ROWS,
+    MASK_COLS,
+    MASK_X0_F,
+    MASK_Y0_F,
+    MASK_X1_F,
+    MASK_Y1_F,
+    MASK_RECORD_LEN,
+};
+
+/* Facing order of brileta.types.Facing. */
+enum { FACING_SOUTH, FACING_NORTH, FACING_EAST, FACING_WEST };
+/* Mask-set key order: "north", "side", "south". */
+enum { MASK_KEY_NORTH, MASK_KEY_SIDE, MASK_KEY_SOUTH };
+/* Torso draw function: _draw_bare/shirt/armor/robe_torso. */
+enum { TORSO_BARE, TORSO_SHIRT, TORSO_ARMOR, TORSO_ROBE };
+/* Collar mask set, -1 for styles without a collar. */
+enum { COLLAR_SHIRT, COLLAR_ARMOR, COLLAR_ROBE };
+
+typedef struct {
+    int r, g, b;
+} CharRgb;
+
+typedef struct {
+    int canvas_size;
+    double head_radius;
+    double head_top_pad;
+    double torso_rx;
+    double torso_ry;
+    double torso_cy_factor;
+    double belly_rx;
+    double belly_ry;
+    double belly_cy_offset;
+    double shoulder_width;
+    int arm_thickness;
+    double leg_spacing;
+    double leg_w1;
+    double leg_w2;
+    double neck_rx;
+    double neck_ry;
+    double neck_gap;
+    double hand_radius;
+    double arm_shoulder_factor;
+    double arm_end_torso_factor;
+    double arm_end_belly_factor;
+    double arm_shoulder_anchor_torso_factor;
+    double arm_shoulder_anchor_shoulder_width_factor;
+    double arm_hand_inset;
+    double arm_hand_drop;
+    int arm_hand_alpha;
+    double neck_y_offset;
+    int arm_end_from_belly;
+    int leg_from_torso;
+    int torso_kind;
+    int collar_kind;
+    int covers_legs;
+    int hair_is_long;
+    int hair_is_tall;
+    int hair_mask[3];
+    int collar_mask[3];
+    CharRgb skin[3];
+    CharRgb hair[3];
+    CharRgb cloth[3];
+    CharRgb pants[3];
+} CharAppearance;
+
+typedef struct {
+    int facing;
+    double left_leg_dx;
+    double left_leg_dy;
+    double right_leg_dx;
+    double right_leg_dy;
+    double left_arm_dy;
+    double right_arm_dy;
+    double body_dy;
+} CharPose;
+
+/* Shared geometry for one pose (renderer.CharacterDrawContext). */
+typedef struct {
+    uint8_t *data;
+    int size;
+    const CharAppearance *ap;
+    const CharPose *pose;
+    const int8_t *mask_tones;
+    const double *mask_boxes;
+    int side_view;
+    double cx;
+    double hr;
+    double head_cy;
+    double torso_cy;
+    double belly_cy;
+    double torso_bottom;
+    int leg_bottom;
+    int leg_top;
+    int is_thin_legs;
+} CharContext;
+
+static void char_unpack_palette(const double *rec, CharRgb *pal) {
+    for (int t = 0; t < 3; t++) {
+        pal[t].r = (int)rec[t * 3];
+        pal[t].g = (int)rec[t * 3 + 1];
+        pal[t].b = (int)rec[t * 3 + 2];
+    }
+}
+
+static void char_unpack_appearance(const double *rec, CharAppearance *ap) {
+    ap->canvas_size = (int)rec[CHAR_CANVAS_SIZE];
+    ap->head_radius = rec[CHAR_HEAD_RADIUS];
+    ap->head_top_pad = rec[CHAR_HEAD_TOP_PAD];
+    ap->torso_rx = rec[CHAR_TORSO_RX];
+    ap->torso_ry = rec[CHAR_TORSO_RY];
+    ap->torso_cy_factor = rec[CHAR_TORSO_CY_FACTOR];
+    ap->belly_rx = rec[CHAR_BELLY_RX];
+    ap->belly_ry = rec[CHAR_BELLY_RY];
+    ap->belly_cy_offset = rec[CHAR_BELLY_CY_OFFSET];
+    ap->shoulder_width = rec[CHAR_SHOULDER_WIDTH];
+    ap->arm_thickness = (int)rec[CHAR_ARM_THICKNESS];
+    ap->leg_spacing = rec[CHAR_LEG_SPACING];
+    ap->leg_w1 = rec[CHAR_LEG_W1];
+    ap->leg_w2 = rec[CHAR_LEG_W2];
+    ap->neck_rx = rec[CHAR_NECK_RX];
+    ap->neck_ry = rec[CHAR_NECK_RY];
+    ap->neck_gap = rec[CHAR_NECK_GAP];
+    ap->hand_radius = rec[CHAR_HAND_RADIUS];
+    ap->arm_shoulder_factor = rec[CHAR_ARM_SHOULDER_FACTOR];
+    ap->arm_end_torso_factor = rec[CHAR_ARM_END_TORSO_FACTOR];
+    ap->arm_end_belly_factor = rec[CHAR_ARM_END_BELLY_FACTOR];
+    ap->arm_shoulder_anchor_torso_factor = rec[CHAR_ARM_SHOULDER_ANCHOR_TORSO_FACTOR];
+    ap->arm_shoulder_anchor_shoulder_width_factor =
+        rec[CHAR_ARM_SHOULDER_ANCHOR_SHOULDER_WIDTH_FACTOR];
+    ap->arm_hand_inset = rec[CHAR_ARM_HAND_INSET];
+    ap->arm_hand_drop = rec[CHAR_ARM_HAND_DROP];
+    ap->arm_hand_alpha = (int)rec[CHAR_ARM_HAND_ALPHA];
+    ap->neck_y_offset = rec[CHAR_NECK_Y_OFFSET];
+    ap->arm_end_from_belly = rec[CHAR_ARM_END_FROM_BELLY] != 0.0;
+    ap->leg_from_torso = rec[CHAR_LEG_FROM_TORSO] != 0.0;
+    ap->torso_kind = (int)rec[CHAR_TORSO_KIND];
+    ap->collar_kind = (int)rec[CHAR_COLLAR_KIND];
+    ap->covers_legs = rec[CHAR_COVERS_LEGS] != 0.0;
+    ap->hair_is_long = rec[CHAR_HAIR_IS_LONG] != 0.0;
+    ap->hair_is_tall = rec[CHAR_HAIR_IS_TALL] != 0.0;
+    for (int k = 0; k < 3; k++) {
+        ap->hair_mask[k] = (int)rec[CHAR_HAIR_MASK + k];
+        ap->collar_mask[k] = (int)rec[CHAR_COLLAR_MASK + k];
+    }
+    char_unpack_palette(rec + CHAR_SKIN_PAL, ap->skin);
+    char_unpack_palette(rec + CHAR_HAIR_PAL, ap->hair);
+    char_unpack_palette(rec + CHAR_CLOTH_PAL, ap->cloth);
+    char_unpack_palette(rec + CHAR_PANTS_PAL, ap->pants);
+}
+
+static void char_unpack_pose(const double *rec, CharPose *pose) {
+    pose->facing = (int)rec[POSE_FACING];
+    pose->left_leg_dx = rec[POSE_LEFT_LEG_DX];
+    pose->left_leg_dy = rec[POSE_LEFT_LEG_DY];
+    pose->right_leg_dx = rec[POSE_RIGHT_LEG_DX];
+    pose->right_leg_dy = rec[POSE_RIGHT_LEG_DY];
+    pose->left_arm_dy = rec[POSE_LEFT_ARM_DY];
+    pose->right_arm_dy = rec[POSE_RIGHT_ARM_DY];
+    pose->body_dy = rec[POSE_BODY_DY];
+}
+
+/* Stamping helpers: primitives.stamp_ellipse/stamp_fuzzy_circle with an RGB. */
+static void char_ellipse(const CharContext *c,
+                         double cx,
+                         double cy,
+                         double rx,
+                         double ry,
+                         CharRgb rgb,
+                         int alpha,
+                         double falloff,
+                         double hardness) {
+    c_stamp_ellipse(
+        c->data, c->size, c->size, cx, cy, rx, ry, rgb.r, rgb.g, rgb.b, alpha, falloff, hardness);
+}
+
+static void char_circle(const CharContext *c,
+                        double cx,
+                        double cy,
+                        double radius,
+                        CharRgb rgb,
+                        int alpha,
+                        double falloff,
+                        double hardness) {
+    c_stamp_fuzzy_circle(
+        c->data, c->size, c->size, cx, cy, radius, rgb.r, rgb.g, rgb.b, alpha, falloff, hardness);
+}
+
+static void char_thick_line(const CharContext *c,
+                            double x0,
+                            double y0,
+                            double x1,
+                            double y1,
+                            CharRgb rgb,
+                            int alpha,
+                            int thickness) {
+    c_draw_thick_line(
+        c->data, c->size, c->size, x0, y0, x1, y1, rgb.r, rgb.g, rgb.b, alpha, thickness);
+}
+
+/* HeadBrush.rel_ellipse / rel_circle: head-relative factors. */
+static void char_head_ellipse(const CharContext *c,
+                              double cx_f,
+                              double cy_f,
+                              double rx_f,
+                              double ry_f,
+                              CharRgb rgb,
+                              int alpha,
+                              double falloff,
+                              double hardness) {
+    char_ellipse(c,
+                 c->cx + c->hr * cx_f,
+                 c->head_cy + c->hr * cy_f,
+                 c->hr * rx_f,
+                 c->hr * ry_f,
+                 rgb,
+                 alpha,
+                 falloff,
+                 hardness);
+}
+
+static void char_head_circle(const CharContext *c,
+                             double cx_f,
+                             double cy_f,
+                             double r_f,
+                             CharRgb rgb,
+                             int alpha,
+                             double falloff,
+                             double hardness) {
+    char_circle(c,
+                c->cx + c->hr * cx_f,
+                c->head_cy + c->hr * cy_f,
+                c->hr * r_f,
+                rgb,
+                alpha,
+                falloff,
+                hardness);
+}
+
+/* masks.render_mask for the mask in table slot `slot`. */
+static void char_render_mask(
+    const CharContext *c, int slot, const CharRgb *pal, double hx, double hy, double hr) {
+    const double *box = c->mask_boxes + (size_t)slot * MASK_RECORD_LEN;
+    int pal_ints[9];
+    for (int t = 0; t < 3; t++) {
+        pal_ints[t * 3] = pal[t].r;
+        pal_ints[t * 3 + 1] = pal[t].g;
+        pal_ints[t * 3 + 2] = pal[t].b;
+    }
+    c_render_mask(c->data,
+                  c->size,
+                  c->size,
+                  c->mask_tones + (size_t)box[MASK_OFFSET],
+                  (int)box[MASK_ROWS],
+                  (int)box[MASK_COLS],
+                  hx + hr * box[MASK_X0_F],
+                  hy + hr * box[MASK_Y0_F],
+                  hx + hr * box[MASK_X1_F],
+                  hy + hr * box[MASK_Y1_F],
+                  0,
+                  pal_ints);
+}
+
+static int char_mask_key(int facing) {
+    if (facing == FACING_NORTH)
+        return MASK_KEY_NORTH;
+    if (facing == FACING_EAST || facing == FACING_WEST)
+        return MASK_KEY_SIDE;
+    return MASK_KEY_SOUTH;
+}
+
+/* renderer._build_character_draw_context */
+static void char_build_context(CharContext *c,
+                               uint8_t *data,
+                               const CharAppearance *ap,
+                               const CharPose *pose,
+                               const int8_t *mask_tones,
+                               const double *mask_boxes) {
+    c->data = data;
+    c->size = ap->canvas_size;
+    c->ap = ap;
+    c->pose = pose;
+    c->mask_tones = mask_tones;
+    c->mask_boxes = mask_boxes;
+    c->side_view = pose->facing == FACING_EAST || pose->facing == FACING_WEST;
+    c->cx = ap->canvas_size / 2.0;
+    c->hr = ap->head_radius;
+    c->head_cy = c->hr + ap->head_top_pad + pose->body_dy;
+    c->torso_cy = c->head_cy + c->hr + ap->neck_gap + ap->torso_ry * ap->torso_cy_factor;
+    c->belly_cy = c->torso_cy + ap->belly_cy_offset;
+    c->torso_bottom = c->torso_cy + ap->torso_ry;
+    if (ap->belly_ry > 0)
+        c->torso_bottom = c->belly_cy + ap->belly_ry;
+
+    c->leg_bottom = ap->canvas_size - 1;
+    c->is_thin_legs = ap->leg_w1 <= 1.05 && ap->arm_thickness == 1;
+    if (ap->leg_from_torso) {
+        c->leg_top = (int)(c->torso_bottom - 0.3);
+    } else {
+        int min_leg_len = c->is_thin_legs ? 4 : 3;
+        int anchored_top = (int)(c->torso_bottom + 0.4);
+        int max_top = c->leg_bottom - min_leg_len;
+        c->leg_top = anchored_top < max_top ? anchored_top : max_top;
+    }
+}
+
+/* body._layer_legs.  Returns -1 when a trunk scratch allocation fails. */
+static int char_layer_legs(const CharContext *c) {
+    const CharAppearance *ap = c->ap;
+    const CharPose *pose = c->pose;
+    CharRgb p_shadow = ap->pants[0];
+    CharRgb p_mid = ap->pants[1];
+    if (ap->covers_legs)
+        return 0;
+
+    double leg_x[2];
+    if (c->side_view) {
+        leg_x[0] = c->cx + pose->left_leg_dx;
+        leg_x[1] = c->cx + pose->right_leg_dx;
+    } else {
+        leg_x[0] = c->cx - ap->leg_spacing + pose->left_leg_dx;
+        leg_x[1] = c->cx + ap->leg_spacing + pose->right_leg_dx;
+    }
+    double leg_bot[2] = {c->leg_bottom + pose->left_leg_dy, c->leg_bottom + pose->right_leg_dy};
+
+    for (int i = 0; i < 2; i++) {
+        int l_bot = (int)fmin((double)(ap->canvas_size - 1), leg_bot[i]);
+        if (c_draw_tapered_trunk(c->data,
+                                 c->size,
+                                 c->size,
+                                 leg_x[i],
+                                 l_bot,
+                                 c->leg_top,
+                                 ap->leg_w1 + 0.2,
+                                 ap->leg_w2 + 0.2,
+                                 p_shadow.r,
+                                 p_shadow.g,
+                                 p_shadow.b,
+                                 235,
+                                 0) < 0)
+            return -1;
+        if (c_draw_tapered_trunk(c->data,
+                                 c->size,
+                                 c->size,
+                                 leg_x[i],
+                                 l_bot,
+                                 c->leg_top,
+                                 ap->leg_w1,
+                                 ap->leg_w2,
+                                 p_mid.r,
+                                 p_mid.g,
+                                 p_mid.b,
+                                 230,
+                                 0) < 0)
+            return -1;
+    }
+
+    if (!c->side_view && c->is_thin_legs) {
+        /* Upper-leg mass so thin builds do not read as disconnected sticks. */
+        double thigh_y = fmin((double)(ap->canvas_size - 1), c->leg_top + 1.1);
+        char_ellipse(
+            c, c->cx, thigh_y, fmax(0.6, ap->leg_spacing * 0.62), 0.42, p_shadow, 220, 1.25, 0.72);
+        for (int side = -1; side <= 1; side += 2) {
+            char_circle(c,
+                        c->cx + side * fmax(0.95, ap->leg_spacing * 0.92),
+                        thigh_y + 0.12,
+                        fmax(0.28, ap->leg_w1 * 0.32),
+                        p_shadow,
+                        205,
+                        1.2,
+                        0.68);
+        }
+    }
+
+    if (c->side_view) {
+        /* Side profile gets a visible toe protrusion toward facing direction. */
+        double front_sign = -1.0;
+        double toe_base_x =
+            c->cx + pose->left_leg_dx + front_sign * fmax(0.55, ap->leg_w1 * 0.52);
+        double toe_tip_x = toe_base_x + front_sign * fmax(0.7, ap->leg_w1 * 0.68);
+        double toe_y =
+            fmin((double)ap->canvas_size - 1.0, c->leg_bottom + pose->left_leg_dy - 0.25);
+        char_thick_line(c, toe_base_x, toe_y, toe_tip_x, toe_y + 0.01, p_shadow, 235, 1);
+        char_circle(c,
+                    toe_tip_x + front_sign * 0.08,
+                    toe_y,
+                    fmax(0.28, ap->leg_w1 * 0.22),
+                    p_mid,
+                    220,
+                    1.1,
+                    0.6);
+    }
+    return 0;
+}
+
+/* body._layer_belly via clothing._draw_belly_mass. */
+static void char_layer_belly(const CharContext *c) {
+    const CharAppearance *ap = c->ap;
+    if (!(ap->belly_ry > 0) || ap->covers_legs)
+        return;
+
+    int north = c->pose->facing == FACING_NORTH;
+    int hi_alpha = north ? 175 : 190;
+    double hi_rx = ap->belly_rx * (north ? 0.4 : 0.5);
+    double hi_ry = ap->belly_ry * (north ? 0.3 : 0.4);
+    const CharRgb *pal = ap->cloth;
+
+    char_ellipse(c,
+                 c->cx,
+                 c->belly_cy + 0.3,
+                 ap->belly_rx + 0.3,
+                 ap->belly_ry + 0.3,
+                 pal[0],
+                 240,
+                 2.0,
+                 0.85);
+    char_ellipse(c, c->cx, c->belly_cy, ap->belly_rx, ap->belly_ry, pal[1], 235, 2.0, 0.85);
+    char_ellipse(c,
+                 c->cx + ap->belly_rx * -0.1,
+                 c->belly_cy + ap->belly_ry * -0.1,
+                 hi_rx,
+                 hi_ry,
+                 pal[2],
+                 hi_alpha,
+                 1.6,
+                 0.7);
+}
+
+/* clothing._draw_torso_mass */
+static void char_torso_mass(
+    const CharContext *c, double cx, double cy, double rx, double ry, const CharRgb *pal) {
+    int north = c->pose->facing == FACING_NORTH;
+    int highlight_alpha = north ? 185 : 210;
+    double highlight_rx = north ? rx * 0.55 : rx * 0.7;
+    double highlight_ry = north ? ry * 0.4 : ry * 0.5;
+
+    char_ellipse(c, cx, cy + 0.3, rx + 0.3, ry + 0.3, pal[0], 240, 2.0, 0.88);
+    char_ellipse(c, cx, cy, rx, ry, pal[1], 235, 2.0, 0.88);
+    char_ellipse(c, cx + rx * 0.28, cy + ry * 0.32, rx * 0.6, ry * 0.5, pal[0], 185, 1.7, 0.72);
+    char_ellipse(c,
+                 cx - rx * 0.3,
+                 cy + ry * -0.28,
+                 highlight_rx,
+                 highlight_ry,
+                 pal[2],
+                 highlight_alpha,
+                 1.8,
+                 0.75);
+}
+
+/* clothing._draw_broad_torso */
+static void char_broad_torso(const CharContext *c) {
+    const CharAppearance *ap = c->ap;
+    const CharRgb *pal = ap->cloth;
+    double cx = c->cx;
+    double torso_cy = c->torso_cy;
+    double sw = ap->shoulder_width;
+    double ry = ap->torso_ry;
+    int hi_alpha = c->pose->facing == FACING_NORTH ? 185 : 200;
+
+    char_ellipse(c, cx, torso_cy + ry * -0.2, sw, ry * 0.8, pal[0], 240, 2.2, 0.9);
+    char_ellipse(c, cx, torso_cy + ry * -0.3, sw - 0.3, ry * 0.7, pal[1], 235, 2.2, 0.9);
+    char_ellipse(c, cx, torso_cy + ry * 0.3, sw - 1.5, ry * 0.6, pal[1], 230, 2.0, 0.85);
+    char_ellipse(c, cx, torso_cy + ry * -0.35, sw * 0.45, ry * 0.4, pal[2], hi_alpha, 1.6, 0.72);
+}
+
+/* clothing._draw_armor_torso */
+static void char_armor_torso(const CharContext *c) {
+    const CharAppearance *ap = c->ap;
+    const CharRgb *pal = ap->cloth;
+    int facing = c->pose->facing;
+    double cx = c->cx;
+    double torso_cy = c->torso_cy;
+    double rx;
+    if (c->side_view)
+        rx = fmax(1.8, ap->torso_rx * 0.78);
+    else
+        rx = fmax(ap->torso_rx + 0.4, ap->shoulder_width * 0.9);
+    double ry = fmax(1.4, ap->torso_ry - 0.2);
+
+    char_ellipse(c, cx, torso_cy + 0.3, rx + 0.3, ry + 0.3, pal[0], 245, 2.2, 0.92);
+    char_ellipse(c, cx, torso_cy, rx, ry, pal[1], 240, 2.2, 0.92);
+
+    if (facing == FACING_NORTH) {
+        char_ellipse(c, cx, torso_cy + ry * -0.25, rx * 0.4, ry * 0.3, pal[2], 190, 1.5, 0.7);
+    } else if (facing == FACING_SOUTH) {
+        char_ellipse(c,
+                     cx + rx * -0.15,
+                     torso_cy + ry * -0.3,
+                     rx * 0.4,
+                     ry * 0.35,
+                     pal[2],
+                     215,
+                     1.5,
+                     0.7);
+    } else {
+        /* Side-view plate highlight and shoulder sleeve. */
+        char_ellipse(c,
+                     cx + rx * -0.08,
+                     torso_cy + ry * -0.26,
+                     rx * 0.36,
+                     ry * 0.34,
+                     pal[2],
+                     208,
+                     1.45,
+                     0.68);
+        char_ellipse(
+            c, cx + rx * -0.72, torso_cy + ry * 0.06, 0.6, 0.82, pal[0], 220, 1.4, 0.72);
+        char_ellipse(
+            c, cx + rx * -0.62, torso_cy + ry * 0.34, 0.52, 0.3, pal[2], 195, 1.15, 0.62);
+        char_circle(
+            c, cx + rx * -1.0 - 0.25, torso_cy + ry * -0.42, 1.15, pal[1], 226, 1.8, 0.82);
+        char_circle(c, cx + 0.22, torso_cy + ry * -0.38, 0.65, pal[1], 205, 1.5, 0.72);
+    }
+
+    if (!c->side_view) {
+        char_circle(c, cx + rx * -1.0 - 0.5, torso_cy + ry * -0.5, 1.5, pal[1], 230, 2.0, 0.88);
+        char_circle(c, cx + rx * 1.0 + 0.5, torso_cy + ry * -0.5, 1.5, pal[1], 230, 2.0, 0.88);
+    }
+}
+
+/* clothing._draw_robe_torso */
+static void char_robe_torso(const CharContext *c) {
+    const CharAppearance *ap = c->ap;
+    const CharRgb *pal = ap->cloth;
+    double cx = c->cx;
+    double torso_cy = c->torso_cy;
+    double ry = ap->torso_ry + 2.0;
+    int north = c->pose->facing == FACING_NORTH;
+    int hi_alpha = north ? 185 : 210;
+    double hi_rx = ap->torso_rx * (north ? 0.5 : 0.7);
+    double hi_ry = ry * (north ? 0.3 : 0.4);
+    double hi_cy_factor = north ? -0.1 : -0.15;
+
+    char_ellipse(c, cx, torso_cy + 1.0, ap->torso_rx + 0.8, ry + 0.3, pal[0], 240, 2.0, 0.85);
+    char_ellipse(c, cx, torso_cy + 0.8, ap->torso_rx + 0.5, ry, pal[1], 235, 2.0, 0.85);
+    char_ellipse(c, cx, torso_cy + ry * hi_cy_factor, hi_rx, hi_ry, pal[2], hi_alpha, 1.6, 0.7);
+}
+
+/* clothing._layer_torso */
+static void char_layer_torso(const CharContext *c) {
+    const CharAppearance *ap = c->ap;
+    int facing = c->pose->facing;
+    double cx = c->cx;
+    CharRgb p_shadow = ap->pants[0];
+
+    switch (ap->torso_kind) {
+    case TORSO_BARE:
+        char_torso_mass(c, cx, c->torso_cy, ap->torso_rx, ap->torso_ry, ap->skin);
+        break;
+    case TORSO_SHIRT:
+        if (ap->shoulder_width > ap->torso_rx)
+            char_broad_torso(c);
+        else
+            char_torso_mass(c, cx, c->torso_cy, ap->torso_rx, ap->torso_ry, ap->cloth);
+        break;
+    case TORSO_ARMOR:
+        char_armor_torso(c);
+        break;
+    default:
+        char_robe_torso(c);
+        break;
+    }
+
+    /* Fill the back-view chest/belly seam so the body reads as a back mass. */
+    if (facing == FACING_NORTH && ap->belly_ry > 0 && !ap->covers_legs &&
+        ap->torso_kind != TORSO_BARE) {
+        double seam_y = c->torso_cy + ap->torso_ry * 0.95;
+        double seam_rx = fmax(ap->torso_rx * 0.95, ap->belly_rx * 0.68);
+        double seam_ry = fmax(0.85, ap->belly_ry * 0.38);
+        char_ellipse(c, cx, seam_y, seam_rx, seam_ry, ap->cloth[1], 218, 1.7, 0.8);
+    }
+
+    /* Robes hide legs, but a tiny foot peek preserves grounded human read. */
+    if (ap->covers_legs) {
+        double foot_y = fmin((double)(ap->canvas_size - 1), c->torso_bottom + 0.7);
+        double boot_rx = fmax(0.6, ap->leg_w1 * 0.55);
+        if (c->side_view) {
+            char_ellipse(c, cx + 0.2, foot_y, boot_rx * 0.95, 0.72, p_shadow, 235, 1.6, 0.85);
+        } else {
+            for (int side = -1; side <= 1; side += 2) {
+                char_ellipse(c,
+                             cx + side * fmax(0.85, ap->leg_spacing * 0.68),
+                             foot_y,
+                             boot_rx,
+                             0.72,
+                             p_shadow,
+                             235,
+                             1.6,
+                             0.85);
+            }
+        }
+    }
+}
+
+/* body.ArmLayerState */
+typedef struct {
+    double shoulder_y;
+    double arm_end_y;
+    double shoulder_anchor;
+    int arm_alpha;
+    CharRgb arm_shadow;
+    CharRgb arm_mid;
+} CharArmState;
+
+/* body._build_arm_layer_state */
+static void char_build_arm_state(const CharContext *c, CharArmState *arm) {
+    const CharAppearance *ap = c->ap;
+    CharRgb s_shadow = ap->skin[0];
+    CharRgb s_mid = ap->skin[1];
+    CharRgb c_shadow = ap->cloth[0];
+
+    arm->shoulder_y = c->torso_cy - ap->torso_ry * ap->arm_shoulder_factor;
+    if (ap->arm_end_from_belly && ap->belly_ry > 0)
+        arm->arm_end_y = c->belly_cy + ap->belly_ry * ap->arm_end_belly_factor;
+    else
+        arm->arm_end_y = c->torso_cy + ap->torso_ry * ap->arm_end_torso_factor;
+    if (ap->torso_kind == TORSO_ARMOR)
+        arm->arm_end_y += 1.8;
+
+    arm->arm_alpha = ap->arm_thickness == 1 ? 220 : 225;
+    arm->shoulder_anchor =
+        ap->torso_rx * ap->arm_shoulder_anchor_torso_factor +
+        ap->shoulder_width * ap->arm_shoulder_anchor_shoulder_width_factor;
+
+    /* One tone darker than the torso so the limb reads against it at 1x. */
+    if (ap->torso_kind == TORSO_BARE) {
+        arm->arm_shadow = s_shadow;
+        arm->arm_mid.r = (s_shadow.r + s_mid.r) / 2;
+        arm->arm_mid.g = (s_shadow.g + s_mid.g) / 2;
+        arm->arm_mid.b = (s_shadow.b + s_mid.b) / 2;
+    } else {
+        arm->arm_shadow.r = (c_shadow.r * 3) / 4;
+        arm->arm_shadow.g = (c_shadow.g * 3) / 4;
+        arm->arm_shadow.b = (c_shadow.b * 3) / 4;
+        arm->arm_mid = c_shadow;
+    }
+}
+
+/* body._draw_frontback_arm */
+static void char_frontback_arm(const CharContext *c,
+                               const CharArmState *arm,
+                               int side,
+                               double arm_dy) {
+    const CharAppearance *ap = c->ap;
+    double arm_swing_scale = ap->torso_kind == TORSO_ARMOR ? 0.5 : 1.0;
+    double arm_x = c->cx + side * arm->shoulder_anchor;
+    double hand_x = arm_x - side * ap->arm_hand_inset;
+    double hand_y = arm->arm_end_y + arm_dy * arm_swing_scale;
+    int shadow_alpha = arm->arm_alpha - 30 > 165 ? arm->arm_alpha - 30 : 165;
+
+    char_circle(c,
+                arm_x,
+                arm->shoulder_y,
+                fmax(0.45, ap->arm_thickness * 0.38),
+                arm->arm_shadow,
+                175,
+                1.45,
+                0.72);
+    /* Two-pass arm stroke gives a readable limb edge without looking detached. */
+    char_thick_line(c,
+                    arm_x + side * 0.08,
+                    arm->shoulder_y + 0.05,
+                    hand_x + side * 0.08,
+                    hand_y + 0.05,
+                    arm->arm_shadow,
+                    shadow_alpha,
+                    ap->arm_thickness);
+    char_thick_line(c,
+                    arm_x,
+                    arm->shoulder_y,
+                    hand_x,
+                    hand_y,
+                    arm->arm_mid,
+                    arm->arm_alpha,
+                    ap->arm_thickness);
+    if (ap->hand_radius > 0) {
+        char_circle(c,
+                    hand_x,
+                    hand_y + ap->arm_hand_drop,
+                    ap->hand_radius,
+                    ap->skin[1],
+                    ap->arm_hand_alpha,
+                    2.0,
+                    0.85);
+    }
+}
+
+/* body._layer_back_arm */
+static void char_layer_back_arm(const CharContext *c) {
+    const CharAppearance *ap = c->ap;
+    CharArmState arm;
+    char_build_arm_state(c, &arm);
+    if (!c->side_view) {
+        char_frontback_arm(c, &arm, -1, c->pose->left_arm_dy);
+        return;
+    }
+
+    /* Side profile uses a clear foreground arm plus a faint background arm. */
+    double back_sign = 1.0;
+    double far_arm_x = c->cx + back_sign * ap->torso_rx * 0.34;
+    int alpha = arm.arm_alpha - 55 > 145 ? arm.arm_alpha - 55 : 145;
+    int thickness = ap->arm_thickness - 1 > 1 ? ap->arm_thickness - 1 : 1;
+    char_thick_line(c,
+                    far_arm_x,
+                    arm.shoulder_y + 0.05,
+                    far_arm_x + back_sign * 0.1,
+                    arm.arm_end_y + c->pose->right_arm_dy + 0.05,
+                    arm.arm_shadow,
+                    alpha,
+                    thickness);
+}
+
+/* body._layer_front_arm */
+static void char_layer_front_arm(const CharContext *c) {
+    const CharAppearance *ap = c->ap;
+    CharArmState arm;
+    char_build_arm_state(c, &arm);
+    if (!c->side_view) {
+        char_frontback_arm(c, &arm, 1, c->pose->right_arm_dy);
+        return;
+    }
+
+    double front_sign = -1.0;
+    double front_arm_x = c->cx + front_sign * ap->torso_rx * 0.62;
+    double front_hand_x = front_arm_x + front_sign * 0.18;
+    double hand_radius = ap->hand_radius > 0 ? fmin(0.9, ap->hand_radius) : 0.0;
+    int shadow_alpha = arm.arm_alpha - 30 > 165 ? arm.arm_alpha - 30 : 165;
+
+    char_circle(c,
+                front_arm_x,
+                arm.shoulder_y,
+                fmax(0.45, ap->arm_thickness * 0.38),
+                arm.arm_shadow,
+                185,
+                1.45,
+                0.72);
+    char_thick_line(c,
+                    front_arm_x + front_sign * 0.08,
+                    arm.shoulder_y,
+                    front_hand_x + front_sign * 0.08,
+                    arm.arm_end_y + c->pose->left_arm_dy,
+                    arm.arm_shadow,
+                    shadow_alpha,
+                    ap->arm_thickness);
+    char_thick_line(c,
+                    front_arm_x,
+                    arm.shoulder_y,
+                    front_hand_x,
+                    arm.arm_end_y + c->pose->left_arm_dy,
+                    arm.arm_mid,
+                    arm.arm_alpha,
+                    ap->arm_thickness);
+    if (hand_radius > 0) {
+        char_circle(c,
+                    front_hand_x,
+                    arm.arm_end_y + c->pose->left_arm_dy + ap->arm_hand_drop,
+                    hand_radius,
+                    ap->skin[1],
+                    ap->arm_hand_alpha,
+                    2.0,
+                    0.85);
+    }
+}
+
+/* body._layer_neck */
+static void char_layer_neck(const CharContext *c) {
+    const CharAppearance *ap = c->ap;
+    if (c->pose->facing == FACING_NORTH || !(ap->neck_rx > 0) || !(ap->neck_ry > 0))
+        return;
+    double neck_y = c->head_cy + c->hr + ap->neck_y_offset;
+    char_ellipse(c, c->cx, neck_y, ap->neck_rx, ap->neck_ry, ap->skin[1], 225, 2.0, 0.85);
+}
+
+/* colors.lerp_color (round() is round-half-even, as is nearbyint). */
+static CharRgb char_lerp_rgb(CharRgb base, CharRgb target, double t) {
+    CharRgb out;
+    out.r = (int)nearbyint(base.r + (target.r - base.r) * t);
+    out.g = (int)nearbyint(base.g + (target.g - base.g) * t);
+    out.b = (int)nearbyint(base.b + (target.b - base.b) * t);
+    return out;
+}
+
+/* clothing._layer_collar with clothing._collar_palette. */
+static void char_layer_collar(const CharContext *c) {
+    const CharAppearance *ap = c->ap;
+    if (ap->collar_kind < 0)
+        return;
+    int key = char_mask_key(c->pose->facing);
+    const CharRgb black = {0, 0, 0};
+    const CharRgb white = {255, 255, 255};
+    CharRgb c_shadow = ap->cloth[0];
+    CharRgb c_hi = ap->cloth[2];
+    CharRgb pal[3];
+
+    if (ap->collar_kind == COLLAR_ROBE && key != MASK_KEY_NORTH) {
+        /* Skin V-neck: skin showing down the chest. */
+        pal[0] = ap->skin[0];
+        pal[1] = ap->skin[1];
+        pal[2] = ap->skin[2];
+    } else if (ap->collar_kind == COLLAR_ARMOR) {
+        /* Metal gorget: shadow base, bright body, specular lip. */
+        pal[0] = c_shadow;
+        pal[1] = c_hi;
+        pal[2] = char_lerp_rgb(c_hi, white, 0.5);
+    } else {
+        pal[0] = char_lerp_rgb(c_shadow, black, 0.45);
+        pal[1] = c_shadow;
+        pal[2] = c_hi;
+    }
+    double torso_top = c->torso_cy - ap->torso_ry;
+    char_render_mask(c, ap->collar_mask[key], pal, c->cx, torso_top, ap->torso_rx);
+}
+
+/* body._layer_head */
+static void char_layer_head(const CharContext *c) {
+    const CharAppearance *ap = c->ap;
+    const CharRgb *pal = ap->skin;
+    double hx = c->cx;
+    double hy = c->head_cy;
+    double hr = c->hr;
+
+    if (c->pose->facing == FACING_NORTH) {
+        char_circle(c, hx, hy + 0.2, hr + 0.2, pal[0], 240, 2.0, 0.88);
+        char_circle(c, hx, hy, hr, pal[1], 235, 2.0, 0.88);
+    } else if (c->side_view) {
+        char_ellipse(c, hx, hy + 0.2, hr * 0.85, hr + 0.2, pal[0], 240, 2.0, 0.88);
+        char_ellipse(c, hx, hy, hr * 0.8, hr, pal[1], 235, 2.0, 0.88);
+        char_head_ellipse(c, -0.14, -0.2, 0.45, 0.55, pal[2], 210, 1.6, 0.75);
+        char_head_ellipse(c, -0.26, -0.12, 0.34, 0.48, pal[2], 205, 1.5, 0.72);
+        if (!ap->hair_is_tall)
+            char_head_ellipse(c, 0.28, 0.03, 0.3, 0.46, pal[0], 195, 1.5, 0.72);
+        char_head_circle(c, -0.63, -0.02, 0.12, pal[2], 190, 1.4, 0.7);
+    } else {
+        char_circle(c, hx, hy + 0.2, hr + 0.2, pal[0], 240, 2.0, 0.88);
+        char_circle(c, hx, hy, hr, pal[1], 235, 2.0, 0.88);
+        char_head_circle(c, 0.0, -0.22, 0.6, pal[2], 210, 1.6, 0.75);
+    }
+}
+
+/*
+ * hair._layer_hair.  Every hair style except bald has a mask set (asserted by
+ * renderer.py), so a style without a mask draws no strokes and only gets the
+ * bald readability overlays.
+ */
+static void char_layer_hair(const CharContext *c) {
+    const CharAppearance *ap = c->ap;
+    int slot = ap->hair_mask[char_mask_key(c->pose->facing)];
+    if (slot >= 0) {
+        char_render_mask(c, slot, ap->hair, c->cx, c->head_cy, c->hr);
+        return;
+    }
+
+    const CharRgb *skin = ap->skin;
+    double hx = c->cx;
+    double hy = c->head_cy;
+    double hr = c->hr;
+    if (c->pose->facing == FACING_SOUTH) {
+        char_head_ellipse(c, 0.0, -0.05, 0.44, 0.36, skin[1], 205, 1.35, 0.72);
+        char_head_ellipse(c, 0.0, -0.22, 0.28, 0.2, skin[2], 190, 1.2, 0.65);
+    } else if (c->side_view) {
+        char_head_ellipse(c, -0.56, -0.06, 0.2, 0.3, skin[1], 210, 1.3, 0.68);
+        char_head_ellipse(c, -0.9, 0.01, 0.08, 0.06, skin[0], 200, 1.0, 0.62);
+        char_head_circle(c, -0.72, -0.03, 0.12, skin[2], 195, 1.25, 0.66);
+        char_circle(
+            c, hx + hr * -0.9 - 0.18, hy + hr * 0.01 + 0.02, hr * 0.06, skin[0], 192, 1.0, 0.6);
+        char_head_circle(c, 0.42, 0.02, 0.1, skin[0], 175, 1.25, 0.66);
+    }
+}
+
+/* body._layer_back_definition */
+static void char_layer_back_definition(const CharContext *c) {
+    const CharAppearance *ap = c->ap;
+    if (c->pose->facing != FACING_NORTH)
+        return;
+    double cx = c->cx;
+
+    /* Long hair drapes over the back: crown highlight instead of a nape. */
+    if (ap->hair_is_long) {
+        char_ellipse(c,
+                     cx - c->hr * 0.3,
+                     c->head_cy - c->hr * 0.35,
+                     c->hr * 0.5,
+                     c->hr * 0.42,
+                     ap->hair[2],
+                     200,
+                     1.6,
+                     0.7);
+        return;
+    }
+
+    /* Nape contact shadow, then top-left-lit shoulder highlights. */
+    double nape_y = c->head_cy + c->hr + ap->neck_gap * 0.35;
+    CharRgb c_shadow = ap->cloth[0];
+    CharRgb nape_rgb;
+    nape_rgb.r = (int)(c_shadow.r * 0.6);
+    nape_rgb.g = (int)(c_shadow.g * 0.6);
+    nape_rgb.b = (int)(c_shadow.b * 0.6);
+    char_ellipse(c, cx, nape_y, fmax(0.7, c->hr * 0.32), 0.55, nape_rgb, 205, 1.5, 0.8);
+
+    double shoulder_y = c->torso_cy - ap->torso_ry * 0.35;
+    double shoulder_dx = fmax(1.4, ap->torso_rx * 0.62);
+    const double sides[2] = {-1.0, 1.0};
+    const int alphas[2] = {205, 175};
+    for (int i = 0; i < 2; i++) {
+        char_ellipse(c,
+                     cx + sides[i] * shoulder_dx,
+                     shoulder_y,
+                     ap->torso_rx * 0.34,
+                     ap->torso_ry * 0.34,
+                     ap->cloth[2],
+                     alphas[i],
+                     1.5,
+                     0.72);
+    }
+}
+
+/* body._layer_face_final */
+static void char_layer_face(const CharContext *c) {
+    if (!c->side_view)
+        return;
+    double front_sign = -1.0;
+    double nose_x = nearbyint(c->cx + front_sign * c->hr * 0.9);
+    double nose_y = nearbyint(c->head_cy - c->hr * 0.02);
+    CharRgb s_shadow = c->ap->skin[0];
+    char_circle(c, nose_x, nose_y, fmax(0.24, c->hr * 0.08), s_shadow, 230, 1.0, 0.9);
+    char_circle(c,
+                nose_x + front_sign * 0.35,
+                nose_y + 0.02,
+                fmax(0.2, c->hr * 0.06),
+                s_shadow,
+                220,
+                1.0,
+                0.85);
+}
+
+/*
+ * Draw every pose of every actor: clear each canvas, run the layer pipeline,
+ * then finish_pose (mirroring EAST from the left-facing side drawing).
+ * Returns -1 when a scratch allocation fails.
+ */
+static int char_draw_pose_sets(uint8_t *const *canvases,
+                               const CharAppearance *appearances,
+                               int n_actors,
+                               const CharPose *poses,
+                               int n_poses,
+                               const int8_t *mask_tones,
+                               const double *mask_boxes,
+                               int threshold,
+                               int dr,
+                               int dg,
+                               int db) {
+    for (int i = 0; i < n_actors; i++) {
+        const CharAppearance *ap = &appearances[i];
+        size_t canvas_bytes = (size_t)ap->canvas_size * (size_t)ap->canvas_size * 4;
+        for (int p = 0; p < n_poses; p++) {
+            uint8_t *data = canvases[i] + (size_t)p * canvas_bytes;
+            CharContext c;
+            memset(data, 0, canvas_bytes);
+            char_build_context(&c, data, ap, &poses[p], mask_tones, mask_boxes);
+
+            if (char_layer_legs(&c) < 0)
+                return -1;
+            char_layer_belly(&c);
+            char_layer_torso(&c);
+            char_layer_back_arm(&c);
+            char_layer_front_arm(&c);
+            char_layer_neck(&c);
+            char_layer_collar(&c);
+            char_layer_head(&c);
+            char_layer_hair(&c);
+            char_layer_back_definition(&c);
+            char_layer_face(&c);
+
+            int mirror = poses[p].facing == FACING_EAST;
+            if (c_finish_pose(data, c.size, c.size, threshold, mirror, dr, dg, db) < 0)
+                return -1;
+        }
+    }
+    return 0;
+}
+
+/* Validate one mask slot index against the table.  Sets ValueError. */
+static int char_check_mask_slot(int slot, int n_masks) {
+    if (slot < -1 || slot >= n_masks) {
+        PyErr_SetString(PyExc_ValueError, "mask slot out of range");
+        return -1;
+    }
+    return 0;
+}
+
+/*
+ * sprite_draw_character_poses(canvases, appearances, poses, mask_tones,
+ *                             mask_boxes, alpha_threshold, darken_r,
+ *                             darken_g, darken_b)
+ *
+ * canvases:    sequence of (n_poses, S, S, 4) uint8 arrays, one per actor,
+ *              where S is that actor's canvas size; overwritten.
+ * appearances: float64 (n_actors, CHAR_RECORD_LEN) appearance records.
+ * poses:       float64 (n_poses, POSE_RECORD_LEN) pose records.
+ * mask_tones:  int8 tone grids of every mask, concatenated.
+ * mask_boxes:  float64 (n_masks, MASK_RECORD_LEN) mask records.
+ *
+ * Buffers are acquired with the GIL held; drawing runs with it released.
+ */
+PyObject *brileta_native_sprite_draw_character_poses(PyObject *self, PyObject *args) {
+    PyObject *canvases_obj, *appearances_obj, *poses_obj, *tones_obj, *boxes_obj;
+    int threshold, dr, dg, db;
+
+    if (!PyArg_ParseTuple(args,
+                          "OOOOOiiii",
+                          &canvases_obj,
+                          &appearances_obj,
+                          &poses_obj,
+                          &tones_obj,
+                          &boxes_obj,
+                          &threshold,
+                          &dr,
+                          &dg,
+                          &db))
+        return NULL;
+
+    PyObject *seq = PySequence_Fast(canvases_obj, "canvases must be a sequence of arrays");
+    if (!seq)
+        return NULL;
+    Py_ssize_t n_actors = PySequence_Fast_GET_SIZE(seq);
+
+    Py_buffer app_buf = {0}, poses_buf = {0}, tones_buf = {0}, boxes_buf = {0};
+    Py_buffer *canvas_bufs = NULL;
+    uint8_t **canvases = NULL;
+    CharAppearance *appearances = NULL;
+    CharPose *poses = NULL;
+    Py_ssize_t acquired = 0;
+    PyObject *result = NULL;
+
+    if (PyObject_GetBuffer(appearances_obj, &app_buf, PyBUF_C_CONTIGUOUS) < 0)
+        goto done;
+    if (PyObject_GetBuffer(poses_obj, &poses_buf, PyBUF_C_CONTIGUOUS) < 0)
+        goto done;
+    if (PyObject_GetBuffer(tones_obj, &tones_buf, PyBUF_C_CONTIGUOUS) < 0)
+        goto done;
+    if (PyObject_GetBuffer(boxes_obj, &boxes_buf, PyBUF_C_CONTIGUOUS) < 0)
+        goto done;
+    if (app_buf.ndim != 2 || app_buf.itemsize != 8 || app_buf.shape[0] != n_actors ||
+        app_buf.shape[1] != CHAR_RECORD_LEN) {
+        PyErr_SetString(PyExc_ValueError,
+                        "appearances must be a float64 (n_actors, record_len) array");
+        goto done;
+    }
+    if (poses_buf.ndim != 2 || poses_buf.itemsize != 8 || poses_buf.shape[1] != POSE_RECORD_LEN) {
+        PyErr_SetString(PyExc_ValueError, "poses must be a float64 (n_poses, 8) array");
+        goto done;
+    }
+    if (tones_buf.itemsize != 1 || boxes_buf.ndim != 2 || boxes_buf.itemsize != 8 ||
+        boxes_buf.shape[1] != MASK_RECORD_LEN) {
+        PyErr_SetString(PyExc_ValueError,
+                        "mask_tones must be int8 and mask_boxes a float64 (n_masks, 7) array");
+        goto done;
+    }
+
+    int n_poses = (int)poses_buf.shape[0];
+    int n_masks = (int)boxes_buf.shape[0];
+    const double *boxes = (const double *)boxes_buf.buf;
+    for (int m = 0; m < n_masks; m++) {
+        const double *box = boxes + (size_t)m * MASK_RECORD_LEN;
+        if (box[MASK_OFFSET] < 0 || box[MASK_ROWS] < 0 || box[MASK_COLS] < 0 ||
+            box[MASK_OFFSET] + box[MASK_ROWS] * box[MASK_COLS] > (double)tones_buf.len) {
+            PyErr_SetString(PyExc_ValueError, "mask box runs past mask_tones");
+            goto done;
+        }
+    }
+
+    poses = PyMem_Calloc((size_t)(n_poses > 0 ? n_poses : 1), sizeof(CharPose));
+    appearances = PyMem_Calloc((size_t)(n_actors > 0 ? n_actors : 1), sizeof(CharAppearance));
+    canvases = PyMem_Calloc((size_t)(n_actors > 0 ? n_actors : 1), sizeof(uint8_t *));
+    canvas_bufs = PyMem_Calloc((size_t)(n_actors > 0 ? n_actors : 1), sizeof(Py_buffer));
+    if (!poses || !appearances || !canvases || !canvas_bufs) {
+        PyErr_NoMemory();
+        goto done;
+    }
+    for (int p = 0; p < n_poses; p++) {
+        char_unpack_pose((const double *)poses_buf.buf + (size_t)p * POSE_RECORD_LEN, &poses[p]);
+        if (poses[p].facing < FACING_SOUTH || poses[p].facing > FACING_WEST) {
+            PyErr_SetString(PyExc_ValueError, "pose facing out of range");
+            goto done;
+        }
+    }
+
+    for (Py_ssize_t i = 0; i < n_actors; i++) {
+        CharAppearance *ap = &appearances[i];
+        char_unpack_appearance((const double *)app_buf.buf + (size_t)i * CHAR_RECORD_LEN, ap);
+        for (int k = 0; k < 3; k++) {
+            if (char_check_mask_slot(ap->hair_mask[k], n_masks) < 0 ||
+                char_check_mask_slot(ap->collar_mask[k], n_masks) < 0)
+                goto done;
+            if (ap->collar_kind >= 0 && ap->collar_mask[k] < 0) {
+                PyErr_SetString(PyExc_ValueError, "collar style without a collar mask");
+                goto done;
+            }
+        }
+
+        Py_buffer *b = &canvas_bufs[i];
+        if (PyObject_GetBuffer(
+                PySequence_Fast_GET_ITEM(seq, i), b, PyBUF_C_CONTIGUOUS | PyBUF_WRITABLE) < 0)
+            goto done;
+        acquired++;
+        int size = ap->canvas_size;
+        if (b->ndim != 4 || b->itemsize != 1 || b->shape[0] != n_poses || b->shape[1] != size ||
+            b->shape[2] != size || b->shape[3] != 4 || size <= 0) {
+            PyErr_SetString(PyExc_ValueError,
+                            "each canvas must be a contiguous (n_poses, S, S, 4) uint8 array "
+                            "matching its appearance's canvas size");
+            goto done;
+        }
+        canvases[i] = (uint8_t *)b->buf;
+    }
+
+    int rc;
+    /* clang-format off */
+    Py_BEGIN_ALLOW_THREADS
+    rc = char_draw_pose_sets(canvases, appearances, (int)n_actors, poses, n_poses,
+                             (const int8_t *)tones_buf.buf, boxes, threshold, dr, dg, db);
+    Py_END_ALLOW_THREADS
+    /* clang-format on */
+    if (rc < 0) {
+        PyErr_NoMemory();
+        goto done;
+    }
+    result = Py_NewRef(Py_None);
+
+done:
+    for (Py_ssize_t i = 0; i < acquired; i++)
+        PyBuffer_Release(&canvas_bufs[i]);
+    PyMem_Free(canvas_bufs);
+    PyMem_Free(canvases);
+    PyMem_Free(appearances);
+    PyMem_Free(poses);
+    if (boxes_buf.obj)
+        PyBuffer_Release(&boxes_buf);
+    if (tones_buf.obj)
+        PyBuffer_Release(&tones_buf);
+    if (poses_buf.obj)
+        PyBuffer_Release(&poses_buf);
+    if (app_buf.obj)
+        PyBuffer_Release(&app_buf);
+    Py_DECREF(seq);
+    return result;
+}
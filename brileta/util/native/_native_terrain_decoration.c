@@ -0,0 +1,266 @@
+/*
+ * Per-tile terrain decoration for brileta.environment.tile_types.
+ *
+ * One pass over N tiles replaces the per-pool Python loop: each tile computes
+ * derive_spatial_seed_array()'s hash inline, looks up its type's glyph pool in
+ * a small table, and writes its glyph and jittered fg/bg colors in place.
+ * Tiles whose type has no pool are left untouched.
+ *
+ * The arithmetic mirrors the numpy version exactly: the hash is a wrapping
+ * int64 (x * PRIME_X) ^ (y * PRIME_Y) ^ seed, shifts are arithmetic, and every
+ * modulo is a floor modulo, so results are bit-identical for any coordinates,
+ * including negative hashes.
+ *
+ * Inputs may have any integer dtype and any strides (field views of an
+ * appearance array are typical), so values are loaded by itemsize and
+ * signedness from the buffer format.
+ */
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#include <stdint.h>
+#include <string.h>
+
+#define SPATIAL_PRIME_X 73856093ULL
+#define SPATIAL_PRIME_Y 19349663ULL
+
+/* Pool table columns, one int32 row per tile type. */
+#define POOL_GLYPH_START 0
+#define POOL_GLYPH_COUNT 1 /* 0 = no decoration for this type */
+#define POOL_BG_JITTER 2
+#define POOL_FG_JITTER 3
+#define POOL_COLUMNS 4
+
+typedef struct {
+    char *buf;
+    Py_ssize_t stride;
+    Py_ssize_t itemsize;
+    int is_signed;
+} IntColumn;
+
+typedef struct {
+    char *buf;
+    Py_ssize_t stride, channel_stride;
+} RgbColumn;
+
+static inline int64_t column_get(const IntColumn *c, Py_ssize_t i) {
+    const char *p = c->buf + i * c->stride;
+    switch (c->itemsize) {
+    case 1:
+        return c->is_signed ? (int64_t) * (const int8_t *)p : (int64_t) * (const uint8_t *)p;
+    case 2: {
+        uint16_t v;
+        memcpy(&v, p, 2);
+        return c->is_signed ? (int64_t)(int16_t)v : (int64_t)v;
+    }
+    case 4: {
+        uint32_t v;
+        memcpy(&v, p, 4);
+        return c->is_signed ? (int64_t)(int32_t)v : (int64_t)v;
+    }
+    default: {
+        uint64_t v;
+        memcpy(&v, p, 8);
+        return (int64_t)v; /* uint64 wraps like numpy's astype(int64) */
+    }
+    }
+}
+
+static inline void column_set(const IntColumn *c, Py_ssize_t i, int32_t value) {
+    char *p = c->buf + i * c->stride;
+    switch (c->itemsize) {
+    case 1: {
+        uint8_t v = (uint8_t)value;
+        *p = (char)v;
+        break;
+    }
+    case 2: {
+        int16_t v = (int16_t)value;
+        memcpy(p, &v, 2);
+        break;
+    }
+    case 4:
+        memcpy(p, &value, 4);
+        break;
+    default: {
+        int64_t v = value;
+        memcpy(p, &v, 8);
+    }
+    }
+}
+
+static inline int64_t floor_mod(int64_t a, int64_t n) {
+    int64_t m = a % n;
+    return m < 0 ? m + n : m;
+}
+
+static inline void jitter_rgb(const RgbColumn *c, Py_ssize_t i, int64_t offset) {
+    char *p = c->buf + i * c->stride;
+    for (int ch = 0; ch < 3; ch++) {
+        uint8_t *v = (uint8_t *)(p + ch * c->channel_stride);
+        int64_t next = (int64_t)*v + offset;
+        *v = (uint8_t)(next < 0 ? 0 : (next > 255 ? 255 : next));
+    }
+}
+
+/* Acquire a 1D integer buffer of any integer dtype and stride. */
+static int get_int_column(PyObject *obj, Py_buffer *buf, IntColumn *col, int writable,
+                          const char *name) {
+    int flags = PyBUF_STRIDES | PyBUF_FORMAT | (writable ? PyBUF_WRITABLE : 0);
+    if (PyObject_GetBuffer(obj, buf, flags) < 0)
+        return -1;
+    const char *format = buf->format ? buf->format : "B";
+    char code = format[strlen(format) - 1];
+    if (buf->ndim != 1 || strchr("bBhHiIlLqQnN", code) == NULL ||
+        (buf->itemsize != 1 && buf->itemsize != 2 && buf->itemsize != 4 &&
+         buf->itemsize != 8)) {
+        PyErr_Format(PyExc_TypeError, "%s must be a 1D integer array", name);
+        return -1;
+    }
+    col->buf = (char *)buf->buf;
+    col->stride = buf->strides[0];
+    col->itemsize = buf->itemsize;
+    col->is_signed = code >= 'a' && code <= 'z';
+    return 0;
+}
+
+static int get_rgb_column(PyObject *obj, Py_buffer *buf, RgbColumn *col, const char *name) {
+    if (PyObject_GetBuffer(obj, buf, PyBUF_STRIDES | PyBUF_WRITABLE) < 0)
+        return -1;
+    if (buf->ndim != 2 || buf->itemsize != 1 || buf->shape[1] != 3) {
+        PyErr_Format(PyExc_TypeError, "%s must be an (N, 3) uint8 array", name);
+        return -1;
+    }
+    col->buf = (char *)buf->buf;
+    col->stride = buf->strides[0];
+    col->channel_stride = buf->strides[1];
+    return 0;
+}
+
+PyObject *brileta_native_terrain_decoration(PyObject *self, PyObject *args) {
+    PyObject *chars_obj, *fg_obj, *bg_obj, *tiles_obj, *x_obj, *y_obj, *table_obj, *glyphs_obj;
+    long long seed;
+
+    if (!PyArg_ParseTuple(args,
+                          "OOOOOOOOL",
+                          &chars_obj,  /* (N,) integer char codes, written         */
+                          &fg_obj,     /* (N, 3) uint8 fg, jittered in place       */
+                          &bg_obj,     /* (N, 3) uint8 bg, jittered in place       */
+                          &tiles_obj,  /* (N,) integer tile type ids               */
+                          &x_obj,      /* (N,) integer world x                     */
+                          &y_obj,      /* (N,) integer world y                     */
+                          &table_obj,  /* (n_types, 4) int32 pool table, C order  */
+                          &glyphs_obj, /* (n_glyphs,) int32 pooled glyph codes     */
+                          &seed))
+        return NULL;
+
+    Py_buffer chars_buf = {0}, fg_buf = {0}, bg_buf = {0}, tiles_buf = {0}, x_buf = {0},
+              y_buf = {0}, table_buf = {0}, glyphs_buf = {0};
+    IntColumn chars, tiles, xs, ys;
+    RgbColumn fg, bg;
+    PyObject *result = NULL;
+
+    if (get_int_column(chars_obj, &chars_buf, &chars, 1, "chars") < 0)
+        goto done;
+    if (get_rgb_column(fg_obj, &fg_buf, &fg, "fg_rgb") < 0)
+        goto done;
+    if (get_rgb_column(bg_obj, &bg_buf, &bg, "bg_rgb") < 0)
+        goto done;
+    if (get_int_column(tiles_obj, &tiles_buf, &tiles, 0, "tile_ids") < 0)
+        goto done;
+    if (get_int_column(x_obj, &x_buf, &xs, 0, "world_x") < 0)
+        goto done;
+    if (get_int_column(y_obj, &y_buf, &ys, 0, "world_y") < 0)
+        goto done;
+    if (PyObject_GetBuffer(table_obj, &table_buf, PyBUF_C_CONTIGUOUS) < 0)
+        goto done;
+    if (table_buf.ndim != 2 || table_buf.itemsize != 4 || table_buf.shape[1] != POOL_COLUMNS) {
+        PyErr_SetString(PyExc_TypeError, "pool table must be an (n_types, 4) int32 array");
+        goto done;
+    }
+    if (PyObject_GetBuffer(glyphs_obj, &glyphs_buf, PyBUF_C_CONTIGUOUS) < 0)
+        goto done;
+    if (glyphs_buf.itemsize != 4) {
+        PyErr_SetString(PyExc_TypeError, "pool glyphs must be an int32 array");
+        goto done;
+    }
+
+    Py_ssize_t n = tiles_buf.shape[0];
+    if (chars_buf.shape[0] != n || fg_buf.shape[0] != n || bg_buf.shape[0] != n ||
+        x_buf.shape[0] != n || y_buf.shape[0] != n) {
+        PyErr_SetString(PyExc_ValueError, "all per-tile arrays must have the same length");
+        goto done;
+    }
+
+    const int32_t *table = (const int32_t *)table_buf.buf;
+    const int32_t *glyphs = (const int32_t *)glyphs_buf.buf;
+    int64_t n_types = table_buf.shape[0];
+    int64_t n_glyphs = glyphs_buf.len / 4;
+    for (int64_t t = 0; t < n_types; t++) {
+        const int32_t *pool = table + t * POOL_COLUMNS;
+        if (pool[POOL_GLYPH_COUNT] > 0 &&
+            (pool[POOL_GLYPH_START] < 0 ||
+             (int64_t)pool[POOL_GLYPH_START] + pool[POOL_GLYPH_COUNT] > n_glyphs ||
+             pool[POOL_BG_JITTER] < 0 || pool[POOL_FG_JITTER] < 0)) {
+            PyErr_SetString(PyExc_ValueError, "pool table row is inconsistent with glyphs");
+            goto done;
+        }
+    }
+
+    uint64_t seed_bits = (uint64_t)seed;
+
+    /* clang-format off */
+    Py_BEGIN_ALLOW_THREADS
+    for (Py_ssize_t i = 0; i < n; i++) {
+        int64_t tid = column_get(&tiles, i);
+        if (tid < 0 || tid >= n_types)
+            continue;
+        const int32_t *pool = table + tid * POOL_COLUMNS;
+        int64_t count = pool[POOL_GLYPH_COUNT];
+        if (count <= 0)
+            continue;
+
+        uint64_t x = (uint64_t)column_get(&xs, i);
+        uint64_t y = (uint64_t)column_get(&ys, i);
+        int64_t h = (int64_t)((x * SPATIAL_PRIME_X) ^ (y * SPATIAL_PRIME_Y) ^ seed_bits);
+
+        /* Glyph from the low bits. */
+        column_set(&chars, i, glyphs[pool[POOL_GLYPH_START] + floor_mod(h, count)]);
+
+        /* BG brightness jitter from bits 8-15, same offset on every channel. */
+        int64_t bg_jitter = pool[POOL_BG_JITTER];
+        int64_t bg_offset = floor_mod(h >> 8, 2 * bg_jitter + 1) - bg_jitter;
+        jitter_rgb(&bg, i, bg_offset);
+
+        /* FG gets its own offset from bits 16-23 when it has a jitter of its own;
+           otherwise it is locked to the bg offset. */
+        int64_t fg_jitter = pool[POOL_FG_JITTER];
+        int64_t fg_offset =
+            fg_jitter > 0 ? floor_mod(h >> 16, 2 * fg_jitter + 1) - fg_jitter : bg_offset;
+        jitter_rgb(&fg, i, fg_offset);
+    }
+    Py_END_ALLOW_THREADS
+    /* clang-format on */
+
+    result = Py_None;
+    Py_INCREF(result);
+
+done:
+    if (glyphs_buf.obj)
+        PyBuffer_Release(&glyphs_buf);
+    if (table_buf.obj)
+        PyBuffer_Release(&table_buf);
+    if (y_buf.obj)
+        PyBuffer_Release(&y_buf);
+    if (x_buf.obj)
+        PyBuffer_Release(&x_buf);
+    if (tiles_buf.obj)
+        PyBuffer_Release(&tiles_buf);
+    if (bg_buf.obj)
+        PyBuffer_Release(&bg_buf);
+    if (fg_buf.obj)
+        PyBuffer_Release(&fg_buf);
+    if (chars_buf.obj)
+        PyBuffer_Release(&chars_buf);
+    return result;
+}
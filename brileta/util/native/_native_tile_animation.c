@@ -0,0 +1,183 @@
+/*
+ * Terrain tile animation random walk for WorldView.
+ *
+ * Each frame a fixed share of the visible animated tiles in the viewport gets
+ * its foreground and background RGB modulation values (0-1000) nudged by an
+ * independent uniform offset in [-step, step] and clamped back into range.
+ *
+ * The kernel works in place on the `fg_values` / `bg_values` field views of
+ * GameMap.animation_state, so there are no index or offset temporaries.  It
+ * makes two passes over the viewport slice: one counts candidate tiles
+ * (visible and animates), the other picks exactly
+ * max(1, count * percent / 100) of them with selection sampling (Knuth's
+ * Algorithm S), which visits candidates in scan order and keeps each with
+ * probability (still_needed / still_remaining).  All randomness comes from a
+ * seeded xoshiro128++ stream, so a given seed reproduces the same walk.
+ *
+ * The state array is a packed structured dtype, so the int16 fields are not
+ * 2-byte aligned; they are read and written with memcpy.
+ */
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "_native_rng.h"
+
+#define ANIM_VALUE_MAX 1000
+
+typedef struct {
+    char *buf;
+    Py_ssize_t sx, sy, sc; /* strides for x, y and channel (field views are 3D) */
+} ChannelGrid;
+
+static inline int32_t rng_offset(NativeRng *rng, int32_t step) {
+    /* Lemire's multiply-shift maps a u32 onto [0, 2 * step] without division. */
+    uint32_t span = (uint32_t)(2 * step + 1);
+    uint32_t r = (uint32_t)(((uint64_t)native_rng_next_u32(rng) * span) >> 32);
+    return (int32_t)r - step;
+}
+
+static inline void walk_channels(const ChannelGrid *g, Py_ssize_t x, Py_ssize_t y, NativeRng *rng,
+                                 int32_t step) {
+    char *cell = g->buf + x * g->sx + y * g->sy;
+    for (int c = 0; c < 3; c++) {
+        int16_t value;
+        memcpy(&value, cell + c * g->sc, sizeof(value));
+        int32_t next = (int32_t)value + rng_offset(rng, step);
+        next = next < 0 ? 0 : (next > ANIM_VALUE_MAX ? ANIM_VALUE_MAX : next);
+        value = (int16_t)next;
+        memcpy(cell + c * g->sc, &value, sizeof(value));
+    }
+}
+
+static int get_mask(PyObject *obj, Py_buffer *buf, const char *name) {
+    if (PyObject_GetBuffer(obj, buf, PyBUF_STRIDES) < 0)
+        return -1;
+    if (buf->ndim != 2 || buf->itemsize != 1) {
+        PyErr_Format(PyExc_TypeError, "%s must be a 2D bool array", name);
+        return -1;
+    }
+    return 0;
+}
+
+static int get_channels(PyObject *obj, Py_buffer *buf, ChannelGrid *grid, const char *name) {
+    if (PyObject_GetBuffer(obj, buf, PyBUF_STRIDES | PyBUF_WRITABLE) < 0)
+        return -1;
+    if (buf->ndim != 3 || buf->itemsize != 2 || buf->shape[2] != 3) {
+        PyErr_Format(PyExc_TypeError, "%s must be a (w, h, 3) int16 array", name);
+        return -1;
+    }
+    grid->buf = (char *)buf->buf;
+    grid->sx = buf->strides[0];
+    grid->sy = buf->strides[1];
+    grid->sc = buf->strides[2];
+    return 0;
+}
+
+PyObject *brileta_native_tile_animation_walk(PyObject *self, PyObject *args) {
+    PyObject *visible_obj, *animates_obj, *fg_obj, *bg_obj;
+    int left, top, right, bottom, percent, step;
+    unsigned long long seed;
+
+    if (!PyArg_ParseTuple(args,
+                          "OOOOiiiiiiK",
+                          &visible_obj,  /* (w, h) bool, any layout                */
+                          &animates_obj, /* (w, h) bool animation_params["animates"] */
+                          &fg_obj,       /* (w, h, 3) int16 state["fg_values"], r/w */
+                          &bg_obj,       /* (w, h, 3) int16 state["bg_values"], r/w */
+                          &left,         /* inclusive world-tile bounds             */
+                          &top,
+                          &right,
+                          &bottom,
+                          &percent,
+                          &step,
+                          &seed))
+        return NULL;
+
+    Py_buffer visible_buf = {0}, animates_buf = {0}, fg_buf = {0}, bg_buf = {0};
+    PyObject *result = NULL;
+    ChannelGrid fg, bg;
+
+    if (get_mask(visible_obj, &visible_buf, "visible") < 0)
+        goto done;
+    if (get_mask(animates_obj, &animates_buf, "animates") < 0)
+        goto done;
+    if (get_channels(fg_obj, &fg_buf, &fg, "fg_values") < 0)
+        goto done;
+    if (get_channels(bg_obj, &bg_buf, &bg, "bg_values") < 0)
+        goto done;
+
+    Py_ssize_t width = visible_buf.shape[0];
+    Py_ssize_t height = visible_buf.shape[1];
+    if (animates_buf.shape[0] != width || animates_buf.shape[1] != height ||
+        fg_buf.shape[0] != width || fg_buf.shape[1] != height || bg_buf.shape[0] != width ||
+        bg_buf.shape[1] != height) {
+        PyErr_SetString(PyExc_ValueError, "visible, animates and state must share a shape");
+        goto done;
+    }
+    if (step < 0) {
+        PyErr_SetString(PyExc_ValueError, "step must be non-negative");
+        goto done;
+    }
+
+    Py_ssize_t x0 = left < 0 ? 0 : left;
+    Py_ssize_t y0 = top < 0 ? 0 : top;
+    Py_ssize_t x1 = right >= width ? width - 1 : right;
+    Py_ssize_t y1 = bottom >= height ? height - 1 : bottom;
+
+    const char *visible = (const char *)visible_buf.buf;
+    const char *animates = (const char *)animates_buf.buf;
+    Py_ssize_t vis_sx = visible_buf.strides[0], vis_sy = visible_buf.strides[1];
+    Py_ssize_t anim_sx = animates_buf.strides[0], anim_sy = animates_buf.strides[1];
+    Py_ssize_t updated = 0;
+
+    /* clang-format off */
+    Py_BEGIN_ALLOW_THREADS
+    Py_ssize_t candidates = 0;
+    for (Py_ssize_t x = x0; x <= x1; x++)
+        for (Py_ssize_t y = y0; y <= y1; y++)
+            candidates += visible[x * vis_sx + y * vis_sy] && animates[x * anim_sx + y * anim_sy];
+
+    if (candidates > 0) {
+        Py_ssize_t wanted = candidates * percent / 100;
+        if (wanted < 1)
+            wanted = 1;
+        if (wanted > candidates)
+            wanted = candidates;
+
+        NativeRng rng;
+        native_rng_init(&rng, (uint64_t)seed);
+        Py_ssize_t remaining = candidates;
+        for (Py_ssize_t x = x0; x <= x1 && updated < wanted; x++) {
+            for (Py_ssize_t y = y0; y <= y1 && updated < wanted; y++) {
+                if (!visible[x * vis_sx + y * vis_sy] || !animates[x * anim_sx + y * anim_sy])
+                    continue;
+                /* Algorithm S: keep with probability needed / remaining. */
+                double needed = (double)(wanted - updated);
+                if (native_rng_next_double(&rng) * (double)remaining < needed) {
+                    walk_channels(&fg, x, y, &rng, step);
+                    walk_channels(&bg, x, y, &rng, step);
+                    updated++;
+                }
+                remaining--;
+            }
+        }
+    }
+    Py_END_ALLOW_THREADS
+    /* clang-format on */
+
+    result = PyLong_FromSsize_t(updated);
+
+done:
+    if (bg_buf.obj)
+        PyBuffer_Release(&bg_buf);
+    if (fg_buf.obj)
+        PyBuffer_Release(&fg_buf);
+    if (animates_buf.obj)
+        PyBuffer_Release(&animates_buf);
+    if (visible_buf.obj)
+        PyBuffer_Release(&visible_buf);
+    return result;
+}
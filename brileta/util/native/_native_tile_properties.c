@@ -0,0 +1,176 @@
+/*
+ * Fused per-tile property lookup for brileta.environment.tile_types.
+ *
+ * Every derived map (walkable, transparent, shadow height, hazard cost,
+ * animation and emission records, decoration amplitudes) is a field of one
+ * packed per-tile-type record.  A single pass over a window of the tile-id
+ * grid reads each tile's record once and scatters the requested fields into
+ * their output grids, instead of one full-grid fancy-index per property.
+ *
+ * Outputs are passed as (array, byte_offset) pairs; each array's itemsize is
+ * the field size, so any fixed-size field (including nested records) can be
+ * filled.  Outputs may have any strides, which lets a dirty rect be patched
+ * inside existing full-map arrays.
+ */
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#include <stdint.h>
+#include <string.h>
+
+#define MAX_TILE_PROPERTY_OUTPUTS 16
+
+typedef struct {
+    char *buf;
+    Py_ssize_t stride_x, stride_y;
+    Py_ssize_t offset; /* byte offset of the field inside a record */
+    Py_ssize_t size;   /* field size in bytes */
+} PropertyOutput;
+
+static inline void copy_field(char *dst, const char *src, Py_ssize_t size) {
+    switch (size) {
+    case 1:
+        *dst = *src;
+        break;
+    case 2:
+        memcpy(dst, src, 2);
+        break;
+    case 4:
+        memcpy(dst, src, 4);
+        break;
+    default:
+        memcpy(dst, src, (size_t)size);
+    }
+}
+
+PyObject *brileta_native_tile_property_fill(PyObject *self, PyObject *args) {
+    PyObject *tiles_obj, *lut_obj, *outputs_obj;
+    int x1, y1, x2, y2;
+
+    if (!PyArg_ParseTuple(args,
+                          "OOOiiii",
+                          &tiles_obj,   /* (w, h) uint8 tile type ids, any layout      */
+                          &lut_obj,     /* (n_types,) packed records, C-contiguous     */
+                          &outputs_obj, /* sequence of (array (w, h), field offset)    */
+                          &x1,          /* window, exclusive end, clipped to the grid */
+                          &y1,
+                          &x2,
+                          &y2))
+        return NULL;
+
+    Py_buffer tiles_buf = {0}, lut_buf = {0};
+    Py_buffer out_bufs[MAX_TILE_PROPERTY_OUTPUTS];
+    PropertyOutput outputs[MAX_TILE_PROPERTY_OUTPUTS];
+    Py_ssize_t n_outputs = 0;
+    PyObject *outputs_seq = NULL;
+    PyObject *result = NULL;
+
+    if (PyObject_GetBuffer(tiles_obj, &tiles_buf, PyBUF_STRIDES) < 0)
+        goto done;
+    if (tiles_buf.ndim != 2 || tiles_buf.itemsize != 1) {
+        PyErr_SetString(PyExc_TypeError, "tiles must be a 2D uint8 array");
+        goto done;
+    }
+    if (PyObject_GetBuffer(lut_obj, &lut_buf, PyBUF_C_CONTIGUOUS) < 0)
+        goto done;
+    if (lut_buf.ndim != 1 || lut_buf.itemsize <= 0) {
+        PyErr_SetString(PyExc_TypeError, "lut must be a 1D record array");
+        goto done;
+    }
+
+    outputs_seq = PySequence_Fast(outputs_obj, "outputs must be a sequence");
+    if (outputs_seq == NULL)
+        goto done;
+    Py_ssize_t n_requested = PySequence_Fast_GET_SIZE(outputs_seq);
+    if (n_requested > MAX_TILE_PROPERTY_OUTPUTS) {
+        PyErr_Format(PyExc_ValueError,
+                     "at most %d outputs per pass",
+                     MAX_TILE_PROPERTY_OUTPUTS);
+        goto done;
+    }
+
+    Py_ssize_t width = tiles_buf.shape[0];
+    Py_ssize_t height = tiles_buf.shape[1];
+    Py_ssize_t record_size = lut_buf.itemsize;
+    Py_ssize_t n_types = lut_buf.shape[0];
+
+    for (Py_ssize_t i = 0; i < n_requested; i++) {
+        PyObject *item = PySequence_Fast_GET_ITEM(outputs_seq, i);
+        PyObject *array_obj;
+        Py_ssize_t offset;
+        if (!PyArg_ParseTuple(item, "On", &array_obj, &offset))
+            goto done;
+        Py_buffer *buf = &out_bufs[n_outputs];
+        if (PyObject_GetBuffer(array_obj, buf, PyBUF_STRIDES | PyBUF_WRITABLE) < 0)
+            goto done;
+        n_outputs++;
+        if (buf->ndim != 2 || buf->shape[0] != width || buf->shape[1] != height) {
+            PyErr_SetString(PyExc_ValueError, "outputs must match the tiles shape");
+            goto done;
+        }
+        if (offset < 0 || offset + buf->itemsize > record_size) {
+            PyErr_SetString(PyExc_ValueError, "field offset lies outside the record");
+            goto done;
+        }
+        outputs[i].buf = (char *)buf->buf;
+        outputs[i].stride_x = buf->strides[0];
+        outputs[i].stride_y = buf->strides[1];
+        outputs[i].offset = offset;
+        outputs[i].size = buf->itemsize;
+    }
+
+    if (x1 < 0)
+        x1 = 0;
+    if (y1 < 0)
+        y1 = 0;
+    if (x2 > width)
+        x2 = (int)width;
+    if (y2 > height)
+        y2 = (int)height;
+
+    const uint8_t *tiles = (const uint8_t *)tiles_buf.buf;
+    const char *lut = (const char *)lut_buf.buf;
+    Py_ssize_t tiles_sx = tiles_buf.strides[0], tiles_sy = tiles_buf.strides[1];
+    int bad_tile = -1;
+
+    /* clang-format off */
+    Py_BEGIN_ALLOW_THREADS
+    for (int y = y1; y < y2 && bad_tile < 0; y++) {
+        for (int x = x1; x < x2; x++) {
+            uint8_t tile = tiles[x * tiles_sx + y * tiles_sy];
+            if (tile >= n_types) {
+                bad_tile = tile;
+                break;
+            }
+            const char *record = lut + tile * record_size;
+            for (Py_ssize_t o = 0; o < n_outputs; o++) {
+                const PropertyOutput *out = &outputs[o];
+                copy_field(out->buf + x * out->stride_x + y * out->stride_y,
+                           record + out->offset, out->size);
+            }
+        }
+    }
+    Py_END_ALLOW_THREADS
+    /* clang-format on */
+
+    if (bad_tile >= 0) {
+        PyErr_Format(PyExc_IndexError,
+                     "tile type id %d is out of bounds for %zd registered types",
+                     bad_tile,
+                     n_types);
+        goto done;
+    }
+
+    result = Py_None;
+    Py_INCREF(result);
+
+done:
+    for (Py_ssize_t i = 0; i < n_outputs; i++)
+        PyBuffer_Release(&out_bufs[i]);
+    Py_XDECREF(outputs_seq);
+    if (lut_buf.obj)
+        PyBuffer_Release(&lut_buf);
+    if (tiles_buf.obj)
+        PyBuffer_Release(&tiles_buf);
+    return result;
+}
@@ -18,7 +18,9 @@ if TYPE_CHECKING:
 
 # Native pathfinding is required at runtime.
 try:
+    from brileta.util._native import IncrementalPlanner
     from brileta.util._native import astar as _c_astar
+    from brileta.util._native import astar_within as _c_astar_within
 except ImportError as exc:  # pragma: no cover - fails fast by design
     raise ImportError(
         "brileta.util._native is required. "
@@ -207,6 +209,7 @@ def find_local_path(
     end_pos: WorldTilePos,
     *,
     can_open_doors: bool = False,
+    stop_distance: int = 0,
 ) -> list[WorldTilePos]:
     """
     Calculate a path from a start to an end position using A*.
@@ -230,6 +233,10 @@ def find_local_path(
     This lets door-capable NPCs plan routes through closed doors while
     still preferring open paths when they exist.
 
+    With ``stop_distance > 0`` the goal is any passable tile within that
+    Chebyshev distance of ``end_pos`` rather than ``end_pos`` itself, found
+    in a single search. This is how approach plans reach an occupied target.
+
     Args:
         game_map: The GameMap instance, used for static terrain checks.
         actor_spatial_index: The spatial index, used for dynamic obstacle checks.
@@ -239,24 +246,36 @@ def find_local_path(
         end_pos: The (x, y) target coordinate for the path.
         can_open_doors: If True, treat closed doors as high-cost passable
             tiles rather than walls. Defaults to False.
+        stop_distance: Accept any tile within this Chebyshev distance of
+            ``end_pos`` as the end of the path. Defaults to 0 (exact).
 
     Returns:
         A list of (x, y) tuples representing the path from start to end.
         The list does not include the start point. Returns an empty list
-        if no path is found.
+        if no path is found, or if the start already satisfies
+        ``stop_distance``.
     """
-    from brileta.environment.tile_types import (
-        DOOR_TRAVERSAL_COST,
-        HAZARD_BASE_COST,
-        TileTypeID,
-        get_hazard_cost_map,
-    )
+    cost = _static_path_costs(game_map, can_open_doors=can_open_doors)
+    bounds = _actor_bounds(game_map, start_pos, end_pos, stop_distance)
+    for (x, y), actor_cost in _actor_path_costs(
+        actor_spatial_index, pathing_actor, bounds, cost
+    ).items():
+        cost[x, y] = actor_cost
+
+    if stop_distance > 0:
+        return _astar_within(cost, start_pos, end_pos, stop_distance)
+    path: list[WorldTilePos] = _astar(cost, start_pos, end_pos)
+    return path
+
 
-    # Build cost array: start with hazard costs for all tiles, then mask
-    # non-walkable tiles to 0. This ensures hazards anywhere on the map
-    # are considered, not just within the start-end bounding box.
-    hazard_costs = get_hazard_cost_map(game_map.tiles)
-    cost = np.where(game_map.walkable, hazard_costs, 0).astype(np.int16)
+def _static_path_costs(game_map: GameMap, *, can_open_doors: bool) -> np.ndarray:
+    """Terrain cost grid for A*: hazard weights, 0 where impassable."""
+    from brileta.environment.tile_types import DOOR_TRAVERSAL_COST, TileTypeID
+
+    # Start with hazard costs for all tiles, then mask non-walkable tiles to
+    # 0. This ensures hazards anywhere on the map are considered, not just
+    # within the start-end bounding box.
+    cost = np.where(game_map.walkable, game_map.hazard_costs, 0).astype(np.int16)
 
     # Door-capable actors can pathfind through closed doors at extra cost.
     # Doors are non-walkable (cost 0 after the mask above), so we overlay
@@ -264,16 +283,57 @@ def find_local_path(
     if can_open_doors:
         door_mask = game_map.tiles == TileTypeID.DOOR_CLOSED
         cost[door_mask] = DOOR_TRAVERSAL_COST
+    return cost
+
+
+def _static_tile_cost(
+    game_map: GameMap, x: int, y: int, *, can_open_doors: bool
+) -> int:
+    """One tile of :func:`_static_path_costs`, for patching after tile edits."""
+    from brileta.environment.tile_types import DOOR_TRAVERSAL_COST, TileTypeID
+
+    if can_open_doors and game_map.tiles[x, y] == TileTypeID.DOOR_CLOSED:
+        return DOOR_TRAVERSAL_COST
+    if not game_map.walkable[x, y]:
+        return 0
+    return int(np.int16(game_map.hazard_costs[x, y]))
+
 
-    # Bounding box for spatial index queries (actors near the path)
-    x1 = max(0, min(start_pos[0], end_pos[0]))
-    y1 = max(0, min(start_pos[1], end_pos[1]))
-    x2 = min(game_map.width - 1, max(start_pos[0], end_pos[0]))
-    y2 = min(game_map.height - 1, max(start_pos[1], end_pos[1]))
+def _actor_bounds(
+    game_map: GameMap,
+    start_pos: WorldTilePos,
+    end_pos: WorldTilePos,
+    stop_distance: int,
+) -> tuple[int, int, int, int]:
+    """Bounding box for spatial index queries (actors near the path).
+
+    Widened by ``stop_distance`` to cover every acceptable end tile.
+    """
+    return (
+        max(0, min(start_pos[0], end_pos[0] - stop_distance)),
+        max(0, min(start_pos[1], end_pos[1] - stop_distance)),
+        min(game_map.width - 1, max(start_pos[0], end_pos[0] + stop_distance)),
+        min(game_map.height - 1, max(start_pos[1], end_pos[1] + stop_distance)),
+    )
+
+
+def _actor_path_costs(
+    actor_spatial_index: SpatialIndex[Actor],
+    pathing_actor: Actor,
+    bounds: tuple[int, int, int, int],
+    base_cost: np.ndarray,
+) -> dict[WorldTilePos, int]:
+    """Cost overrides from actors inside ``bounds``, keyed by tile.
 
-    nearby_actors = actor_spatial_index.get_in_bounds(x1, y1, x2, y2)
+    Blocking actors make their tile impassable (0); fire actors raise the
+    tile's cost. ``base_cost`` is the terrain grid the overrides apply to.
+    """
+    from brileta.environment.tile_types import HAZARD_BASE_COST
 
-    for actor in nearby_actors:
+    overrides: dict[WorldTilePos, int] = {}
+    fires: list[tuple[WorldTilePos, int]] = []
+    for actor in actor_spatial_index.get_in_bounds(*bounds):
+        pos = (actor.x, actor.y)
         # All blocking actors are treated as impassable obstacles.
         #
         # NOTE: Do NOT "optimize" this to ignore mobile actors. We tried that
@@ -284,16 +344,127 @@ def find_local_path(
         # an actor blocks the path. Treat all blockers as obstacles here; the
         # validation mechanism handles dynamic rerouting when actors move.
         if actor.blocks_movement and actor is not pathing_actor:
-            cost[actor.x, actor.y] = 0
+            overrides[pos] = 0
 
         damage_per_turn = getattr(actor, "damage_per_turn", 0)
-        if damage_per_turn > 0 and cost[actor.x, actor.y] > 0:
+        if damage_per_turn > 0:
+            fires.append((pos, damage_per_turn))
+
+    for pos, damage_per_turn in fires:
+        current = overrides.get(pos, int(base_cost[pos]))
+        if current > 0:
             # Fire hazards (campfires, barrel fires, torches) are high-cost
-            fire_cost = HAZARD_BASE_COST + damage_per_turn
-            cost[actor.x, actor.y] = max(cost[actor.x, actor.y], fire_cost)
+            overrides[pos] = max(current, HAZARD_BASE_COST + damage_per_turn)
+    return overrides
 
-    path: list[WorldTilePos] = _astar(cost, start_pos, end_pos)
-    return path
+
+class RepairablePath:
+    """A path to a goal box that is repaired, not recomputed, when tiles change.
+
+    Wraps the native D* Lite :class:`IncrementalPlanner` around the same
+    cost grid :func:`find_local_path` builds. Each :meth:`repair` feeds the
+    planner only the tiles whose cost moved since the last call - terrain
+    reported by ``GameMap.tiles_changed_since()`` (door toggles and other
+    edits) and tiles whose blocking or fire actors changed - so a crowded
+    street costs a handful of vertex updates per blocked move instead of a
+    fresh search.
+
+    Paths end at the first tile within ``stop_distance`` (Chebyshev) of the
+    target, like ``find_local_path(..., stop_distance=...)``, and are
+    optimal for the current grid.
+    """
+
+    def __init__(
+        self,
+        game_map: GameMap,
+        actor_spatial_index: SpatialIndex[Actor],
+        pathing_actor: Actor,
+        target: WorldTilePos,
+        *,
+        stop_distance: int = 0,
+        can_open_doors: bool = False,
+    ) -> None:
+        self.game_map = game_map
+        self.actor_spatial_index = actor_spatial_index
+        self.pathing_actor = pathing_actor
+        self.target = target
+        self.stop_distance = stop_distance
+        self.can_open_doors = can_open_doors
+        self._planner: IncrementalPlanner | None = None
+        self._base_cost = np.zeros((0, 0), dtype=np.int16)
+        self._overrides: dict[WorldTilePos, int] = {}
+        self._revision = -1
+
+    def matches(
+        self, target: WorldTilePos, stop_distance: int, can_open_doors: bool
+    ) -> bool:
+        """Whether this path still answers the given approach request."""
+        return (
+            self.target == target
+            and self.stop_distance == stop_distance
+            and self.can_open_doors == can_open_doors
+        )
+
+    @property
+    def expansions(self) -> int:
+        """Vertices the planner popped during the last repair."""
+        return 0 if self._planner is None else self._planner.expansions
+
+    def repair(self, start_pos: WorldTilePos) -> list[WorldTilePos]:
+        """Bring the planner up to date and return the path from ``start_pos``.
+
+        Returns:
+            The path excluding ``start_pos``, or an empty list if the goal
+            box is unreachable or ``start_pos`` is already inside it.
+        """
+        gm = self.game_map
+        changed = gm.tiles_changed_since(self._revision)
+        if self._planner is None or changed is None:
+            self._rebuild(start_pos)
+            assert self._planner is not None
+            return self._planner.compute_path()
+
+        updates: dict[WorldTilePos, int] = {}
+        for x, y in changed:
+            self._base_cost[x, y] = _static_tile_cost(
+                gm, x, y, can_open_doors=self.can_open_doors
+            )
+            updates[(x, y)] = int(self._base_cost[x, y])
+        self._revision = gm.structural_revision
+
+        bounds = _actor_bounds(gm, start_pos, self.target, self.stop_distance)
+        overrides = _actor_path_costs(
+            self.actor_spatial_index, self.pathing_actor, bounds, self._base_cost
+        )
+        # Tiles an actor left fall back to terrain; current actors win.
+        for pos in self._overrides.keys() - overrides.keys():
+            updates[pos] = int(self._base_cost[pos])
+        updates.update(overrides)
+        self._overrides = overrides
+
+        self._planner.update_costs([(x, y, c) for (x, y), c in updates.items()])
+        self._planner.set_start(*start_pos)
+        return self._planner.compute_path()
+
+    def _rebuild(self, start_pos: WorldTilePos) -> None:
+        gm = self.game_map
+        self._base_cost = _static_path_costs(gm, can_open_doors=self.can_open_doors)
+        self._revision = gm.structural_revision
+        bounds = _actor_bounds(gm, start_pos, self.target, self.stop_distance)
+        self._overrides = _actor_path_costs(
+            self.actor_spatial_index, self.pathing_actor, bounds, self._base_cost
+        )
+        cost = self._base_cost.copy()
+        for (x, y), actor_cost in self._overrides.items():
+            cost[x, y] = actor_cost
+        self._planner = IncrementalPlanner(
+            cost,
+            start_pos[0],
+            start_pos[1],
+            self.target[0],
+            self.target[1],
+            self.stop_distance,
+        )
 
 
 def _astar(
@@ -320,3 +491,23 @@ def _astar(
     # The C extension needs a C-contiguous int16 array.
     c_cost = np.ascontiguousarray(cost, dtype=np.int16)
     return _c_astar(c_cost, start[0], start[1], goal[0], goal[1])
+
+
+def _astar_within(
+    cost: np.ndarray,
+    start: tuple[int, int],
+    target: tuple[int, int],
+    distance: int,
+) -> list[WorldTilePos]:
+    """A* to the cheapest passable tile within Chebyshev *distance* of *target*.
+
+    Same costs and diagonal rule as :func:`_astar`, but the search stops at
+    the first settled tile of the goal box, guided by the octile distance to
+    that box. The target tile itself may be blocked.
+
+    Returns:
+        List of (x, y) positions from start to the reached tile, excluding
+        start. Empty list if no path exists or start is already in range.
+    """
+    c_cost = np.ascontiguousarray(cost, dtype=np.int16)
+    return _c_astar_within(c_cost, start[0], start[1], target[0], target[1], distance)
@@ -285,6 +285,21 @@ def unicode_to_cp437(codepoint: int, fallback: int = ord("?")) -> int:
     return UNICODE_TO_CP437.get(codepoint, fallback)
 
 
+def unicode_to_cp437_array(codepoints: np.ndarray) -> np.ndarray:
+    """Vectorized atlas-index lookup over an array of Unicode code points.
+
+    Code points 0-255 index the atlas directly (as single characters do);
+    anything higher goes through :func:`unicode_to_cp437`.
+
+    Returns:
+        An int64 array of CP437 positions, shaped like ``codepoints``.
+    """
+    glyphs = np.array(codepoints, dtype=np.int64)
+    for codepoint in np.unique(glyphs[glyphs > 255]):
+        glyphs[glyphs == codepoint] = unicode_to_cp437(int(codepoint))
+    return glyphs
+
+
 def derive_outlined_atlas(
     atlas_pixels: np.ndarray,
     tile_width: int,
@@ -9,25 +9,45 @@ single late actor: it generates that actor's pose set, packs it into the live
 atlas with a partial upload, and assigns its UVs - reusing the exact per-actor
 generate/assign logic the batch pass uses, so a late dog and a world-gen dog
 with the same actor id and map seed look identical.
+
+All generation goes through a :class:`~brileta.sprites.cache.SpriteCache`
+keyed by (generator, archetype, seed, size, generator version), persisted
+between runs, so rebuilding or reloading a world only generates sprites it has
+never seen. The atlas packs with content dedupe, so actors whose sprites are
+byte-identical share one UV rectangle.
+
+GPU memory for the atlas is capped by ``config.SPRITE_ATLAS_PAGE_SIZE`` and
+``config.SPRITE_ATLAS_PAGE_COUNT``. A world whose sprites fit that budget is
+packed in full as above. A bigger one switches to streaming: nothing is
+generated up front, and :meth:`ActorSpriteManager.update_residency`, called
+each frame with the camera bounds, generates and packs sprites for actors near
+the view into a :class:`~brileta.backends.wgpu.sprite_atlas.PagedSpriteAtlas`
+a few per frame, evicting the least recently seen page when the budget is
+full. Actors without resident sprites render as their glyph meanwhile.
 """
 
 from __future__ import annotations
 
 import logging
-from typing import TYPE_CHECKING, Literal
+from typing import TYPE_CHECKING, Any, Literal
 
+from brileta import config
 from brileta.game.actors import Actor
 from brileta.game.actors.boulder import Boulder
 from brileta.game.actors.core import NPC, Character
 from brileta.game.actors.trees import Tree
-from brileta.types import MapDecorationSeed, SpriteUV
+from brileta.sprites.cache import SpriteCache, SpriteCacheKey, archetype_tag
+from brileta.types import ActorId, MapDecorationSeed, SpatialSeed, SpriteUV
 from brileta.util.live_vars import record_time_live_variable
 
 if TYPE_CHECKING:
+    from collections.abc import Callable, Sequence
+
     import numpy as np
 
-    from brileta.backends.wgpu.sprite_atlas import SpriteAtlas
+    from brileta.backends.wgpu.sprite_atlas import PagedSpriteAtlas, SpriteAtlas
     from brileta.game.game_world import GameWorld
+    from brileta.util.coordinates import Rect
 
     from .graphics import GraphicsContext
 
@@ -43,6 +63,16 @@ _ActorSpriteKind = Literal["humanoid", "quadruped"]
 # larger texture changes nothing visually.
 _HEADROOM_POSE_SETS = 32
 
+# Base sizes passed to each generator. Part of the sprite-cache key, so they
+# are spelled out here rather than left to the generators' defaults.
+_TREE_BASE_SIZE = 20
+_BOULDER_BASE_SIZE = 16
+_POSE_SET_SIZE = 20
+
+# Actors per sprite family generated up front to estimate the world's atlas
+# area against the budget. Smaller worlds are measured exactly.
+_BUDGET_SAMPLE_SIZE = 64
+
 
 class ActorSpriteManager:
     """Owns the live actor sprite atlas and assigns UVs to actors.
@@ -51,8 +81,19 @@ class ActorSpriteManager:
     :meth:`build_for_world` again, which replaces the atlas.
     """
 
-    def __init__(self, graphics: GraphicsContext) -> None:
+    def __init__(
+        self,
+        graphics: GraphicsContext,
+        sprite_cache: SpriteCache | None = None,
+    ) -> None:
         self._graphics = graphics
+        # Generated sprites by content key, shared by every world this manager
+        # builds and persisted to disk when enabled in config.
+        if sprite_cache is None:
+            sprite_cache = SpriteCache(
+                config.SPRITE_CACHE_PATH if config.SPRITE_CACHE_ENABLED else None
+            )
+        self._sprite_cache = sprite_cache
         # The live atlas, kept alive after the batch build so late actors can
         # pack into it. None when no environmental sprites justified an atlas
         # (see build_for_world) or the backend has no atlas support.
@@ -61,6 +102,13 @@ class ActorSpriteManager:
         # same seed and a growth rebuild can re-census the world.
         self._map_seed: MapDecorationSeed = 0
         self._gw: GameWorld | None = None
+        # Streaming mode (world over the atlas budget): the paged atlas, the
+        # actors currently holding sprites in it, their pre-sprite visual
+        # scales (restored on eviction), and the per-frame residency stamp.
+        self._paged_atlas: PagedSpriteAtlas | None = None
+        self._streamed: dict[ActorId, Actor] = {}
+        self._glyph_scales: dict[ActorId, float] = {}
+        self._residency_stamp = 0
 
     # ------------------------------------------------------------------
     # Per-actor logic shared by the batch build and late-spawn path
@@ -84,26 +132,70 @@ class ActorSpriteManager:
     def _generate_pose_set(
         self, actor: Actor, kind: _ActorSpriteKind
     ) -> list[np.ndarray]:
-        """Generate one actor's pose-set frames, seeded from its id + map seed."""
+        """Return one actor's pose-set frames, seeded from its id + map seed.
+
+        Served from the sprite cache when this (seed, appearance) was generated
+        before; the returned frames are shared and must not be mutated.
+        """
+        return self._generate_pose_sets([actor], kind)[0]
+
+    def _generate_pose_sets(
+        self, actors: Sequence[Actor], kind: _ActorSpriteKind
+    ) -> list[list[np.ndarray]]:
+        """Batch form of :meth:`_generate_pose_set`, in input order.
+
+        Cache misses are generated in one batch call, which fans out through
+        ``parallel_map`` like the tree and boulder families.
+        """
         from brileta.sprites.characters import (
+            CHARACTER_SPRITE_GENERATOR_VERSION,
             character_sprite_seed,
-            generate_character_pose_set,
+            generate_character_pose_sets,
         )
         from brileta.sprites.quadrupeds import (
-            generate_quadruped_pose_set,
+            QUADRUPED_SPRITE_GENERATOR_VERSION,
+            generate_quadruped_pose_sets,
             quadruped_sprite_seed,
         )
 
+        items: list[tuple[int, Any]]
         if kind == "humanoid":
-            return generate_character_pose_set(
-                character_sprite_seed(actor.actor_id, self._map_seed),
-                presentation_profile=getattr(actor, "character_presentation", None),
+            generator, version = "character", CHARACTER_SPRITE_GENERATOR_VERSION
+            items = [
+                (
+                    character_sprite_seed(a.actor_id, self._map_seed),
+                    getattr(a, "character_presentation", None),
+                )
+                for a in actors
+            ]
+        else:
+            generator, version = "quadruped", QUADRUPED_SPRITE_GENERATOR_VERSION
+            items = []
+            for a in actors:
+                assert isinstance(a, NPC) and a.critter_preset is not None
+                items.append(
+                    (
+                        quadruped_sprite_seed(a.actor_id, self._map_seed),
+                        a.critter_preset,
+                    )
+                )
+
+        def generate_misses(misses: list[tuple[int, Any]]) -> list[list[np.ndarray]]:
+            seeds = [seed for seed, _ in misses]
+            archetypes = [archetype for _, archetype in misses]
+            if kind == "humanoid":
+                return generate_character_pose_sets(
+                    seeds, _POSE_SET_SIZE, presentation_profiles=archetypes
+                )
+            return generate_quadruped_pose_sets(seeds, archetypes, _POSE_SET_SIZE)
+
+        keys = [
+            SpriteCacheKey(
+                generator, archetype_tag(archetype), seed, _POSE_SET_SIZE, version
             )
-        assert isinstance(actor, NPC) and actor.critter_preset is not None
-        return generate_quadruped_pose_set(
-            quadruped_sprite_seed(actor.actor_id, self._map_seed),
-            actor.critter_preset,
-        )
+            for seed, archetype in items
+        ]
+        return self._sprite_cache.get_or_generate_many(keys, items, generate_misses)
 
     def _assign_pose_uvs(
         self,
@@ -129,6 +221,8 @@ class ActorSpriteManager:
 
         actor.character_sprite_uvs = tuple(resolved)
         actor.sprite_uv = resolved[0]
+        # Streamed-in actors may already face elsewhere; pick their pose.
+        actor._update_active_sprite_uv(moving=False)
         actor.visual_scale = sprite_visual_scale_for_shadow_height(
             pose_sprites[0], actor.shadow_height
         )
@@ -144,7 +238,9 @@ class ActorSpriteManager:
         Idempotent: an actor that already has UVs is a no-op. If no live atlas
         exists (no environmental sprites, or a backend without atlas support),
         the actor keeps its glyph. If the atlas is full, falls back to a full
-        rebuild that re-packs everyone including this actor.
+        rebuild that re-packs everyone including this actor. While streaming,
+        this is a no-op: :meth:`update_residency` picks the actor up once it
+        is near the camera.
         """
         if self._atlas is None:
             return  # No atlas - actor renders as a glyph, as before.
@@ -157,7 +253,7 @@ class ActorSpriteManager:
             return  # Already has sprites - idempotent no-op, no re-pack.
 
         pose_sprites = self._generate_pose_set(actor, kind)
-        uvs = self._atlas.pack_incremental(pose_sprites)
+        uvs = self._atlas.pack_incremental(pose_sprites, dedupe=True)
         if any(uv is None for uv in uvs):
             # Atlas full: rebuild the whole atlas with headroom re-applied. This
             # re-censuses the world (now including this actor), so it ends with
@@ -181,41 +277,34 @@ class ActorSpriteManager:
         """Generate and upload sprites for every actor in the world at once.
 
         Censuses trees, boulders, humanoid characters, and quadruped critters;
-        generates their sprites in parallel; sizes a power-of-two atlas that
-        fits them all plus headroom for late spawns; packs and uploads in a
-        single flush; and keeps the atlas alive for late-spawn packing.
+        takes their sprites from the sprite cache, generating only the misses
+        (in parallel); sizes a power-of-two atlas that fits the distinct
+        sprites plus headroom for late spawns; packs with content dedupe and
+        uploads in a single flush; keeps the atlas alive for late-spawn
+        packing; and persists any newly generated sprites.
+
+        If the world's sprites would not fit the configured atlas budget, sets
+        up streaming instead (see :meth:`update_residency`) and generates
+        nothing beyond the sample used for the estimate.
 
         Preserves the original behavior that no trees/boulders means no atlas at
         all (characters piggyback on the environmental atlas), in which case
         everyone renders as glyphs.
         """
 
-        from brileta.backends.wgpu.sprite_atlas import PADDING, compute_atlas_size
-        from brileta.sprites.boulders import (
-            archetype_for_position as boulder_archetype_for_position,
-        )
-        from brileta.sprites.boulders import (
-            generate_boulder_sprite_for_position,
-        )
-        from brileta.sprites.boulders import (
-            shadow_height_for_archetype as boulder_shadow_height,
-        )
-        from brileta.sprites.boulders import (
-            visual_scale_with_height_jitter as boulder_visual_scale_with_height_jitter,
+        from brileta.backends.wgpu.sprite_atlas import (
+            PADDING,
+            compute_atlas_size,
+            unique_sprites,
         )
         from brileta.sprites.characters import CHARACTER_POSE_COUNT
-        from brileta.sprites.common import sprite_content_bbox
         from brileta.sprites.quadrupeds import QUADRUPED_POSE_COUNT
-        from brileta.sprites.trees import (
-            generate_tree_sprite_for_position,
-        )
-        from brileta.sprites.trees import (
-            visual_scale_with_height_jitter as tree_visual_scale_with_height_jitter,
-        )
-        from brileta.util.parallel import parallel_map
 
         self._gw = gw
         self._atlas = None
+        self._paged_atlas = None
+        self._streamed.clear()
+        self._glyph_scales.clear()
 
         trees: list[Tree] = []
         boulders: list[Boulder] = []
@@ -242,44 +331,28 @@ class ActorSpriteManager:
 
         map_seed: MapDecorationSeed = int(gw.game_map.decoration_seed)
         self._map_seed = map_seed
+        cache = self._sprite_cache
+        cache.load()
+        self._apply_boulder_shadow_heights(boulders)
+
+        if not self._fits_atlas_budget(trees, boulders, characters, critters):
+            self._start_streaming()
+            cache.save()
+            return
 
         with record_time_live_variable("time.sprites.total_ms"):
-            # Phase 1: Pre-generate all sprites into CPU memory so we can
-            # measure the total area before creating the GPU texture.
+            # Phase 1: Collect all sprites into CPU memory so we can measure
+            # the total area before creating the GPU texture. Cache hits are
+            # free; only misses are generated, in parallel.
             with record_time_live_variable("time.sprites.generate_ms"):
-                tree_sprites = parallel_map(
-                    generate_tree_sprite_for_position,
-                    [t.x for t in trees],
-                    [t.y for t in trees],
-                    [map_seed] * len(trees),
-                    [t.tree_type for t in trees],
-                )
+                tree_sprites = self._tree_sprites(trees)
+                boulder_sprites = self._boulder_sprites(boulders)
 
-                boulder_archetypes = [
-                    boulder_archetype_for_position(b.x, b.y, map_seed) for b in boulders
-                ]
-                for boulder, archetype in zip(
-                    boulders, boulder_archetypes, strict=True
-                ):
-                    boulder.shadow_height = boulder_shadow_height(archetype)
-
-                boulder_sprites = parallel_map(
-                    generate_boulder_sprite_for_position,
-                    [b.x for b in boulders],
-                    [b.y for b in boulders],
-                    [map_seed] * len(boulders),
-                    boulder_archetypes,
-                )
-
-                # Character and critter pose sets go through the same per-actor
-                # generate helper the late-spawn path uses, so both routes
-                # produce identical pixels for the same actor.
-                char_pose_sprites = [
-                    self._generate_pose_set(c, "humanoid") for c in characters
-                ]
-                critter_pose_sprites = [
-                    self._generate_pose_set(c, "quadruped") for c in critters
-                ]
+                # Character and critter pose sets go through the same generate
+                # helper the late-spawn path uses, so both routes produce
+                # identical pixels for the same actor.
+                char_pose_sprites = self._generate_pose_sets(characters, "humanoid")
+                critter_pose_sprites = self._generate_pose_sets(critters, "quadruped")
 
             # Phase 2: Compute the atlas size (with late-spawn headroom) and
             # create it.
@@ -299,7 +372,9 @@ class ActorSpriteManager:
                 flat_char_sprites + flat_critter_sprites, PADDING
             )
             gpu_max = self._graphics.gpu_max_texture_dimension_2d
-            atlas_side = compute_atlas_size(all_sprites, gpu_max, extra_area)
+            atlas_side = compute_atlas_size(
+                unique_sprites(all_sprites), gpu_max, extra_area
+            )
 
             atlas = self._graphics.create_sprite_atlas(atlas_side, atlas_side)
             if atlas is None:
@@ -309,10 +384,11 @@ class ActorSpriteManager:
                 )
                 return
 
-            # Phase 3: Bulk-pack all sprites via shelf packing, then flush
-            # to the GPU in a single write_texture call.
+            # Phase 3: Bulk-pack all sprites via shelf packing (identical
+            # pixel blocks share one rectangle), then flush to the GPU in a
+            # single write_texture call.
             with record_time_live_variable("time.sprites.atlas_pack_ms"):
-                uvs = atlas.pack_all(all_sprites)
+                uvs = atlas.pack_all(all_sprites, dedupe=True)
 
                 # Assign UVs and visual scales back to the actors.
                 # UV list order: [trees..., boulders..., characters...].
@@ -320,30 +396,12 @@ class ActorSpriteManager:
                 for i, tree in enumerate(trees):
                     uv = uvs[i]
                     if uv is not None:
-                        tree.sprite_uv = uv
-                        tree.visual_scale = tree_visual_scale_with_height_jitter(
-                            tree_sprites[i],
-                            tree.shadow_height,
-                            tree.x,
-                            tree.y,
-                            map_seed,
-                        )
-                        tree.sprite_content_bbox = sprite_content_bbox(tree_sprites[i])
+                        self._assign_single(tree, tree_sprites[i], uv)
 
                 for j, boulder in enumerate(boulders):
                     uv = uvs[n_trees + j]
                     if uv is not None:
-                        boulder.sprite_uv = uv
-                        boulder.visual_scale = boulder_visual_scale_with_height_jitter(
-                            boulder_sprites[j],
-                            boulder.shadow_height,
-                            boulder.x,
-                            boulder.y,
-                            map_seed,
-                        )
-                        boulder.sprite_content_bbox = sprite_content_bbox(
-                            boulder_sprites[j]
-                        )
+                        self._assign_single(boulder, boulder_sprites[j], uv)
 
                 # Characters and critters both use the character_sprite_uvs
                 # pipeline (same 12-frame layout), so the same per-actor assign
@@ -364,6 +422,10 @@ class ActorSpriteManager:
 
                 atlas.flush()
 
+        # Persist anything generated this build so the next startup of this
+        # world skips generation.
+        cache.save()
+
         # Keep the atlas alive for late-spawn packing (was dropped before).
         self._atlas = atlas
         if atlas.texture is not None:
@@ -373,7 +435,7 @@ class ActorSpriteManager:
             "Sprite atlas: %dx%d (%d tree + %d boulder + %d character"
             " + %d critter pose sprites"
             " across %d characters and %d critters,"
-            " %d allocations)",
+            " %d allocations, %d deduplicated; sprite cache %d hits / %d misses)",
             atlas_side,
             atlas_side,
             len(trees),
@@ -383,7 +445,287 @@ class ActorSpriteManager:
             len(characters),
             len(critters),
             atlas.allocated_count,
+            atlas.deduplicated_count,
+            cache.hits,
+            cache.misses,
+        )
+
+    def _fits_atlas_budget(
+        self,
+        trees: list[Tree],
+        boulders: list[Boulder],
+        characters: list[Character],
+        critters: list[NPC],
+    ) -> bool:
+        """Whether every censused sprite fits one atlas within the page budget.
+
+        Generates (through the cache) up to ``_BUDGET_SAMPLE_SIZE`` actors of
+        each family and extrapolates their mean padded area to the whole
+        family, so deciding never costs a full generation pass. The batch
+        build then reuses the sampled sprites as cache hits.
+        """
+        from brileta.backends.wgpu.sprite_atlas import PADDING, required_atlas_side
+
+        sample_sprites: list[np.ndarray] = []
+        pose_frames: list[np.ndarray] = []
+        extrapolated_area = 0.0
+        families: list[
+            tuple[list[Any], Callable[[list[Any]], list[np.ndarray]], bool]
+        ] = [
+            (trees, self._tree_sprites, False),
+            (boulders, self._boulder_sprites, False),
+            (characters, lambda cs: self._flat_pose_sets(cs, "humanoid"), True),
+            (critters, lambda cs: self._flat_pose_sets(cs, "quadruped"), True),
+        ]
+        for actors, sprites_for, is_pose_set in families:
+            if not actors:
+                continue
+            sampled = actors[:_BUDGET_SAMPLE_SIZE]
+            sample = sprites_for(sampled)
+            sample_sprites.extend(sample)
+            if is_pose_set:
+                pose_frames.extend(sample)
+            padded_area = sum(
+                (px.shape[0] + PADDING) * (px.shape[1] + PADDING) for px in sample
+            )
+            extrapolated_area += (
+                padded_area * (len(actors) - len(sampled)) / len(sampled)
+            )
+
+        side = required_atlas_side(
+            sample_sprites,
+            int(extrapolated_area) + _headroom_area(pose_frames, PADDING),
+        )
+        budget_area = config.SPRITE_ATLAS_PAGE_SIZE**2 * config.SPRITE_ATLAS_PAGE_COUNT
+        return (
+            side <= self._graphics.gpu_max_texture_dimension_2d
+            and side * side <= budget_area
+        )
+
+    # ------------------------------------------------------------------
+    # Streaming: worlds whose sprites exceed the atlas budget
+    # ------------------------------------------------------------------
+
+    def _start_streaming(self) -> None:
+        """Create the fixed-budget paged atlas; sprites arrive per frame."""
+        atlas = self._graphics.create_paged_sprite_atlas(
+            config.SPRITE_ATLAS_PAGE_SIZE, config.SPRITE_ATLAS_PAGE_COUNT
+        )
+        if atlas is None:
+            logger.debug(
+                "Graphics backend has no paged sprite atlas support; "
+                "actors will use fallback glyph rendering."
+            )
+            return
+        self._paged_atlas = atlas
+        self._residency_stamp = 0
+        self._graphics.set_sprite_atlas_texture(atlas.texture)
+        logger.info(
+            "Sprite atlas: world exceeds the %d x %dpx page budget;"
+            " streaming sprites for actors near the camera.",
+            atlas.page_count,
+            atlas.page_size,
+        )
+
+    @property
+    def is_streaming(self) -> bool:
+        """True when sprites are streamed by camera residency, not prebuilt."""
+        return self._paged_atlas is not None
+
+    def update_residency(self, view: Rect) -> None:
+        """Keep sprites resident for actors in or near *view* (world tiles).
+
+        Call once per frame with the visible world bounds. Touches the pages
+        of every resident actor within ``config.SPRITE_RESIDENCY_MARGIN_TILES``
+        of the view, then generates and packs sprites for up to
+        ``config.SPRITE_STREAM_ACTORS_PER_FRAME`` of the rest, nearest the
+        view centre first; those further down the queue keep their glyph until
+        a later frame. Packing may evict the least recently seen page, whose
+        actors drop back to glyphs until they come near the camera again
+        (their sprites come back from the sprite cache, so re-streaming them
+        is cheap). No-op unless the world is streaming.
+        """
+        atlas = self._paged_atlas
+        gw = self._gw
+        if atlas is None or gw is None:
+            return
+
+        self._residency_stamp += 1
+        stamp = self._residency_stamp
+        margin = config.SPRITE_RESIDENCY_MARGIN_TILES
+        nearby = gw.actor_spatial_index.get_in_bounds(
+            view.x1 - margin, view.y1 - margin, view.x2 + margin, view.y2 + margin
+        )
+        missing = [
+            actor
+            for actor in nearby
+            if not atlas.touch(actor.actor_id, stamp) and self._is_streamable(actor)
+        ]
+        if not missing:
+            return
+
+        center_x, center_y = view.center()
+        missing.sort(key=lambda a: max(abs(a.x - center_x), abs(a.y - center_y)))
+        with record_time_live_variable("time.sprites.stream_ms"):
+            for actor in missing[: config.SPRITE_STREAM_ACTORS_PER_FRAME]:
+                frames = self._sprite_frames(actor)
+                uvs, evicted = atlas.pack_group(actor.actor_id, frames, stamp)
+                for actor_id in evicted:
+                    self._drop_streamed(actor_id)
+                if uvs is None:
+                    # Every page holds sprites in use this frame: the budget
+                    # is smaller than the view's working set. The rest wait.
+                    logger.debug("Sprite atlas budget full for the current view.")
+                    break
+                self._glyph_scales.setdefault(actor.actor_id, actor.visual_scale)
+                self._assign_frames(actor, frames, uvs)
+                self._streamed[actor.actor_id] = actor
+
+    def _is_streamable(self, actor: Actor) -> bool:
+        return isinstance(actor, (Tree, Boulder)) or self._classify(actor) is not None
+
+    def _sprite_frames(self, actor: Actor) -> list[np.ndarray]:
+        """One actor's sprite frames: a single sprite, or its pose set."""
+        if isinstance(actor, Tree):
+            return self._tree_sprites([actor])
+        if isinstance(actor, Boulder):
+            return self._boulder_sprites([actor])
+        kind = self._classify(actor)
+        assert kind is not None  # only streamable actors reach here
+        return self._generate_pose_set(actor, kind)
+
+    def _assign_frames(
+        self, actor: Actor, frames: list[np.ndarray], uvs: list[SpriteUV]
+    ) -> None:
+        if isinstance(actor, (Tree, Boulder)):
+            self._assign_single(actor, frames[0], uvs[0])
+        else:
+            self._assign_pose_uvs(actor, frames, list(uvs))
+
+    def _drop_streamed(self, actor_id: ActorId) -> None:
+        """Return an evicted actor to glyph rendering."""
+        actor = self._streamed.pop(actor_id, None)
+        if actor is None:
+            return
+        actor.sprite_uv = None
+        actor.character_sprite_uvs = None
+        actor.sprite_content_bbox = None
+        actor.visual_scale = self._glyph_scales.pop(actor_id, actor.visual_scale)
+
+    # ------------------------------------------------------------------
+    # Per-family generation and assignment
+    # ------------------------------------------------------------------
+
+    def _apply_boulder_shadow_heights(self, boulders: list[Boulder]) -> None:
+        from brileta.sprites.boulders import (
+            archetype_for_position,
+            shadow_height_for_archetype,
+        )
+
+        for boulder in boulders:
+            archetype = archetype_for_position(boulder.x, boulder.y, self._map_seed)
+            boulder.shadow_height = shadow_height_for_archetype(archetype)
+
+    def _tree_sprites(self, trees: list[Tree]) -> list[np.ndarray]:
+        from brileta.sprites.trees import (
+            TREE_SPRITE_GENERATOR_VERSION,
+            generate_tree_sprite,
+            tree_sprite_seed,
+        )
+
+        return self._cached_single_sprites(
+            "tree",
+            generate_tree_sprite,
+            [tree_sprite_seed(t.x, t.y, self._map_seed) for t in trees],
+            [t.tree_type for t in trees],
+            _TREE_BASE_SIZE,
+            TREE_SPRITE_GENERATOR_VERSION,
+        )
+
+    def _boulder_sprites(self, boulders: list[Boulder]) -> list[np.ndarray]:
+        from brileta.sprites.boulders import (
+            BOULDER_SPRITE_GENERATOR_VERSION,
+            archetype_for_position,
+            boulder_sprite_seed,
+            generate_boulder_sprite,
+        )
+
+        return self._cached_single_sprites(
+            "boulder",
+            generate_boulder_sprite,
+            [boulder_sprite_seed(b.x, b.y, self._map_seed) for b in boulders],
+            [archetype_for_position(b.x, b.y, self._map_seed) for b in boulders],
+            _BOULDER_BASE_SIZE,
+            BOULDER_SPRITE_GENERATOR_VERSION,
+        )
+
+    def _flat_pose_sets(
+        self, actors: list[Any], kind: _ActorSpriteKind
+    ) -> list[np.ndarray]:
+        return [
+            px for frames in self._generate_pose_sets(actors, kind) for px in frames
+        ]
+
+    def _assign_single(
+        self, actor: Tree | Boulder, sprite: np.ndarray, uv: SpriteUV
+    ) -> None:
+        """Assign a tree or boulder its UV and the scale/bbox its sprite implies."""
+        from brileta.sprites.boulders import (
+            visual_scale_with_height_jitter as boulder_visual_scale_with_height_jitter,
+        )
+        from brileta.sprites.common import sprite_content_bbox
+        from brileta.sprites.trees import (
+            visual_scale_with_height_jitter as tree_visual_scale_with_height_jitter,
+        )
+
+        jitter = (
+            tree_visual_scale_with_height_jitter
+            if isinstance(actor, Tree)
+            else boulder_visual_scale_with_height_jitter
+        )
+        actor.sprite_uv = uv
+        actor.visual_scale = jitter(
+            sprite, actor.shadow_height, actor.x, actor.y, self._map_seed
+        )
+        actor.sprite_content_bbox = sprite_content_bbox(sprite)
+
+    def _cached_single_sprites(
+        self,
+        generator: str,
+        generate: Callable[[SpatialSeed, Any, int], np.ndarray],
+        seeds: list[SpatialSeed],
+        archetypes: list[Any],
+        size: int,
+        version: int,
+    ) -> list[np.ndarray]:
+        """One sprite per (seed, archetype), generating only cache misses.
+
+        Misses go to *generate* through ``parallel_map`` in one batch, so a
+        cold world-gen still fans out across cores while a warm one does no
+        generation at all.
+        """
+        from brileta.util.parallel import parallel_map
+
+        keys = [
+            SpriteCacheKey(generator, archetype_tag(archetype), seed, size, version)
+            for seed, archetype in zip(seeds, archetypes, strict=True)
+        ]
+
+        def generate_misses(
+            misses: list[tuple[SpatialSeed, Any]],
+        ) -> list[list[np.ndarray]]:
+            sprites = parallel_map(
+                generate,
+                [seed for seed, _ in misses],
+                [archetype for _, archetype in misses],
+                [size] * len(misses),
+            )
+            return [[px] for px in sprites]
+
+        entries = self._sprite_cache.get_or_generate_many(
+            keys, list(zip(seeds, archetypes, strict=True)), generate_misses
         )
+        return [frames[0] for frames in entries]
 
     def _assign_block(
         self,
@@ -7,10 +7,12 @@ which are ephemeral and fade quickly, decals persist for an extended period
 before gradually fading away.
 
 Design Decisions:
-    - Tile-based: Decals snap to tile coordinates (not sub-tile like particles)
-    - Sparse storage: Only tiles with decals consume memory
-    - LRU eviction: Oldest decals removed when hitting global limits
-    - Age-based fade: Decals fade after DECAL_LIFETIME seconds
+    - Sub-tile positions, bucketed by integer tile for spatial queries
+    - Ring-buffer storage: decals live in structure-of-arrays slots in
+      creation order, so both LRU eviction and expiry advance a head pointer
+    - Age-based fade: Decals fade after DECAL_LIFETIME seconds. The GPU
+      backend mirrors the slots in a persistent instance buffer and computes
+      the fade in its shader, so a frame uploads only newly added decals
 
 Usage Example:
     # In an effect that creates blood splatter
@@ -26,8 +28,10 @@ Usage Example:
 from __future__ import annotations
 
 import math
+from collections import deque
 from dataclasses import dataclass, field
-from typing import TYPE_CHECKING
+
+import numpy as np
 
 from brileta import colors
 from brileta.types import DeltaTime, WorldTilePos
@@ -35,14 +39,17 @@ from brileta.util import rng
 
 _rng = rng.get("effects.decals")
 
-if TYPE_CHECKING:
-    pass
+# Slots allocated up front; storage doubles when the live count reaches it.
+_INITIAL_CAPACITY = 256
 
 
 @dataclass
 class Decal:
     """A single persistent decal mark with sub-tile precision.
 
+    DecalSystem stores decals as arrays; these records are built on demand
+    for per-decal queries.
+
     Attributes:
         x: X coordinate in world space (float for sub-tile precision)
         y: Y coordinate in world space (float for sub-tile precision)
@@ -62,17 +69,28 @@ class Decal:
 class DecalSystem:
     """Manages persistent sub-tile decals like blood splatters.
 
-    The system stores decals with sub-tile (float) coordinates for precise
-    visual placement. It enforces a global limit to prevent unbounded growth
-    and provides age-based fade-out.
+    Decals are stored in a ring buffer of parallel arrays (float32 position,
+    creation time, RGB, glyph). Every decal gets a monotonically increasing
+    sequence number; its slot is ``seq % capacity`` and the live decals are
+    the sequence range ``[_head, _tail)``, oldest first. ``add_decal``
+    rejects creation times older than the newest decal, so evicting the
+    oldest decal and expiring faded ones both just advance ``_head``. A
+    tile-bucket index maps each tile to its live sequence numbers for spatial
+    queries.
+
+    ``generation`` changes whenever live decals move to different slots
+    (growth) or are dropped wholesale (``clear``); between changes, slots are
+    only ever written at ``_tail``, so a GPU mirror can upload just the
+    sequence range added since its last sync.
 
     Attributes:
-        MAX_TOTAL_DECALS: Maximum decals across all tiles
+        MAX_TOTAL_DECALS: Memory backstop on live decals; expiry normally
+            bounds the count long before this
         DECAL_LIFETIME: Seconds before fade-out begins
         FADE_DURATION: Duration of fade-out in seconds
     """
 
-    MAX_TOTAL_DECALS: int = 200  # Smaller cap to prevent visual clutter
+    MAX_TOTAL_DECALS: int = 1_000_000  # Memory backstop; fading handles clutter
     DECAL_LIFETIME: float = 60.0  # 1 minute before fade starts
     FADE_DURATION: float = 30.0  # 30 second fade-out
     BASE_ALPHA: float = 0.5  # Lower opacity so decals don't obscure gameplay
@@ -92,12 +110,32 @@ class DecalSystem:
     MIN_DECAL_COUNT: int = 3
     MAX_DECAL_COUNT: int = 10
 
-    # Storage: flat list of all decals (sub-tile positions)
-    decals: dict[WorldTilePos, list[Decal]] = field(default_factory=dict)
-    # Track total count for efficient limit checking
-    _total_count: int = field(default=0, repr=False)
-    # Track creation order for LRU eviction
-    _creation_order: list[Decal] = field(default_factory=list, repr=False)
+    # Ring-buffer storage, indexed by slot (seq % capacity).
+    positions: np.ndarray = field(
+        default_factory=lambda: np.zeros((_INITIAL_CAPACITY, 2), dtype=np.float32),
+        repr=False,
+    )
+    created_at: np.ndarray = field(
+        default_factory=lambda: np.zeros(_INITIAL_CAPACITY, dtype=np.float64),
+        repr=False,
+    )
+    rgb: np.ndarray = field(
+        default_factory=lambda: np.zeros((_INITIAL_CAPACITY, 3), dtype=np.uint8),
+        repr=False,
+    )
+    chars: np.ndarray = field(
+        default_factory=lambda: np.full(_INITIAL_CAPACITY, " ", dtype="<U1"),
+        repr=False,
+    )
+    # Live sequence range [_head, _tail).
+    _head: int = field(default=0, repr=False)
+    _tail: int = field(default=0, repr=False)
+    # Tile -> live sequence numbers on that tile, oldest first.
+    _tile_index: dict[WorldTilePos, deque[int]] = field(
+        default_factory=dict, repr=False
+    )
+    # Bumped when live decals are re-slotted or cleared (see class docstring).
+    _generation: int = field(default=0, repr=False)
     # Current game time (updated each frame)
     _game_time: float = field(default=0.0, repr=False)
 
@@ -120,24 +158,37 @@ class DecalSystem:
             char: ASCII character to display
             color: RGB color tuple
             game_time: Optional game time; uses internal time if not provided
+
+        Raises:
+            ValueError: If the creation time is older than the newest decal's.
+                Expiry drops the oldest decals as a prefix, which requires
+                creation times to be non-decreasing.
         """
-        # Key by integer tile for spatial queries
-        key = (int(x), int(y))
         creation_time = game_time if game_time is not None else self._game_time
-
-        # Initialize tile entry if needed
-        if key not in self.decals:
-            self.decals[key] = []
+        if self._tail > self._head:
+            newest = float(self.created_at[(self._tail - 1) % self.capacity])
+            if creation_time < newest:
+                raise ValueError(
+                    f"Decal created at {creation_time} is older than the newest "
+                    f"decal ({newest}); decals must be added in time order"
+                )
 
         # Global limit: evict oldest decals until under limit
-        while self._total_count >= self.MAX_TOTAL_DECALS:
+        while self.total_count > 0 and self.total_count >= self.MAX_TOTAL_DECALS:
             self._evict_oldest()
+        if self.total_count == self.capacity:
+            self._grow()
+
+        seq = self._tail
+        slot = seq % self.capacity
+        self.positions[slot] = (x, y)
+        self.created_at[slot] = creation_time
+        self.rgb[slot] = color
+        self.chars[slot] = char
+        self._tail += 1
 
-        # Create and store the new decal with sub-tile position
-        decal = Decal(x=x, y=y, char=char, color=color, created_at=creation_time)
-        self.decals[key].append(decal)
-        self._creation_order.append(decal)
-        self._total_count += 1
+        # Key by the stored float32 position so eviction finds the same tile.
+        self._tile_index.setdefault(self._tile_of(slot), deque()).append(seq)
 
     def add_splatter_cone(
         self,
@@ -303,35 +354,25 @@ class DecalSystem:
     def update(self, delta_time: DeltaTime, game_time: float) -> None:
         """Update the system and remove fully expired decals.
 
+        Decals expire in creation order, so expiry drops a prefix of the ring
+        buffer in one vectorized pass and frames with nothing to expire stop
+        after checking the oldest decal.
+
         Args:
             delta_time: Time since last update (unused, kept for API consistency)
             game_time: Current game time for age calculations
         """
         self._game_time = game_time
         max_age = self.DECAL_LIFETIME + self.FADE_DURATION
+        if self._head == self._tail:
+            return
+        if game_time - self.created_at[self._head % self.capacity] < max_age:
+            return
 
-        # Find and remove expired decals
-        keys_to_remove: list[WorldTilePos] = []
-        for key, decal_list in self.decals.items():
-            # Filter out expired decals
-            remaining = [d for d in decal_list if (game_time - d.created_at) < max_age]
-            removed_count = len(decal_list) - len(remaining)
-
-            if removed_count > 0:
-                # Update creation order list
-                for d in decal_list:
-                    if d not in remaining and d in self._creation_order:
-                        self._creation_order.remove(d)
-                self._total_count -= removed_count
-
-            if remaining:
-                self.decals[key] = remaining
-            else:
-                keys_to_remove.append(key)
-
-        # Clean up empty tile entries
-        for key in keys_to_remove:
-            del self.decals[key]
+        # Creation times are non-decreasing, so the expired decals are a prefix.
+        expired = (game_time - self.created_at[self.live_slots()]) >= max_age
+        count = len(expired) if expired.all() else int(np.argmin(expired))
+        self._evict_count(count)
 
     def get_alpha(self, decal: Decal, game_time: float) -> float:
         """Calculate the alpha (opacity) for a decal based on its age.
@@ -349,6 +390,22 @@ class DecalSystem:
         fade_progress = (age - self.DECAL_LIFETIME) / self.FADE_DURATION
         return max(0.0, self.BASE_ALPHA * (1.0 - fade_progress))
 
+    def live_slots(self) -> np.ndarray:
+        """Return the storage slots of all live decals, oldest first."""
+        return np.arange(self._head, self._tail, dtype=np.int64) % self.capacity
+
+    @property
+    def decals(self) -> dict[WorldTilePos, list[Decal]]:
+        """Snapshot of live decals grouped by tile, oldest first per tile.
+
+        Builds Decal records on every access; renderers should read the
+        arrays through :meth:`live_slots` instead.
+        """
+        return {
+            key: [self._decal_at(seq) for seq in seqs]
+            for key, seqs in self._tile_index.items()
+        }
+
     def get_decals_at(self, x: int, y: int) -> list[Decal]:
         """Get all decals at a specific tile position.
 
@@ -359,33 +416,92 @@ class DecalSystem:
         Returns:
             List of decals at this position, or empty list if none
         """
-        return self.decals.get((x, y), [])
+        return [self._decal_at(seq) for seq in self._tile_index.get((x, y), ())]
 
     def clear(self) -> None:
         """Clear all decals. Call this on map change."""
-        self.decals.clear()
-        self._creation_order.clear()
-        self._total_count = 0
+        self._head = 0
+        self._tail = 0
+        self._tile_index.clear()
+        self._generation += 1
 
     def _evict_oldest(self) -> None:
         """Remove the globally oldest decal to make room for new ones."""
-        if not self._creation_order:
+        if self._head == self._tail:
             return
 
-        oldest = self._creation_order.pop(0)
-        # Key is based on integer tile position
-        key = (int(oldest.x), int(oldest.y))
-
-        if key in self.decals:
-            try:
-                self.decals[key].remove(oldest)
-                self._total_count -= 1
-                # Clean up empty entries
-                if not self.decals[key]:
-                    del self.decals[key]
-            except ValueError:
-                # Decal already removed (shouldn't happen but be safe)
-                pass
+        key = self._tile_of(self._head % self.capacity)
+        # The globally oldest decal is also the oldest on its tile.
+        tile_seqs = self._tile_index[key]
+        tile_seqs.popleft()
+        if not tile_seqs:
+            del self._tile_index[key]
+        self._head += 1
+
+    def _evict_count(self, count: int) -> None:
+        """Remove the ``count`` oldest decals in one pass."""
+        if count <= 0:
+            return
+        slots = (
+            np.arange(self._head, self._head + count, dtype=np.int64) % self.capacity
+        )
+        tiles = np.trunc(self.positions[slots]).astype(np.int64)
+        # Pack (x, y) into one int64 so the per-tile counts are a 1-D unique.
+        packed = (tiles[:, 0] << 32) | (tiles[:, 1] & 0xFFFFFFFF)
+        keys, counts = np.unique(packed, return_counts=True)
+        for packed_key, removed in zip(keys.tolist(), counts.tolist(), strict=True):
+            tile_y = packed_key & 0xFFFFFFFF
+            key = (
+                packed_key >> 32,
+                tile_y - (1 << 32) if tile_y >= 1 << 31 else tile_y,
+            )
+            tile_seqs = self._tile_index[key]
+            if removed >= len(tile_seqs):
+                del self._tile_index[key]
+            else:
+                for _ in range(removed):
+                    tile_seqs.popleft()
+        self._head += count
+
+    def _grow(self) -> None:
+        """Double the slot capacity, re-slotting live decals by sequence."""
+        old_capacity = self.capacity
+        new_capacity = old_capacity * 2
+        seqs = np.arange(self._head, self._tail, dtype=np.int64)
+        old_slots = seqs % old_capacity
+        new_slots = seqs % new_capacity
+
+        positions = np.zeros((new_capacity, 2), dtype=np.float32)
+        created_at = np.zeros(new_capacity, dtype=np.float64)
+        rgb = np.zeros((new_capacity, 3), dtype=np.uint8)
+        chars = np.full(new_capacity, " ", dtype="<U1")
+        positions[new_slots] = self.positions[old_slots]
+        created_at[new_slots] = self.created_at[old_slots]
+        rgb[new_slots] = self.rgb[old_slots]
+        chars[new_slots] = self.chars[old_slots]
+        self.positions = positions
+        self.created_at = created_at
+        self.rgb = rgb
+        self.chars = chars
+        self._generation += 1
+
+    def _tile_of(self, slot: int) -> WorldTilePos:
+        """Integer tile containing the decal in ``slot``."""
+        x, y = self.positions[slot].tolist()
+        return (int(x), int(y))
+
+    def _decal_at(self, seq: int) -> Decal:
+        """Build a Decal record for the live decal with sequence number ``seq``."""
+        slot = seq % self.capacity
+        x, y = self.positions[slot].tolist()
+        r, g, b = self.rgb[slot].tolist()
+        return Decal(
+            x=x,
+            y=y,
+            char=str(self.chars[slot]),
+            color=(r, g, b),
+            created_at=float(self.created_at[slot]),
+        )
 
     def _vary_color(self, color: colors.Color) -> colors.Color:
         """Slightly vary a color for natural-looking splatter.
@@ -407,4 +523,19 @@ class DecalSystem:
     @property
     def total_count(self) -> int:
         """Return the total number of decals across all tiles."""
-        return self._total_count
+        return self._tail - self._head
+
+    @property
+    def capacity(self) -> int:
+        """Number of allocated ring-buffer slots."""
+        return len(self.created_at)
+
+    @property
+    def live_range(self) -> tuple[int, int]:
+        """Sequence range ``[head, tail)`` of the live decals, oldest first."""
+        return (self._head, self._tail)
+
+    @property
+    def generation(self) -> int:
+        """Counter bumped whenever existing slots are re-laid out or cleared."""
+        return self._generation
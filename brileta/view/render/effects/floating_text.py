@@ -1,18 +1,18 @@
 """Floating text effect system for game feedback.
 
 Displays rising, fading text above actors when significant outcomes occur.
-Uses Pillow + Cozette font for rendering, enabling full Unicode support
-including emoji-like glyphs.
+Glyphs come from a persistent Cozette atlas per FloatingTextSize (see
+text_atlas), so spawning text never creates a texture; each string is a few
+atlas quads, and every active text of a size draws in one batched call.
 """
 
 from __future__ import annotations
 
 from dataclasses import dataclass, field
-from typing import TYPE_CHECKING, Any
+from typing import TYPE_CHECKING
 
 import numpy as np
-from PIL import Image as PILImage
-from PIL import ImageDraw, ImageFont
+from PIL import ImageFont
 
 from brileta import colors, config
 from brileta.events import (
@@ -21,7 +21,8 @@ from brileta.events import (
     FloatingTextValence,
     subscribe_to_event,
 )
-from brileta.types import ActorId, DeltaTime, Opacity, ViewOffset
+from brileta.types import ActorId, DeltaTime, ViewOffset
+from brileta.view.render.effects.text_atlas import TextAtlas, TextLayout
 
 if TYPE_CHECKING:
     from brileta.game.game_world import GameWorld
@@ -39,70 +40,14 @@ VALENCE_COLORS: dict[FloatingTextValence, colors.Color] = {
 # Default duration for floating text (in seconds)
 DEFAULT_DURATION: float = 0.7
 
-# Speech/indicator panel styling: an aged-parchment scrap with a worn brown
-# border. Warmer and softer than the stark UI panels, which suits a floating
-# world element. Text drawn on it must be dark ink or a darkened/saturated
-# signal color (see barks.emit_bark and indicators.INDICATOR_STYLES); bright
-# colors wash out on the cream fill.
-BUBBLE_FILL: tuple[int, int, int, int] = (222, 205, 170, 250)
-BUBBLE_BORDER: tuple[int, int, int, int] = (120, 96, 62, 255)
-
-
-def build_text_texture(
-    graphics: GraphicsContext,
-    font: ImageFont.FreeTypeFont,
-    text: str,
-    color: colors.Color,
-    bubble: bool,
-) -> tuple[Any, int, int]:
-    """Rasterize text (optionally inside a parchment panel) to a GPU texture.
-
-    Shared by floating text and by persistent presence indicators. When
-    ``bubble`` is set, the text sits in an aged-parchment panel with rounded
-    corners and a worn brown border. Returns (texture, width_px, height_px).
-    """
-    # Measure text to create appropriately sized image
-    bbox = font.getbbox(text)
-    text_width = int(bbox[2] - bbox[0])
-    text_height = int(bbox[3] - bbox[1])
-
-    # Bubbles get generous padding so the text breathes (the cramped look was
-    # the complaint); plain floating text stays tight.
-    padding_x = 11 if bubble else 4
-    padding_y = 8 if bubble else 4
-    img_width = max(1, text_width + padding_x * 2)
-    img_height = max(1, text_height + padding_y * 2)
-
-    # Create RGBA image with transparent background
-    image = PILImage.new("RGBA", (img_width, img_height), (0, 0, 0, 0))
-    draw = ImageDraw.Draw(image)
-
-    if bubble:
-        draw.rounded_rectangle(
-            (0, 0, img_width - 1, img_height - 1),
-            radius=10,
-            fill=BUBBLE_FILL,
-            outline=BUBBLE_BORDER,
-            width=2,
-        )
-
-    # Draw text centered in image
-    text_x = padding_x - int(bbox[0])  # Adjust for glyph offset
-    text_y = padding_y - int(bbox[1])
-    draw.text((text_x, text_y), text, font=font, fill=(*color, 255))
-
-    # Convert to numpy and create texture
-    pixels = np.ascontiguousarray(np.array(image, dtype=np.uint8))
-    texture = graphics.texture_from_numpy(pixels, transparent=True)
-    return texture, img_width, img_height
-
 
 @dataclass
 class FloatingText:
-    """A single floating text instance with cached texture and animation state.
+    """A single floating text instance with cached layout and animation state.
 
-    Renders text once using Pillow + Cozette, caches the texture, then
-    draws it each frame with position offset and alpha modulation.
+    Lays the text out once against its size's glyph atlas, caches the quads
+    and their tints, then draws them each frame with position offset and
+    alpha modulation.
     """
 
     text: str
@@ -114,10 +59,9 @@ class FloatingText:
     color_override: colors.Color | None = None  # Overrides valence color
     bubble: bool = False
 
-    # Cached texture (created on first render)
-    _texture: Any = field(default=None, init=False, repr=False)
-    _texture_width: int = field(default=0, init=False)
-    _texture_height: int = field(default=0, init=False)
+    # Cached atlas layout and per-quad tints (created on first render)
+    _layout: TextLayout | None = field(default=None, init=False, repr=False)
+    _tints: np.ndarray | None = field(default=None, init=False, repr=False)
 
     # Animation state
     elapsed: float = 0.0
@@ -170,37 +114,30 @@ class FloatingText:
             self.valence, VALENCE_COLORS[FloatingTextValence.NEUTRAL]
         )
 
-    def ensure_texture(
-        self, graphics: GraphicsContext, font: ImageFont.FreeTypeFont
-    ) -> None:
-        """Create the texture if not already cached."""
-        if self._texture is not None:
-            return
+    def ensure_layout(self, atlas: TextAtlas) -> TextLayout:
+        """Lay the text out against ``atlas`` if not already cached."""
+        if self._layout is None:
+            self._layout = atlas.layout(self.text, self.bubble)
+            self._tints = self._layout.quad_colors(self.get_color())
+        return self._layout
 
-        self._texture, self._texture_width, self._texture_height = build_text_texture(
-            graphics, font, self.text, self.get_color(), self.bubble
-        )
-
-    def cleanup_texture(self, graphics: GraphicsContext) -> None:
-        """Release texture resources via the graphics context.
-
-        Args:
-            graphics: The graphics context that created the texture.
-        """
-        if self._texture is not None:
-            graphics.release_texture(self._texture)
-            self._texture = None
+    def quad_tints(self) -> np.ndarray:
+        """Per-quad RGBA tints with the current alpha applied."""
+        assert self._tints is not None, "ensure_layout() must run first"
+        tints = self._tints.copy()
+        tints[:, 3] *= self.alpha
+        return tints
 
 
 class FloatingTextManager:
-    """Manages floating text lifecycle: creation, animation, rendering, cleanup.
+    """Manages floating text lifecycle: creation, animation, rendering.
 
     Subscribes to FloatingTextEvent, maintains active texts, and coordinates
     with the graphics system for rendering.
 
-    Texture cleanup is deferred to render() when graphics context is available,
-    so _handle_event() and update() can safely queue texts for cleanup without
-    needing the graphics context.
+    Texts own no GPU resources: each FloatingTextSize has one glyph atlas,
+    built on first use and kept for the manager's lifetime, so removing a
+    text is just dropping it from the list.
     """
 
     def __init__(self, max_texts: int = 20) -> None:
@@ -212,24 +149,22 @@ class FloatingTextManager:
         """
         self.max_texts = max_texts
         self._texts: list[FloatingText] = []
-        self._pending_cleanup: list[FloatingText] = []
-        self._fonts: dict[FloatingTextSize, ImageFont.FreeTypeFont] = {}
+        self._atlases: dict[FloatingTextSize, TextAtlas] = {}
 
         subscribe_to_event(FloatingTextEvent, self._handle_event)
 
-    def _ensure_font(self, size: FloatingTextSize) -> ImageFont.FreeTypeFont:
-        """Lazy-load the Cozette font for the given size preset."""
-        if size not in self._fonts:
-            font_path = config.UI_FONT_PATH
-            self._fonts[size] = ImageFont.truetype(str(font_path), size.value)
-        return self._fonts[size]
+    def _ensure_atlas(self, size: FloatingTextSize) -> TextAtlas:
+        """Lazy-build the Cozette glyph atlas for the given size preset."""
+        if size not in self._atlases:
+            font = ImageFont.truetype(str(config.UI_FONT_PATH), size.value)
+            self._atlases[size] = TextAtlas(font)
+        return self._atlases[size]
 
     def _handle_event(self, event: FloatingTextEvent) -> None:
         """Create a new FloatingText from an event."""
-        # Enforce limit by removing oldest (defer cleanup to render())
+        # Enforce limit by removing oldest
         while len(self._texts) >= self.max_texts:
-            old = self._texts.pop(0)
-            self._pending_cleanup.append(old)
+            self._texts.pop(0)
 
         # Use event duration if provided, otherwise use default
         duration = event.duration if event.duration is not None else DEFAULT_DURATION
@@ -248,20 +183,8 @@ class FloatingTextManager:
         self._texts.append(text)
 
     def update(self, delta_time: DeltaTime) -> None:
-        """Update all floating texts, removing completed ones.
-
-        Completed texts are queued for cleanup, which happens in render()
-        when the graphics context is available.
-        """
-        remaining: list[FloatingText] = []
-
-        for text in self._texts:
-            if not text.update(delta_time):
-                remaining.append(text)
-            else:
-                self._pending_cleanup.append(text)
-
-        self._texts = remaining
+        """Update all floating texts, removing completed ones."""
+        self._texts = [text for text in self._texts if not text.update(delta_time)]
 
     def render(
         self,
@@ -270,32 +193,40 @@ class FloatingTextManager:
         view_offset: ViewOffset,
         game_world: GameWorld,
     ) -> None:
-        """Render all active floating texts.
+        """Render all active floating texts, one batched draw per atlas.
 
-        Also handles deferred texture cleanup for texts that were removed
-        since the last render call.
+        Quads are gathered in list order, so later texts draw on top within a
+        size.
         """
-        # Clean up textures from removed texts (deferred from update/_handle_event)
-        for text in self._pending_cleanup:
-            text.cleanup_texture(graphics)
-        self._pending_cleanup.clear()
-
+        batches: dict[
+            FloatingTextSize, list[tuple[np.ndarray, np.ndarray, np.ndarray]]
+        ] = {}
         for text in self._texts:
-            font = self._ensure_font(text.size)
-            self._render_single(
-                text, graphics, viewport_system, view_offset, game_world, font
+            placed = self._place_single(
+                text, graphics, viewport_system, view_offset, game_world
             )
+            if placed is not None:
+                batches.setdefault(text.size, []).append(placed)
+
+        for size, parts in batches.items():
+            self._atlases[size].draw(graphics, parts)
 
-    def _render_single(
+    def _place_single(
         self,
         text: FloatingText,
         graphics: GraphicsContext,
         viewport_system: ViewportSystem,
         view_offset: ViewOffset,
         game_world: GameWorld,
-        font: ImageFont.FreeTypeFont,
-    ) -> None:
-        """Render a single floating text."""
+    ) -> tuple[np.ndarray, np.ndarray, np.ndarray] | None:
+        """Position a single floating text's quads on screen.
+
+        Returns (screen rects, atlas source rects, tints), or None when the
+        text is off screen or fully faded.
+        """
+        if text.alpha <= 0.0:
+            return None
+
         # Get actor position (or use stored position if actor is gone)
         world_x = text.world_x
         world_y = text.world_y
@@ -310,12 +241,11 @@ class FloatingTextManager:
 
         # Check visibility
         if not viewport_system.is_visible(int(world_x), int(render_y)):
-            return
+            return None
 
-        # Ensure texture is created
-        text.ensure_texture(graphics, font)
-        if text._texture is None:
-            return
+        layout = text.ensure_layout(self._ensure_atlas(text.size))
+        if layout.quad_count == 0:
+            return None
 
         # Convert world position to viewport coordinates
         vp_x, vp_y = viewport_system.world_to_screen_float(world_x, render_y)
@@ -335,21 +265,16 @@ class FloatingTextManager:
         else:
             draw_sx, draw_sy = scale_x, scale_y
 
-        # Center the texture horizontally on the tile
+        # Center the text block horizontally on the tile, above it
         tile_w, _ = graphics.tile_dimensions
         scaled_tile_w = tile_w * scale_x
-        centered_x = screen_x + (scaled_tile_w - (text._texture_width * draw_sx)) / 2
-        centered_y = screen_y - (text._texture_height * draw_sy)  # Above the tile
-
-        # Draw with alpha
-        graphics.draw_texture_alpha(
-            text._texture,
-            centered_x,
-            centered_y,
-            Opacity(text.alpha),
-            scale_x=draw_sx,
-            scale_y=draw_sy,
-        )
+        centered_x = screen_x + (scaled_tile_w - (layout.width * draw_sx)) / 2
+        centered_y = screen_y - (layout.height * draw_sy)
+
+        rects = layout.rects * np.array(
+            [draw_sx, draw_sy, draw_sx, draw_sy], dtype=np.float32
+        ) + np.array([centered_x, centered_y, centered_x, centered_y], np.float32)
+        return rects, layout.src, text.quad_tints()
 
     @property
     def active_count(self) -> int:
@@ -360,17 +285,7 @@ class FloatingTextManager:
         """Clear all floating texts. Use for game state resets.
 
         Args:
-            graphics: If provided, textures are released immediately.
-                If None, textures are queued for cleanup on next render().
+            graphics: Accepted for API compatibility. Texts hold no textures,
+                and the glyph atlases persist across resets.
         """
-        if graphics is not None:
-            # Clean up immediately when graphics context is available
-            for text in self._texts:
-                text.cleanup_texture(graphics)
-            for text in self._pending_cleanup:
-                text.cleanup_texture(graphics)
-            self._pending_cleanup.clear()
-        else:
-            # Queue for cleanup on next render()
-            self._pending_cleanup.extend(self._texts)
         self._texts.clear()
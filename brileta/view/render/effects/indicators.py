@@ -2,8 +2,9 @@
 
 Unlike floating text (event-driven, rises and fades), an indicator is polled
 each frame from NPC.indicator and drawn as a small speech bubble that stays put
-while the NPC's state holds. Bubbles reuse floating text's builder so they look
-identical, and are cached per IndicatorKind since the glyph set is tiny.
+while the NPC's state holds. Bubbles are laid out on the same kind of glyph
+atlas as floating text so they look identical; one layout is cached per
+IndicatorKind, and every visible bubble draws in a single batched call.
 
 Indicators draw only for NPCs the player can actually see (FOV): an "!" over an
 NPC hidden behind a wall would be a wallhack.
@@ -11,15 +12,16 @@ NPC hidden behind a wall would be a wallhack.
 
 from __future__ import annotations
 
-from typing import TYPE_CHECKING, Any
+from typing import TYPE_CHECKING
 
+import numpy as np
 from PIL import ImageFont
 
 from brileta import config
 from brileta.events import FloatingTextSize
 from brileta.game.actors.indicators import INDICATOR_STYLES, IndicatorKind
-from brileta.types import Opacity, ViewOffset
-from brileta.view.render.effects.floating_text import build_text_texture
+from brileta.types import ViewOffset
+from brileta.view.render.effects.text_atlas import TextAtlas, TextLayout
 
 if TYPE_CHECKING:
     from brileta.game.game_world import GameWorld
@@ -31,27 +33,25 @@ class IndicatorRenderer:
     """Draws NPC.indicator bubbles above visible NPCs each frame."""
 
     def __init__(self) -> None:
-        self._font: ImageFont.FreeTypeFont | None = None
-        # One cached (texture, width, height) per kind. The vocabulary is small
-        # and world-independent, so these live for the renderer's lifetime.
-        self._cache: dict[IndicatorKind, tuple[Any, int, int]] = {}
-
-    def _ensure_font(self) -> ImageFont.FreeTypeFont:
-        if self._font is None:
-            self._font = ImageFont.truetype(
+        self._atlas: TextAtlas | None = None
+        # One cached (layout, tints) per kind. The vocabulary is small and
+        # world-independent, so these live for the renderer's lifetime.
+        self._cache: dict[IndicatorKind, tuple[TextLayout, np.ndarray]] = {}
+
+    def _ensure_atlas(self) -> TextAtlas:
+        if self._atlas is None:
+            font = ImageFont.truetype(
                 str(config.UI_FONT_PATH), FloatingTextSize.NORMAL.value
             )
-        return self._font
+            self._atlas = TextAtlas(font)
+        return self._atlas
 
-    def _ensure_texture(
-        self, graphics: GraphicsContext, kind: IndicatorKind
-    ) -> tuple[Any, int, int]:
+    def _ensure_layout(self, kind: IndicatorKind) -> tuple[TextLayout, np.ndarray]:
         cached = self._cache.get(kind)
         if cached is None:
             glyph, color = INDICATOR_STYLES[kind]
-            cached = build_text_texture(
-                graphics, self._ensure_font(), glyph, color, bubble=True
-            )
+            layout = self._ensure_atlas().layout(glyph, bubble=True)
+            cached = (layout, layout.quad_colors(color))
             self._cache[kind] = cached
         return cached
 
@@ -64,6 +64,7 @@ class IndicatorRenderer:
     ) -> None:
         """Draw an indicator bubble above every visible NPC that has one."""
         game_map = game_world.game_map
+        parts: list[tuple[np.ndarray, np.ndarray, np.ndarray]] = []
         for actor in game_world.actors:
             kind: IndicatorKind | None = getattr(actor, "indicator", None)
             if kind is None:
@@ -77,7 +78,7 @@ class IndicatorRenderer:
             if not viewport_system.is_visible(actor.x, actor.y):
                 continue
 
-            texture, tex_w, tex_h = self._ensure_texture(graphics, kind)
+            layout, tints = self._ensure_layout(kind)
 
             # World -> viewport -> root console -> screen pixels (mirrors the
             # bubble path in FloatingTextManager). Bubbles draw at fixed pixel
@@ -92,14 +93,14 @@ class IndicatorRenderer:
 
             tile_w, _ = graphics.tile_dimensions
             scaled_tile_w = tile_w * scale_x
-            centered_x = screen_x + (scaled_tile_w - tex_w) / 2
-            centered_y = screen_y - tex_h  # Above the tile
-
-            graphics.draw_texture_alpha(
-                texture,
-                centered_x,
-                centered_y,
-                Opacity(1.0),
-                scale_x=1.0,
-                scale_y=1.0,
+            centered_x = screen_x + (scaled_tile_w - layout.width) / 2
+            centered_y = screen_y - layout.height  # Above the tile
+
+            offset = np.array(
+                [centered_x, centered_y, centered_x, centered_y], np.float32
             )
+            parts.append((layout.rects + offset, layout.src, tints))
+
+        if not parts:
+            return
+        self._ensure_atlas().draw(graphics, parts)
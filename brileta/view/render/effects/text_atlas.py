@@ -0,0 +1,311 @@
+"""Persistent glyph atlas for floating text and speech bubbles.
+
+Floating text used to rasterize every string into its own Pillow image and
+upload it as a fresh GPU texture, then release it when the text expired. With
+a burst of combat numbers that is an allocation, an upload and a destroy per
+string. A TextAtlas instead rasterizes each glyph of one font size once into a
+shared RGBA sheet (white ink, coverage in alpha) together with a small
+parchment-bubble template. A string becomes a TextLayout: a handful of quads
+that sample the sheet, drawn in one batched call per atlas with the ink color
+applied as a per-quad tint.
+
+Printable ASCII is rasterized up front; any other glyph (e.g. the surrender
+flag) is added on first use, which marks the sheet dirty so the next
+texture() call re-uploads it.
+
+Layouts reproduce Pillow's own placement: the text block is measured with
+font.getbbox(), glyphs sit at the pen position plus their own bbox offset, and
+the pen advances by font.getlength(). The bubble is a 9-slice of a rounded
+rectangle drawn with the same radius, fill and border as the old per-string
+panel, so corners keep their exact pixels and straight edges stretch.
+"""
+
+from __future__ import annotations
+
+from collections.abc import Sequence
+from dataclasses import dataclass
+from typing import TYPE_CHECKING, Any
+
+import numpy as np
+from PIL import Image as PILImage
+from PIL import ImageDraw, ImageFont
+
+from brileta import colors
+
+if TYPE_CHECKING:
+    from brileta.view.render.graphics import GraphicsContext
+
+# Speech/indicator panel styling: an aged-parchment scrap with a worn brown
+# border. Warmer and softer than the stark UI panels, which suits a floating
+# world element. Text drawn on it must be dark ink or a darkened/saturated
+# signal color (see barks.emit_bark and indicators.INDICATOR_STYLES); bright
+# colors wash out on the cream fill.
+BUBBLE_FILL: tuple[int, int, int, int] = (222, 205, 170, 250)
+BUBBLE_BORDER: tuple[int, int, int, int] = (120, 96, 62, 255)
+BUBBLE_RADIUS = 10
+BUBBLE_BORDER_WIDTH = 2
+
+# Bubbles get generous padding so the text breathes; plain floating text stays
+# tight. (padding_x, padding_y) in pixels.
+BUBBLE_PADDING = (11, 8)
+TEXT_PADDING = (4, 4)
+
+# 9-slice corner size: the rounded corner plus its border fit inside this
+# square, so everything between two corners is a straight, stretchable run.
+_BUBBLE_CORNER = BUBBLE_RADIUS + 1
+_BUBBLE_TEMPLATE_SIZE = 2 * _BUBBLE_CORNER + 1
+
+ATLAS_WIDTH = 512
+_ATLAS_INITIAL_HEIGHT = 256
+# Transparent gutter between cells so scaled (nearest) sampling never picks up
+# a neighbour's edge.
+_CELL_GUTTER = 1
+
+_PRELOADED_GLYPHS = "".join(chr(code) for code in range(32, 127))
+
+# Damage numbers and barks repeat constantly, so finished layouts are kept
+# (oldest evicted first) and a repeat costs one dict lookup.
+_LAYOUT_CACHE_LIMIT = 512
+
+
+@dataclass(frozen=True, slots=True)
+class _Glyph:
+    """Where one glyph lives in the sheet and how it sits on the pen line."""
+
+    src: tuple[int, int, int, int] | None  # (x1, y1, x2, y2) sheet pixels
+    offset_x: int  # bbox left relative to the pen position
+    offset_y: int  # bbox top relative to the text origin
+    advance: float
+
+
+@dataclass(frozen=True, slots=True)
+class TextLayout:
+    """A laid-out string: quads in layout pixels plus their sheet sources.
+
+    ``rects`` and ``src`` are (N, 4) float32 arrays of (x1, y1, x2, y2); rects
+    are relative to the top-left of the text block (the area the old per-string
+    texture covered), src are sheet pixels. ``inked`` marks glyph quads, which
+    take the text color; bubble quads draw with their own colors.
+    """
+
+    width: int
+    height: int
+    rects: np.ndarray
+    src: np.ndarray
+    inked: np.ndarray
+
+    @property
+    def quad_count(self) -> int:
+        return len(self.rects)
+
+    def quad_colors(self, color: colors.Color) -> np.ndarray:
+        """(N, 4) float32 RGBA tints: ``color`` for glyphs, white for the bubble."""
+        tints = np.ones((self.quad_count, 4), dtype=np.float32)
+        tints[self.inked, :3] = np.asarray(color, dtype=np.float32) / 255.0
+        return tints
+
+
+class TextAtlas:
+    """Glyph sheet for one font, shared by every string drawn at that size."""
+
+    def __init__(self, font: ImageFont.FreeTypeFont) -> None:
+        self.font = font
+        self.pixels = np.zeros((_ATLAS_INITIAL_HEIGHT, ATLAS_WIDTH, 4), np.uint8)
+        self._glyphs: dict[str, _Glyph] = {}
+        self._layouts: dict[tuple[str, bool], TextLayout] = {}
+        # Shelf packer state: the current row's origin and tallest cell.
+        self._pen_x = 0
+        self._pen_y = 0
+        self._row_height = 0
+        self._texture: Any = None
+        self._dirty = True
+
+        self._bubble_origin = self._pack_bubble_template()
+        for ch in _PRELOADED_GLYPHS:
+            self._glyph(ch)
+
+    @property
+    def glyph_count(self) -> int:
+        return len(self._glyphs)
+
+    # ------------------------------------------------------------------
+    # Sheet packing
+    # ------------------------------------------------------------------
+
+    def _allocate(self, width: int, height: int) -> tuple[int, int]:
+        """Reserve a width x height cell, growing the sheet downward if full."""
+        if width + _CELL_GUTTER > ATLAS_WIDTH:
+            raise ValueError(f"glyph is wider than the atlas ({width}px)")
+        if self._pen_x + width + _CELL_GUTTER > ATLAS_WIDTH:
+            self._pen_x = 0
+            self._pen_y += self._row_height + _CELL_GUTTER
+            self._row_height = 0
+        while self._pen_y + height + _CELL_GUTTER > self.pixels.shape[0]:
+            grown = np.zeros((self.pixels.shape[0] * 2, ATLAS_WIDTH, 4), np.uint8)
+            grown[: self.pixels.shape[0]] = self.pixels
+            self.pixels = grown
+        x, y = self._pen_x, self._pen_y
+        self._pen_x += width + _CELL_GUTTER
+        self._row_height = max(self._row_height, height)
+        self._dirty = True
+        return x, y
+
+    def _pack_bubble_template(self) -> tuple[int, int]:
+        size = _BUBBLE_TEMPLATE_SIZE
+        image = PILImage.new("RGBA", (size, size), (0, 0, 0, 0))
+        ImageDraw.Draw(image).rounded_rectangle(
+            (0, 0, size - 1, size - 1),
+            radius=BUBBLE_RADIUS,
+            fill=BUBBLE_FILL,
+            outline=BUBBLE_BORDER,
+            width=BUBBLE_BORDER_WIDTH,
+        )
+        x, y = self._allocate(size, size)
+        self.pixels[y : y + size, x : x + size] = np.asarray(image, dtype=np.uint8)
+        return x, y
+
+    def _glyph(self, ch: str) -> _Glyph:
+        glyph = self._glyphs.get(ch)
+        if glyph is not None:
+            return glyph
+
+        x0, y0, x1, y1 = (int(v) for v in self.font.getbbox(ch))
+        advance = float(self.font.getlength(ch))
+        width, height = x1 - x0, y1 - y0
+        src = None
+        if width > 0 and height > 0:
+            image = PILImage.new("RGBA", (width, height), (0, 0, 0, 0))
+            ImageDraw.Draw(image).text(
+                (-x0, -y0), ch, font=self.font, fill=(255, 255, 255, 255)
+            )
+            x, y = self._allocate(width, height)
+            self.pixels[y : y + height, x : x + width] = np.asarray(
+                image, dtype=np.uint8
+            )
+            src = (x, y, x + width, y + height)
+
+        glyph = _Glyph(src=src, offset_x=x0, offset_y=y0, advance=advance)
+        self._glyphs[ch] = glyph
+        return glyph
+
+    # ------------------------------------------------------------------
+    # Layout
+    # ------------------------------------------------------------------
+
+    def layout(self, text: str, bubble: bool = False) -> TextLayout:
+        """Lay out ``text`` (optionally inside a parchment bubble) as quads.
+
+        Layouts are shared between callers and their arrays are read-only.
+        """
+        key = (text, bubble)
+        layout = self._layouts.get(key)
+        if layout is None:
+            layout = self._build_layout(text, bubble)
+            if len(self._layouts) >= _LAYOUT_CACHE_LIMIT:
+                del self._layouts[next(iter(self._layouts))]
+            self._layouts[key] = layout
+        return layout
+
+    def _build_layout(self, text: str, bubble: bool) -> TextLayout:
+        bbox = self.font.getbbox(text)
+        padding_x, padding_y = BUBBLE_PADDING if bubble else TEXT_PADDING
+        width = max(1, int(bbox[2] - bbox[0]) + padding_x * 2)
+        height = max(1, int(bbox[3] - bbox[1]) + padding_y * 2)
+        if bubble:
+            width = max(width, _BUBBLE_TEMPLATE_SIZE)
+            height = max(height, _BUBBLE_TEMPLATE_SIZE)
+
+        rects: list[tuple[float, float, float, float]] = []
+        src: list[tuple[float, float, float, float]] = []
+        if bubble:
+            self._nine_slice(width, height, rects, src)
+        n_bubble = len(rects)
+
+        text_x = padding_x - int(bbox[0])
+        text_y = padding_y - int(bbox[1])
+        pen = 0.0
+        for ch in text:
+            glyph = self._glyph(ch)
+            if glyph.src is not None:
+                gx = text_x + int(pen) + glyph.offset_x
+                gy = text_y + glyph.offset_y
+                sx1, sy1, sx2, sy2 = glyph.src
+                rects.append((gx, gy, gx + sx2 - sx1, gy + sy2 - sy1))
+                src.append(glyph.src)
+            pen += glyph.advance
+
+        inked = np.zeros(len(rects), dtype=np.bool_)
+        inked[n_bubble:] = True
+        arrays = (
+            np.asarray(rects, dtype=np.float32).reshape(-1, 4),
+            np.asarray(src, dtype=np.float32).reshape(-1, 4),
+            inked,
+        )
+        for array in arrays:
+            array.flags.writeable = False
+        return TextLayout(width, height, *arrays)
+
+    def _nine_slice(
+        self,
+        width: int,
+        height: int,
+        rects: list[tuple[float, float, float, float]],
+        src: list[tuple[float, float, float, float]],
+    ) -> None:
+        """Append the bubble's corner, edge and centre quads for a panel size."""
+        c = _BUBBLE_CORNER
+        ox, oy = self._bubble_origin
+        # Template columns/rows: corner, one stretchable pixel, corner.
+        tx = (ox, ox + c, ox + c + 1, ox + _BUBBLE_TEMPLATE_SIZE)
+        ty = (oy, oy + c, oy + c + 1, oy + _BUBBLE_TEMPLATE_SIZE)
+        dx = (0, c, width - c, width)
+        dy = (0, c, height - c, height)
+        for row in range(3):
+            if dy[row + 1] <= dy[row]:
+                continue
+            for col in range(3):
+                if dx[col + 1] <= dx[col]:
+                    continue
+                rects.append((dx[col], dy[row], dx[col + 1], dy[row + 1]))
+                src.append((tx[col], ty[row], tx[col + 1], ty[row + 1]))
+
+    # ------------------------------------------------------------------
+    # GPU texture
+    # ------------------------------------------------------------------
+
+    def uvs(self, src: np.ndarray) -> np.ndarray:
+        """Convert sheet-pixel source rects to normalized texture coordinates."""
+        height, width = self.pixels.shape[:2]
+        return src * np.array([1 / width, 1 / height] * 2, dtype=np.float32)
+
+    def texture(self, graphics: GraphicsContext) -> Any:
+        """The sheet's backend texture, (re)uploaded only when glyphs were added."""
+        if self._dirty or self._texture is None:
+            if self._texture is not None:
+                graphics.release_texture(self._texture)
+            self._texture = graphics.texture_from_numpy(self.pixels, transparent=True)
+            self._dirty = False
+        return self._texture
+
+    def draw(
+        self,
+        graphics: GraphicsContext,
+        parts: Sequence[tuple[np.ndarray, np.ndarray, np.ndarray]],
+    ) -> None:
+        """Draw placed layouts, given as (screen rects, src, tints), in one batch.
+
+        Fetches the texture after the caller has laid everything out, so glyphs
+        added this frame are uploaded before they are sampled.
+        """
+        if not parts:
+            return
+        rects, src, tints = (
+            np.concatenate(column) for column in zip(*parts, strict=True)
+        )
+        graphics.draw_texture_quads(self.texture(graphics), rects, self.uvs(src), tints)
+
+    def release(self, graphics: GraphicsContext) -> None:
+        """Release the backend texture; the next texture() call re-uploads."""
+        if self._texture is not None:
+            graphics.release_texture(self._texture)
+            self._texture = None
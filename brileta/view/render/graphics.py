@@ -31,10 +31,9 @@ from brileta.types import (
 from brileta.util.coordinates import (
     CoordinateConverter,
     Rect,
-    convert_particle_to_screen_coords,
 )
 from brileta.util.glyph_buffer import GlyphBuffer
-from brileta.util.tilesets import unicode_to_cp437
+from brileta.util.tilesets import unicode_to_cp437, unicode_to_cp437_array
 from brileta.view.render.effects.decals import DecalSystem
 from brileta.view.render.effects.particles import ParticleLayer, SubTileParticleSystem
 from brileta.view.render.viewport import ViewportSystem
@@ -58,6 +57,16 @@ class ScreenRenderer(Protocol):
         color_rgba: ColorRGBAf,
     ) -> None: ...
 
+    def add_quad_batch(
+        self,
+        x: np.ndarray,
+        y: np.ndarray,
+        w: np.ndarray,
+        h: np.ndarray,
+        uv_coords: np.ndarray,
+        colors: np.ndarray,
+    ) -> None: ...
+
 
 class GraphicsContext:
     """Concrete base class for all graphics backends.
@@ -207,6 +216,45 @@ class GraphicsContext:
         """Draw a projected glyph shadow as a stretched parallelogram quad."""
         raise NotImplementedError
 
+    def draw_actor_shadow_batch(
+        self,
+        *,
+        char_codes: np.ndarray,
+        screen_x: np.ndarray,
+        screen_y: np.ndarray,
+        shadow_dir_x: float,
+        shadow_dir_y: float,
+        shadow_length_pixels: np.ndarray,
+        shadow_alpha: float,
+        scale_x: float = 1.0,
+        scale_y: float = 1.0,
+        fade_tip: bool = True,
+    ) -> None:
+        """Batch-draw projected glyph shadows that share direction and scale.
+
+        ``char_codes`` are Unicode codepoints. The default implementation
+        falls back to one ``draw_actor_shadow()`` call per glyph.
+        """
+        for code, x, y, length in zip(
+            char_codes.tolist(),
+            screen_x.tolist(),
+            screen_y.tolist(),
+            shadow_length_pixels.tolist(),
+            strict=True,
+        ):
+            self.draw_actor_shadow(
+                char=chr(code),
+                screen_x=x,
+                screen_y=y,
+                shadow_dir_x=shadow_dir_x,
+                shadow_dir_y=shadow_dir_y,
+                shadow_length_pixels=length,
+                shadow_alpha=shadow_alpha,
+                scale_x=scale_x,
+                scale_y=scale_y,
+                fade_tip=fade_tip,
+            )
+
     def draw_sprite_shadow(
         self,
         sprite_uv: SpriteUV,
@@ -280,6 +328,20 @@ class GraphicsContext:
         """Create a dynamic sprite atlas if supported by the backend."""
         return None
 
+    def create_paged_sprite_atlas(self, page_size: int, page_count: int) -> Any | None:
+        """Create a fixed-budget paged sprite atlas if supported by the backend."""
+        return None
+
+    def create_palette_map(
+        self, width: int, height: int, palette: np.ndarray
+    ) -> Any | None:
+        """Create a GPU palette-indexed tile map if supported by the backend.
+
+        ``palette`` is ``(states, entries, 4)`` uint8 RGBA. Returns None when
+        the backend has no GPU recolour path; callers then composite on the CPU.
+        """
+        return None
+
     def draw_sprite_outline(
         self,
         sprite_uv: SpriteUV,
@@ -357,46 +419,87 @@ class GraphicsContext:
         view_offset: ViewOffset,
         viewport_system: ViewportSystem | None = None,
     ) -> None:
-        """Render particles by adding each active particle to the quad buffer."""
+        """Render one layer's particles as a single quad batch.
+
+        Same culling and placement as
+        :func:`~brileta.util.coordinates.convert_particle_to_screen_coords`
+        applied per particle, evaluated over the particle arrays at once.
+        """
         if self.screen_renderer is None:
             return
         if self.uv_map is None:
             return
 
+        indices = np.flatnonzero(
+            particle_system.layers[: particle_system.active_count] == layer.value
+        )
+        if indices.size == 0:
+            return
+
         particle_scale = (1.0, 1.0)
         if viewport_system is not None:
             particle_scale = viewport_system.get_display_scale_factors()
 
-        for i in range(particle_system.active_count):
-            if particle_system.layers[i] != layer.value:
-                continue
-
-            coords = convert_particle_to_screen_coords(
-                particle_system,
-                i,
-                viewport_bounds,
-                view_offset,
-                self,
-                viewport_system,
+        positions = particle_system.positions[indices]
+        world_x = positions[:, 0] / particle_system.subdivision
+        world_y = positions[:, 1] / particle_system.subdivision
+        if viewport_system is not None:
+            # Tile containing the particle, with the same negative-coordinate
+            # rounding as the scalar converter.
+            tile_x = np.where(world_x >= 0, np.trunc(world_x), np.trunc(world_x) - 1)
+            tile_y = np.where(world_y >= 0, np.trunc(world_y), np.trunc(world_y) - 1)
+            visible = viewport_system.get_visible_bounds()
+            keep = (
+                (tile_x >= visible.x1)
+                & (tile_x <= visible.x2)
+                & (tile_y >= visible.y1)
+                & (tile_y <= visible.y2)
             )
-            if coords is None:
-                continue
-
-            screen_x, screen_y = coords
-            if not np.isnan(particle_system.flash_intensity[i]):
-                alpha = particle_system.flash_intensity[i]
-            else:
-                alpha = particle_system.lifetimes[i] / particle_system.max_lifetimes[i]
-
-            self._draw_particle_to_buffer(
-                particle_system.chars[i],
-                tuple(particle_system.colors[i]),
-                screen_x,
-                screen_y,
-                Opacity(alpha),
-                scale_x=particle_scale[0],
-                scale_y=particle_scale[1],
+            # Positions sit at tile centers; offset to the glyph quad's top-left.
+            vp_x, vp_y = viewport_system.world_to_screen_float(
+                world_x - 0.5, world_y - 0.5
             )
+        else:
+            keep = np.ones(indices.size, dtype=np.bool_)
+            vp_x, vp_y = world_x, world_y
+
+        keep &= (
+            (vp_x >= viewport_bounds.x1)
+            & (vp_x <= viewport_bounds.x2)
+            & (vp_y >= viewport_bounds.y1)
+            & (vp_y <= viewport_bounds.y2)
+        )
+        if not keep.any():
+            return
+        indices = indices[keep]
+        screen_x, screen_y = self._console_to_screen_arrays(
+            view_offset[0] + vp_x[keep], view_offset[1] + vp_y[keep]
+        )
+
+        flash = particle_system.flash_intensity[indices]
+        alpha = np.where(
+            np.isnan(flash),
+            particle_system.lifetimes[indices] / particle_system.max_lifetimes[indices],
+            flash,
+        )
+        rgba = np.empty((indices.size, 4), dtype=np.float32)
+        rgba[:, :3] = particle_system.colors[indices] / 255.0
+        rgba[:, 3] = np.clip(alpha, 0.0, 1.0)
+
+        # '<U1' chars view as their UCS-4 codepoints; empty means space.
+        codepoints = particle_system.chars[indices].view(np.uint32)
+        glyphs = unicode_to_cp437_array(np.where(codepoints == 0, ord(" "), codepoints))
+
+        tile_w, tile_h = self.tile_dimensions
+        n = indices.size
+        self.screen_renderer.add_quad_batch(
+            screen_x,
+            screen_y,
+            np.full(n, tile_w * particle_scale[0], dtype=np.float32),
+            np.full(n, tile_h * particle_scale[1], dtype=np.float32),
+            self.uv_map[glyphs],
+            rgba,
+        )
 
     def render_decals(
         self,
@@ -406,46 +509,12 @@ class GraphicsContext:
         viewport_system: ViewportSystem,
         game_time: float,
     ) -> None:
-        """Render decals from world-space sub-tile coordinates."""
-        if self.screen_renderer is None:
-            return
-        if self.uv_map is None:
-            return
-
-        decal_scale_x, decal_scale_y = viewport_system.get_display_scale_factors()
-        for (tile_x, tile_y), decals in decal_system.decals.items():
-            screen_tile_x, screen_tile_y = viewport_system.world_to_screen(
-                tile_x, tile_y
-            )
+        """Queue or ignore this frame's decal layer.
 
-            if not (
-                -1 <= screen_tile_x < viewport_bounds.width + 1
-                and -1 <= screen_tile_y < viewport_bounds.height + 1
-            ):
-                continue
-
-            for decal in decals:
-                alpha = decal_system.get_alpha(decal, game_time)
-                if alpha <= 0:
-                    continue
-
-                world_screen_x, world_screen_y = viewport_system.world_to_screen_float(
-                    decal.x,
-                    decal.y,
-                )
-                console_x = view_offset[0] + world_screen_x
-                console_y = view_offset[1] + world_screen_y
-                pixel_x, pixel_y = self.console_to_screen_coords(console_x, console_y)
-
-                self._draw_particle_to_buffer(
-                    decal.char,
-                    decal.color,
-                    pixel_x,
-                    pixel_y,
-                    Opacity(alpha),
-                    scale_x=decal_scale_x,
-                    scale_y=decal_scale_y,
-                )
+        Backends that draw decals layer them above the quads added so far,
+        in creation order so newer decals draw over older ones.
+        """
+        return
 
     def _draw_particle_to_buffer(
         self,
@@ -508,6 +577,22 @@ class GraphicsContext:
         screen_y = offset_y + console_y * (scaled_h / self.console_height_tiles)
         return (screen_x, screen_y)
 
+    def _console_to_screen_arrays(
+        self, console_x: np.ndarray, console_y: np.ndarray
+    ) -> tuple[np.ndarray, np.ndarray]:
+        """Array form of :meth:`console_to_screen_coords` (same rounding)."""
+        if self.letterbox_geometry is None:
+            return (
+                np.trunc(console_x * self._tile_dimensions[0]),
+                np.trunc(console_y * self._tile_dimensions[1]),
+            )
+
+        offset_x, offset_y, scaled_w, scaled_h = self.letterbox_geometry
+        return (
+            offset_x + console_x * (scaled_w / self.console_width_tiles),
+            offset_y + console_y * (scaled_h / self.console_height_tiles),
+        )
+
     def pixel_to_tile(
         self,
         pixel_x: PixelCoord,
@@ -561,6 +646,21 @@ class GraphicsContext:
         """Draw a texture at pixel coordinates with alpha modulation."""
         raise NotImplementedError
 
+    def draw_texture_quads(
+        self,
+        texture: Any,
+        rects: np.ndarray,
+        uvs: np.ndarray,
+        tints: np.ndarray,
+    ) -> None:
+        """Draw many sub-rectangles of one texture as a single batch.
+
+        ``rects`` and ``uvs`` are (N, 4) float arrays of (x1, y1, x2, y2) in
+        screen pixels and normalized texture coordinates; ``tints`` is (N, 4)
+        float RGBA (0-1) multiplied into each quad's samples.
+        """
+        raise NotImplementedError
+
     def draw_background(
         self,
         texture: Any,
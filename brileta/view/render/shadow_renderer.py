@@ -9,6 +9,7 @@ import numpy as np
 from brileta import config
 from brileta.environment.tile_types import TileTypeID, get_shadow_height_map
 from brileta.types import InterpolationAlpha
+from brileta.util._native import accumulate_shadow_dimming, clip_shadow_lengths
 
 from .graphics import GraphicsContext
 from .viewport import ViewportSystem
@@ -596,94 +597,23 @@ class ShadowRenderer:
         # 5. Receiver dimming (LOD detail only).
         # ------------------------------------------------------------------
         if lod_detail and shadow_receivers:
-            eligible_indices_for_dimming = np.flatnonzero(eligible_mask)
-            n_casters = len(eligible_indices_for_dimming)
-            n_receivers = len(shadow_receivers)
-
-            if n_casters > 0 and n_receivers > 0:
-                c_center_x = (
-                    actor_x[eligible_indices_for_dimming].astype(np.float64) + 0.5
-                )
-                c_center_y = (
-                    actor_y[eligible_indices_for_dimming].astype(np.float64) + 0.5
-                )
-                c_shadow_h = shadow_heights[eligible_indices_for_dimming]
-                c_vis_scale = visual_scale[eligible_indices_for_dimming]
-                c_shadow_len = shadow_length_tiles[eligible_indices_for_dimming]
-
-                r_center_x = np.array(
-                    [float(r.x) + 0.5 for r in shadow_receivers],
-                    dtype=np.float64,
-                )
-                r_center_y = np.array(
-                    [float(r.y) + 0.5 for r in shadow_receivers],
-                    dtype=np.float64,
-                )
-                r_vis_scale = np.array(
-                    [float(r.visual_scale) for r in shadow_receivers],
-                    dtype=np.float64,
-                )
-
-                # Build identity mask to skip self-shadowing.
-                caster_ids = [id(actors[ci]) for ci in eligible_indices_for_dimming]
-                receiver_id_map = {id(r): ri for ri, r in enumerate(shadow_receivers)}
-                identity_mask = np.zeros((n_casters, n_receivers), dtype=bool)
-                for ci, cid in enumerate(caster_ids):
-                    ri = receiver_id_map.get(cid)
-                    if ri is not None:
-                        identity_mask[ci, ri] = True
-
-                # Pairwise geometry [N_casters, D_receivers].
-                rel_x = r_center_x[np.newaxis, :] - c_center_x[:, np.newaxis]
-                rel_y = r_center_y[np.newaxis, :] - c_center_y[:, np.newaxis]
-
-                dist_along = rel_x * shadow_dir_x + rel_y * shadow_dir_y
-                dist_perp = np.abs(rel_x * shadow_dir_y - rel_y * shadow_dir_x)
-
-                height_factor = np.minimum(1.0, c_shadow_h / 4.0)
-                shadow_half_width = 0.18 + 0.22 * np.maximum(0.5, c_vis_scale)
-                receiver_radius = 0.2 + 0.18 * np.maximum(0.5, r_vis_scale)
-                lateral_limit = (
-                    shadow_half_width[:, np.newaxis] + receiver_radius[np.newaxis, :]
-                )
-
-                valid = (
-                    ~identity_mask
-                    & (dist_along > 0.0)
-                    & (dist_along < c_shadow_len[:, np.newaxis])
-                    & (dist_perp < lateral_limit)
-                )
-
-                shadow_alpha_dim = float(config.ACTOR_SHADOW_ALPHA)
-                fade_tip_dim = bool(config.ACTOR_SHADOW_FADE_TIP)
-
-                lateral_factor = np.where(valid, 1.0 - dist_perp / lateral_limit, 0.0)
-                tip_factor = np.where(
-                    valid & fade_tip_dim,
-                    1.0 - dist_along / c_shadow_len[:, np.newaxis],
-                    np.where(valid, 1.0, 0.0),
-                )
-                attenuation = (
-                    shadow_alpha_dim
-                    * height_factor[:, np.newaxis]
-                    * lateral_factor
-                    * tip_factor
-                )
-                attenuation = np.where(valid, attenuation, 0.0)
-
-                per_pair_factor = np.where(
-                    attenuation > 0.0,
-                    1.0 - np.minimum(0.95, attenuation),
-                    1.0,
-                )
-                per_receiver_scale = np.prod(per_pair_factor, axis=0)
-                per_receiver_scale = np.maximum(0.05, per_receiver_scale)
-
-                for ri, receiver in enumerate(shadow_receivers):
-                    if per_receiver_scale[ri] < 1.0 - 1e-9:
-                        self._actor_shadow_receive_light_scale[receiver] = float(
-                            per_receiver_scale[ri]
-                        )
+            dimming_indices = np.flatnonzero(eligible_mask)
+            count = len(dimming_indices)
+            shadows = np.empty((count, 8), dtype=np.float64)
+            shadows[:, 0] = actor_x[dimming_indices] + 0.5
+            shadows[:, 1] = actor_y[dimming_indices] + 0.5
+            shadows[:, 2] = visual_scale[dimming_indices]
+            shadows[:, 3] = shadow_heights[dimming_indices]
+            shadows[:, 4] = shadow_dir_x
+            shadows[:, 5] = shadow_dir_y
+            shadows[:, 6] = shadow_length_tiles[dimming_indices]
+            shadows[:, 7] = float(config.ACTOR_SHADOW_ALPHA)
+            self._apply_receiver_dimming(
+                [actors[i] for i in dimming_indices.tolist()],
+                shadows,
+                shadow_receivers,
+                fade_tip=bool(config.ACTOR_SHADOW_FADE_TIP),
+            )
 
         # ------------------------------------------------------------------
         # 6. Use pre-computed screen positions from batch data.
@@ -819,8 +749,10 @@ class ShadowRenderer:
         """Render projected glyph shadows for small terrain objects (boulders, etc.).
 
         Tiles whose shadow_height is in (0, 2] get a CPU-projected glyph shadow
-        using the same draw_actor_shadow() path as actors. Taller tiles (walls,
-        doors) keep their shader-only tile shadows.
+        with the same geometry as actor shadows. Taller tiles (walls, doors)
+        keep their shader-only tile shadows. Wall clipping and vertex building
+        each run as one native pass over all candidates, and the shadows are
+        submitted as a single draw_actor_shadow_batch() call.
         """
         # At low zoom, terrain glyph shadows (boulders etc.) are rendered at
         # ~10px per tile - the small projected shadow shapes are imperceptible.
@@ -865,53 +797,88 @@ class ShadowRenderer:
         if len(candidates) == 0:
             return
 
-        cam_frac_x, cam_frac_y = self._camera_frac_offset
-
-        for rel_x, rel_y in candidates:
-            world_x = world_left + int(rel_x)
-            world_y = world_top + int(rel_y)
-
-            # Only render in outdoor areas exposed to sunlight.
-            if not self._can_render_sun_shadow_at_tile(world_x, world_y):
-                continue
-
-            glyph_shadow_height = float(heights[rel_x, rel_y])
-            shadow_length_tiles = glyph_shadow_height * shadow_length_scale
-            if shadow_length_tiles <= 0.0:
-                continue
+        world_x = (candidates[:, 0] + world_left).astype(np.int32)
+        world_y = (candidates[:, 1] + world_top).astype(np.int32)
 
-            # Clip shadow by nearby walls.
-            clipped_length_tiles = self._clip_shadow_length_by_walls(
-                world_x, world_y, shadow_dir_x, shadow_dir_y, shadow_length_tiles
+        # Only render in outdoor areas exposed to sunlight.
+        eligible_grid = self._get_sun_shadow_eligibility_grid()
+        if eligible_grid is not None:
+            outdoor = np.asarray(eligible_grid[world_x, world_y], dtype=bool)
+        else:
+            outdoor = np.fromiter(
+                (
+                    self._can_render_sun_shadow_at_tile(x, y)
+                    for x, y in zip(world_x.tolist(), world_y.tolist(), strict=True)
+                ),
+                dtype=bool,
+                count=len(world_x),
             )
-            if clipped_length_tiles <= 0.0:
-                continue
 
-            # Get the tile's glyph character for the shadow shape.
-            ch_code = int(self.game_map.light_appearance_map[world_x, world_y]["ch"])
-            char = chr(ch_code)
+        # Clip every candidate by nearby walls in one native pass.
+        shadow_length_tiles = heights[candidates[:, 0], candidates[:, 1]].astype(
+            np.float64
+        ) * float(shadow_length_scale)
+        clip_shadow_lengths(
+            self.game_map.shadow_heights,
+            world_x,
+            world_y,
+            shadow_length_tiles,
+            float(shadow_dir_x),
+            float(shadow_dir_y),
+        )
+        keep = np.flatnonzero(outdoor & (shadow_length_tiles > 0.0))
+        if len(keep) == 0:
+            return
+
+        world_x = world_x[keep]
+        world_y = world_y[keep]
+        shadow_length_pixels = shadow_length_tiles[keep] * float(tile_height)
+        # The tile's glyph character gives the shadow its shape.
+        char_codes = self.game_map.light_appearance_map["ch"][world_x, world_y]
+        shadow_alpha = config.TERRAIN_GLYPH_SHADOW_ALPHA * shadow_fade
+        fade_tip = config.ACTOR_SHADOW_FADE_TIP
+        cam_frac_x, cam_frac_y = self._camera_frac_offset
 
-            # Convert tile position to screen coordinates.
-            vp_x, vp_y = self.viewport_system.world_to_screen(world_x, world_y)
+        viewport_pos = self._world_to_screen_float_batch(
+            world_x.astype(np.float64), world_y.astype(np.float64)
+        )
+        if viewport_pos is not None:
+            # world_to_screen() rounds; np.round matches Python's round-half-even.
+            vp_x, vp_y = np.round(viewport_pos[0]), np.round(viewport_pos[1])
             root_x = self._view_origin[0] + vp_x - cam_frac_x
             root_y = self._view_origin[1] + vp_y - cam_frac_y
-            draw_root_x, draw_root_y = self._zoomed_tile_draw_origin(root_x, root_y)
-            screen_x, screen_y = self.graphics.console_to_screen_coords(
-                draw_root_x, draw_root_y
+            screen_x, screen_y = self._console_to_screen_coords_batch(
+                root_x + (viewport_scale_x - 1.0) * 0.5,
+                root_y + (viewport_scale_y - 1.0) * 0.5,
             )
+        else:
+            # Per-tile scalar positions for test doubles.
+            screen_x = np.empty(len(world_x), dtype=np.float64)
+            screen_y = np.empty(len(world_x), dtype=np.float64)
+            for idx, (x, y) in enumerate(
+                zip(world_x.tolist(), world_y.tolist(), strict=True)
+            ):
+                vp_x, vp_y = self.viewport_system.world_to_screen(x, y)
+                draw_root_x, draw_root_y = self._zoomed_tile_draw_origin(
+                    self._view_origin[0] + vp_x - cam_frac_x,
+                    self._view_origin[1] + vp_y - cam_frac_y,
+                )
+                screen_x[idx], screen_y[idx] = self.graphics.console_to_screen_coords(
+                    draw_root_x, draw_root_y
+                )
 
-            self.graphics.draw_actor_shadow(
-                char=char,
-                screen_x=screen_x,
-                screen_y=screen_y,
-                shadow_dir_x=shadow_dir_x,
-                shadow_dir_y=shadow_dir_y,
-                shadow_length_pixels=clipped_length_tiles * tile_height,
-                shadow_alpha=config.TERRAIN_GLYPH_SHADOW_ALPHA * shadow_fade,
-                scale_x=viewport_scale_x,
-                scale_y=viewport_scale_y,
-                fade_tip=config.ACTOR_SHADOW_FADE_TIP,
-            )
+        self.graphics.draw_actor_shadow_batch(
+            char_codes=char_codes,
+            screen_x=screen_x,
+            screen_y=screen_y,
+            shadow_dir_x=shadow_dir_x,
+            shadow_dir_y=shadow_dir_y,
+            shadow_length_pixels=shadow_length_pixels,
+            shadow_alpha=shadow_alpha,
+            scale_x=viewport_scale_x,
+            scale_y=viewport_scale_y,
+            fade_tip=fade_tip,
+        )
 
     def _render_point_light_actor_shadows(
         self,
@@ -968,6 +935,11 @@ class ShadowRenderer:
         # Cache config values outside the loop.
         actor_shadow_alpha_cfg = float(config.ACTOR_SHADOW_ALPHA)
         fade_tip = bool(config.ACTOR_SHADOW_FADE_TIP)
+        visual_scale_arr = batch_data.visual_scale
+
+        # Receiver dimming is applied once after the loop, in caster order.
+        dimming_casters: list[Actor] = []
+        dimming_rows: list[tuple[float, ...]] = []
 
         for idx_val in eligible_indices.tolist():
             actor = actors[idx_val]
@@ -1024,14 +996,18 @@ class ShadowRenderer:
                     clipped_length_tiles = shadow_height
 
                 if lod_detail:
-                    self._accumulate_actor_shadow_receiver_dimming(
-                        caster=actor,
-                        receivers=shadow_receivers,
-                        shadow_dir_x=dir_x,
-                        shadow_dir_y=dir_y,
-                        shadow_length_tiles=clipped_length_tiles,
-                        shadow_alpha=shadow_alpha,
-                        fade_tip=fade_tip,
+                    dimming_casters.append(actor)
+                    dimming_rows.append(
+                        (
+                            ax + 0.5,
+                            ay + 0.5,
+                            float(visual_scale_arr[idx_val]),
+                            shadow_height,
+                            dir_x,
+                            dir_y,
+                            clipped_length_tiles,
+                            shadow_alpha,
+                        )
                     )
 
                 self._emit_actor_shadow_quads(
@@ -1047,6 +1023,14 @@ class ShadowRenderer:
                     fade_tip=fade_tip,
                 )
 
+        if dimming_rows and shadow_receivers:
+            self._apply_receiver_dimming(
+                dimming_casters,
+                np.array(dimming_rows, dtype=np.float64),
+                shadow_receivers,
+                fade_tip=fade_tip,
+            )
+
     # CP437 solid block (█) used as a fallback when sprite-silhouette shadows
     # are unavailable on the current graphics backend.
     _SOLID_BLOCK_CHAR = chr(219)
@@ -1182,73 +1166,52 @@ class ShadowRenderer:
 
         return shadow_length_tiles
 
-    def _accumulate_actor_shadow_receiver_dimming(
+    def _apply_receiver_dimming(
         self,
-        caster: Actor,
+        casters: list[Actor],
+        shadows: np.ndarray,
         receivers: list[Actor],
-        shadow_dir_x: float,
-        shadow_dir_y: float,
-        shadow_length_tiles: float,
-        shadow_alpha: float,
+        *,
         fade_tip: bool,
     ) -> None:
-        """Accumulate per-actor light attenuation from projected actor shadows."""
-        if shadow_length_tiles <= 0.0 or shadow_alpha <= 0.0:
-            return
-
-        direction_length_sq = shadow_dir_x * shadow_dir_x + shadow_dir_y * shadow_dir_y
-        if direction_length_sq <= 1e-12:
-            return
-
-        # Callers pass normalized vectors; avoid per-receiver renormalization work.
-        dir_x = shadow_dir_x
-        dir_y = shadow_dir_y
-        caster_center_x = float(caster.x) + 0.5
-        caster_center_y = float(caster.y) + 0.5
-
-        # Taller actors should darken receivers more than shorter actors.
-        caster_shadow_height = max(0.0, float(caster.shadow_height))
-        height_factor = min(1.0, caster_shadow_height / 4.0)
-        if height_factor <= 0.0:
+        """Multiply a batch of projected actor shadows into receiver light scales.
+
+        ``shadows`` has one row per caster shadow, aligned with ``casters``:
+        (center_x, center_y, visual_scale, shadow_height, dir_x, dir_y,
+        length_tiles, alpha). The native kernel buckets receivers by tile and
+        only tests those near each shadow's capsule, applying rows in order so
+        every receiver sees the same multiply-and-clamp sequence as applying the
+        shadows one at a time.
+        """
+        if len(shadows) == 0 or not receivers:
             return
 
-        caster_scale = max(0.5, float(caster.visual_scale))
-        shadow_half_width = 0.18 + 0.22 * caster_scale
-
-        for receiver in receivers:
-            if receiver is caster:
-                continue
-
-            receiver_scale = max(0.5, float(receiver.visual_scale))
-            receiver_radius = 0.2 + 0.18 * receiver_scale
-            receiver_center_x = float(receiver.x) + 0.5
-            receiver_center_y = float(receiver.y) + 0.5
-
-            rel_x = receiver_center_x - caster_center_x
-            rel_y = receiver_center_y - caster_center_y
-
-            # Signed distance along the projected shadow axis.
-            distance_along_shadow = rel_x * dir_x + rel_y * dir_y
-            if (
-                distance_along_shadow <= 0.0
-                or distance_along_shadow >= shadow_length_tiles
-            ):
-                continue
-
-            # Perpendicular distance to the shadow axis.
-            distance_from_axis = abs(rel_x * dir_y - rel_y * dir_x)
-            lateral_limit = shadow_half_width + receiver_radius
-            if distance_from_axis >= lateral_limit:
-                continue
-
-            lateral_factor = 1.0 - distance_from_axis / lateral_limit
-            tip_factor = (
-                1.0 - distance_along_shadow / shadow_length_tiles if fade_tip else 1.0
-            )
-            attenuation = shadow_alpha * height_factor * lateral_factor * tip_factor
-            if attenuation <= 0.0:
-                continue
-
-            current_scale = self._actor_shadow_receive_light_scale.get(receiver, 1.0)
-            next_scale = current_scale * (1.0 - min(0.95, attenuation))
-            self._actor_shadow_receive_light_scale[receiver] = max(0.05, next_scale)
+        receiver_index = {id(receiver): i for i, receiver in enumerate(receivers)}
+        self_index = np.fromiter(
+            (receiver_index.get(id(caster), -1) for caster in casters),
+            dtype=np.int32,
+            count=len(casters),
+        )
+        receiver_rows = np.array(
+            [
+                (float(r.x) + 0.5, float(r.y) + 0.5, float(r.visual_scale))
+                for r in receivers
+            ],
+            dtype=np.float64,
+        )
+        scale_map = self._actor_shadow_receive_light_scale
+        scales = np.fromiter(
+            (scale_map.get(receiver, 1.0) for receiver in receivers),
+            dtype=np.float32,
+            count=len(receivers),
+        )
+        accumulate_shadow_dimming(
+            np.ascontiguousarray(shadows, dtype=np.float64),
+            self_index,
+            receiver_rows,
+            scales,
+            fade_tip,
+        )
+        for receiver, scale in zip(receivers, scales.tolist(), strict=True):
+            if scale < 1.0:
+                scale_map[receiver] = scale
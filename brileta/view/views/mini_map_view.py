@@ -9,6 +9,7 @@ import numpy as np
 from brileta import colors, config
 from brileta.backends.pillow.canvas import PillowImageCanvas
 from brileta.environment import tile_types
+from brileta.environment.map import EXPLORATION_CHUNK_SIZE
 from brileta.game.actors import Character
 from brileta.game.actors.boulder import Boulder
 from brileta.game.actors.trees import Tree
@@ -24,8 +25,24 @@ if TYPE_CHECKING:
     from brileta.view.render.viewport import ViewportSystem
 
 
+# Per-tile fog state stored alongside the palette index; also the palette row.
+_STATE_UNEXPLORED = 0
+_STATE_EXPLORED = 1
+_STATE_VISIBLE = 2
+
+TileRect = tuple[int, int, int, int]
+
+
 class MiniMapView(TextView):
-    """Render a compact overview of explored and visible map tiles."""
+    """Render a compact overview of explored and visible map tiles.
+
+    The map is held as a persistent ``(palette_index, fog_state)`` cell grid,
+    one cell per tile. Palette indices are tile IDs, with static features
+    (trees, boulders) appended after them; the palette has one row per fog
+    state, so recolouring is a single lookup. On backends with a GPU palette
+    map only the cells that changed are uploaded and the lookup runs in a
+    shader; otherwise the same lookup is done on the CPU.
+    """
 
     _MAP_BORDER_PX = 2
     _EXPLORED_DIM_FACTOR = 0.4
@@ -73,21 +90,30 @@ class MiniMapView(TextView):
             self._dim_color(color, self._EXPLORED_DIM_FACTOR)
             for color in self._visible_colors
         )
-        # NumPy lookup tables for vectorized terrain rendering, indexed by TileTypeID.
-        self._visible_colors_np = np.array(self._visible_colors, dtype=np.uint8)
-        self._explored_colors_np = np.array(self._explored_colors, dtype=np.uint8)
+        self._feature_palette_index: dict[type, int] = {
+            feature_type: len(self._visible_colors) + k
+            for k, feature_type in enumerate(self._FEATURE_COLORS)
+        }
+        self._palette = self._build_palette()
 
         game_map = self.controller.gw.game_map
-        self._map_rgb = np.zeros((game_map.height, game_map.width, 3), dtype=np.uint8)
-        self._map_rgb_revision: int = -1
-        self._map_rgb_exploration_revision: int = -1
-
-        # Precomputed feature layers, built lazily on first terrain render
-        # and invalidated when structural_revision changes.
-        self._feature_layer_rev: int = -1
-        self._feature_mask: np.ndarray = np.empty(0, dtype=bool)
-        self._feature_vis_rgb: np.ndarray = np.empty(0, dtype=np.uint8)
-        self._feature_exp_rgb: np.ndarray = np.empty(0, dtype=np.uint8)
+        self._map_cells = np.zeros((game_map.height, game_map.width, 2), dtype=np.uint8)
+        self._map_cells_revision: int = -1
+        self._map_cells_exploration_revision: int = -1
+        self._explored_chunk_snapshot: np.ndarray = np.empty((0, 0), dtype=np.int64)
+        # FOV rectangle refreshed on the last exploration update; tiles leaving
+        # visibility are always inside it.
+        self._fov_rect: TileRect | None = None
+
+        # Palette index of the static feature on each tile (0 = none), built
+        # on full rebuilds only.
+        self._feature_index: np.ndarray = np.empty((0, 0), dtype=np.uint8)
+
+        # GPU palette map, created lazily on first draw. ``False`` once the
+        # backend has reported that it has none.
+        self._palette_map: Any | None = None
+        self._palette_map_supported = True
+        self._palette_terrain_key: tuple | None = None
 
     def reset_for_new_world(self) -> None:
         """Invalidate all cached map state so the next draw rebuilds from scratch.
@@ -97,9 +123,9 @@ class MiniMapView(TextView):
         not change between the old and new maps.  Forcing the revision counters
         to -1 guarantees a full terrain rebuild on the next frame.
         """
-        self._map_rgb_revision = -1
-        self._map_rgb_exploration_revision = -1
-        self._feature_layer_rev = -1
+        self._map_cells_revision = -1
+        self._map_cells_exploration_revision = -1
+        self._release_palette_map()
         self._terrain_texture_cache.clear()
         self._texture_cache.clear()
         self._cached_terrain_texture = None
@@ -142,41 +168,40 @@ class MiniMapView(TextView):
             lut.append(cls._tune_terrain_color((int(bg[0]), int(bg[1]), int(bg[2]))))
         return tuple(lut)
 
-    def _get_feature_layers(
-        self,
-    ) -> tuple[np.ndarray, np.ndarray, np.ndarray]:
-        """Return (mask, vis_rgb, exp_rgb) arrays for static feature actors.
+    def _build_palette(self) -> np.ndarray:
+        """Return the ``(state, palette_index)`` RGBA palette.
 
-        Built once from the actor list, then cached until
-        ``structural_revision`` changes (which covers map regeneration).
+        Rows are indexed by fog state; columns are tile IDs followed by the
+        feature types. Unexplored cells are opaque black.
         """
-        game_map = self.controller.gw.game_map
-        rev = game_map.structural_revision
-        if self._feature_layer_rev == rev:
-            return self._feature_mask, self._feature_vis_rgb, self._feature_exp_rgb
-
-        h, w = game_map.height, game_map.width
-        mask = np.zeros((h, w), dtype=bool)
-        vis_rgb = np.zeros((h, w, 3), dtype=np.uint8)
-        exp_rgb = np.zeros((h, w, 3), dtype=np.uint8)
+        visible = [*self._visible_colors, *self._FEATURE_COLORS.values()]
         dim = self._EXPLORED_DIM_FACTOR
+        explored = [self._dim_color(color, dim) for color in visible]
+        explored[: len(self._explored_colors)] = self._explored_colors
+        assert len(visible) <= 256, "mini-map palette indices must fit in uint8"
+
+        palette = np.zeros((3, len(visible), 4), dtype=np.uint8)
+        palette[:, :, 3] = 255
+        palette[_STATE_EXPLORED, :, :3] = explored
+        palette[_STATE_VISIBLE, :, :3] = visible
+        return palette
+
+    def _rebuild_feature_index(self) -> None:
+        """Rebuild the ``(h, w)`` feature palette-index layer (0 = no feature).
 
+        Static features never move, so this only runs on full rebuilds.
+        """
+        game_map = self.controller.gw.game_map
+        h, w = game_map.height, game_map.width
+        feature_index = np.zeros((h, w), dtype=np.uint8)
         for actor in self.controller.gw.actors:
-            color = self._FEATURE_COLORS.get(type(actor))
-            if color is None:
+            index = self._feature_palette_index.get(type(actor))
+            if index is None:
                 continue
             ax, ay = actor.x, actor.y
-            if not (0 <= ax < w and 0 <= ay < h):
-                continue
-            mask[ay, ax] = True
-            vis_rgb[ay, ax] = color
-            exp_rgb[ay, ax] = self._dim_color(color, dim)
-
-        self._feature_layer_rev = rev
-        self._feature_mask = mask
-        self._feature_vis_rgb = vis_rgb
-        self._feature_exp_rgb = exp_rgb
-        return mask, vis_rgb, exp_rgb
+            if 0 <= ax < w and 0 <= ay < h:
+                feature_index[ay, ax] = index
+        self._feature_index = feature_index
 
     def _get_pixels_per_tile(self) -> int:
         """Return the largest integer tile scale that fits the current bounds."""
@@ -293,102 +318,195 @@ class MiniMapView(TextView):
         if self.tile_dimensions != (0, 0):
             self._configure_overlay_canvas()
 
-    def _render_terrain_pixels(self) -> np.ndarray:
-        """Render the terrain/fog layer as a small RGBA pixel buffer via NumPy.
+    def _terrain_layout(self) -> tuple[int, int, int, int]:
+        """Return (small_w, small_h, origin_x, origin_y) of the terrain layer.
 
-        Each map tile is exactly 1 pixel. The GPU's nearest-neighbor sampler
-        handles upscaling to screen resolution, which reduces the buffer from
-        ~3 MB (full resolution) to ~70 KB and eliminates the costly np.repeat
-        and tobytes overhead.  The 1px border is drawn by the overlay layer at
-        full resolution instead.
+        The terrain layer is 1 pixel per map tile with margins for centering;
+        the GPU's nearest-neighbor sampler stretches it back to the view.
         """
-        game_map = self.controller.gw.game_map
-        self._ensure_map_rgb_current()
         px_per_tile, _ma_x, _ma_y, tile_origin_x, tile_origin_y = self._map_layout()
-
-        # Small texture: 1 pixel per map tile, with margins for centering.
-        # The GPU stretches this back to the full view area on present.
         small_w = max(1, -(-self.view_width_px // px_per_tile))
         small_h = max(1, -(-self.view_height_px // px_per_tile))
         origin_x = round(tile_origin_x / px_per_tile)
         origin_y = round(tile_origin_y / px_per_tile)
+        return small_w, small_h, origin_x, origin_y
 
-        # Composite 1:1 map content into the small opaque-black buffer.
+    def _render_terrain_pixels(self) -> np.ndarray:
+        """Render the terrain/fog layer as a small RGBA pixel buffer via NumPy.
+
+        CPU fallback for backends without a palette map. Each map tile is
+        exactly 1 pixel; the 1px border is drawn by the overlay layer at full
+        resolution instead.
+        """
+        game_map = self.controller.gw.game_map
+        self._ensure_map_cells_current()
+        small_w, small_h, origin_x, origin_y = self._terrain_layout()
+
+        # Composite the palette lookup into the small opaque-black buffer.
         buf = np.zeros((small_h, small_w, 4), dtype=np.uint8)
         buf[:, :, 3] = 255
         clip_h = min(game_map.height, small_h - origin_y)
         clip_w = min(game_map.width, small_w - origin_x)
         if clip_h > 0 and clip_w > 0:
-            buf[origin_y : origin_y + clip_h, origin_x : origin_x + clip_w, :3] = (
-                self._map_rgb[:clip_h, :clip_w]
+            cells = self._map_cells[:clip_h, :clip_w]
+            buf[origin_y : origin_y + clip_h, origin_x : origin_x + clip_w] = (
+                self._palette[cells[:, :, 1], cells[:, :, 0]]
             )
+        return buf
 
-        return np.ascontiguousarray(buf)
+    def _ensure_map_cells_current(self) -> list[TileRect]:
+        """Bring the persistent cell grid up to date with the map.
 
-    def _ensure_map_rgb_current(self) -> None:
-        """Keep the persistent mini-map terrain buffer synchronized to map state."""
+        Returns the ``(x0, y0, x1, y1)`` tile rectangles whose cells changed,
+        for upload to the GPU palette map. Steady state touches only changed
+        tiles, chunks that gained explored tiles, and the previous and current
+        FOV rectangles - never the whole map.
+        """
         gw = self.controller.gw
         game_map = gw.game_map
-        target_shape = (game_map.height, game_map.width, 3)
-        if self._map_rgb.shape != target_shape:
-            self._map_rgb = np.zeros(target_shape, dtype=np.uint8)
-            self._map_rgb_revision = -1
-            self._map_rgb_exploration_revision = -1
+        w, h = game_map.width, game_map.height
+        if self._map_cells.shape != (h, w, 2):
+            self._map_cells = np.zeros((h, w, 2), dtype=np.uint8)
+            self._map_cells_revision = -1
 
         structural_revision = game_map.structural_revision
         exploration_revision = game_map.exploration_revision
-
-        needs_full_rebuild = self._map_rgb_revision != structural_revision
-        if needs_full_rebuild:
-            self._update_map_rgb_region(0, 0, game_map.width, game_map.height)
-            self._map_rgb_revision = structural_revision
-            self._map_rgb_exploration_revision = exploration_revision
-            return
-
-        if self._map_rgb_exploration_revision == exploration_revision:
-            return
-
-        player = gw.player
+        chunk_revisions = game_map.explored_chunk_revisions
+
+        changed_tiles = None
+        if self._map_cells_revision >= 0:
+            changed_tiles = game_map.tiles_changed_since(self._map_cells_revision)
+        if changed_tiles is None:
+            self._rebuild_feature_index()
+            self._update_cell_indices(0, 0, w, h)
+            self._update_cell_states(0, 0, w, h)
+            self._map_cells_revision = structural_revision
+            self._map_cells_exploration_revision = exploration_revision
+            self._explored_chunk_snapshot = chunk_revisions.copy()
+            self._fov_rect = self._player_fov_rect()
+            return [(0, 0, w, h)]
+
+        dirty: list[TileRect] = []
+        if self._map_cells_revision != structural_revision:
+            for x, y in changed_tiles:
+                if 0 <= x < w and 0 <= y < h:
+                    self._update_cell_indices(x, y, x + 1, y + 1)
+                    dirty.append((x, y, x + 1, y + 1))
+            self._map_cells_revision = structural_revision
+
+        if self._map_cells_exploration_revision != exploration_revision:
+            size = EXPLORATION_CHUNK_SIZE
+            for cx, cy in zip(
+                *np.nonzero(chunk_revisions != self._explored_chunk_snapshot),
+                strict=True,
+            ):
+                x0, y0 = int(cx) * size, int(cy) * size
+                dirty.append((x0, y0, min(w, x0 + size), min(h, y0 + size)))
+            self._explored_chunk_snapshot = chunk_revisions.copy()
+
+            fov_rect = self._player_fov_rect()
+            dirty.extend(_merge_rects(self._fov_rect, fov_rect))
+            self._fov_rect = fov_rect
+            self._map_cells_exploration_revision = exploration_revision
+
+            for rect in dirty:
+                self._update_cell_states(*rect)
+        return dirty
+
+    def _player_fov_rect(self) -> TileRect:
+        """Return the tile rectangle the player's FOV can reach.
+
+        Without a player the whole map is treated as in view.
+        """
+        game_map = self.controller.gw.game_map
+        player = self.controller.gw.player
         if player is None:
-            self._update_map_rgb_region(0, 0, game_map.width, game_map.height)
-            self._map_rgb_exploration_revision = exploration_revision
-            return
-
+            return (0, 0, game_map.width, game_map.height)
         radius = config.FOV_RADIUS
-        x0 = max(0, player.x - radius)
-        y0 = max(0, player.y - radius)
-        x1 = min(game_map.width, player.x + radius + 1)
-        y1 = min(game_map.height, player.y + radius + 1)
-        self._update_map_rgb_region(x0, y0, x1, y1)
-        self._map_rgb_exploration_revision = exploration_revision
-
-    def _update_map_rgb_region(self, x0: int, y0: int, x1: int, y1: int) -> None:
-        """Recompute terrain RGB for a map sub-rectangle in tile coordinates."""
+        return (
+            max(0, player.x - radius),
+            max(0, player.y - radius),
+            min(game_map.width, player.x + radius + 1),
+            min(game_map.height, player.y + radius + 1),
+        )
+
+    def _update_cell_indices(self, x0: int, y0: int, x1: int, y1: int) -> None:
+        """Recompute palette indices (tile ID or feature) for a tile rectangle."""
         if x1 <= x0 or y1 <= y0:
             return
+        game_map = self.controller.gw.game_map
+        # Source map arrays are indexed as [x, y]; transpose to image layout [y, x].
+        indices = self._map_cells[y0:y1, x0:x1, 0]
+        indices[:] = game_map.tiles[x0:x1, y0:y1].T
+        features = self._feature_index[y0:y1, x0:x1]
+        np.copyto(indices, features, where=features != 0)
 
+    def _update_cell_states(self, x0: int, y0: int, x1: int, y1: int) -> None:
+        """Recompute fog states (unexplored/explored/visible) for a tile rectangle."""
+        if x1 <= x0 or y1 <= y0:
+            return
+        game_map = self.controller.gw.game_map
+        states = self._map_cells[y0:y1, x0:x1, 1]
+        states[:] = game_map.explored[x0:x1, y0:y1].T
+        states[game_map.visible[x0:x1, y0:y1].T] = _STATE_VISIBLE
+
+    def _get_palette_map(self, graphics: GraphicsContext) -> Any | None:
+        """Return the GPU palette map for the current map, creating it if needed."""
+        if not self._palette_map_supported:
+            return None
         game_map = self.controller.gw.game_map
+        palette_map = self._palette_map
+        if palette_map is not None and (palette_map.width, palette_map.height) == (
+            game_map.width,
+            game_map.height,
+        ):
+            return palette_map
+
+        self._release_palette_map()
+        palette_map = graphics.create_palette_map(
+            game_map.width, game_map.height, self._palette
+        )
+        if palette_map is None:
+            self._palette_map_supported = False
+            return None
+        # A fresh GPU grid is empty, so the next sync must upload everything.
+        self._palette_map = palette_map
+        self._map_cells_revision = -1
+        return palette_map
+
+    def _release_palette_map(self) -> None:
+        """Drop the GPU palette map and its rendered terrain texture."""
+        if self._palette_map is not None:
+            self._palette_map.release()
+            self._palette_map = None
+        self._palette_terrain_key = None
+
+    def _draw_terrain_layer(self, graphics: GraphicsContext) -> None:
+        """Bring the terrain texture up to date for the current frame."""
+        terrain_key = self._get_terrain_cache_key()
+        palette_map = self._get_palette_map(graphics)
+        if palette_map is not None:
+            for x0, y0, x1, y1 in self._ensure_map_cells_current():
+                palette_map.write_cells(x0, y0, self._map_cells[y0:y1, x0:x1])
+            if self._palette_terrain_key != terrain_key:
+                self._cached_terrain_texture = palette_map.render(
+                    *self._terrain_layout()
+                )
+                self._palette_terrain_key = terrain_key
+            return
 
-        # Source map arrays are indexed as [x, y]; transpose to image layout [y, x].
-        tile_ids = game_map.tiles[x0:x1, y0:y1].T.astype(np.intp)
-        visible_t = game_map.visible[x0:x1, y0:y1].T
-        explored_t = game_map.explored[x0:x1, y0:y1].T
-
-        target = self._map_rgb[y0:y1, x0:x1]
-        target[:] = 0
-        target[visible_t] = self._visible_colors_np[tile_ids[visible_t]]
-        explored_only = explored_t & ~visible_t
-        target[explored_only] = self._explored_colors_np[tile_ids[explored_only]]
-
-        # Apply feature overlays after terrain so trees/boulders replace base color.
-        feat_mask, feat_vis, feat_exp = self._get_feature_layers()
-        feat_mask_region = feat_mask[y0:y1, x0:x1]
-        feat_vis_region = feat_vis[y0:y1, x0:x1]
-        feat_exp_region = feat_exp[y0:y1, x0:x1]
-        vis_features = feat_mask_region & visible_t
-        target[vis_features] = feat_vis_region[vis_features]
-        exp_features = feat_mask_region & explored_only
-        target[exp_features] = feat_exp_region[exp_features]
+        # CPU fallback - rendered via NumPy, bypassing the canvas pipeline.
+        cached_terrain = self._terrain_texture_cache.get(terrain_key)
+        if cached_terrain is None:
+            terrain_pixels = self._render_terrain_pixels()
+            terrain_texture = graphics.texture_from_numpy(
+                terrain_pixels, transparent=False
+            )
+            if terrain_texture:
+                self._terrain_texture_cache.store(terrain_key, terrain_texture)
+                self._cached_terrain_texture = terrain_texture
+        else:
+            self._cached_terrain_texture = cached_terrain
 
     def _map_layout(self) -> tuple[int, int, int, int, int]:
         """Return (px_per_tile, map_area_x, map_area_y, tile_origin_x, tile_origin_y).
@@ -499,19 +617,7 @@ class MiniMapView(TextView):
             self._sync_view_metrics(graphics)
             self._configure_overlay_canvas()
 
-            # Terrain layer - rendered via NumPy, bypassing the canvas pipeline.
-            terrain_key = self._get_terrain_cache_key()
-            cached_terrain = self._terrain_texture_cache.get(terrain_key)
-            if cached_terrain is None:
-                terrain_pixels = self._render_terrain_pixels()
-                terrain_texture = graphics.texture_from_numpy(
-                    terrain_pixels, transparent=False
-                )
-                if terrain_texture:
-                    self._terrain_texture_cache.store(terrain_key, terrain_texture)
-                    self._cached_terrain_texture = terrain_texture
-            else:
-                self._cached_terrain_texture = cached_terrain
+            self._draw_terrain_layer(graphics)
 
             # Overlay layer - viewport rect and actor markers via Pillow canvas.
             # Compute markers once and reuse for both the cache key and drawing.
@@ -541,3 +647,12 @@ class MiniMapView(TextView):
                 self._cached_terrain_texture, self.x, self.y, self.width, self.height
             )
         super().present(graphics, alpha)
+
+
+def _merge_rects(a: TileRect | None, b: TileRect) -> list[TileRect]:
+    """Return ``a`` and ``b``, merged into their bounding box if they overlap."""
+    if a is None or a == b:
+        return [b]
+    if a[0] < b[2] and b[0] < a[2] and a[1] < b[3] and b[1] < a[3]:
+        return [(min(a[0], b[0]), min(a[1], b[1]), max(a[2], b[2]), max(a[3], b[3]))]
+    return [a, b]
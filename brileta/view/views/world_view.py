@@ -8,8 +8,12 @@ import numpy as np
 
 from brileta import colors, config
 from brileta.environment import tile_types
+from brileta.environment.edge_transitions import (
+    CARDINAL_DIRECTIONS,
+    fill_edge_transitions,
+    gather_edge_transitions,
+)
 from brileta.types import (
-    Direction,
     InterpolationAlpha,
     Opacity,
     PixelCoord,
@@ -18,9 +22,10 @@ from brileta.types import (
     saturate,
 )
 from brileta.util import rng
+from brileta.util._native import tile_animation_walk
 from brileta.util.caching import ResourceCache
 from brileta.util.coordinates import Rect
-from brileta.util.glyph_buffer import GlyphBuffer
+from brileta.util.glyph_buffer import GLYPH_DTYPE, GlyphBuffer
 from brileta.util.live_vars import record_time_live_variable
 from brileta.view.render.actor_renderer import ActorRenderer
 from brileta.view.render.effects.decals import DecalSystem
@@ -54,24 +59,11 @@ _rng = rng.get("effects.animation")
 DEFAULT_VIEWPORT_WIDTH = 80
 DEFAULT_VIEWPORT_HEIGHT = 40  # Initial height before layout adjustments
 
-# Cardinal boundary directions only (W, N, S, E). Organic edge blending uses
-# corner rounding in the shader, so diagonals are not transported separately.
-_EDGE_BLEND_CARDINAL_DIRECTIONS: tuple[Direction, ...] = (
-    (-1, 0),
-    (0, -1),
-    (0, 1),
-    (1, 0),
-)
-
 _ROOF_TILE_IDS: tuple[int, ...] = (
     int(tile_types.TileTypeID.ROOF_THATCH),
     int(tile_types.TileTypeID.ROOF_SHINGLE),
     int(tile_types.TileTypeID.ROOF_TIN),
 )
-_EDGE_BLEND_HARD_EDGE_NEIGHBOR_TILE_IDS: tuple[int, ...] = (
-    int(tile_types.TileTypeID.WALL),
-    *_ROOF_TILE_IDS,
-)
 
 
 def _adjust_color_brightness(
@@ -174,6 +166,123 @@ class _RoofStamp:
     split_noise_pattern: np.ndarray  # (w, ext_h) uint8
     # Packed weathering data for the fragment shader (material|condition|edge).
     wear_pack: np.ndarray  # (w, ext_h) uint32
+    # Sun-dependent ridge shading, applied when the stamp is blitted so the
+    # cached visuals survive the sun moving (see _roof_ridge_brightness).
+    ridge_mode: np.ndarray  # (w, ext_h) uint8 _RIDGE_* target
+    ridge_sign: np.ndarray  # (w, ext_h) int8 side of the ridge line
+    ridge_peak_sun: np.ndarray  # (w, ext_h) int8 peak on the sunlit side
+    ridge_peak_shade: np.ndarray  # (w, ext_h) int8 peak on the shaded side
+    eave_offset: np.ndarray  # (w, ext_h) int16 darkening applied after ridge
+
+
+# Where a roof stamp cell's ridge shading lands: nowhere, on its primary
+# colors, or on its split colors (the roof visible below a chimney body).
+_RIDGE_NONE = np.uint8(0)
+_RIDGE_PRIMARY = np.uint8(1)
+_RIDGE_SPLIT = np.uint8(2)
+
+
+def _roof_ridge_brightness(
+    ridge_horizontal: np.ndarray,
+    ridge_sign: np.ndarray,
+    peak_sun: np.ndarray,
+    peak_shade: np.ndarray,
+    sun_dx: float,
+    sun_dy: float,
+) -> np.ndarray:
+    """Return the (N, 1) int16 ridge brightness offsets for the given sun.
+
+    Horizontal ridges are shaded by the sun's y component, vertical ridges
+    by its x component; cells on the side the sun faces take the sunlit peak.
+    """
+    sun_component = np.where(ridge_horizontal, sun_dy, sun_dx)
+    is_sun_side = (ridge_sign * sun_component) > 0
+    peak = np.where(is_sun_side, peak_sun, peak_shade)
+    return np.round(peak * np.abs(sun_component)).astype(np.int16)[:, np.newaxis]
+
+
+@dataclass(slots=True)
+class _RoofLayer:
+    """Every building's roof stamp flattened into one world-space lookup.
+
+    Built once per building set; substitution then gathers cells through
+    ``cell_index`` and masks out the player's building by owner ID, so
+    entering or leaving a building never restamps anything. Per-cell arrays
+    mirror the _RoofStamp fields. Where stamps overlap the later building
+    wins, and ``stacks`` keeps the covered entries for when it is hidden.
+    """
+
+    origin_x: int
+    origin_y: int
+    cell_index: np.ndarray  # (w, h) int32 entry index, -1 = no roof
+    owner: np.ndarray  # (n,) int32 building ID
+    ridge_horizontal: np.ndarray  # (n,) bool
+    tile_ids: np.ndarray
+    chars: np.ndarray
+    fg_rgb: np.ndarray
+    bg_rgb: np.ndarray
+    noise_pattern: np.ndarray
+    noise_pattern_mask: np.ndarray
+    split_y: np.ndarray
+    split_bg: np.ndarray
+    split_fg: np.ndarray
+    split_noise: np.ndarray
+    split_noise_pattern: np.ndarray
+    wear_pack: np.ndarray
+    ridge_mode: np.ndarray
+    ridge_sign: np.ndarray
+    ridge_peak_sun: np.ndarray
+    ridge_peak_shade: np.ndarray
+    eave_offset: np.ndarray
+    # Layer-local (x, y) -> entry indices in stamping order, overlaps only.
+    stacks: dict[tuple[int, int], list[int]]
+    stacked_owners: frozenset[int]
+
+
+def _empty_roof_stamp_cells() -> _RoofStamp:
+    """Return a zero-cell stamp, used for the per-cell arrays of an empty layer."""
+    return _RoofStamp(
+        chars=np.zeros(0, dtype=np.int32),
+        fg_rgb=np.zeros((0, 3), dtype=np.uint8),
+        bg_rgb=np.zeros((0, 3), dtype=np.uint8),
+        tile_ids=np.zeros(0, dtype=np.int32),
+        draw_mask=np.zeros(0, dtype=np.bool_),
+        north_overhang=0,
+        noise_pattern=np.zeros(0, dtype=np.uint8),
+        noise_pattern_mask=np.zeros(0, dtype=np.bool_),
+        split_y=np.zeros(0, dtype=np.float32),
+        split_bg=np.zeros((0, 4), dtype=np.uint8),
+        split_fg=np.zeros((0, 4), dtype=np.uint8),
+        split_noise=np.zeros(0, dtype=np.float32),
+        split_noise_pattern=np.zeros(0, dtype=np.uint8),
+        wear_pack=np.zeros(0, dtype=np.uint32),
+        ridge_mode=np.zeros(0, dtype=np.uint8),
+        ridge_sign=np.zeros(0, dtype=np.int8),
+        ridge_peak_sun=np.zeros(0, dtype=np.int8),
+        ridge_peak_shade=np.zeros(0, dtype=np.int8),
+        eave_offset=np.zeros(0, dtype=np.int16),
+    )
+
+
+_ROOF_STAMP_CELL_FIELDS = (
+    "tile_ids",
+    "chars",
+    "fg_rgb",
+    "bg_rgb",
+    "noise_pattern",
+    "noise_pattern_mask",
+    "split_y",
+    "split_bg",
+    "split_fg",
+    "split_noise",
+    "split_noise_pattern",
+    "wear_pack",
+    "ridge_mode",
+    "ridge_sign",
+    "ridge_peak_sun",
+    "ridge_peak_shade",
+    "eave_offset",
+)
 
 
 @dataclass(slots=True)
@@ -206,128 +315,222 @@ class _LightBufferCache:
     explored_mask: np.ndarray | None = None
 
 
-def _shift_boundary_valid_mask(shape: tuple[int, int], dx: int, dy: int) -> np.ndarray:
-    """Build a boolean mask marking cells whose ``(dx, dy)`` neighbor is in bounds.
+class _TerrainChunkCache:
+    """World-space cache of the camera-independent unlit terrain cells.
 
-    After ``np.roll(arr, shift=(-dx, -dy), axis=(0, 1))``, the rolled array
-    wraps around at the edges.  This mask is ``False`` for cells whose shifted
-    neighbor originated from the opposite edge (i.e. is not a true neighbor).
-    """
-    mask = np.ones(shape, dtype=np.bool_)
-    if dx < 0:
-        mask[:-dx, :] = False
-    elif dx > 0:
-        mask[-dx:, :] = False
-    if dy < 0:
-        mask[:, :-dy] = False
-    elif dy > 0:
-        mask[:, -dy:] = False
-    return mask
-
-
-def _compute_tile_edge_transition_metadata(
-    tile_id_window: np.ndarray,
-    edge_blend_window: np.ndarray,
-    drawn_mask_window: np.ndarray,
-    bg_rgb_window: np.ndarray,
-) -> tuple[np.ndarray, np.ndarray]:
-    """Compute neighbor masks/colors for organic tile edge transitions.
-
-    The inputs are buffer-aligned windows in glyph-buffer tile coordinates:
-    `tile_id_window[x, y]`, `edge_blend_window[x, y]`, `drawn_mask_window[x, y]`,
-    and `bg_rgb_window[x, y, rgb]`.
-    The returned mask uses `_EDGE_BLEND_CARDINAL_DIRECTIONS` bit ordering.
-    """
-    edge_neighbor_mask = np.zeros(tile_id_window.shape, dtype=np.uint8)
-    edge_neighbor_bg = np.zeros(
-        (*tile_id_window.shape, len(_EDGE_BLEND_CARDINAL_DIRECTIONS), 3), dtype=np.uint8
-    )
+    A tile's unlit cell (dark appearance, decoration, sub-tile noise and edge
+    transition metadata) depends only on the tile, its explored state, the
+    decoration seed, the LOD level and its four neighbours - never on the
+    camera. Cells are built once per ``chunk_size`` square of world tiles into
+    a map-sized ``GLYPH_DTYPE`` array, so scrolling the view is a slice copy
+    out of that array instead of a regather of the whole padded viewport.
 
-    for bit_index, (dx, dy) in enumerate(_EDGE_BLEND_CARDINAL_DIRECTIONS):
-        shifted_ids = np.roll(tile_id_window, shift=(-dx, -dy), axis=(0, 1))
-        shifted_edge_blend = np.roll(edge_blend_window, shift=(-dx, -dy), axis=(0, 1))
-        shifted_drawn = np.roll(drawn_mask_window, shift=(-dx, -dy), axis=(0, 1))
-        shifted_bg = np.roll(bg_rgb_window, shift=(-dx, -dy), axis=(0, 1))
+    Edge transitions are gathered from the map's precomputed per-tile
+    metadata (``GameMap.get_edge_transition_maps``), so they see real world
+    neighbours across chunk and viewport edges alike.
 
-        valid_neighbor = _shift_boundary_valid_mask(tile_id_window.shape, dx, dy)
+    A change to map size, decoration seed or LOD drops every chunk. Tile
+    changes reported through ``tiles_changed_since``, region rewrites reported
+    through ``appearance_changed_since`` and exploration changes only rebuild
+    the chunks around the changed tiles.
+    """
 
-        # One-sided ownership prevents both tiles from cutting into each other.
-        # The tile with the higher edge_blend value owns the boundary so organic
-        # tiles feather into rigid ones regardless of enum ID ordering. When the
-        # blend values tie, the lower tile type ID wins for determinism.
-        owns_boundary = (edge_blend_window > shifted_edge_blend) | (
-            (edge_blend_window == shifted_edge_blend) & (tile_id_window < shifted_ids)
+    def __init__(self, chunk_size: int) -> None:
+        self.chunk_size = chunk_size
+        self.cells = np.zeros((0, 0), dtype=GLYPH_DTYPE)
+        self.chunks_built = 0
+        self._built = np.zeros((0, 0), dtype=np.bool_)
+        self._explored = np.zeros((0, 0), dtype=np.bool_)
+        self._key: tuple[object, ...] | None = None
+        self._structural_revision = 0
+        self._appearance_revision = 0
+        self._lod_detail = False
+
+    def sync(self, game_map: Any, lod_detail: bool) -> None:
+        """Drop chunks whose cells no longer match the map."""
+        key = (
+            int(game_map.width),
+            int(game_map.height),
+            int(game_map.decoration_seed),
+            lod_detail,
         )
-        different_neighbor_mask = (
-            drawn_mask_window
-            & shifted_drawn
-            & valid_neighbor
-            & (shifted_ids != tile_id_window)
-            & owns_boundary
+        revision = int(getattr(game_map, "structural_revision", 0))
+        appearance_revision = int(getattr(game_map, "appearance_revision", 0))
+        if key == self._key and self._catch_up(game_map, revision, appearance_revision):
+            return
+
+        self._key = key
+        self._structural_revision = revision
+        self._appearance_revision = appearance_revision
+        self._lod_detail = lod_detail
+        width, height = int(game_map.width), int(game_map.height)
+        size = self.chunk_size
+        self.cells = np.zeros((width, height), dtype=GLYPH_DTYPE)
+        self.cells["ch"] = ord(" ")
+        self._built = np.zeros((-(-width // size), -(-height // size)), dtype=np.bool_)
+        self._explored = np.zeros((width, height), dtype=np.bool_)
+
+    def _catch_up(self, game_map: Any, revision: int, appearance_revision: int) -> bool:
+        """Stale the chunks the map reports as changed since the last sync.
+
+        Returns False when the map can't say what changed, in which case the
+        caller drops every chunk.
+        """
+        if revision != self._structural_revision:
+            changed = None
+            if hasattr(game_map, "tiles_changed_since"):
+                changed = game_map.tiles_changed_since(self._structural_revision)
+            if changed is None:
+                return False
+            self._structural_revision = revision
+            if changed:
+                xs, ys = np.array(changed, dtype=np.intp).T
+                self._mark_stale_around(xs, ys)
+
+        if appearance_revision != self._appearance_revision:
+            rects = None
+            if hasattr(game_map, "appearance_changed_since"):
+                rects = game_map.appearance_changed_since(self._appearance_revision)
+            if rects is None:
+                return False
+            self._appearance_revision = appearance_revision
+            size = self.chunk_size
+            for rect in rects:
+                # Neighbours' edge colours read the rect's tiles: add a halo.
+                cx1, cy1 = max(0, rect.x1 - 1) // size, max(0, rect.y1 - 1) // size
+                self._built[cx1 : rect.x2 // size + 1, cy1 : rect.y2 // size + 1] = (
+                    False
+                )
+        return True
+
+    def blit(
+        self, game_map: Any, dest: np.ndarray, origin_x: int, origin_y: int
+    ) -> tuple[slice, slice] | None:
+        """Copy the cells under a ``dest``-sized window at the given world origin.
+
+        Builds any stale chunk the window touches first. Returns the slices of
+        ``dest`` that were written, or None when the window misses the map.
+        """
+        width, height = self.cells.shape
+        x1 = max(0, origin_x)
+        y1 = max(0, origin_y)
+        x2 = min(width, origin_x + dest.shape[0])
+        y2 = min(height, origin_y + dest.shape[1])
+        if x1 >= x2 or y1 >= y2:
+            return None
+
+        self._invalidate_explored_changes(game_map, x1, y1, x2, y2)
+        size = self.chunk_size
+        for cx in range(x1 // size, (x2 - 1) // size + 1):
+            for cy in range(y1 // size, (y2 - 1) // size + 1):
+                if not self._built[cx, cy]:
+                    self._build_chunk(game_map, cx, cy)
+
+        dest_slices = (
+            slice(x1 - origin_x, x2 - origin_x),
+            slice(y1 - origin_y, y2 - origin_y),
         )
-        if not np.any(different_neighbor_mask):
-            continue
+        dest[dest_slices] = self.cells[x1:x2, y1:y2]
+        return dest_slices
 
-        edge_neighbor_mask[different_neighbor_mask] |= np.uint8(1 << bit_index)
-        color_slice = edge_neighbor_bg[:, :, bit_index, :]
-        color_slice[different_neighbor_mask] = shifted_bg[different_neighbor_mask]
+    def _invalidate_explored_changes(
+        self, game_map: Any, x1: int, y1: int, x2: int, y2: int
+    ) -> None:
+        """Mark chunks stale where exploration changed in or around a window.
 
-    return edge_neighbor_mask, edge_neighbor_bg
+        Compares the window plus a one-tile halo against the explored snapshot
+        the chunks were built from.
+        """
+        width, height = self.cells.shape
+        hx1, hy1 = max(0, x1 - 1), max(0, y1 - 1)
+        hx2, hy2 = min(width, x2 + 1), min(height, y2 + 1)
+        explored = game_map.explored[hx1:hx2, hy1:hy2]
+        snapshot = self._explored[hx1:hx2, hy1:hy2]
+        changed_x, changed_y = np.nonzero(explored != snapshot)
+        if len(changed_x) == 0:
+            return
+        snapshot[...] = explored
+        self._mark_stale_around(changed_x + hx1, changed_y + hy1)
+
+    def _mark_stale_around(self, xs: np.ndarray, ys: np.ndarray) -> None:
+        """Stale the chunks of changed tiles and of their cardinal neighbours."""
+        width, height = self.cells.shape
+        size = self.chunk_size
+        for dx, dy in ((0, 0), *CARDINAL_DIRECTIONS):
+            nx = xs + dx
+            ny = ys + dy
+            valid = (nx >= 0) & (nx < width) & (ny >= 0) & (ny < height)
+            self._built[nx[valid] // size, ny[valid] // size] = False
+
+    def _build_chunk(self, game_map: Any, cx: int, cy: int) -> None:
+        """Rebuild one chunk's cells from the map."""
+        width, height = self.cells.shape
+        size = self.chunk_size
+        x1, y1 = cx * size, cy * size
+        x2, y2 = min(width, x1 + size), min(height, y1 + size)
+
+        self._built[cx, cy] = True
+        self.chunks_built += 1
+        cells = self.cells[x1:x2, y1:y2]
+        cells[...] = np.zeros((), dtype=GLYPH_DTYPE)
+        cells["ch"] = ord(" ")
+
+        # Edge masks depend on the explored state one tile beyond the chunk.
+        hx1, hy1 = max(0, x1 - 1), max(0, y1 - 1)
+        hx2, hy2 = min(width, x2 + 1), min(height, y2 + 1)
+        self._explored[hx1:hx2, hy1:hy2] = game_map.explored[hx1:hx2, hy1:hy2]
+        local_x, local_y = np.nonzero(game_map.explored[x1:x2, y1:y2])
+        if len(local_x) == 0:
+            return
+        world_x = local_x + x1
+        world_y = local_y + y1
 
+        dark_app = game_map.dark_appearance_map[world_x, world_y]
+        chars = dark_app["ch"]
+        fg_rgb = dark_app["fg"]
+        bg_rgb = dark_app["bg"]
+        tile_ids = game_map.tiles[world_x, world_y]
+        if self._lod_detail:
+            tile_types.apply_terrain_decoration(
+                chars,
+                fg_rgb,
+                bg_rgb,
+                tile_ids,
+                world_x,
+                world_y,
+                game_map.decoration_seed,
+            )
 
-def _suppress_edge_blend_toward_hard_edges(
-    edge_neighbor_mask: np.ndarray, tile_id_window: np.ndarray
-) -> None:
-    """Clear edge-blend mask bits that point at architectural hard-edge tiles.
+        cells["ch"][local_x, local_y] = chars
+        cells["fg"][local_x, local_y, :3] = fg_rgb
+        cells["fg"][local_x, local_y, 3] = 255
+        cells["bg"][local_x, local_y, :3] = bg_rgb
+        cells["bg"][local_x, local_y, 3] = 255
+        # Edge transitions create organic feathering between terrain types.
+        # At low zoom, tiles are too small for the blending to be visible.
+        fields = ["sub_tile_jitter", "sub_tile_pattern"]
+        if self._lod_detail:
+            fields.append("edge_blend")
+        props = tile_types.build_tile_property_maps(
+            game_map.tiles[x1:x2, y1:y2], fields
+        )
+        cells["noise"][local_x, local_y] = props["sub_tile_jitter"][local_x, local_y]
+        cells["noise_pattern"][local_x, local_y] = props["sub_tile_pattern"][
+            local_x, local_y
+        ]
+        if not self._lod_detail:
+            return
 
-    Organic terrain should feather into other natural terrain, but not into
-    building surfaces like walls/roofs. Those boundaries should stay crisp.
-    """
-    if not np.any(edge_neighbor_mask):
-        return
-
-    hard_edge_tiles = np.isin(tile_id_window, _EDGE_BLEND_HARD_EDGE_NEIGHBOR_TILE_IDS)
-    if not np.any(hard_edge_tiles):
-        return
-    source_is_hard_edge = hard_edge_tiles
-
-    for bit_index, (dx, dy) in enumerate(_EDGE_BLEND_CARDINAL_DIRECTIONS):
-        shifted_hard_edges = np.roll(hard_edge_tiles, shift=(-dx, -dy), axis=(0, 1))
-
-        valid_neighbor = _shift_boundary_valid_mask(tile_id_window.shape, dx, dy)
-
-        direction_bit = np.uint8(1 << bit_index)
-        mask_points_to_hard_edge = (
-            valid_neighbor
-            & ~source_is_hard_edge
-            & shifted_hard_edges
-            & ((edge_neighbor_mask & direction_bit) != 0)
-        )
-        if not np.any(mask_points_to_hard_edge):
-            continue
-
-        edge_neighbor_mask[mask_points_to_hard_edge] &= np.uint8(0xFF ^ direction_bit)
-
-
-def _override_edge_neighbor_bg_with_self_darken(
-    edge_neighbor_bg: np.ndarray,
-    tile_id_window: np.ndarray,
-    bg_rgb_window: np.ndarray,
-) -> None:
-    """Replace edge blend target colors with a darkened self color when configured."""
-    edge_self_darken = tile_types.get_edge_self_darken_map(tile_id_window)
-    self_darken_mask = edge_self_darken > 0
-    if not np.any(self_darken_mask):
-        return
-
-    # Signed cast so negation produces a proper negative offset.
-    darken_amount = edge_self_darken[self_darken_mask].astype(np.int16)[:, np.newaxis]
-    darkened_bg = _adjust_color_brightness(
-        bg_rgb_window[self_darken_mask], -darken_amount
-    )
-    # Write every cardinal slot so the shader always darkens toward self-color
-    # for these materials, regardless of actual neighbor type.
-    edge_neighbor_bg[self_darken_mask] = darkened_bg[:, np.newaxis, :]
+        cells["edge_blend"][local_x, local_y] = props["edge_blend"][local_x, local_y]
+        edge_neighbor_mask, edge_neighbor_bg = gather_edge_transitions(
+            game_map.get_edge_transition_maps(is_light=False),
+            game_map.tiles,
+            game_map.explored,
+            world_x,
+            world_y,
+        )
+        cells["edge_neighbor_mask"][local_x, local_y] = edge_neighbor_mask
+        cells["edge_neighbor_bg"][local_x, local_y] = edge_neighbor_bg
 
 
 class WorldView(View):
@@ -338,6 +541,9 @@ class WorldView(View):
     # fractional amount. The padding ensures there's always content to show at edges.
     _SCROLL_PADDING: int = 1
 
+    # Largest per-channel change a tile animation step can apply (values are 0-1000).
+    _TILE_ANIM_STEP: int = 80
+
     def __init__(
         self,
         controller: Controller,
@@ -363,14 +569,19 @@ class WorldView(View):
         # Light source buffer cache: skip full rebuild when viewport and exploration
         # haven't changed since the last frame.
         self._map_unlit_buffer_cache_key: tuple[object, ...] | None = None
+        self._terrain_chunks = _TerrainChunkCache(config.MAP_TERRAIN_CHUNK_SIZE)
         self._light_cache = _LightBufferCache()
         # Persistent visible mask buffer to avoid per-frame allocation.
         self._visible_mask_buffer: np.ndarray | None = None
         self._roof_state_cache_key: tuple[object, ...] | None = None
         self._roof_state_cache_value: tuple[int | None, list[Building]] | None = None
-        self._roof_stamp_cache: dict[
-            tuple[int, bool], tuple[tuple[object, ...], _RoofStamp]
-        ] = {}
+        # Bumps when the player's building or the set of viewport buildings
+        # changes, so cache keys need not carry per-building identity tuples.
+        self._roof_state_revision = 0
+        self._roof_state_signature: tuple[object, ...] | None = None
+        self._map_unlit_debug_hash_key: tuple[object, ...] | None = None
+        # World-space roof layers keyed by is_light, with their build key.
+        self._roof_layers: dict[bool, tuple[tuple[object, ...], _RoofLayer]] = {}
         self.effect_library = EffectLibrary()
         self.floating_text_manager = FloatingTextManager()
         self.indicator_renderer = IndicatorRenderer()
@@ -405,7 +616,7 @@ class WorldView(View):
         )
         # Cumulative game time for decal age tracking
         self._game_time: float = 0.0
-        # Numpy RNG for vectorized tile animation random walks.
+        # Seeds the native tile animation random walk each frame.
         self._tile_anim_rng = np.random.default_rng()
         # Lazily rebuilt when GameWorld actor membership changes.
         self._particle_emitter_actors: set[Actor] = set()
@@ -648,7 +859,85 @@ class WorldView(View):
         return hashlib.blake2b(array.tobytes(order="A"), digest_size=16).digest()
 
     def _get_map_unlit_buffer_cache_key(self) -> tuple[object, ...]:
-        """Return a cache key for `_render_map_unlit()` GlyphBuffer contents."""
+        """Return a cache key for `_render_map_unlit()` GlyphBuffer contents.
+
+        Built from integers only: the explored window is keyed by the map's
+        per-chunk exploration revisions, and roofs by the roof-state and
+        building revisions rather than per-building identity tuples.
+        """
+        gw = self.controller.gw
+        game_map = gw.game_map
+        vs = self.viewport_system
+        pad = self._SCROLL_PADDING
+
+        bounds = vs.viewport.get_world_bounds(vs.camera)
+        world_origin_x = bounds.x1 - vs.offset_x - pad
+        world_origin_y = bounds.y1 - vs.offset_y - pad
+        buf_width = self.map_glyph_buffer.width
+        buf_height = self.map_glyph_buffer.height
+
+        world_x1 = max(0, world_origin_x)
+        world_y1 = max(0, world_origin_y)
+        world_x2 = min(game_map.width, world_origin_x + buf_width)
+        world_y2 = min(game_map.height, world_origin_y + buf_height)
+        explored_revision: object = 0
+        if world_x1 < world_x2 and world_y1 < world_y2:
+            window_revision = getattr(game_map, "explored_window_revision", None)
+            if window_revision is not None:
+                explored_revision = window_revision(
+                    world_x1, world_y1, world_x2, world_y2
+                )
+            else:
+                # Test doubles without chunk revisions fall back to hashing.
+                explored_revision = self._hash_array_view(
+                    game_map.explored[world_x1:world_x2, world_y1:world_y2]
+                )
+
+        # Refreshes the roof-state revision when the player or viewport moved.
+        self._compute_roof_state()
+
+        return (
+            id(self.map_glyph_buffer),
+            buf_width,
+            buf_height,
+            int(world_origin_x),
+            int(world_origin_y),
+            int(game_map.width),
+            int(game_map.height),
+            int(vs.offset_x),
+            int(vs.offset_y),
+            round(float(vs.camera.world_x), 6),
+            round(float(vs.camera.world_y), 6),
+            int(getattr(game_map, "structural_revision", 0)),
+            int(getattr(game_map, "appearance_revision", 0)),
+            int(game_map.decoration_seed),
+            explored_revision,
+            getattr(self, "_roof_state_revision", 0),
+            int(getattr(gw, "buildings_revision", 0)),
+            self._get_sun_direction_cache_key(),
+            self._viewport_zoom >= config.LOD_DETAIL_ZOOM_THRESHOLD,
+        )
+
+    def _verify_map_unlit_buffer_cache_key(self, cache_key: tuple[object, ...]) -> None:
+        """Fail loudly if the revision key would reuse a stale unlit buffer."""
+        hash_key = self._get_map_unlit_buffer_hash_key()
+        if cache_key == self._map_unlit_buffer_cache_key and hash_key != getattr(
+            self, "_map_unlit_debug_hash_key", None
+        ):
+            raise AssertionError(
+                "map unlit cache key unchanged but its hashed inputs changed: "
+                "an explored, roof or building mutation skipped its revision bump"
+            )
+        self._map_unlit_debug_hash_key = hash_key
+
+    def _get_map_unlit_buffer_hash_key(self) -> tuple[object, ...]:
+        """Return a content-hashing cache key for `_render_map_unlit()`.
+
+        Hashes the explored window and keys every viewport building by its
+        identity. Too slow for every frame; with
+        ``config.DEBUG_VERIFY_RENDER_CACHE_KEYS`` it cross-checks the
+        revision-based key from `_get_map_unlit_buffer_cache_key()`.
+        """
         gw = self.controller.gw
         game_map = gw.game_map
         vs = self.viewport_system
@@ -706,9 +995,8 @@ class WorldView(View):
             int(getattr(game_map, "structural_revision", 0)),
             int(game_map.decoration_seed),
             id(game_map.dark_appearance_map),
+            int(getattr(game_map, "appearance_revision", 0)),
             explored_key,
-            getattr(getattr(gw, "player", None), "x", None),
-            getattr(getattr(gw, "player", None), "y", None),
             player_building_id,
             roof_buildings_key,
             self._get_sun_direction_cache_key(),
@@ -760,6 +1048,10 @@ class WorldView(View):
         # so the noise pattern stays anchored to world tiles during scrolling.
         graphics.set_noise_seed(gw.game_map.decoration_seed)
         bounds = vs.get_visible_bounds()
+
+        # Stream actor sprites in around the camera (no-op unless the world
+        # exceeded the sprite atlas budget).
+        self.controller.actor_sprite_manager.update_residency(bounds)
         pad = self._SCROLL_PADDING
         graphics.set_noise_tile_offset(
             bounds.x1 - vs.offset_x - pad,
@@ -1442,6 +1734,7 @@ class WorldView(View):
             player_x,
             player_y,
             getattr(game_map, "structural_revision", 0),
+            getattr(gw, "buildings_revision", 0),
             len(buildings),
         )
         # getattr is deliberate: some test doubles bypass __init__, so
@@ -1500,6 +1793,10 @@ class WorldView(View):
                 viewport_buildings.append(building)
 
         roof_state = (player_building_id, viewport_buildings)
+        signature = (player_building_id, *(id(b) for b in viewport_buildings))
+        if signature != getattr(self, "_roof_state_signature", None):
+            self._roof_state_signature = signature
+            self._roof_state_revision = getattr(self, "_roof_state_revision", 0) + 1
         self._roof_state_cache_key = cache_key
         self._roof_state_cache_value = roof_state
         return roof_state
@@ -1533,16 +1830,14 @@ class WorldView(View):
         *,
         is_light: bool,
         decoration_seed: int,
-        sun_dx: float,
-        sun_dy: float,
     ) -> _RoofStamp:
-        """Build cached perspective-aware roof visuals for a building.
+        """Build perspective-aware roof visuals for a building.
 
         The stamp covers the building footprint extended north by the
         perspective offset (roof overhang region). It precomputes all
         zone visuals - roof surface, wall face, split boundary tiles,
-        chimney - so the per-frame blit in _apply_roof_substitution is
-        just an array copy.
+        chimney - for _build_roof_layer. Ridge shading depends on the sun,
+        so it is recorded per cell rather than baked into the colors.
         """
         fp = building.bounding_rect
         width = int(fp.width)
@@ -1572,6 +1867,11 @@ class WorldView(View):
                 split_noise=np.zeros((width, ext_h), dtype=np.float32),
                 split_noise_pattern=np.zeros((width, ext_h), dtype=np.uint8),
                 wear_pack=np.zeros((width, ext_h), dtype=np.uint32),
+                ridge_mode=np.zeros((width, ext_h), dtype=np.uint8),
+                ridge_sign=np.zeros((width, ext_h), dtype=np.int8),
+                ridge_peak_sun=np.zeros((width, ext_h), dtype=np.int8),
+                ridge_peak_shade=np.zeros((width, ext_h), dtype=np.int8),
+                eave_offset=np.zeros((width, ext_h), dtype=np.int16),
             )
 
         if width <= 0 or ext_h <= 0:
@@ -1589,6 +1889,11 @@ class WorldView(View):
         split_fg_arr = np.zeros((width, ext_h, 4), dtype=np.uint8)
         split_noise_arr = np.zeros((width, ext_h), dtype=np.float32)
         split_noise_pattern_arr = np.zeros((width, ext_h), dtype=np.uint8)
+        ridge_mode_arr = np.zeros((width, ext_h), dtype=np.uint8)
+        ridge_sign_arr = np.zeros((width, ext_h), dtype=np.int8)
+        ridge_peak_sun_arr = np.zeros((width, ext_h), dtype=np.int8)
+        ridge_peak_shade_arr = np.zeros((width, ext_h), dtype=np.int8)
+        eave_offset_arr = np.zeros((width, ext_h), dtype=np.int16)
 
         # World coordinate grids for the extended stamp region.
         x_coords = np.arange(fp.x1, fp.x2, dtype=np.int32)
@@ -1728,8 +2033,9 @@ class WorldView(View):
             fg_rgb[all_roof] = roof_fg
             bg_rgb[all_roof] = roof_bg
 
-        # --- Ridge shading on all roof surfaces ---
+        # --- Ridge shading parameters on all roof surfaces ---
         # Ridge center is shifted north by N tiles to follow the visual roof.
+        # The sun-dependent part is resolved per frame by _roof_ridge_brightness.
         if np.any(all_roof):
             rx = world_x_grid[all_roof]
             ry = world_y_grid[all_roof]
@@ -1737,16 +2043,12 @@ class WorldView(View):
             if building.ridge_axis == "horizontal":
                 shifted_center = (fp.y1 + fp.y2) / 2.0 - N
                 ridge_axis_offset = ry + 0.5 - shifted_center
-                sun_component = sun_dy
             else:
                 center = (fp.x1 + fp.x2) / 2.0
                 ridge_axis_offset = rx + 0.5 - center
-                sun_component = sun_dx
 
             abs_ridge_offset = np.abs(ridge_axis_offset)
             is_ridge = abs_ridge_offset < 0.6
-            is_sun_side = (ridge_axis_offset * sun_component) > 0
-            intensity = abs(sun_component)
             roof_profile = building.roof_profile
 
             # Corrugated tin still has a pitched profile, but its smoother,
@@ -1760,9 +2062,8 @@ class WorldView(View):
                 slope_peak = 18
 
             if roof_profile == "flat":
-                ridge_brightness = np.full(
-                    rx.shape, np.int16(round(2 * intensity)), dtype=np.int16
-                )
+                peak_sun = np.full(rx.shape, 2, dtype=np.int8)
+                peak_shade = peak_sun
             elif roof_profile == "low_slope":
                 short_axis_span = (
                     int(fp.height)
@@ -1777,33 +2078,15 @@ class WorldView(View):
                 # stable per-tile brightness offsets.
                 low_slope_peak = max(4, round(slope_peak * 0.6))
                 flat_peak = max(1, round(ridge_peak * 0.5))
-                ridge_brightness = np.where(
-                    in_flat_section,
-                    np.int16(round(flat_peak * intensity)),
-                    np.where(
-                        is_sun_side,
-                        np.int16(round(low_slope_peak * intensity)),
-                        np.int16(round(-low_slope_peak * intensity)),
-                    ),
-                )
+                peak_sun = np.where(in_flat_section, flat_peak, low_slope_peak)
+                peak_shade = np.where(in_flat_section, flat_peak, -low_slope_peak)
             else:
-                ridge_brightness = np.where(
-                    is_ridge,
-                    np.int16(round(ridge_peak * intensity)),
-                    np.where(
-                        is_sun_side,
-                        np.int16(round(slope_peak * intensity)),
-                        np.int16(round(-slope_peak * intensity)),
-                    ),
-                )
+                peak_sun = np.where(is_ridge, ridge_peak, slope_peak)
+                peak_shade = np.where(is_ridge, ridge_peak, -slope_peak)
 
-            ridge_brightness_offset = ridge_brightness[:, np.newaxis]
-            bg_rgb[all_roof] = _adjust_color_brightness(
-                bg_rgb[all_roof], ridge_brightness_offset
-            )
-            fg_rgb[all_roof] = _adjust_color_brightness(
-                fg_rgb[all_roof], ridge_brightness_offset
-            )
+            ridge_sign_arr[all_roof] = np.sign(ridge_axis_offset)
+            ridge_peak_sun_arr[all_roof] = peak_sun
+            ridge_peak_shade_arr[all_roof] = peak_shade
 
         # --- Eave darkening on shifted roof perimeter ---
         # The visual roof spans from the first full roof row to the south
@@ -1825,17 +2108,11 @@ class WorldView(View):
         perimeter_mask = visual_roof & ~(
             west_neighbor & east_neighbor & north_neighbor & south_neighbor
         )
-        if np.any(perimeter_mask):
-            bg_rgb[perimeter_mask] = _adjust_color_brightness(
-                bg_rgb[perimeter_mask], -6
-            )
+        eave_offset_arr[perimeter_mask] -= 6
 
         # Strong darkening on south edge where roof meets wall face.
         south_roof_edge = visual_roof & ~south_neighbor
-        if np.any(south_roof_edge):
-            bg_rgb[south_roof_edge] = _adjust_color_brightness(
-                bg_rgb[south_roof_edge], -10
-            )
+        eave_offset_arr[south_roof_edge] -= 10
 
         neighbor_count = (
             west_neighbor.astype(np.int8)
@@ -1844,8 +2121,7 @@ class WorldView(View):
             + south_neighbor.astype(np.int8)
         )
         corner_mask = visual_roof & (neighbor_count <= 2)
-        if np.any(corner_mask):
-            bg_rgb[corner_mask] = _adjust_color_brightness(bg_rgb[corner_mask], -4)
+        eave_offset_arr[corner_mask] -= 4
 
         # --- Eave shadow color (shared by wall face and south split) ---
         eave_bg = np.asarray(
@@ -1888,6 +2164,9 @@ class WorldView(View):
                 bg_rgb[wall_and_edge] = darkened
                 fg_rgb[wall_and_edge] = darkened
 
+        # Wall faces replace the roof colors outright, so they take no ridge.
+        ridge_mode_arr[all_roof & ~wall_mask] = _RIDGE_PRIMARY
+
         # --- South split: primary=roof (above threshold), split=eave shadow ---
         # The wall portion right under the roof is the darkest part (eave
         # shadow), selling the roof-wall depth separation.
@@ -1935,9 +2214,12 @@ class WorldView(View):
                     and not south_split_mask[lx, body_ly]
                 )
                 if body_on_roof:
-                    # Save existing roof colors for the lower (roof) portion.
+                    # Save existing roof colors for the lower (roof) portion;
+                    # the ridge shading moves with them.
                     saved_bg = bg_rgb[lx, body_ly].copy()
                     saved_fg = fg_rgb[lx, body_ly].copy()
+                    if ridge_mode_arr[lx, body_ly] == _RIDGE_PRIMARY:
+                        ridge_mode_arr[lx, body_ly] = _RIDGE_SPLIT
 
                     # Primary = chimney body (above split threshold).
                     # Use matching fg/bg so the glyph is invisible - the
@@ -2009,6 +2291,11 @@ class WorldView(View):
             split_noise_arr,
             split_noise_pattern_arr,
             wear_pack_arr,
+            ridge_mode_arr,
+            ridge_sign_arr,
+            ridge_peak_sun_arr,
+            ridge_peak_shade_arr,
+            eave_offset_arr,
         )
 
     def _render_chimney_shadows(
@@ -2238,38 +2525,99 @@ class WorldView(View):
                     tile_bg=body_stone,
                 )
 
-    def _get_cached_roof_stamp(
-        self,
-        building: Building,
-        *,
-        is_light: bool,
-        decoration_seed: int,
-        sun_dx: float,
-        sun_dy: float,
-        sun_direction_key: tuple[float, float] | None,
-    ) -> _RoofStamp:
-        """Return a cached roof stamp, rebuilding when inputs changed."""
+    def _build_roof_layer(
+        self, buildings: list[Building], *, is_light: bool, decoration_seed: int
+    ) -> _RoofLayer:
+        """Stamp every building's roof into one world-space layer."""
+        stamps: list[tuple[Building, _RoofStamp, np.ndarray, np.ndarray]] = []
+        for building in buildings:
+            stamp = self._build_roof_stamp(
+                building, is_light=is_light, decoration_seed=decoration_seed
+            )
+            local_x, local_y = np.nonzero(stamp.draw_mask)
+            if len(local_x) > 0:
+                stamps.append((building, stamp, local_x, local_y))
+
+        if not stamps:
+            origin_x = origin_y = 0
+            cell_index = np.full((0, 0), -1, dtype=np.int32)
+        else:
+            origin_x = min(int(b.bounding_rect.x1) for b, *_ in stamps)
+            origin_y = min(
+                int(b.bounding_rect.y1) - st.north_overhang for b, st, *_ in stamps
+            )
+            extent_x = max(int(b.bounding_rect.x2) for b, *_ in stamps)
+            extent_y = max(int(b.bounding_rect.y2) for b, *_ in stamps)
+            cell_index = np.full(
+                (extent_x - origin_x, extent_y - origin_y), -1, dtype=np.int32
+            )
+
+        fields: dict[str, list[np.ndarray]] = {f: [] for f in _ROOF_STAMP_CELL_FIELDS}
+        owners: list[np.ndarray] = []
+        ridge_horizontal: list[np.ndarray] = []
+        stacks: dict[tuple[int, int], list[int]] = {}
+        entry_count = 0
+        for building, stamp, local_x, local_y in stamps:
+            fp = building.bounding_rect
+            cell_x = local_x + (int(fp.x1) - origin_x)
+            cell_y = local_y + (int(fp.y1) - stamp.north_overhang - origin_y)
+            entries = np.arange(entry_count, entry_count + len(local_x), dtype=np.int32)
+
+            covered = cell_index[cell_x, cell_y]
+            for i in np.nonzero(covered >= 0)[0]:
+                key = (int(cell_x[i]), int(cell_y[i]))
+                stacks.setdefault(key, [int(covered[i])]).append(int(entries[i]))
+            cell_index[cell_x, cell_y] = entries
+
+            for name, values in fields.items():
+                values.append(getattr(stamp, name)[local_x, local_y])
+            owners.append(np.full(len(local_x), int(building.id), dtype=np.int32))
+            ridge_horizontal.append(
+                np.full(len(local_x), building.ridge_axis == "horizontal")
+            )
+            entry_count += len(local_x)
+
+        empty = _empty_roof_stamp_cells()
+        cells = {
+            name: np.concatenate(values) if values else getattr(empty, name)
+            for name, values in fields.items()
+        }
+        owner = np.concatenate(owners) if owners else np.zeros(0, dtype=np.int32)
+        stacked_owners = frozenset(int(owner[e[-1]]) for e in stacks.values())
+        return _RoofLayer(
+            origin_x=origin_x,
+            origin_y=origin_y,
+            cell_index=cell_index,
+            owner=owner,
+            ridge_horizontal=(
+                np.concatenate(ridge_horizontal)
+                if ridge_horizontal
+                else np.zeros(0, dtype=np.bool_)
+            ),
+            stacks=stacks,
+            stacked_owners=stacked_owners,
+            **cells,
+        )
+
+    def _get_roof_layer(self, *, is_light: bool, decoration_seed: int) -> _RoofLayer:
+        """Return the roof layer for the world's buildings, building it once."""
+        gw = self.controller.gw
+        buildings = gw.buildings
         cache_key = (
-            *self._building_identity_key(building),
-            bool(is_light),
+            id(buildings),
+            len(buildings),
+            gw.buildings_revision,
             int(decoration_seed),
-            sun_direction_key,
         )
 
-        cache_slot = (int(building.id), bool(is_light))
-        cached = self._roof_stamp_cache.get(cache_slot)
+        cached = self._roof_layers.get(is_light)
         if cached is not None and cached[0] == cache_key:
             return cached[1]
-
-        stamp = self._build_roof_stamp(
-            building,
-            is_light=is_light,
-            decoration_seed=decoration_seed,
-            sun_dx=sun_dx,
-            sun_dy=sun_dy,
+        layer = self._build_roof_layer(
+            buildings, is_light=is_light, decoration_seed=decoration_seed
         )
-        self._roof_stamp_cache[cache_slot] = (cache_key, stamp)
-        return stamp
+        self._roof_layers[is_light] = (cache_key, layer)
+        return layer
 
     def _apply_roof_substitution(
         self,
@@ -2282,12 +2630,6 @@ class WorldView(View):
         *,
         is_light: bool,
         decoration_seed: int,
-        buf_x: np.ndarray | None = None,
-        buf_y: np.ndarray | None = None,
-        buf_width: int | None = None,
-        buf_height: int | None = None,
-        world_origin_x: int | None = None,
-        world_origin_y: int | None = None,
     ) -> _RoofSubstitutionResult:
         """Overlay virtual roof and wall face visuals for pseudo-3D perspective.
 
@@ -2295,6 +2637,10 @@ class WorldView(View):
         exposing a south-facing wall strip. Boundary tiles use split_y data
         so the fragment shader can render a sub-tile roof/wall boundary.
 
+        Cells are gathered from the precomputed roof layer; the player's
+        building is masked out by owner ID and only ridge shading is
+        evaluated per call, for the current sun direction.
+
         Returns effective tile IDs and optional per-tile split data arrays.
         """
         n = len(tile_ids)
@@ -2306,203 +2652,119 @@ class WorldView(View):
         if not viewport_buildings:
             return no_change
 
-        # Get sun direction for ridge shading across all buildings.
-        directional_light = self._get_directional_light()
-        if directional_light is not None:
-            sun_dx = directional_light.direction.x
-            sun_dy = directional_light.direction.y
-            sun_direction_key = (
-                round(float(sun_dx), 3),
-                round(float(sun_dy), 3),
+        layer = self._get_roof_layer(is_light=is_light, decoration_seed=decoration_seed)
+        layer_w, layer_h = layer.cell_index.shape
+        local_x = world_x - layer.origin_x
+        local_y = world_y - layer.origin_y
+        inside = (local_x >= 0) & (local_x < layer_w) & (local_y >= 0)
+        inside &= local_y < layer_h
+        entries = np.full(n, -1, dtype=np.int32)
+        entries[inside] = layer.cell_index[local_x[inside], local_y[inside]]
+
+        if player_building_id is not None:
+            hidden = entries >= 0
+            hidden[hidden] = layer.owner[entries[hidden]] == player_building_id
+            entries[hidden] = -1
+            if player_building_id in layer.stacked_owners and np.any(hidden):
+                self._uncover_stacked_roof_cells(
+                    layer, player_building_id, entries, hidden, local_x, local_y
+                )
+
+        target = np.nonzero(entries >= 0)[0]
+        if len(target) == 0:
+            return no_change
+        entry = entries[target]
+
+        effective_tile_ids = tile_ids.copy()
+        effective_tile_ids[target] = layer.tile_ids[entry]
+        chars[target] = layer.chars[entry]
+        hit_fg = layer.fg_rgb[entry]
+        hit_bg = layer.bg_rgb[entry]
+        split_bg = layer.split_bg[entry]
+        split_fg = layer.split_fg[entry]
+
+        # Ridge shading for the current sun, then eave darkening on top.
+        ridge_mode = layer.ridge_mode[entry]
+        shaded = np.nonzero(ridge_mode != _RIDGE_NONE)[0]
+        if len(shaded) > 0:
+            directional_light = self._get_directional_light()
+            if directional_light is not None:
+                sun_dx = float(directional_light.direction.x)
+                sun_dy = float(directional_light.direction.y)
+            else:
+                sun_dx, sun_dy = -0.7, -0.7
+            shaded_entry = entry[shaded]
+            ridge = _roof_ridge_brightness(
+                layer.ridge_horizontal[shaded_entry],
+                layer.ridge_sign[shaded_entry],
+                layer.ridge_peak_sun[shaded_entry],
+                layer.ridge_peak_shade[shaded_entry],
+                sun_dx,
+                sun_dy,
             )
-        else:
-            sun_dx, sun_dy = -0.7, -0.7
-            sun_direction_key = None
-
-        direct_indexing_available = (
-            buf_x is not None
-            and buf_y is not None
-            and buf_width is not None
-            and buf_height is not None
-            and world_origin_x is not None
-            and world_origin_y is not None
-            and len(buf_x) == len(tile_ids)
-            and len(buf_y) == len(tile_ids)
-        )
-        buffer_index_lookup: np.ndarray | None = None
-        if direct_indexing_available:
-            assert buf_x is not None
-            assert buf_y is not None
-            assert buf_width is not None
-            assert buf_height is not None
-            buffer_index_lookup = np.full(
-                (int(buf_width), int(buf_height)),
-                -1,
-                dtype=np.int32,
+            eave = layer.eave_offset[shaded_entry][:, np.newaxis]
+            on_split = ridge_mode[shaded] == _RIDGE_SPLIT
+            primary = shaded[~on_split]
+            hit_fg[primary] = _adjust_color_brightness(
+                hit_fg[primary], ridge[~on_split]
             )
-            buffer_index_lookup[buf_x, buf_y] = np.arange(len(tile_ids), dtype=np.int32)
-
-        # Evict cached stamps for buildings no longer in the viewport so the
-        # cache doesn't grow unboundedly over a long session.
-        viewport_building_ids = {b.id for b in viewport_buildings}
-        stale_keys = [
-            k for k in self._roof_stamp_cache if k[0] not in viewport_building_ids
-        ]
-        for k in stale_keys:
-            del self._roof_stamp_cache[k]
+            hit_bg[primary] = _adjust_color_brightness(
+                _adjust_color_brightness(hit_bg[primary], ridge[~on_split]),
+                eave[~on_split],
+            )
+            split = shaded[on_split]
+            split_fg[split, :3] = _adjust_color_brightness(
+                split_fg[split, :3], ridge[on_split]
+            )
+            split_bg[split, :3] = _adjust_color_brightness(
+                _adjust_color_brightness(split_bg[split, :3], ridge[on_split]),
+                eave[on_split],
+            )
+        fg_rgb[target] = hit_fg
+        bg_rgb[target] = hit_bg
 
-        effective_tile_ids: np.ndarray | None = None
-        any_roof_applied = False
-        # Split arrays allocated on first building with fractional offset.
+        # Override sub-tile pattern IDs for roofs that require per-building
+        # orientation (e.g., tin corrugation following roof slope direction).
+        noise_pattern_arr: np.ndarray | None = None
+        noise_pattern_mask_arr: np.ndarray | None = None
+        has_pattern_override = layer.noise_pattern_mask[entry]
+        if np.any(has_pattern_override):
+            noise_pattern_arr = np.zeros(n, dtype=np.uint8)
+            noise_pattern_mask_arr = np.zeros(n, dtype=np.bool_)
+            noise_pattern_arr[target] = layer.noise_pattern[entry]
+            noise_pattern_mask_arr[target] = has_pattern_override
+
+        # Split data for perspective boundary tiles.
         split_y_arr: np.ndarray | None = None
         split_bg_arr: np.ndarray | None = None
         split_fg_arr: np.ndarray | None = None
         split_noise_arr: np.ndarray | None = None
         split_noise_pattern_arr: np.ndarray | None = None
-        noise_pattern_arr: np.ndarray | None = None
-        noise_pattern_mask_arr: np.ndarray | None = None
+        split_y = layer.split_y[entry]
+        has_split = split_y > 0
+        if np.any(has_split):
+            split_target = target[has_split]
+            split_entry = entry[has_split]
+            split_y_arr = np.zeros(n, dtype=np.float32)
+            split_bg_arr = np.zeros((n, 4), dtype=np.uint8)
+            split_fg_arr = np.zeros((n, 4), dtype=np.uint8)
+            split_noise_arr = np.zeros(n, dtype=np.float32)
+            split_noise_pattern_arr = np.zeros(n, dtype=np.uint8)
+            split_y_arr[split_target] = split_y[has_split]
+            split_bg_arr[split_target] = split_bg[has_split]
+            split_fg_arr[split_target] = split_fg[has_split]
+            split_noise_arr[split_target] = layer.split_noise[split_entry]
+            split_noise_pattern_arr[split_target] = layer.split_noise_pattern[
+                split_entry
+            ]
+
+        # Packed weathering data for shader-based weathering.
         wear_pack_arr: np.ndarray | None = None
+        wear_pack = layer.wear_pack[entry]
+        if np.any(wear_pack > 0):
+            wear_pack_arr = np.zeros(n, dtype=np.uint32)
+            wear_pack_arr[target] = wear_pack
 
-        for building in viewport_buildings:
-            if building.id == player_building_id:
-                continue
-
-            stamp = self._get_cached_roof_stamp(
-                building,
-                is_light=is_light,
-                decoration_seed=decoration_seed,
-                sun_dx=float(sun_dx),
-                sun_dy=float(sun_dy),
-                sun_direction_key=sun_direction_key,
-            )
-
-            fp = building.bounding_rect
-            stamp_world_y_start = int(fp.y1) - stamp.north_overhang
-
-            # --- Locate stamp cells in the render arrays ---
-            if direct_indexing_available and buffer_index_lookup is not None:
-                assert buf_width is not None
-                assert buf_height is not None
-                assert world_origin_x is not None
-                assert world_origin_y is not None
-
-                # Map extended stamp world coords to buffer coords.
-                stamp_buf_x1 = int(fp.x1) - int(world_origin_x)
-                stamp_buf_y1 = stamp_world_y_start - int(world_origin_y)
-                stamp_buf_x2 = int(fp.x2) - int(world_origin_x)
-                stamp_buf_y2 = int(fp.y2) - int(world_origin_y)
-
-                # Clip to buffer bounds.
-                clip_x1 = max(0, stamp_buf_x1)
-                clip_y1 = max(0, stamp_buf_y1)
-                clip_x2 = min(int(buf_width), stamp_buf_x2)
-                clip_y2 = min(int(buf_height), stamp_buf_y2)
-                if clip_x1 >= clip_x2 or clip_y1 >= clip_y2:
-                    continue
-
-                # Stamp-local coords for the clipped region.
-                local_x1 = clip_x1 - stamp_buf_x1
-                local_y1 = clip_y1 - stamp_buf_y1
-                local_x2 = local_x1 + (clip_x2 - clip_x1)
-                local_y2 = local_y1 + (clip_y2 - clip_y1)
-
-                stamp_mask_view = stamp.draw_mask[local_x1:local_x2, local_y1:local_y2]
-                if not np.any(stamp_mask_view):
-                    continue
-
-                lookup_view = buffer_index_lookup[clip_x1:clip_x2, clip_y1:clip_y2]
-                visible_stamp_mask = stamp_mask_view & (lookup_view >= 0)
-                if not np.any(visible_stamp_mask):
-                    continue
-
-                hit_local_x, hit_local_y = np.nonzero(visible_stamp_mask)
-                target_indices = lookup_view[hit_local_x, hit_local_y]
-                stamp_x = hit_local_x + local_x1
-                stamp_y = hit_local_y + local_y1
-            else:
-                # Fallback: per-element mask matching against extended bounds.
-                in_stamp = (
-                    (world_x >= int(fp.x1))
-                    & (world_x < int(fp.x2))
-                    & (world_y >= stamp_world_y_start)
-                    & (world_y < int(fp.y2))
-                )
-                if not np.any(in_stamp):
-                    continue
-
-                stamp_indices = np.nonzero(in_stamp)[0]
-                local_x = world_x[stamp_indices] - int(fp.x1)
-                local_y = world_y[stamp_indices] - stamp_world_y_start
-                drawn = stamp.draw_mask[local_x, local_y]
-                if not np.any(drawn):
-                    continue
-
-                target_indices = stamp_indices[drawn]
-                stamp_x = local_x[drawn]
-                stamp_y = local_y[drawn]
-
-            if len(target_indices) == 0:
-                continue
-
-            any_roof_applied = True
-            if effective_tile_ids is None:
-                effective_tile_ids = tile_ids.copy()
-
-            # Blit precomputed stamp visuals into the render arrays.
-            effective_tile_ids[target_indices] = stamp.tile_ids[stamp_x, stamp_y]
-            chars[target_indices] = stamp.chars[stamp_x, stamp_y]
-            fg_rgb[target_indices] = stamp.fg_rgb[stamp_x, stamp_y]
-            bg_rgb[target_indices] = stamp.bg_rgb[stamp_x, stamp_y]
-
-            # Override sub-tile pattern IDs for roofs that require per-building
-            # orientation (e.g., tin corrugation following roof slope direction).
-            has_pattern_override = stamp.noise_pattern_mask[stamp_x, stamp_y]
-            if np.any(has_pattern_override):
-                if noise_pattern_arr is None:
-                    noise_pattern_arr = np.zeros(n, dtype=np.uint8)
-                    noise_pattern_mask_arr = np.zeros(n, dtype=np.bool_)
-                assert noise_pattern_mask_arr is not None
-                override_idx = target_indices[has_pattern_override]
-                ox = stamp_x[has_pattern_override]
-                oy = stamp_y[has_pattern_override]
-                noise_pattern_arr[override_idx] = stamp.noise_pattern[ox, oy]
-                noise_pattern_mask_arr[override_idx] = True
-
-            # Copy split data from stamp for perspective boundary tiles.
-            has_split = stamp.split_y[stamp_x, stamp_y] > 0
-            if np.any(has_split):
-                if split_y_arr is None:
-                    split_y_arr = np.zeros(n, dtype=np.float32)
-                    split_bg_arr = np.zeros((n, 4), dtype=np.uint8)
-                    split_fg_arr = np.zeros((n, 4), dtype=np.uint8)
-                    split_noise_arr = np.zeros(n, dtype=np.float32)
-                    split_noise_pattern_arr = np.zeros(n, dtype=np.uint8)
-
-                assert split_bg_arr is not None
-                assert split_fg_arr is not None
-                assert split_noise_arr is not None
-                assert split_noise_pattern_arr is not None
-                split_idx = target_indices[has_split]
-                sx = stamp_x[has_split]
-                sy = stamp_y[has_split]
-                split_y_arr[split_idx] = stamp.split_y[sx, sy]
-                split_bg_arr[split_idx] = stamp.split_bg[sx, sy]
-                split_fg_arr[split_idx] = stamp.split_fg[sx, sy]
-                split_noise_arr[split_idx] = stamp.split_noise[sx, sy]
-                split_noise_pattern_arr[split_idx] = stamp.split_noise_pattern[sx, sy]
-
-            # Copy wear_pack from stamp for shader-based weathering.
-            has_weather = stamp.wear_pack[stamp_x, stamp_y] > 0
-            if np.any(has_weather):
-                if wear_pack_arr is None:
-                    wear_pack_arr = np.zeros(n, dtype=np.uint32)
-                w_idx = target_indices[has_weather]
-                wx = stamp_x[has_weather]
-                wy = stamp_y[has_weather]
-                wear_pack_arr[w_idx] = stamp.wear_pack[wx, wy]
-
-        if not any_roof_applied or effective_tile_ids is None:
-            return no_change
         return _RoofSubstitutionResult(
             effective_tile_ids,
             noise_pattern_arr,
@@ -2515,6 +2777,25 @@ class WorldView(View):
             wear_pack_arr,
         )
 
+    @staticmethod
+    def _uncover_stacked_roof_cells(
+        layer: _RoofLayer,
+        hidden_building_id: int,
+        entries: np.ndarray,
+        hidden: np.ndarray,
+        local_x: np.ndarray,
+        local_y: np.ndarray,
+    ) -> None:
+        """Show the next roof down where the hidden building's stamp overlapped."""
+        for (cell_x, cell_y), stack in layer.stacks.items():
+            if int(layer.owner[stack[-1]]) != hidden_building_id:
+                continue
+            below = [e for e in stack if int(layer.owner[e]) != hidden_building_id]
+            if not below:
+                continue
+            at_cell = hidden & (local_x == cell_x) & (local_y == cell_y)
+            entries[at_cell] = below[-1]
+
     @record_time_live_variable("time.render.map_unlit_ms")
     def _render_map_unlit(self) -> None:
         """Renders the static, unlit background of the game world.
@@ -2524,7 +2805,9 @@ class WorldView(View):
         between tiles, we offset the rendered texture by the fractional amount,
         and the padding ensures there's always content at the edges.
 
-        Uses vectorized numpy operations for performance.
+        Terrain cells come from the world-space chunk cache, so an integer
+        scroll step is a slice copy; only the camera-dependent roof pass is
+        re-applied on top.
         """
         gw = self.controller.gw
         vs = self.viewport_system
@@ -2532,6 +2815,8 @@ class WorldView(View):
         game_map = gw.game_map
 
         cache_key = self._get_map_unlit_buffer_cache_key()
+        if config.DEBUG_VERIFY_RENDER_CACHE_KEYS:
+            self._verify_map_unlit_buffer_cache_key(cache_key)
         if cache_key == self._map_unlit_buffer_cache_key:
             return
 
@@ -2545,65 +2830,54 @@ class WorldView(View):
         world_origin_x = bounds.x1 - vs.offset_x - pad
         world_origin_y = bounds.y1 - vs.offset_y - pad
 
-        buf_width = self.map_glyph_buffer.width
-        buf_height = self.map_glyph_buffer.height
-
-        # Create coordinate arrays for all buffer positions
-        buf_x_coords = np.arange(buf_width)
-        buf_y_coords = np.arange(buf_height)
-        buf_x_grid, buf_y_grid = np.meshgrid(buf_x_coords, buf_y_coords, indexing="ij")
-
-        # Convert buffer coords to world coords
-        world_x_grid = buf_x_grid + world_origin_x
-        world_y_grid = buf_y_grid + world_origin_y
-
-        # Mask for tiles within map bounds
-        in_bounds_mask = (
-            (world_x_grid >= 0)
-            & (world_x_grid < game_map.width)
-            & (world_y_grid >= 0)
-            & (world_y_grid < game_map.height)
+        lod_detail = self._viewport_zoom >= config.LOD_DETAIL_ZOOM_THRESHOLD
+        self._terrain_chunks.sync(game_map, lod_detail)
+        buf_slices = self._terrain_chunks.blit(
+            game_map, self.map_glyph_buffer.data, world_origin_x, world_origin_y
         )
+        self._map_unlit_buffer_cache_key = cache_key
+        if buf_slices is not None:
+            self._apply_map_unlit_roofs(
+                buf_slices, world_origin_x, world_origin_y, lod_detail
+            )
 
-        # Get the valid world coordinates
-        valid_world_x = world_x_grid[in_bounds_mask]
-        valid_world_y = world_y_grid[in_bounds_mask]
-
-        # Mask for explored tiles (subset of in-bounds)
-        explored_mask = game_map.explored[valid_world_x, valid_world_y]
+    def _apply_map_unlit_roofs(
+        self,
+        buf_slices: tuple[slice, slice],
+        world_origin_x: int,
+        world_origin_y: int,
+        lod_detail: bool,
+    ) -> None:
+        """Overlay roof substitution onto the chunk-assembled unlit buffer.
 
-        if not np.any(explored_mask):
-            self._map_unlit_buffer_cache_key = cache_key
+        Rewrites the explored cells' glyphs, colors and noise with the roof
+        pass output, then refreshes edge transitions only around the tiles the
+        roofs actually changed.
+        """
+        _player_building_id, viewport_buildings = self._compute_roof_state()
+        if not viewport_buildings:
             return
 
-        # Get final coordinates for explored tiles
-        final_world_x = valid_world_x[explored_mask]
-        final_world_y = valid_world_y[explored_mask]
-        final_buf_x = buf_x_grid[in_bounds_mask][explored_mask]
-        final_buf_y = buf_y_grid[in_bounds_mask][explored_mask]
-
-        # Get dark appearance data for all explored tiles at once
-        dark_app = game_map.dark_appearance_map[final_world_x, final_world_y]
-
-        # Extract character codes and colors
-        chars = dark_app["ch"]
-        fg_rgb = dark_app["fg"]  # Shape: (N, 3)
-        bg_rgb = dark_app["bg"]  # Shape: (N, 3)
-
-        # Apply per-tile glyph and color decoration for terrain variety.
-        # At low zoom (below LOD threshold), tiles are too small for glyph
-        # variation and color jitter to be visible - skip the work.
+        game_map = self.controller.gw.game_map
+        buf_x_slice, buf_y_slice = buf_slices
+        explored_window = game_map.explored[
+            buf_x_slice.start + world_origin_x : buf_x_slice.stop + world_origin_x,
+            buf_y_slice.start + world_origin_y : buf_y_slice.stop + world_origin_y,
+        ]
+        final_buf_x, final_buf_y = np.nonzero(explored_window)
+        if len(final_buf_x) == 0:
+            return
+        final_buf_x += buf_x_slice.start
+        final_buf_y += buf_y_slice.start
+        final_world_x = final_buf_x + world_origin_x
+        final_world_y = final_buf_y + world_origin_y
+
+        buf = self.map_glyph_buffer.data
+        chars = buf["ch"][final_buf_x, final_buf_y]
+        fg_rgb = buf["fg"][final_buf_x, final_buf_y, :3]
+        bg_rgb = buf["bg"][final_buf_x, final_buf_y, :3]
+        base_bg_rgb = bg_rgb.copy()
         unlit_tile_ids = game_map.tiles[final_world_x, final_world_y]
-        if self._viewport_zoom >= config.LOD_DETAIL_ZOOM_THRESHOLD:
-            tile_types.apply_terrain_decoration(
-                chars,
-                fg_rgb,
-                bg_rgb,
-                unlit_tile_ids,
-                final_world_x,
-                final_world_y,
-                game_map.decoration_seed,
-            )
 
         roof_result = self._apply_roof_substitution(
             chars,
@@ -2614,48 +2888,34 @@ class WorldView(View):
             final_world_y,
             is_light=False,
             decoration_seed=game_map.decoration_seed,
-            buf_x=final_buf_x,
-            buf_y=final_buf_y,
-            buf_width=buf_width,
-            buf_height=buf_height,
-            world_origin_x=world_origin_x,
-            world_origin_y=world_origin_y,
         )
         effective_unlit_tile_ids = roof_result.effective_tile_ids
 
-        # Add alpha channel (255) to make RGBA
-        alpha = np.full((len(chars), 1), 255, dtype=np.uint8)
-        fg_rgba = np.hstack((fg_rgb, alpha))
-        bg_rgba = np.hstack((bg_rgb, alpha))
-
-        # Assign to glyph buffer using coordinate indexing
-        self.map_glyph_buffer.data["ch"][final_buf_x, final_buf_y] = chars
-        self.map_glyph_buffer.data["fg"][final_buf_x, final_buf_y] = fg_rgba
-        self.map_glyph_buffer.data["bg"][final_buf_x, final_buf_y] = bg_rgba
-
-        # Write sub-tile jitter amplitude so the fragment shader can apply
-        # per-pixel brightness variation within each tile cell.
-        self.map_glyph_buffer.data["noise"][final_buf_x, final_buf_y] = (
-            tile_types.get_sub_tile_jitter_map(effective_unlit_tile_ids)
+        buf["ch"][final_buf_x, final_buf_y] = chars
+        buf["fg"][final_buf_x, final_buf_y, :3] = fg_rgb
+        buf["bg"][final_buf_x, final_buf_y, :3] = bg_rgb
+        buf["noise"][final_buf_x, final_buf_y] = tile_types.get_sub_tile_jitter_map(
+            effective_unlit_tile_ids
         )
-        self.map_glyph_buffer.data["noise_pattern"][final_buf_x, final_buf_y] = (
-            _apply_noise_pattern_overrides(effective_unlit_tile_ids, roof_result)
+        buf["noise_pattern"][final_buf_x, final_buf_y] = _apply_noise_pattern_overrides(
+            effective_unlit_tile_ids, roof_result
         )
-        # Edge transitions create organic feathering between terrain types.
-        # At low zoom, tiles are too small for the blending to be visible.
-        if self._viewport_zoom >= config.LOD_DETAIL_ZOOM_THRESHOLD:
-            self._apply_tile_edge_transition_data(
-                glyph_buffer=self.map_glyph_buffer,
-                final_buf_x=final_buf_x,
-                final_buf_y=final_buf_y,
-                tile_ids=effective_unlit_tile_ids,
-                decorated_bg_rgb=bg_rgb,
+
+        if lod_detail:
+            roof_changed = (effective_unlit_tile_ids != unlit_tile_ids) | np.any(
+                bg_rgb != base_bg_rgb, axis=1
             )
-        self._map_unlit_buffer_cache_key = cache_key
+            if np.any(roof_changed):
+                self._refresh_edge_transitions_near(
+                    self.map_glyph_buffer,
+                    final_buf_x,
+                    final_buf_y,
+                    effective_unlit_tile_ids,
+                    roof_changed,
+                )
 
         # Write perspective offset split data for boundary tiles.
         if roof_result.split_y is not None:
-            buf = self.map_glyph_buffer.data
             buf["split_y"][final_buf_x, final_buf_y] = roof_result.split_y
             buf["split_bg"][final_buf_x, final_buf_y] = roof_result.split_bg
             buf["split_fg"][final_buf_x, final_buf_y] = roof_result.split_fg
@@ -2666,9 +2926,78 @@ class WorldView(View):
 
         # Write packed weathering data for per-pixel shader effects.
         if roof_result.wear_pack is not None:
-            self.map_glyph_buffer.data["wear_pack"][final_buf_x, final_buf_y] = (
-                roof_result.wear_pack
-            )
+            buf["wear_pack"][final_buf_x, final_buf_y] = roof_result.wear_pack
+
+    def _refresh_edge_transitions_near(
+        self,
+        glyph_buffer: GlyphBuffer,
+        buf_x: np.ndarray,
+        buf_y: np.ndarray,
+        tile_ids: np.ndarray,
+        changed: np.ndarray,
+    ) -> None:
+        """Recompute edge metadata around tiles a roof or animation pass rewrote.
+
+        Edge data for a tile depends on itself and its cardinal neighbours, so
+        only the bounding box of the changed tiles grown by one is rewritten,
+        computed over that box grown by one more so every rewritten tile sees
+        its neighbours. ``buf_x``/``buf_y``/``tile_ids`` cover every drawn
+        tile; ``changed`` flags the ones whose id or background changed.
+        """
+        buf = glyph_buffer.data
+        width, height = buf.shape
+        changed_x = buf_x[changed]
+        changed_y = buf_y[changed]
+        write_x1 = max(0, int(changed_x.min()) - 1)
+        write_y1 = max(0, int(changed_y.min()) - 1)
+        write_x2 = min(width, int(changed_x.max()) + 2)
+        write_y2 = min(height, int(changed_y.max()) + 2)
+        box_x1, box_y1 = max(0, write_x1 - 1), max(0, write_y1 - 1)
+        box_x2, box_y2 = min(width, write_x2 + 1), min(height, write_y2 + 1)
+
+        in_box = (buf_x >= box_x1) & (buf_x < box_x2) & (buf_y >= box_y1)
+        in_box &= buf_y < box_y2
+        box_x = buf_x[in_box] - box_x1
+        box_y = buf_y[in_box] - box_y1
+        box_ids = tile_ids[in_box]
+        box_shape = (box_x2 - box_x1, box_y2 - box_y1)
+
+        tile_id_window = np.zeros(box_shape, dtype=np.uint8)
+        drawn_mask_window = np.zeros(box_shape, dtype=np.bool_)
+        bg_rgb_window = np.zeros((*box_shape, 3), dtype=np.uint8)
+        tile_id_window[box_x, box_y] = box_ids
+        drawn_mask_window[box_x, box_y] = True
+        bg_rgb_window[box_x, box_y] = buf["bg"][box_x + box_x1, box_y + box_y1, :3]
+        edge_neighbor_mask = np.zeros(box_shape, dtype=np.uint8)
+        edge_neighbor_bg = np.zeros(
+            (*box_shape, len(CARDINAL_DIRECTIONS), 3), dtype=np.uint8
+        )
+        fill_edge_transitions(
+            tile_id_window,
+            bg_rgb_window,
+            edge_neighbor_mask,
+            edge_neighbor_bg,
+            drawn=drawn_mask_window,
+            region=(
+                write_x1 - box_x1,
+                write_y1 - box_y1,
+                write_x2 - box_x1,
+                write_y2 - box_y1,
+            ),
+        )
+
+        write = (
+            (box_x + box_x1 >= write_x1)
+            & (box_x + box_x1 < write_x2)
+            & (box_y + box_y1 >= write_y1)
+            & (box_y + box_y1 < write_y2)
+        )
+        wx, wy = box_x[write], box_y[write]
+        buf["edge_blend"][wx + box_x1, wy + box_y1] = tile_types.get_edge_blend_map(
+            box_ids[write]
+        )
+        buf["edge_neighbor_mask"][wx + box_x1, wy + box_y1] = edge_neighbor_mask[wx, wy]
+        buf["edge_neighbor_bg"][wx + box_x1, wy + box_y1] = edge_neighbor_bg[wx, wy]
 
     def _get_directional_light(self) -> DirectionalLight | None:
         """Return the first directional/global sun light active in the world."""
@@ -2734,10 +3063,20 @@ class WorldView(View):
         glyph_buffer: GlyphBuffer,
         final_buf_x: np.ndarray,
         final_buf_y: np.ndarray,
+        world_x: np.ndarray,
+        world_y: np.ndarray,
         tile_ids: np.ndarray,
-        decorated_bg_rgb: np.ndarray,
+        changed: np.ndarray,
+        *,
+        is_light: bool,
     ) -> None:
-        """Populate per-tile organic edge transition metadata for the glyph shader."""
+        """Populate per-tile organic edge transition metadata for the glyph shader.
+
+        Gathers the map's precomputed metadata for the drawn tiles, then
+        recomputes it locally around ``changed`` tiles, whose effective tile
+        id or background differs from the plain decorated map (roofs,
+        animated colours).
+        """
         if len(tile_ids) == 0:
             return
 
@@ -2746,45 +3085,30 @@ class WorldView(View):
         if not np.any(edge_blend > 0.0):
             return
 
-        tile_id_window = np.zeros(
-            (glyph_buffer.width, glyph_buffer.height), dtype=np.int32
-        )
-        drawn_mask_window = np.zeros(
-            (glyph_buffer.width, glyph_buffer.height), dtype=np.bool_
-        )
-        bg_rgb_window = np.zeros(
-            (glyph_buffer.width, glyph_buffer.height, 3), dtype=np.uint8
-        )
-        edge_blend_window = np.zeros(
-            (glyph_buffer.width, glyph_buffer.height), dtype=np.float32
-        )
-
-        tile_id_window[final_buf_x, final_buf_y] = tile_ids.astype(np.int32, copy=False)
-        edge_blend_window[final_buf_x, final_buf_y] = edge_blend
-        drawn_mask_window[final_buf_x, final_buf_y] = True
-        bg_rgb_window[final_buf_x, final_buf_y] = decorated_bg_rgb
-
-        edge_neighbor_mask, edge_neighbor_bg = _compute_tile_edge_transition_metadata(
-            tile_id_window=tile_id_window,
-            edge_blend_window=edge_blend_window,
-            drawn_mask_window=drawn_mask_window,
-            bg_rgb_window=bg_rgb_window,
-        )
-        _suppress_edge_blend_toward_hard_edges(
-            edge_neighbor_mask=edge_neighbor_mask,
-            tile_id_window=tile_id_window,
-        )
-        _override_edge_neighbor_bg_with_self_darken(
-            edge_neighbor_bg=edge_neighbor_bg,
-            tile_id_window=tile_id_window,
-            bg_rgb_window=bg_rgb_window,
+        game_map = self.controller.gw.game_map
+        drawn_mask = np.zeros((glyph_buffer.width, glyph_buffer.height), np.bool_)
+        drawn_mask[final_buf_x, final_buf_y] = True
+        edge_neighbor_mask, edge_neighbor_bg = gather_edge_transitions(
+            game_map.get_edge_transition_maps(is_light=is_light),
+            game_map.tiles,
+            drawn_mask,
+            world_x,
+            world_y,
+            drawn_origin=(
+                int(world_x[0]) - int(final_buf_x[0]),
+                int(world_y[0]) - int(final_buf_y[0]),
+            ),
         )
         glyph_buffer.data["edge_neighbor_mask"][final_buf_x, final_buf_y] = (
-            edge_neighbor_mask[final_buf_x, final_buf_y]
+            edge_neighbor_mask
         )
         glyph_buffer.data["edge_neighbor_bg"][final_buf_x, final_buf_y] = (
-            edge_neighbor_bg[final_buf_x, final_buf_y]
+            edge_neighbor_bg
         )
+        if np.any(changed):
+            self._refresh_edge_transitions_near(
+                glyph_buffer, final_buf_x, final_buf_y, tile_ids, changed
+            )
 
     def _update_actor_particles(self) -> None:
         """Emit particles from actors with particle emitters."""
@@ -2834,8 +3158,8 @@ class WorldView(View):
         """Update animation state for a percentage of visible animated tiles.
 
         Uses a random walk algorithm: each updated tile's RGB modulation values
-        are adjusted by a random offset, then clamped to [0, 1000]. This creates
-        organic color oscillation.
+        are adjusted by a random offset in [-_TILE_ANIM_STEP, _TILE_ANIM_STEP],
+        then clamped to [0, 1000]. This creates organic color oscillation.
 
         Args:
             percent_of_cells: Percentage of visible animated tiles to update
@@ -2846,63 +3170,23 @@ class WorldView(View):
         vs = self.viewport_system
         game_map = gw.game_map
 
-        # Get viewport bounds
+        # The native kernel walks the visible & animates mask of the viewport
+        # slice and updates the chosen tiles' fg/bg values in place.
         bounds = vs.get_visible_bounds()
-        world_left = max(0, bounds.x1)
-        world_top = max(0, bounds.y1)
-        world_right = min(game_map.width - 1, bounds.x2)
-        world_bottom = min(game_map.height - 1, bounds.y2)
-
-        # Vectorized: slice viewport region and find visible animated tiles
-        # using numpy boolean operations instead of a Python loop.
-        vp_slice = (
-            slice(world_left, world_right + 1),
-            slice(world_top, world_bottom + 1),
-        )
-        visible_slice = game_map.visible[vp_slice]
-        animates_slice = game_map.animation_params["animates"][vp_slice]
-        animated_mask = visible_slice & animates_slice
-
-        # Get local (within-slice) coordinates of animated tiles
-        local_x, local_y = np.nonzero(animated_mask)
-        num_animated = len(local_x)
-        if num_animated == 0:
-            return
-
-        # Select a random subset of tiles to update (percent_of_cells %)
-        num_to_update = max(1, num_animated * percent_of_cells // 100)
-        if num_to_update < num_animated:
-            chosen = self._tile_anim_rng.choice(
-                num_animated, size=num_to_update, replace=False
-            )
-            local_x = local_x[chosen]
-            local_y = local_y[chosen]
-            num_to_update = len(local_x)
-
-        # Convert to world coordinates for the animation_state write
-        world_x = local_x + world_left
-        world_y = local_y + world_top
-
-        # Vectorized random walk: generate all offsets in one batch
-        # (num_to_update, 3) for fg and bg independently
-        step_size = 80
-        fg_offsets = self._tile_anim_rng.integers(
-            -step_size, step_size + 1, size=(num_to_update, 3), dtype=np.int16
-        )
-        bg_offsets = self._tile_anim_rng.integers(
-            -step_size, step_size + 1, size=(num_to_update, 3), dtype=np.int16
-        )
-
-        # Read current state, apply offsets, clamp, write back
         state = game_map.animation_state
-        fg_vals = state["fg_values"][world_x, world_y].astype(np.int16)
-        bg_vals = state["bg_values"][world_x, world_y].astype(np.int16)
-        fg_vals += fg_offsets
-        bg_vals += bg_offsets
-        np.clip(fg_vals, 0, 1000, out=fg_vals)
-        np.clip(bg_vals, 0, 1000, out=bg_vals)
-        state["fg_values"][world_x, world_y] = fg_vals
-        state["bg_values"][world_x, world_y] = bg_vals
+        tile_animation_walk(
+            game_map.visible,
+            game_map.animation_params["animates"],
+            state["fg_values"],
+            state["bg_values"],
+            bounds.x1,
+            bounds.y1,
+            bounds.x2,
+            bounds.y2,
+            percent_of_cells,
+            self._TILE_ANIM_STEP,
+            int(self._tile_anim_rng.integers(0, 2**63)),
+        )
 
     def _update_mouse_tile_location(self) -> None:
         """Update the stored world-space mouse tile based on the current camera."""
@@ -3217,6 +3501,7 @@ class WorldView(View):
                             valid_exp_y + world_top,
                             gw.game_map.decoration_seed,
                         )
+                    decorated_light_bg_rgb = light_bg_rgb.copy()
                     lit_roof_result = self._apply_roof_substitution(
                         light_chars,
                         light_fg_rgb,
@@ -3226,12 +3511,6 @@ class WorldView(View):
                         valid_exp_y + world_top,
                         is_light=True,
                         decoration_seed=gw.game_map.decoration_seed,
-                        buf_x=final_buf_x,
-                        buf_y=final_buf_y,
-                        buf_width=buf_width,
-                        buf_height=buf_height,
-                        world_origin_x=world_left - vs.offset_x - pad,
-                        world_origin_y=world_top - vs.offset_y - pad,
                     )
                     effective_world_tile_ids = lit_roof_result.effective_tile_ids
                     roof_covered_mask = np.isin(
@@ -3296,12 +3575,20 @@ class WorldView(View):
                         effective_world_tile_ids, lit_roof_result
                     )
                     if self._viewport_zoom >= config.LOD_DETAIL_ZOOM_THRESHOLD:
+                        # Roofs and animated colours differ from the map's
+                        # precomputed edge data and are refreshed locally.
+                        edge_changed = (effective_world_tile_ids != world_tile_ids) | (
+                            np.any(light_bg_rgb != decorated_light_bg_rgb, axis=1)
+                        )
                         self._apply_tile_edge_transition_data(
                             glyph_buffer=light_source_buffer,
                             final_buf_x=final_buf_x,
                             final_buf_y=final_buf_y,
+                            world_x=valid_exp_x + world_left,
+                            world_y=valid_exp_y + world_top,
                             tile_ids=effective_world_tile_ids,
-                            decorated_bg_rgb=light_bg_rgb,
+                            changed=edge_changed,
+                            is_light=True,
                         )
 
                     # Write perspective offset split data for boundary tiles.
@@ -0,0 +1,189 @@
+#!/usr/bin/env python3
+"""Benchmark a pack of NPCs planning an approach to an occupied target.
+
+The target actor blocks its own tile, so a direct path always fails and each
+NPC falls back to ending within ``stop_distance`` of it. Times:
+
+- neighbours: the old fallback, probing each of the 8 tiles around the target
+  and running a separate ``find_local_path()`` to every open one
+- within:     one ``find_local_path(..., stop_distance=k)`` goal-region search
+
+Usage:
+    uv run python -m scripts.benchmark_approach_paths
+    uv run python -m scripts.benchmark_approach_paths --pack 24 --size 200
+"""
+
+from __future__ import annotations
+
+import argparse
+import time
+from collections import deque
+from collections.abc import Callable
+from dataclasses import dataclass
+
+import numpy as np
+
+from brileta.environment.generators.pipeline import create_settlement_pipeline
+from brileta.environment.map import GameMap
+from brileta.types import DIRECTIONS, WorldTilePos
+from brileta.util.pathfinding import find_local_path
+from brileta.util.spatial import SpatialHashGrid
+
+
+@dataclass(eq=False)
+class _PackActor:
+    """Minimal blocking actor for the spatial index."""
+
+    x: int
+    y: int
+    blocks_movement: bool = True
+
+
+def _neighbour_fallback(
+    game_map: GameMap,
+    index: SpatialHashGrid,
+    actor: _PackActor,
+    target: WorldTilePos,
+) -> tuple[list[WorldTilePos], int]:
+    """The per-neighbour loop the goal-region search replaces."""
+    best: list[WorldTilePos] | None = None
+    searches = 0
+    for dx, dy in DIRECTIONS:
+        tx, ty = target[0] + dx, target[1] + dy
+        if not (0 <= tx < game_map.width and 0 <= ty < game_map.height):
+            continue
+        if not game_map.walkable[tx, ty]:
+            continue
+        if any(
+            other.blocks_movement and other is not actor
+            for other in index.get_at_point(tx, ty)
+        ):
+            continue
+        searches += 1
+        candidate = find_local_path(
+            game_map, index, actor, (actor.x, actor.y), (tx, ty)
+        )
+        if candidate and (best is None or len(candidate) < len(best)):
+            best = candidate
+    return best or [], searches
+
+
+def _component(game_map: GameMap, start: WorldTilePos) -> list[WorldTilePos]:
+    """Walkable tiles 8-connected to *start*."""
+    seen = {start}
+    queue = deque([start])
+    while queue:
+        x, y = queue.popleft()
+        for dx, dy in DIRECTIONS:
+            nx, ny = x + dx, y + dy
+            if (
+                0 <= nx < game_map.width
+                and 0 <= ny < game_map.height
+                and game_map.walkable[nx, ny]
+                and (nx, ny) not in seen
+            ):
+                seen.add((nx, ny))
+                queue.append((nx, ny))
+    return sorted(seen)
+
+
+def _pick_tiles(
+    game_map: GameMap, count: int, rng: np.random.Generator
+) -> list[WorldTilePos]:
+    """A target plus *count* pack tiles, all in one large walkable area."""
+    xs, ys = np.nonzero(game_map.walkable)
+    while True:
+        i = int(rng.integers(len(xs)))
+        area = _component(game_map, (int(xs[i]), int(ys[i])))
+        if len(area) >= len(xs) // 4:
+            break
+    picks = rng.choice(len(area), size=count + 1, replace=False)
+    return [area[i] for i in picks]
+
+
+def _time_ms(fn: Callable[[], None], repeats: int) -> float:
+    """Average wall time of *fn* in milliseconds."""
+    start = time.perf_counter()
+    for _ in range(repeats):
+        fn()
+    return (time.perf_counter() - start) * 1000.0 / repeats
+
+
+def main(argv: list[str] | None = None) -> None:
+    parser = argparse.ArgumentParser(description="Benchmark approach-plan paths")
+    parser.add_argument("--size", type=int, default=120, help="Map size in tiles")
+    parser.add_argument("--pack", type=int, default=12, help="Approaching NPCs")
+    parser.add_argument("--stop-distance", type=int, default=1)
+    parser.add_argument("--repeats", type=int, default=5)
+    parser.add_argument("--seed", type=int, default=7)
+    args = parser.parse_args(argv)
+
+    map_data = create_settlement_pipeline(
+        args.size, args.size, seed=args.seed
+    ).generate()
+    game_map = GameMap(args.size, args.size, map_data)
+    rng = np.random.default_rng(args.seed)
+    tiles = _pick_tiles(game_map, args.pack, rng)
+
+    index: SpatialHashGrid = SpatialHashGrid(cell_size=16)
+    target_actor = _PackActor(*tiles[0])
+    pack = [_PackActor(x, y) for x, y in tiles[1:]]
+    index.add(target_actor)
+    for actor in pack:
+        index.add(actor)
+    target = (target_actor.x, target_actor.y)
+
+    searches = 0
+    neighbour_lengths: list[int] = []
+    within_lengths: list[int] = []
+
+    def neighbours() -> None:
+        nonlocal searches
+        searches = 0
+        neighbour_lengths.clear()
+        for actor in pack:
+            path, count = _neighbour_fallback(game_map, index, actor, target)
+            searches += count
+            neighbour_lengths.append(len(path))
+
+    def within() -> None:
+        within_lengths.clear()
+        for actor in pack:
+            path = find_local_path(
+                game_map,
+                index,
+                actor,
+                (actor.x, actor.y),
+                target,
+                stop_distance=args.stop_distance,
+            )
+            within_lengths.append(len(path))
+
+    neighbours_ms = _time_ms(neighbours, args.repeats)
+    within_ms = _time_ms(within, args.repeats)
+    reached = sum(1 for n in within_lengths if n > 0)
+
+    print("Approach Path Benchmark")
+    print("=" * 60)
+    print(
+        f"Map: {args.size}x{args.size} tiles, pack of {args.pack}, "
+        f"target {target}, stop distance {args.stop_distance}"
+    )
+    print(f"Pack members with a path: {reached}/{args.pack}")
+    print()
+    print(f"{'Path':>12} {'Avg (ms)':>10} {'Searches':>10} {'Mean len':>10}")
+    print("-" * 46)
+    print(
+        f"{'neighbours':>12} {neighbours_ms:10.3f} {searches:10d} "
+        f"{np.mean(neighbour_lengths):10.1f}"
+    )
+    print(
+        f"{'within':>12} {within_ms:10.3f} {len(pack):10d} "
+        f"{np.mean(within_lengths):10.1f}"
+    )
+    if within_ms > 0:
+        print(f"\nGoal-region speedup: {neighbours_ms / within_ms:.1f}x")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,256 @@
+#!/usr/bin/env python3
+"""Benchmark spawning and drawing a burst of floating text.
+
+Spawns N floating texts (half plain damage numbers, half bubble barks) through
+FloatingTextEvent and times the first frame that draws them, then a steady
+frame with everything already laid out. Two paths are compared:
+
+- legacy: the old per-string path, one Pillow image and texture per text
+  (rebuilt here since floating_text no longer has it)
+- atlas:  FloatingTextManager on the per-size glyph atlas, one batched
+  draw_texture_quads() call per size
+
+The graphics context is a CPU stub that copies pixels for texture creation
+and records draw calls, so times cover rasterization, layout and quad
+assembly but not the GPU upload the atlas also avoids.
+
+Usage:
+    uv run python -m scripts.benchmark_floating_text
+    uv run python -m scripts.benchmark_floating_text --texts 1000 --repeats 5
+"""
+
+from __future__ import annotations
+
+import argparse
+import time
+from collections.abc import Callable
+from typing import Any
+
+import numpy as np
+from PIL import Image as PILImage
+from PIL import ImageDraw, ImageFont
+
+from brileta import config
+from brileta.events import (
+    FloatingTextEvent,
+    FloatingTextSize,
+    FloatingTextValence,
+    publish_event,
+    reset_event_bus_for_testing,
+)
+from brileta.types import ActorId
+from brileta.view.render.effects.floating_text import FloatingTextManager
+from brileta.view.render.effects.text_atlas import (
+    BUBBLE_BORDER,
+    BUBBLE_FILL,
+    BUBBLE_PADDING,
+    TEXT_PADDING,
+    TextAtlas,
+)
+
+_BARKS = ["Get out of here!", "Who goes there?", "Help!", "Run!", "Surrender?"]
+
+
+class _StubGraphics:
+    """CPU stand-in for a GraphicsContext that counts texture traffic."""
+
+    tile_dimensions = (20, 20)
+
+    def __init__(self) -> None:
+        self.textures_created = 0
+        self.draw_calls = 0
+        self.quads = 0
+
+    def texture_from_numpy(self, pixels: np.ndarray, transparent: bool = True) -> Any:
+        self.textures_created += 1
+        return np.array(pixels, copy=True)
+
+    def release_texture(self, texture: Any) -> None:
+        pass
+
+    def console_to_screen_coords(self, x: float, y: float) -> tuple[float, float]:
+        return x * 20.0, y * 20.0
+
+    def draw_texture_alpha(self, *_args: Any, **_kwargs: Any) -> None:
+        self.draw_calls += 1
+        self.quads += 1
+
+    def draw_texture_quads(
+        self, texture: Any, rects: np.ndarray, uvs: np.ndarray, tints: np.ndarray
+    ) -> None:
+        self.draw_calls += 1
+        self.quads += len(rects)
+
+
+class _StubViewport:
+    """Identity camera: every tile visible, world == screen tiles."""
+
+    def is_visible(self, x: int, y: int) -> bool:
+        return True
+
+    def world_to_screen_float(self, x: float, y: float) -> tuple[float, float]:
+        return x, y
+
+    def get_display_scale_factors(self) -> tuple[float, float]:
+        return 1.0, 1.0
+
+
+class _StubWorld:
+    """No live actors, so texts stay at their spawn positions."""
+
+    def get_actor_by_id(self, actor_id: ActorId) -> None:
+        return None
+
+
+def _events(count: int) -> list[FloatingTextEvent]:
+    events = []
+    for i in range(count):
+        bubble = i % 2 == 1
+        events.append(
+            FloatingTextEvent(
+                text=_BARKS[i % len(_BARKS)] if bubble else f"-{i % 40}",
+                target_actor_id=ActorId(i),
+                valence=FloatingTextValence.NEGATIVE,
+                size=FloatingTextSize.LARGE if i % 7 == 0 else FloatingTextSize.NORMAL,
+                world_x=i % 60,
+                world_y=i // 60,
+                bubble=bubble,
+                color=(40, 30, 20) if bubble else None,
+            )
+        )
+    return events
+
+
+def _legacy_texture(
+    graphics: _StubGraphics,
+    font: ImageFont.FreeTypeFont,
+    text: str,
+    color: tuple[int, int, int],
+    bubble: bool,
+) -> Any:
+    """The per-string Pillow rasterization the atlas replaced."""
+    bbox = font.getbbox(text)
+    padding_x, padding_y = BUBBLE_PADDING if bubble else TEXT_PADDING
+    width = max(1, int(bbox[2] - bbox[0]) + padding_x * 2)
+    height = max(1, int(bbox[3] - bbox[1]) + padding_y * 2)
+    image = PILImage.new("RGBA", (width, height), (0, 0, 0, 0))
+    draw = ImageDraw.Draw(image)
+    if bubble:
+        draw.rounded_rectangle(
+            (0, 0, width - 1, height - 1),
+            radius=10,
+            fill=BUBBLE_FILL,
+            outline=BUBBLE_BORDER,
+            width=2,
+        )
+    draw.text(
+        (padding_x - int(bbox[0]), padding_y - int(bbox[1])),
+        text,
+        font=font,
+        fill=(*color, 255),
+    )
+    pixels = np.ascontiguousarray(np.array(image, dtype=np.uint8))
+    return graphics.texture_from_numpy(pixels, transparent=True)
+
+
+def _time_ms(fn: Callable[[], None], repeats: int) -> float:
+    """Average wall time of *fn* in milliseconds."""
+    start = time.perf_counter()
+    for _ in range(repeats):
+        fn()
+    return (time.perf_counter() - start) * 1000.0 / repeats
+
+
+def main(argv: list[str] | None = None) -> None:
+    parser = argparse.ArgumentParser(description="Benchmark floating text spawning")
+    parser.add_argument("--texts", type=int, default=500, help="Texts per burst")
+    parser.add_argument("--repeats", type=int, default=10)
+    args = parser.parse_args(argv)
+
+    events = _events(args.texts)
+    fonts = {
+        size: ImageFont.truetype(str(config.UI_FONT_PATH), size.value)
+        for size in FloatingTextSize
+    }
+    game_world: Any = _StubWorld()
+    viewport: Any = _StubViewport()
+
+    # Legacy: every spawned string rasterizes and uploads its own texture.
+    legacy_graphics = _StubGraphics()
+
+    def legacy_burst() -> None:
+        textures = [
+            _legacy_texture(
+                legacy_graphics,
+                fonts[event.size],
+                event.text,
+                event.color or (255, 130, 60),
+                event.bubble,
+            )
+            for event in events
+        ]
+        for texture in textures:
+            legacy_graphics.draw_texture_alpha(texture, 0.0, 0.0, 1.0)
+
+    # Atlas: one manager (atlases built once), a fresh burst each repeat.
+    reset_event_bus_for_testing()
+    manager = FloatingTextManager(max_texts=args.texts)
+    atlas_graphics = _StubGraphics()
+
+    def spawn() -> None:
+        manager.clear()
+        for event in events:
+            publish_event(event)
+
+    def atlas_frame() -> None:
+        manager.render(atlas_graphics, viewport, (0, 0), game_world)
+
+    def atlas_burst() -> None:
+        spawn()
+        atlas_frame()
+
+    atlas_build_ms = _time_ms(lambda: TextAtlas(fonts[FloatingTextSize.NORMAL]), 1)
+    atlas_burst()  # Build both atlases and upload them once, outside the timing.
+    warm_textures = atlas_graphics.textures_created
+
+    legacy_ms = _time_ms(legacy_burst, args.repeats)
+    burst_textures = atlas_graphics.textures_created
+    burst_draws = atlas_graphics.draw_calls
+    burst_ms = _time_ms(atlas_burst, args.repeats)
+    burst_textures = atlas_graphics.textures_created - burst_textures
+    burst_draws = atlas_graphics.draw_calls - burst_draws
+    frame_draws = atlas_graphics.draw_calls
+    frame_quads = atlas_graphics.quads
+    frame_ms = _time_ms(atlas_frame, args.repeats)
+    frame_draws = atlas_graphics.draw_calls - frame_draws
+    frame_quads = atlas_graphics.quads - frame_quads
+
+    print("Floating Text Benchmark")
+    print("=" * 60)
+    print(f"Texts per burst: {args.texts} (half bubbles, 1 in 7 LARGE)")
+    print(
+        f"Atlas build (NORMAL, once): {atlas_build_ms:.2f} ms; "
+        f"{warm_textures} atlas textures uploaded for all sizes"
+    )
+    print()
+    print(f"{'Path':>14} {'Avg (ms)':>10} {'Textures':>10} {'Draws':>8}")
+    print("-" * 46)
+    print(
+        f"{'legacy burst':>14} {legacy_ms:10.3f} "
+        f"{legacy_graphics.textures_created // args.repeats:10d} "
+        f"{legacy_graphics.draw_calls // args.repeats:8d}"
+    )
+    print(
+        f"{'atlas burst':>14} {burst_ms:10.3f} "
+        f"{burst_textures // args.repeats:10d} {burst_draws // args.repeats:8d}"
+    )
+    print(
+        f"{'atlas frame':>14} {frame_ms:10.3f} {0:10d} "
+        f"{frame_draws // args.repeats:8d}  ({frame_quads // args.repeats} quads)"
+    )
+    if burst_ms > 0:
+        print(f"\nBurst speedup: {legacy_ms / burst_ms:.1f}x")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,130 @@
+#!/usr/bin/env python3
+"""Benchmark region-aware appearance maps on a densely built settlement.
+
+Generates a grid-street settlement with the building caps lifted so the map
+carries hundreds of regions, then times:
+
+- rebuild: dropping both appearance maps and rebuilding them through the
+  region floor index (``invalidate_appearance_caches()`` + both properties)
+- mask:    the old per-region ``(tile_to_region_id == id) & floor`` rebuild
+- refresh: ``refresh_region_appearance()`` after toggling one region's sky
+  exposure, with both maps and their edge metadata cached
+
+Usage:
+    uv run python -m scripts.benchmark_region_appearance
+    uv run python -m scripts.benchmark_region_appearance --size 400 --repeats 20
+"""
+
+from __future__ import annotations
+
+import argparse
+import time
+from collections.abc import Callable
+from unittest.mock import patch
+
+import numpy as np
+
+from brileta import config
+from brileta.environment import tile_types
+from brileta.environment.generators.pipeline import create_settlement_pipeline
+from brileta.environment.map import GameMap
+from brileta.environment.tile_types import TileTypeID
+
+
+def _build_settlement(size: int, seed: int) -> GameMap:
+    """Generate a settlement packed with buildings (one region per room)."""
+    with (
+        patch.object(config, "SETTLEMENT_MAX_BUILDINGS", 10_000),
+        patch.object(config, "SETTLEMENT_BUILDING_DENSITY", 1.0),
+    ):
+        map_data = create_settlement_pipeline(
+            size, size, seed=seed, street_style="grid"
+        ).generate()
+    return GameMap(size, size, map_data)
+
+
+def _mask_rebuild(game_map: GameMap, is_light: bool) -> np.ndarray:
+    """The per-region full-map mask rebuild the floor index replaces."""
+    if is_light:
+        appearance_map = tile_types.get_light_appearance_map(game_map.tiles).copy()
+    else:
+        appearance_map = tile_types.get_dark_appearance_map(game_map.tiles).copy()
+    floor = game_map.tiles == TileTypeID.FLOOR
+    for region_id, region in game_map.regions.items():
+        mask = (game_map.tile_to_region_id == region_id) & floor
+        if np.any(mask):
+            appearance_map["bg"][mask] = game_map._get_region_ground_color(
+                region, is_light
+            )
+    return appearance_map
+
+
+def _time_ms(fn: Callable[[], None], repeats: int) -> float:
+    """Average wall time of *fn* in milliseconds."""
+    start = time.perf_counter()
+    for _ in range(repeats):
+        fn()
+    return (time.perf_counter() - start) * 1000.0 / repeats
+
+
+def main(argv: list[str] | None = None) -> None:
+    parser = argparse.ArgumentParser(
+        description="Benchmark region-aware appearance maps"
+    )
+    parser.add_argument("--size", type=int, default=300, help="Map size in tiles")
+    parser.add_argument("--repeats", type=int, default=10)
+    parser.add_argument("--seed", type=int, default=7)
+    args = parser.parse_args(argv)
+
+    game_map = _build_settlement(args.size, args.seed)
+    index = game_map.region_floor_index
+    print("Region Appearance Benchmark")
+    print("=" * 60)
+    print(
+        f"Map: {args.size}x{args.size} tiles, {len(game_map.regions)} regions, "
+        f"{len(index.xs)} region floor tiles"
+    )
+    print()
+
+    def rebuild() -> None:
+        game_map.invalidate_appearance_caches()
+        _ = game_map.dark_appearance_map
+        _ = game_map.light_appearance_map
+
+    def mask() -> None:
+        _mask_rebuild(game_map, is_light=False)
+        _mask_rebuild(game_map, is_light=True)
+
+    rebuild_ms = _time_ms(rebuild, args.repeats)
+    mask_ms = _time_ms(mask, args.repeats)
+    np.testing.assert_array_equal(
+        game_map.dark_appearance_map, _mask_rebuild(game_map, is_light=False)
+    )
+
+    # Warm the maps and edge metadata a renderer would hold.
+    rebuild()
+    game_map.get_edge_transition_maps(is_light=False)
+    game_map.get_edge_transition_maps(is_light=True)
+    counts = index.counts()
+    region_id = int(index.region_ids[int(np.argmax(counts))])
+    region = game_map.regions[region_id]
+
+    def refresh() -> None:
+        region.sky_exposure = 1.0 - region.sky_exposure
+        assert game_map.refresh_region_appearance(region_id) is not None
+
+    refresh_ms = _time_ms(refresh, args.repeats)
+
+    print(f"{'Path':>10} {'Avg (ms)':>10}")
+    print("-" * 22)
+    print(f"{'mask':>10} {mask_ms:10.3f}")
+    print(f"{'rebuild':>10} {rebuild_ms:10.3f}")
+    print(f"{'refresh':>10} {refresh_ms:10.3f}  (region {region_id}, largest)")
+    if rebuild_ms > 0:
+        print(f"\nIndexed rebuild speedup: {mask_ms / rebuild_ms:.1f}x")
+    if refresh_ms > 0:
+        print(f"Single-region refresh vs mask rebuild: {mask_ms / refresh_ms:.1f}x")
+
+
+if __name__ == "__main__":
+    main()
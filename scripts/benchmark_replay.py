@@ -0,0 +1,74 @@
+#!/usr/bin/env python3
+"""Replay a recorded play session headlessly and report per-phase timings.
+
+Record a session by running the game with ``--record-session FILE``; the
+recording is written on quit. Replaying it re-drives the same seed, player
+intents and fixed-timestep boundaries, checks each tick's state hash, and
+prints where the logic time went.
+
+A fresh recording has no tick hashes yet. ``--bless`` replays it once and
+writes the resulting hashes back, after which every replay is also a
+correctness check that names the first divergent tick.
+
+Usage:
+    uv run python -m scripts.benchmark_replay session.json --bless
+    uv run python -m scripts.benchmark_replay session.json
+    uv run python -m scripts.benchmark_replay session.json --no-verify
+"""
+
+from __future__ import annotations
+
+import argparse
+import sys
+
+from brileta.game.session_recording import SessionRecording
+from brileta.testing.replay import ReplayDivergence, replay_session
+
+
+def main(argv: list[str] | None = None) -> None:
+    parser = argparse.ArgumentParser(description="Replay a recorded session")
+    parser.add_argument("session", help="Session recording (JSON)")
+    parser.add_argument(
+        "--bless",
+        action="store_true",
+        help="Write this replay's tick hashes back into the recording",
+    )
+    parser.add_argument(
+        "--no-verify",
+        dest="verify",
+        action="store_false",
+        help="Skip the per-tick state hash check",
+    )
+    args = parser.parse_args(argv)
+
+    recording = SessionRecording.load(args.session)
+    print(
+        f"Replaying {args.session}: seed={recording.seed!r} "
+        f"map={recording.map_size[0]}x{recording.map_size[1]} "
+        f"frames={len(recording.frames)} ticks={recording.tick_count}"
+    )
+    try:
+        result = replay_session(recording, verify=args.verify and not args.bless)
+    except (ReplayDivergence, ValueError) as exc:
+        print(exc)
+        sys.exit(1)
+
+    print(f"\n{'phase':<34} {'samples':>8} {'total ms':>10} {'mean':>8} {'p95':>8}")
+    for name, timing in result.phase_timings.items():
+        print(
+            f"{name:<34} {timing.samples:>8} {timing.total_ms:>10.1f} "
+            f"{timing.mean_ms:>8.3f} {timing.p95_ms:>8.3f}"
+        )
+    ticks = len(result.tick_hashes)
+    print(f"\nwall: {result.wall_ms:.1f} ms for {ticks} ticks")
+
+    if args.bless:
+        recording.tick_hashes = result.tick_hashes
+        recording.save(args.session)
+        print(f"Blessed {ticks} tick hashes into {args.session}")
+    elif args.verify and recording.tick_hashes:
+        print(f"Verified {min(ticks, len(recording.tick_hashes))} tick hashes")
+
+
+if __name__ == "__main__":
+    main()
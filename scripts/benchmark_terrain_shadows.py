@@ -0,0 +1,181 @@
+#!/usr/bin/env python3
+"""Benchmark terrain glyph shadow projection on a forest-heavy viewport.
+
+Drives ``ShadowRenderer._render_terrain_glyph_shadows()`` over a synthetic
+viewport where a large share of tiles are short (height 1-2) glyph casters,
+lit by a low sun so most shadows run the full 8-step wall-clip march. Two
+paths are timed against the same CPU vertex buffer:
+
+- batched:  native wall clip + one native vertex-building batch (default path)
+- per-tile: native wall clip + one ``draw_actor_shadow()`` call per glyph
+
+The per-tile wall clip (``_clip_shadow_length_by_walls``) is timed against the
+native ``clip_shadow_lengths`` kernel separately.
+
+Usage:
+    uv run python -m scripts.benchmark_terrain_shadows
+    uv run python -m scripts.benchmark_terrain_shadows --size 120 --frames 200
+"""
+
+from __future__ import annotations
+
+import argparse
+import time
+from types import SimpleNamespace
+from typing import Any, cast
+from unittest.mock import patch
+
+import numpy as np
+
+from brileta.backends.wgpu.graphics import WGPUGraphicsContext
+from brileta.backends.wgpu.screen_renderer import VERTEX_DTYPE, WGPUScreenRenderer
+from brileta.environment.tile_types import TileTypeAppearance
+from brileta.game.actors import Actor
+from brileta.game.lights import DirectionalLight
+from brileta.util._native import clip_shadow_lengths
+from brileta.view.render.shadow_renderer import ShadowRenderer
+from brileta.view.render.viewport import ViewportSystem
+
+
+def _build_forest(size: int, density: float, seed: int) -> SimpleNamespace:
+    """Build a map stand-in whose glyph heights model a dense forest."""
+    rng = np.random.default_rng(seed)
+    roll = rng.random((size, size))
+    glyph_heights = np.zeros((size, size), dtype=np.uint8)
+    glyph_heights[roll < density] = 2  # trees
+    glyph_heights[roll < density * 0.25] = 1  # shrubs and boulders
+
+    # Scatter a few ruined walls so clipping has something to hit.
+    shadow_heights = glyph_heights.copy()
+    shadow_heights[rng.random((size, size)) < 0.02] = 4
+
+    appearance = np.zeros((size, size), dtype=TileTypeAppearance)
+    appearance["ch"] = rng.choice(
+        np.array([ord("♣"), ord("♠"), ord("o")]), (size, size)
+    )
+    eligible = np.ones((size, size), dtype=bool)
+    return SimpleNamespace(
+        width=size,
+        height=size,
+        tiles=np.zeros((size, size), dtype=np.uint8),
+        visible=np.ones((size, size), dtype=bool),
+        light_appearance_map=appearance,
+        shadow_heights=shadow_heights,
+        glyph_heights=glyph_heights,
+        get_sun_shadow_eligibility_grid=lambda **_kwargs: eligible,
+    )
+
+
+def _build_renderer(game_map: Any, size: int) -> ShadowRenderer:
+    """Wire a ShadowRenderer to a real viewport and a CPU-only screen renderer."""
+    viewport = ViewportSystem(size, size)
+    viewport.update_camera(
+        cast(
+            Actor,
+            SimpleNamespace(x=size // 2, y=size // 2, _animation_controlled=False),
+        ),
+        size,
+        size,
+    )
+
+    screen_renderer = object.__new__(WGPUScreenRenderer)
+    screen_renderer.cpu_vertex_buffer = np.zeros(size * size * 6, dtype=VERTEX_DTYPE)
+    screen_renderer.vertex_count = 0
+    graphics = object.__new__(WGPUGraphicsContext)
+    graphics._tile_dimensions = (20, 20)
+    graphics.letterbox_geometry = None
+    graphics.screen_renderer = screen_renderer
+    graphics.uv_map = graphics._precalculate_uv_map()
+
+    renderer = ShadowRenderer(game_map, viewport, graphics)
+    sun = DirectionalLight.create_sun(elevation_degrees=12.0, azimuth_degrees=120.0)
+    renderer.set_frame_lighting(directional_light=sun, lights=[sun])
+    return renderer
+
+
+def _time_frames(renderer: ShadowRenderer, frames: int) -> tuple[float, int]:
+    """Render the terrain pass *frames* times; return avg ms and quads per frame."""
+    screen_renderer = cast(Any, renderer.graphics).screen_renderer
+    times: list[float] = []
+    for _ in range(frames):
+        screen_renderer.vertex_count = 0
+        start = time.perf_counter()
+        renderer._render_terrain_glyph_shadows(tile_height=20.0)
+        times.append(time.perf_counter() - start)
+    return (sum(times) / frames) * 1000.0, screen_renderer.vertex_count // 6
+
+
+def _benchmark_clip(renderer: ShadowRenderer, game_map: Any) -> tuple[float, float]:
+    """Time the per-caster Python wall clip against the native batch kernel."""
+    xs, ys = np.nonzero(game_map.glyph_heights)
+    tile_x = xs.astype(np.int32)
+    tile_y = ys.astype(np.int32)
+    params = cast(DirectionalLight, renderer._frame_directional_light).shadow_params()
+    lengths = game_map.glyph_heights[xs, ys].astype(np.float64) * params.length_scale
+
+    start = time.perf_counter()
+    for x, y, length in zip(
+        tile_x.tolist(), tile_y.tolist(), lengths.tolist(), strict=True
+    ):
+        renderer._clip_shadow_length_by_walls(x, y, params.dir_x, params.dir_y, length)
+    python_ms = (time.perf_counter() - start) * 1000.0
+
+    start = time.perf_counter()
+    clip_shadow_lengths(
+        game_map.shadow_heights,
+        tile_x,
+        tile_y,
+        lengths.copy(),
+        params.dir_x,
+        params.dir_y,
+    )
+    native_ms = (time.perf_counter() - start) * 1000.0
+    return python_ms, native_ms
+
+
+def main(argv: list[str] | None = None) -> None:
+    parser = argparse.ArgumentParser(
+        description="Benchmark terrain glyph shadow projection"
+    )
+    parser.add_argument("--size", type=int, default=80, help="Viewport size in tiles")
+    parser.add_argument(
+        "--density", type=float, default=0.45, help="Share of tiles that are trees"
+    )
+    parser.add_argument("--frames", type=int, default=100, help="Frames per path")
+    parser.add_argument("--seed", type=int, default=7)
+    args = parser.parse_args(argv)
+
+    game_map = _build_forest(args.size, args.density, args.seed)
+    casters = int(np.count_nonzero(game_map.glyph_heights))
+    print("Terrain Glyph Shadow Benchmark")
+    print("=" * 60)
+    print(f"Viewport: {args.size}x{args.size} tiles, {casters} glyph casters")
+    print(f"Sun elevation 12°, {args.frames} frames per path")
+    print()
+
+    with patch(
+        "brileta.view.render.shadow_renderer.get_shadow_height_map",
+        return_value=game_map.glyph_heights,
+    ):
+        batched = _build_renderer(game_map, args.size)
+        batched_ms, batched_quads = _time_frames(batched, args.frames)
+
+        per_tile = _build_renderer(game_map, args.size)
+        per_tile._world_to_screen_float_batch = lambda _x, _y: None
+        per_tile_ms, per_tile_quads = _time_frames(per_tile, args.frames)
+
+    print(f"{'Path':>10} {'Avg (ms)':>10} {'Quads':>8}")
+    print("-" * 30)
+    print(f"{'batched':>10} {batched_ms:10.3f} {batched_quads:8d}")
+    print(f"{'per-tile':>10} {per_tile_ms:10.3f} {per_tile_quads:8d}")
+    if batched_ms > 0:
+        print(f"\nBatched speedup: {per_tile_ms / batched_ms:.1f}x")
+
+    python_ms, native_ms = _benchmark_clip(batched, game_map)
+    print(f"\nWall clip, {casters} casters:")
+    print(f"  per-caster Python: {python_ms:8.3f} ms")
+    print(f"  native batch:      {native_ms:8.3f} ms")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,407 @@
+"""Tests for terrain edge-transition metadata."""
+
+from __future__ import annotations
+
+import numpy as np
+import pytest
+
+from brileta.environment import tile_types
+from brileta.environment.edge_transitions import (
+    CARDINAL_DIRECTIONS,
+    EdgeTransitionMaps,
+    _compute_tile_edge_transition_metadata,
+    _override_edge_neighbor_bg_with_self_darken,
+    _suppress_edge_blend_toward_hard_edges,
+    build_edge_transition_maps,
+    fill_edge_transitions,
+    gather_edge_transitions,
+)
+from brileta.environment.generators.base import GeneratedMapData
+from brileta.environment.map import GameMap
+from brileta.environment.tile_types import TileTypeID
+
+_PARITY_TILE_IDS = np.array(
+    [
+        TileTypeID.GRASS,
+        TileTypeID.DIRT,
+        TileTypeID.GRAVEL,
+        TileTypeID.FLOOR,
+        TileTypeID.WALL,
+        TileTypeID.ROOF_THATCH,
+        TileTypeID.ROOF_TIN,
+        TileTypeID.DOOR_CLOSED,
+    ],
+    dtype=np.uint8,
+)
+
+
+def _reference_edge_transitions(
+    tile_ids: np.ndarray, bg_rgb: np.ndarray, drawn: np.ndarray
+) -> tuple[np.ndarray, np.ndarray]:
+    """Run the numpy reference passes over a whole grid."""
+    tile_id_window = np.where(drawn, tile_ids, 0).astype(np.int32)
+    bg_rgb_window = np.where(drawn[..., np.newaxis], bg_rgb, 0).astype(np.uint8)
+    edge_blend_window = np.where(
+        drawn, tile_types.get_edge_blend_map(tile_ids), 0
+    ).astype(np.float32)
+    neighbor_mask, neighbor_bg = _compute_tile_edge_transition_metadata(
+        tile_id_window=tile_id_window,
+        edge_blend_window=edge_blend_window,
+        drawn_mask_window=drawn,
+        bg_rgb_window=bg_rgb_window,
+    )
+    _suppress_edge_blend_toward_hard_edges(
+        edge_neighbor_mask=neighbor_mask, tile_id_window=tile_id_window
+    )
+    _override_edge_neighbor_bg_with_self_darken(
+        edge_neighbor_bg=neighbor_bg,
+        tile_id_window=tile_id_window,
+        bg_rgb_window=bg_rgb_window,
+    )
+    neighbor_mask[~drawn] = 0
+    neighbor_bg[~drawn] = 0
+    return neighbor_mask, neighbor_bg
+
+
+def _random_grid(
+    seed: int, width: int = 17, height: int = 13
+) -> tuple[np.ndarray, np.ndarray, np.ndarray]:
+    rng = np.random.default_rng(seed)
+    tile_ids = rng.choice(_PARITY_TILE_IDS, size=(width, height))
+    bg_rgb = rng.integers(0, 256, size=(width, height, 3), dtype=np.uint8)
+    drawn = rng.random((width, height)) < 0.75
+    return tile_ids, bg_rgb, drawn
+
+
+def _random_game_map(seed: int, size: int = 16) -> GameMap:
+    tile_ids, _bg_rgb, explored = _random_grid(seed, size, size)
+    map_data = GeneratedMapData(
+        tiles=np.asfortranarray(tile_ids),
+        regions={},
+        tile_to_region_id=np.full((size, size), -1, dtype=np.int16, order="F"),
+        decoration_seed=seed,
+    )
+    game_map = GameMap(size, size, map_data)
+    game_map.explored[:] = explored
+    return game_map
+
+
+class TestNativeEdgeTransitionFill:
+    """The native kernel must match the numpy reference bit for bit."""
+
+    @pytest.mark.parametrize("seed", [0, 1, 2, 3])
+    def test_matches_reference_with_drawn_mask(self, seed: int) -> None:
+        tile_ids, bg_rgb, drawn = _random_grid(seed)
+        out_mask = np.zeros(tile_ids.shape, dtype=np.uint8)
+        out_bg = np.zeros((*tile_ids.shape, 4, 3), dtype=np.uint8)
+
+        fill_edge_transitions(tile_ids, bg_rgb, out_mask, out_bg, drawn=drawn)
+
+        expected_mask, expected_bg = _reference_edge_transitions(
+            tile_ids, bg_rgb, drawn
+        )
+        np.testing.assert_array_equal(out_mask, expected_mask)
+        np.testing.assert_array_equal(out_bg, expected_bg)
+
+    def test_matches_reference_with_every_tile_drawn(self) -> None:
+        tile_ids, bg_rgb, _drawn = _random_grid(7)
+        out_mask = np.zeros(tile_ids.shape, dtype=np.uint8)
+        out_bg = np.zeros((*tile_ids.shape, 4, 3), dtype=np.uint8)
+
+        fill_edge_transitions(tile_ids, bg_rgb, out_mask, out_bg)
+
+        expected_mask, expected_bg = _reference_edge_transitions(
+            tile_ids, bg_rgb, np.ones(tile_ids.shape, dtype=np.bool_)
+        )
+        np.testing.assert_array_equal(out_mask, expected_mask)
+        np.testing.assert_array_equal(out_bg, expected_bg)
+
+    def test_region_fill_only_writes_inside_region(self) -> None:
+        tile_ids, bg_rgb, drawn = _random_grid(4)
+        out_mask = np.full(tile_ids.shape, 0xAA, dtype=np.uint8)
+        out_bg = np.full((*tile_ids.shape, 4, 3), 0xAA, dtype=np.uint8)
+
+        fill_edge_transitions(
+            tile_ids, bg_rgb, out_mask, out_bg, drawn=drawn, region=(-3, 4, 6, 9)
+        )
+
+        expected_mask, expected_bg = _reference_edge_transitions(
+            tile_ids, bg_rgb, drawn
+        )
+        np.testing.assert_array_equal(out_mask[0:6, 4:9], expected_mask[0:6, 4:9])
+        np.testing.assert_array_equal(out_bg[0:6, 4:9], expected_bg[0:6, 4:9])
+        assert np.all(out_mask[6:] == 0xAA)
+        assert np.all(out_mask[:, :4] == 0xAA)
+
+    def test_gather_matches_fill_with_drawn_mask(self) -> None:
+        tile_ids, bg_rgb, drawn = _random_grid(5)
+        maps_mask = np.zeros(tile_ids.shape, dtype=np.uint8)
+        maps_bg = np.zeros((*tile_ids.shape, 4, 3), dtype=np.uint8)
+        fill_edge_transitions(tile_ids, bg_rgb, maps_mask, maps_bg)
+
+        xs, ys = np.nonzero(drawn)
+        mask, neighbor_bg = gather_edge_transitions(
+            EdgeTransitionMaps(bg_rgb, maps_mask, maps_bg), tile_ids, drawn, xs, ys
+        )
+
+        expected_mask, expected_bg = _reference_edge_transitions(
+            tile_ids, bg_rgb, drawn
+        )
+        np.testing.assert_array_equal(mask, expected_mask[xs, ys])
+        np.testing.assert_array_equal(neighbor_bg, expected_bg[xs, ys])
+
+
+class TestGameMapEdgeTransitionMaps:
+    """Tests for the per-tile edge metadata cached on GameMap."""
+
+    def test_maps_are_cached_until_invalidated(self) -> None:
+        game_map = _random_game_map(11)
+
+        maps = game_map.get_edge_transition_maps()
+
+        assert game_map.get_edge_transition_maps() is maps
+        assert game_map.get_edge_transition_maps(is_light=True) is not maps
+        game_map.invalidate_property_caches()
+        assert game_map.get_edge_transition_maps() is not maps
+
+    @pytest.mark.parametrize("is_light", [False, True])
+    def test_patch_after_tile_change_matches_full_rebuild(self, is_light: bool) -> None:
+        game_map = _random_game_map(12)
+        maps = game_map.get_edge_transition_maps(is_light=is_light)
+
+        for x, y, tile in ((5, 5, TileTypeID.DOOR_OPEN), (0, 3, TileTypeID.WALL)):
+            game_map.tiles[x, y] = tile
+            game_map.invalidate_property_caches(changed_tiles=[(x, y)])
+        patched = game_map.get_edge_transition_maps(is_light=is_light)
+
+        appearance_map = (
+            game_map.light_appearance_map if is_light else game_map.dark_appearance_map
+        )
+        rebuilt = build_edge_transition_maps(
+            game_map.tiles, appearance_map, game_map.decoration_seed
+        )
+        assert patched is maps
+        for patched_array, rebuilt_array in zip(patched, rebuilt, strict=True):
+            np.testing.assert_array_equal(patched_array, rebuilt_array)
+
+    def test_tiles_changed_since_reports_positions_or_none(self) -> None:
+        game_map = _random_game_map(13)
+        start = game_map.structural_revision
+
+        game_map.invalidate_property_caches(changed_tiles=[(1, 2)])
+        game_map.invalidate_property_caches(changed_tiles=[(3, 4)])
+
+        assert game_map.tiles_changed_since(start) == [(1, 2), (3, 4)]
+        assert game_map.tiles_changed_since(start + 1) == [(3, 4)]
+        game_map.invalidate_property_caches()
+        assert game_map.tiles_changed_since(start) is None
+        assert game_map.tiles_changed_since(game_map.structural_revision) == []
+
+
+class TestTileEdgeTransitionMetadata:
+    """Tests for vectorized organic tile edge metadata generation."""
+
+    def test_uses_cardinals_one_sided_ownership_and_no_wraparound(self) -> None:
+        tile_ids = np.array(
+            [
+                [1, 5, 1],
+                [5, 2, 2],
+                [3, 5, 4],
+            ],
+            dtype=np.int32,
+        )
+        drawn_mask = np.ones((3, 3), dtype=np.bool_)
+        drawn_mask[2, 2] = False  # Hidden neighbor should not contribute
+        edge_blend = np.full((3, 3), 0.5, dtype=np.float32)
+
+        bg_rgb = np.zeros((3, 3, 3), dtype=np.uint8)
+        bg_rgb[0, 1] = (10, 20, 30)  # west of center
+        bg_rgb[1, 0] = (40, 50, 60)  # north of center
+        bg_rgb[2, 2] = (70, 80, 90)  # southeast (hidden)
+
+        neighbor_mask, neighbor_bg = _compute_tile_edge_transition_metadata(
+            tile_id_window=tile_ids,
+            edge_blend_window=edge_blend,
+            drawn_mask_window=drawn_mask,
+            bg_rgb_window=bg_rgb,
+        )
+
+        west_idx = CARDINAL_DIRECTIONS.index((-1, 0))
+        north_idx = CARDINAL_DIRECTIONS.index((0, -1))
+        east_idx = CARDINAL_DIRECTIONS.index((1, 0))
+        west_bit = 1 << west_idx
+        north_bit = 1 << north_idx
+        east_bit = 1 << east_idx
+
+        center_mask = int(neighbor_mask[1, 1])
+        assert center_mask & west_bit
+        assert center_mask & north_bit
+        assert neighbor_bg.shape[2] == len(CARDINAL_DIRECTIONS)
+
+        np.testing.assert_array_equal(neighbor_bg[1, 1, west_idx], (10, 20, 30))
+        np.testing.assert_array_equal(neighbor_bg[1, 1, north_idx], (40, 50, 60))
+
+        # One-sided ownership: west tile (id=5) should not also blend toward the
+        # center tile (id=2) on the same boundary because 5 !< 2.
+        assert (int(neighbor_mask[0, 1]) & east_bit) == 0
+
+        # Left-edge cells should not see wrapped neighbors from the right edge.
+        assert (int(neighbor_mask[0, 1]) & west_bit) == 0
+
+    def test_higher_edge_blend_owns_boundary_even_with_higher_tile_id(self) -> None:
+        """Ownership should follow edge_blend strength, not enum ordering alone."""
+        tile_ids = np.array([[2, 0], [5, 0]], dtype=np.int32)  # x,y indexing
+        edge_blend = np.array([[0.0, 0.0], [0.45, 0.0]], dtype=np.float32)
+        drawn_mask = np.array([[True, False], [True, False]], dtype=np.bool_)
+        bg_rgb = np.zeros((2, 2, 3), dtype=np.uint8)
+        bg_rgb[0, 0] = (10, 10, 10)  # rigid neighbor (west)
+        neighbor_mask, neighbor_bg = _compute_tile_edge_transition_metadata(
+            tile_id_window=tile_ids,
+            edge_blend_window=edge_blend,
+            drawn_mask_window=drawn_mask,
+            bg_rgb_window=bg_rgb,
+        )
+
+        west_idx = CARDINAL_DIRECTIONS.index((-1, 0))
+        west_bit = 1 << west_idx
+
+        # Grass-like tile (id 5) should own the boundary because it has higher
+        # edge_blend than the rigid neighbor (id 2), despite its higher ID.
+        assert int(neighbor_mask[1, 0]) & west_bit
+        np.testing.assert_array_equal(neighbor_bg[1, 0, west_idx], (10, 10, 10))
+        # Rigid tile remains non-owner.
+        assert (
+            int(neighbor_mask[0, 0]) & (1 << CARDINAL_DIRECTIONS.index((1, 0)))
+        ) == 0
+
+    @pytest.mark.parametrize(
+        "architectural_tile_id",
+        [
+            TileTypeID.WALL,
+            TileTypeID.ROOF_THATCH,
+            TileTypeID.ROOF_SHINGLE,
+            TileTypeID.ROOF_TIN,
+        ],
+    )
+    def test_suppresses_blending_toward_architectural_neighbors_only(
+        self, architectural_tile_id: TileTypeID
+    ) -> None:
+        """Grass-side roof/wall blending is suppressed without harming natural edges."""
+        # x-major layout: [architectural][grass][dirt]
+        tile_ids = np.array(
+            [[architectural_tile_id], [TileTypeID.GRASS], [TileTypeID.DIRT]],
+            dtype=np.int32,
+        )
+        edge_blend = tile_types.get_edge_blend_map(tile_ids.astype(np.uint8))
+        drawn_mask = np.ones((3, 1), dtype=np.bool_)
+        bg_rgb = np.zeros((3, 1, 3), dtype=np.uint8)
+        bg_rgb[0, 0] = (5, 5, 5)
+        bg_rgb[2, 0] = (40, 30, 20)
+
+        neighbor_mask, _neighbor_bg = _compute_tile_edge_transition_metadata(
+            tile_id_window=tile_ids,
+            edge_blend_window=edge_blend,
+            drawn_mask_window=drawn_mask,
+            bg_rgb_window=bg_rgb,
+        )
+
+        west_idx = CARDINAL_DIRECTIONS.index((-1, 0))
+        east_idx = CARDINAL_DIRECTIONS.index((1, 0))
+        west_bit = 1 << west_idx
+        east_bit = 1 << east_idx
+        arch_east_bit = 1 << CARDINAL_DIRECTIONS.index((1, 0))
+
+        grass_mask_before = int(neighbor_mask[1, 0])
+        arch_mask_before = int(neighbor_mask[0, 0])
+
+        # Grass should still own its natural boundary with dirt.
+        assert grass_mask_before & east_bit
+
+        # Rigid architectural tiles (wall/shingle/tin roof) force grass to own the
+        # boundary pre-suppression. Thatch may own instead when tuned to higher
+        # edge_blend so the roof can render a soft self-darkened edge.
+        if architectural_tile_id in (
+            TileTypeID.WALL,
+            TileTypeID.ROOF_SHINGLE,
+            TileTypeID.ROOF_TIN,
+        ):
+            assert grass_mask_before & west_bit
+
+        _suppress_edge_blend_toward_hard_edges(
+            edge_neighbor_mask=neighbor_mask, tile_id_window=tile_ids
+        )
+
+        # Grass-side architectural edge is always hard after suppression.
+        assert (int(neighbor_mask[1, 0]) & west_bit) == 0
+        assert int(neighbor_mask[1, 0]) & east_bit
+
+        if architectural_tile_id == TileTypeID.ROOF_THATCH:
+            # Suppression is one-sided: a thatch-owned roof edge remains available
+            # so the roof can use self-darkened soft edges.
+            assert arch_mask_before & arch_east_bit
+            assert int(neighbor_mask[0, 0]) & arch_east_bit
+
+    def test_thatch_edge_neighbor_colors_are_overridden_with_darkened_self_color(
+        self,
+    ) -> None:
+        """Thatch roof edges should darken toward self-color, not neighbor color."""
+        tile_ids = np.array(
+            [[TileTypeID.GRASS], [TileTypeID.ROOF_THATCH], [TileTypeID.DIRT]],
+            dtype=np.int32,
+        )
+        edge_blend = tile_types.get_edge_blend_map(tile_ids.astype(np.uint8))
+        drawn_mask = np.ones((3, 1), dtype=np.bool_)
+        bg_rgb = np.zeros((3, 1, 3), dtype=np.uint8)
+        bg_rgb[0, 0] = (10, 90, 10)  # grass neighbor (green)
+        bg_rgb[1, 0] = (120, 100, 70)  # thatch tile's own color
+        bg_rgb[2, 0] = (80, 55, 35)  # dirt neighbor
+
+        _neighbor_mask, neighbor_bg = _compute_tile_edge_transition_metadata(
+            tile_id_window=tile_ids,
+            edge_blend_window=edge_blend,
+            drawn_mask_window=drawn_mask,
+            bg_rgb_window=bg_rgb,
+        )
+
+        _override_edge_neighbor_bg_with_self_darken(
+            edge_neighbor_bg=neighbor_bg,
+            tile_id_window=tile_ids,
+            bg_rgb_window=bg_rgb,
+        )
+
+        expected = np.array([85, 65, 35], dtype=np.uint8)  # 120/100/70 - 35
+        for direction_index in range(len(CARDINAL_DIRECTIONS)):
+            np.testing.assert_array_equal(neighbor_bg[1, 0, direction_index], expected)
+
+    def test_edge_neighbor_colors_are_unchanged_for_tiles_without_self_darken(
+        self,
+    ) -> None:
+        """Tiles with edge_self_darken=0 keep their normal neighbor colors."""
+        tile_ids = np.array([[TileTypeID.GRASS], [TileTypeID.DIRT]], dtype=np.int32)
+        edge_blend = tile_types.get_edge_blend_map(tile_ids.astype(np.uint8))
+        drawn_mask = np.ones((2, 1), dtype=np.bool_)
+        bg_rgb = np.zeros((2, 1, 3), dtype=np.uint8)
+        bg_rgb[0, 0] = (20, 60, 20)
+        bg_rgb[1, 0] = (70, 50, 30)
+
+        neighbor_mask, neighbor_bg = _compute_tile_edge_transition_metadata(
+            tile_id_window=tile_ids,
+            edge_blend_window=edge_blend,
+            drawn_mask_window=drawn_mask,
+            bg_rgb_window=bg_rgb,
+        )
+        neighbor_bg_before = neighbor_bg.copy()
+
+        _override_edge_neighbor_bg_with_self_darken(
+            edge_neighbor_bg=neighbor_bg,
+            tile_id_window=tile_ids,
+            bg_rgb_window=bg_rgb,
+        )
+
+        east_idx = CARDINAL_DIRECTIONS.index((1, 0))
+        east_bit = 1 << east_idx
+        # Grass owns the grass->dirt boundary in this setup, so the slot is populated
+        # and should remain the actual dirt color after the no-op override pass.
+        assert int(neighbor_mask[0, 0]) & east_bit
+        np.testing.assert_array_equal(neighbor_bg[0, 0, east_idx], bg_rgb[1, 0])
+        np.testing.assert_array_equal(neighbor_bg, neighbor_bg_before)
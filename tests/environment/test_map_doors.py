@@ -1,5 +1,6 @@
 import random
 
+from brileta.environment import tile_types
 from brileta.environment.generators import RoomsAndCorridorsGenerator
 from brileta.environment.map import GameMap
 from brileta.environment.tile_types import TileTypeID
@@ -14,3 +15,32 @@ def test_make_map_places_doors() -> None:
     gm = GameMap(40, 30, map_data)
     num_doors = int((gm.tiles == TileTypeID.DOOR_CLOSED).sum())
     assert num_doors > 0
+
+
+def test_reported_tile_change_patches_derived_maps_in_place() -> None:
+    random.seed(0)
+    generator = RoomsAndCorridorsGenerator(
+        40, 30, max_rooms=5, min_room_size=5, max_room_size=8
+    )
+    gm = GameMap(40, 30, generator.generate())
+    walkable = gm.walkable
+    transparent = gm.transparent
+    emission = gm.emission_map
+    door_x, door_y = (int(v[0]) for v in (gm.tiles == TileTypeID.DOOR_CLOSED).nonzero())
+    assert not walkable[door_x, door_y]
+
+    gm.tiles[door_x, door_y] = TileTypeID.DOOR_OPEN
+    gm.invalidate_property_caches(changed_tiles=[(door_x, door_y)])
+
+    assert gm.walkable is walkable
+    assert gm.transparent is transparent
+    assert walkable[door_x, door_y]
+    assert transparent[door_x, door_y]
+    assert (
+        gm.hazard_costs.tobytes() == tile_types.get_hazard_cost_map(gm.tiles).tobytes()
+    )
+    assert gm.emission_map is emission
+    assert emission.tobytes() == tile_types.get_emission_map(gm.tiles).tobytes()
+
+    gm.invalidate_property_caches()
+    assert gm.walkable is not walkable
@@ -0,0 +1,56 @@
+"""Tests for GameMap exploration tracking."""
+
+from __future__ import annotations
+
+import numpy as np
+
+from brileta.environment.generators.base import GeneratedMapData
+from brileta.environment.map import EXPLORATION_CHUNK_SIZE, GameMap
+from brileta.environment.tile_types import TileTypeID
+
+
+def _game_map(width: int = 40, height: int = 24) -> GameMap:
+    map_data = GeneratedMapData(
+        tiles=np.full((width, height), TileTypeID.FLOOR, dtype=np.uint8, order="F"),
+        regions={},
+        tile_to_region_id=np.full((width, height), -1, dtype=np.int16, order="F"),
+    )
+    return GameMap(width, height, map_data)
+
+
+def test_mark_explored_bumps_only_chunks_that_gained_tiles() -> None:
+    game_map = _game_map()
+    assert game_map.explored_chunk_revisions.shape == (3, 2)
+    mask = np.zeros((40, 24), dtype=bool)
+    mask[EXPLORATION_CHUNK_SIZE + 1, 2] = True
+
+    game_map.mark_explored(mask)
+    game_map.mark_explored(mask)  # Nothing new the second time.
+
+    assert game_map.explored[EXPLORATION_CHUNK_SIZE + 1, 2]
+    assert game_map.exploration_revision == 2
+    expected = np.zeros((3, 2), dtype=np.int64)
+    expected[1, 0] = 1
+    np.testing.assert_array_equal(game_map.explored_chunk_revisions, expected)
+
+
+def test_explored_window_revision_tracks_only_touched_chunks() -> None:
+    game_map = _game_map()
+    left = game_map.explored_window_revision(0, 0, 10, 10)
+    right = game_map.explored_window_revision(30, 0, 40, 24)
+    mask = np.zeros((40, 24), dtype=bool)
+    mask[35, 20] = True
+
+    game_map.mark_explored(mask)
+
+    assert game_map.explored_window_revision(0, 0, 10, 10) == left
+    assert game_map.explored_window_revision(30, 0, 40, 24) > right
+
+
+def test_mark_explored_without_mask_reveals_whole_map() -> None:
+    game_map = _game_map()
+
+    game_map.mark_explored()
+
+    assert game_map.explored.all()
+    assert (game_map.explored_chunk_revisions == 1).all()
@@ -0,0 +1,145 @@
+"""Tests for GameMap's region floor index and per-region appearance rewrites."""
+
+from __future__ import annotations
+
+import numpy as np
+
+from brileta import colors
+from brileta.environment import edge_transitions, tile_types
+from brileta.environment.generators.base import GeneratedMapData
+from brileta.environment.map import GameMap, MapRegion, RegionTileIndex
+from brileta.environment.tile_types import TileTypeID
+
+
+def _build_region_grid_map(size: int = 24, block: int = 4, seed: int = 3) -> GameMap:
+    """A map cut into block-sized regions, alternating indoor and outdoor."""
+    rng = np.random.default_rng(seed)
+    palette = np.array(
+        [TileTypeID.FLOOR, TileTypeID.FLOOR, TileTypeID.GRASS, TileTypeID.WALL],
+        dtype=np.uint8,
+    )
+    tiles = np.asfortranarray(rng.choice(palette, size=(size, size)))
+    xs, ys = np.indices((size, size))
+    per_row = size // block
+    tile_to_region_id = np.asfortranarray(
+        ((xs // block) + (ys // block) * per_row).astype(np.int16)
+    )
+    # A strip with no region and a region id with no MapRegion entry.
+    tile_to_region_id[:, 0] = -1
+    regions = {
+        rid: MapRegion(id=rid, region_type="room", sky_exposure=float(rid % 2))
+        for rid in range(per_row * per_row)
+        if rid != 5
+    }
+    map_data = GeneratedMapData(
+        tiles=tiles,
+        regions=regions,
+        tile_to_region_id=tile_to_region_id,
+        decoration_seed=11,
+    )
+    return GameMap(size, size, map_data)
+
+
+def _reference_appearance_map(game_map: GameMap, is_light: bool) -> np.ndarray:
+    """The per-region full-mask rebuild the index replaces."""
+    if is_light:
+        appearance_map = tile_types.get_light_appearance_map(game_map.tiles).copy()
+    else:
+        appearance_map = tile_types.get_dark_appearance_map(game_map.tiles).copy()
+    floor = game_map.tiles == TileTypeID.FLOOR
+    for region_id, region in game_map.regions.items():
+        mask = (game_map.tile_to_region_id == region_id) & floor
+        appearance_map["bg"][mask] = game_map._get_region_ground_color(region, is_light)
+    return appearance_map
+
+
+class TestRegionTileIndex:
+    def test_groups_masked_tiles_by_region(self) -> None:
+        owners = np.array([[2, -1, 0], [2, 0, 7]], dtype=np.int16)
+        mask = np.array([[True, True, True], [False, True, True]])
+
+        index = RegionTileIndex.build(owners, mask)
+
+        np.testing.assert_array_equal(index.region_ids, [0, 2, 7])
+        np.testing.assert_array_equal(index.counts(), [2, 1, 1])
+        xs, ys = index.tiles_of(0)
+        assert sorted(zip(xs.tolist(), ys.tolist(), strict=True)) == [(0, 2), (1, 1)]
+        assert len(index.tiles_of(3)[0]) == 0
+        assert len(index.tiles_of(99)[0]) == 0
+
+    def test_index_follows_structural_revision(self) -> None:
+        game_map = _build_region_grid_map()
+        index = game_map.region_floor_index
+        assert game_map.region_floor_index is index
+
+        game_map.tiles[:] = TileTypeID.WALL
+        game_map.invalidate_property_caches()
+
+        assert len(game_map.region_floor_index.xs) == 0
+
+
+class TestRegionAwareAppearanceMaps:
+    def test_matches_per_region_mask_rebuild(self) -> None:
+        game_map = _build_region_grid_map()
+
+        for is_light in (False, True):
+            actual = (
+                game_map.light_appearance_map
+                if is_light
+                else game_map.dark_appearance_map
+            )
+            np.testing.assert_array_equal(
+                actual, _reference_appearance_map(game_map, is_light)
+            )
+
+    def test_refresh_region_matches_full_rebuild(self) -> None:
+        game_map = _build_region_grid_map()
+        dark = game_map.dark_appearance_map
+        light = game_map.light_appearance_map
+        dark_edges = game_map.get_edge_transition_maps(is_light=False)
+        revision = game_map.appearance_revision
+
+        game_map.regions[8].sky_exposure = 1.0
+        rect = game_map.refresh_region_appearance(8)
+
+        assert rect is not None
+        assert (rect.x1, rect.y1, rect.x2, rect.y2) == (8, 4, 12, 8)
+        assert game_map.appearance_revision == revision + 1
+        assert game_map.appearance_changed_since(revision) == [rect]
+        assert game_map.dark_appearance_map is dark
+        np.testing.assert_array_equal(dark, _reference_appearance_map(game_map, False))
+        np.testing.assert_array_equal(light, _reference_appearance_map(game_map, True))
+        xs, ys = game_map.region_floor_index.tiles_of(8)
+        assert np.all(dark["bg"][xs, ys] == colors.OUTDOOR_DARK_GROUND)
+
+        fresh = edge_transitions.build_edge_transition_maps(
+            game_map.tiles, dark, game_map.decoration_seed
+        )
+        assert game_map.get_edge_transition_maps(is_light=False) is dark_edges
+        np.testing.assert_array_equal(dark_edges.bg_rgb, fresh.bg_rgb)
+        np.testing.assert_array_equal(dark_edges.neighbor_mask, fresh.neighbor_mask)
+        np.testing.assert_array_equal(dark_edges.neighbor_bg, fresh.neighbor_bg)
+
+    def test_refresh_without_colour_change_reports_nothing(self) -> None:
+        game_map = _build_region_grid_map()
+        _ = game_map.dark_appearance_map
+        revision = game_map.appearance_revision
+
+        game_map.regions[8].sky_exposure = 0.3  # Still indoor ground.
+
+        assert game_map.refresh_region_appearance(8) is None
+        assert game_map.refresh_region_appearance(5) is None  # No MapRegion.
+        assert game_map.appearance_revision == revision
+        assert game_map.appearance_changed_since(revision) == []
+
+    def test_full_invalidation_truncates_change_log(self) -> None:
+        game_map = _build_region_grid_map()
+        _ = game_map.dark_appearance_map
+        revision = game_map.appearance_revision
+        game_map.regions[8].sky_exposure = 1.0
+        game_map.refresh_region_appearance(8)
+
+        game_map.invalidate_appearance_caches()
+
+        assert game_map.appearance_changed_since(revision) is None
+        assert game_map.appearance_changed_since(game_map.appearance_revision) == []
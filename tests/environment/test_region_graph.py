@@ -0,0 +1,287 @@
+import random
+
+import numpy as np
+
+from brileta.environment.generators import GeneratedMapData
+from brileta.environment.map import GameMap, MapRegion
+from brileta.environment.region_graph import ConnectionState
+from brileta.environment.tile_types import TileTypeID
+from brileta.util._native import region_max_product
+
+_ROOM = 4  # interior side of each room in the test grid
+_PITCH = _ROOM + 1
+
+
+def _make_room_grid(rooms: int = 4) -> GameMap:
+    """A rooms x rooms grid of walled rooms, each joined to its right and
+    lower neighbours by a closed door in the shared wall."""
+    size = rooms * _PITCH + 1
+    tiles = np.full((size, size), TileTypeID.WALL, dtype=np.uint8, order="F")
+    tile_to_region_id = np.full((size, size), -1, dtype=np.int16, order="F")
+    regions: dict[int, MapRegion] = {}
+    for i in range(rooms):
+        for j in range(rooms):
+            rid = i * rooms + j
+            x0, y0 = 1 + i * _PITCH, 1 + j * _PITCH
+            tiles[x0 : x0 + _ROOM, y0 : y0 + _ROOM] = TileTypeID.FLOOR
+            tile_to_region_id[x0 : x0 + _ROOM, y0 : y0 + _ROOM] = rid
+            regions[rid] = MapRegion(id=rid, region_type="room")
+    for i in range(rooms):
+        for j in range(rooms):
+            rid = i * rooms + j
+            x0, y0 = 1 + i * _PITCH, 1 + j * _PITCH
+            if i + 1 < rooms:
+                door = (x0 + _ROOM, y0 + _ROOM // 2)
+                tiles[door] = TileTypeID.DOOR_CLOSED
+                regions[rid].connections[rid + rooms] = door
+                regions[rid + rooms].connections[rid] = door
+            if j + 1 < rooms:
+                door = (x0 + _ROOM // 2, y0 + _ROOM)
+                tiles[door] = TileTypeID.DOOR_CLOSED
+                regions[rid].connections[rid + 1] = door
+                regions[rid + 1].connections[rid] = door
+    map_data = GeneratedMapData(
+        tiles=tiles, regions=regions, tile_to_region_id=tile_to_region_id
+    )
+    return GameMap(size, size, map_data)
+
+
+def _expected_state(tile: int) -> ConnectionState:
+    if tile == TileTypeID.DOOR_CLOSED:
+        return ConnectionState.CLOSED
+    if tile in (TileTypeID.DOOR_OPEN, TileTypeID.FLOOR):
+        return ConnectionState.OPEN
+    return ConnectionState.BLOCKED
+
+
+def _assert_invariants(gm: GameMap) -> None:
+    graph = gm.region_graph
+    offsets = graph.offsets
+    assert offsets.dtype == np.int32 and graph.neighbors.dtype == np.int32
+    assert offsets[0] == 0 and offsets[-1] == len(graph.neighbors)
+    assert np.all(np.diff(offsets) >= 0)
+    assert graph.node_count == max(gm.regions) + 1
+    np.testing.assert_array_equal(
+        graph.sources, np.repeat(np.arange(graph.node_count), np.diff(offsets))
+    )
+
+    expected = {
+        (source, neighbor, pos)
+        for source, region in gm.regions.items()
+        for neighbor, pos in region.connections.items()
+    }
+    actual = {
+        (int(s), int(n), (int(x), int(y)))
+        for s, n, x, y in zip(
+            graph.sources, graph.neighbors, graph.door_xs, graph.door_ys, strict=True
+        )
+    }
+    assert actual == expected
+    assert len(actual) == len(graph.neighbors)
+
+    for e in range(len(graph.neighbors)):
+        tile = int(gm.tiles[graph.door_xs[e], graph.door_ys[e]])
+        assert graph.states[e] == _expected_state(tile)
+        assert e in graph.edges_at((int(graph.door_xs[e]), int(graph.door_ys[e])))
+        assert graph.edge_revisions[e] <= graph.revision
+        assert graph.region_revisions[graph.sources[e]] >= graph.edge_revisions[e]
+        assert graph.region_revisions[graph.neighbors[e]] >= graph.edge_revisions[e]
+
+
+def test_region_graph_publishes_connections_as_csr() -> None:
+    gm = _make_room_grid(3)
+    graph = gm.region_graph
+
+    _assert_invariants(gm)
+    assert graph.connection_state(0, 1) == ConnectionState.CLOSED
+    assert graph.connection_state(0, 4) is None
+    assert np.all(graph.edge_revisions == graph.revision)
+
+
+def test_door_toggle_bumps_only_its_edges_and_regions() -> None:
+    gm = _make_room_grid(3)
+    graph = gm.region_graph
+    before_edges = graph.edge_revisions.copy()
+    before_regions = graph.region_revisions.copy()
+    door = gm.regions[0].connections[1]
+
+    gm.tiles[door] = TileTypeID.DOOR_OPEN
+    gm.invalidate_property_caches(changed_tiles=[door])
+    graph = gm.region_graph
+
+    assert graph.connection_state(0, 1) == ConnectionState.OPEN
+    assert graph.connection_state(1, 0) == ConnectionState.OPEN
+    toggled = graph.edges_at(door)
+    assert len(toggled) == 2
+    assert np.all(graph.edge_revisions[toggled] == graph.revision)
+    untouched = np.setdiff1d(np.arange(len(graph.neighbors)), toggled)
+    np.testing.assert_array_equal(
+        graph.edge_revisions[untouched], before_edges[untouched]
+    )
+    assert graph.region_revisions[0] == graph.region_revisions[1] == graph.revision
+    np.testing.assert_array_equal(graph.region_revisions[2:], before_regions[2:])
+
+
+def test_non_connection_tile_change_leaves_graph_revision() -> None:
+    gm = _make_room_grid(3)
+    revision = gm.region_graph.revision
+
+    gm.tiles[2, 2] = TileTypeID.WALL
+    gm.invalidate_property_caches(changed_tiles=[(2, 2)])
+
+    assert gm.region_graph.revision == revision
+
+
+def test_unreported_change_bumps_only_changed_edges() -> None:
+    gm = _make_room_grid(3)
+    graph = gm.region_graph
+    topology = graph.topology_revision
+    door = gm.regions[4].connections[5]
+
+    gm.tiles[door] = TileTypeID.WALL
+    gm.invalidate_property_caches()
+    graph = gm.region_graph
+
+    assert graph.topology_revision == topology
+    assert graph.connection_state(4, 5) == ConnectionState.BLOCKED
+    assert set(np.flatnonzero(graph.edge_revisions == graph.revision)) == set(
+        graph.edges_at(door)
+    )
+
+
+def test_breached_wall_connects_regions() -> None:
+    gm = _make_room_grid(3)
+    # Wall up the door between rooms 0 and 1 so they start unconnected.
+    door = gm.regions[0].connections.pop(1)
+    del gm.regions[1].connections[0]
+    gm.tiles[door] = TileTypeID.WALL
+    graph = gm.region_graph
+    kept_revision = graph.edge_revisions[graph.edge_index(0, 3)]
+
+    # A wall tile between rooms 0 and 1, away from the old door.
+    breach = (1, _PITCH)
+    gm.tiles[breach] = TileTypeID.FLOOR
+    gm.invalidate_property_caches(changed_tiles=[breach])
+    graph = gm.region_graph
+
+    _assert_invariants(gm)
+    assert graph.topology_revision == graph.revision
+    assert graph.connection_state(0, 1) == ConnectionState.OPEN
+    assert graph.connection_state(1, 0) == ConnectionState.OPEN
+    assert gm.regions[0].connections[1] == breach
+    assert graph.edge_revisions[graph.edge_index(0, 3)] == kept_revision
+    assert graph.region_revisions[0] == graph.region_revisions[1] == graph.revision
+
+
+def _wall_off_rooms_0_and_1(gm: GameMap) -> None:
+    door = gm.regions[0].connections.pop(1)
+    del gm.regions[1].connections[0]
+    gm.tiles[door] = TileTypeID.WALL
+    gm.invalidate_property_caches(changed_tiles=[door])
+
+
+def test_breach_is_connected_when_reported_not_when_graph_is_read() -> None:
+    gm = _make_room_grid(3)
+    _wall_off_rooms_0_and_1(gm)
+    breach = (1, _PITCH)
+
+    # Reading the graph never writes connections, even with a breach pending.
+    gm.tiles[breach] = TileTypeID.FLOOR
+    assert gm.region_graph.connection_state(0, 1) is None
+    assert 1 not in gm.regions[0].connections
+
+    gm.invalidate_property_caches(changed_tiles=[breach])
+
+    assert gm.regions[0].connections[1] == breach
+    assert gm.region_graph.connection_state(0, 1) == ConnectionState.OPEN
+    _assert_invariants(gm)
+
+
+def test_unreported_breach_is_found_by_full_rescan() -> None:
+    gm = _make_room_grid(3)
+    _wall_off_rooms_0_and_1(gm)
+    topology = gm.region_graph.topology_revision
+    breach = (1, _PITCH)
+
+    gm.tiles[breach] = TileTypeID.FLOOR
+    gm.invalidate_property_caches()
+    graph = gm.region_graph
+
+    assert graph.topology_revision > topology
+    assert graph.connection_state(0, 1) == ConnectionState.OPEN
+    assert gm.regions[1].connections[0] == breach
+    _assert_invariants(gm)
+
+
+def test_breach_survives_tile_change_log_overflow() -> None:
+    gm = _make_room_grid(3)
+    _wall_off_rooms_0_and_1(gm)
+    graph = gm.region_graph
+    revision = gm.structural_revision
+    breach = (1, _PITCH)
+
+    gm.tiles[breach] = TileTypeID.FLOOR
+    gm.invalidate_property_caches(changed_tiles=[breach])
+    for _ in range(300):
+        gm.invalidate_property_caches(changed_tiles=[(2, 2)])
+    assert gm.tiles_changed_since(revision) is None
+
+    graph = gm.region_graph
+    assert graph.connection_state(0, 1) == ConnectionState.OPEN
+    _assert_invariants(gm)
+
+
+def test_random_door_toggles_keep_graph_invariants() -> None:
+    rng = random.Random(1234)
+    gm = _make_room_grid(5)
+    doors = sorted({pos for r in gm.regions.values() for pos in r.connections.values()})
+    graph = gm.region_graph
+    topology = graph.topology_revision
+
+    for step in range(300):
+        before_states = graph.states.copy()
+        before_edges = graph.edge_revisions.copy()
+        before_regions = graph.region_revisions.copy()
+        revision = graph.revision
+
+        flipped = rng.sample(doors, rng.randint(1, 4))
+        for pos in flipped:
+            gm.tiles[pos] = (
+                TileTypeID.DOOR_OPEN
+                if gm.tiles[pos] == TileTypeID.DOOR_CLOSED
+                else TileTypeID.DOOR_CLOSED
+            )
+        # Mostly reported, occasionally wholesale, sometimes batched into
+        # a single revision.
+        if step % 17 == 0:
+            gm.invalidate_property_caches()
+        elif step % 5 == 0:
+            gm.invalidate_property_caches(changed_tiles=flipped)
+        else:
+            for pos in flipped:
+                gm.invalidate_property_caches(changed_tiles=[pos])
+        graph = gm.region_graph
+
+        _assert_invariants(gm)
+        assert graph.topology_revision == topology
+        assert graph.revision == revision + 1
+        moved = graph.states != before_states
+        touched = {e for pos in flipped for e in graph.edges_at(pos)}
+        assert set(np.flatnonzero(moved)) == touched
+        assert np.all(graph.edge_revisions[moved] == graph.revision)
+        np.testing.assert_array_equal(
+            graph.edge_revisions[~moved], before_edges[~moved]
+        )
+        hit = np.zeros(graph.node_count, dtype=bool)
+        hit[graph.sources[moved]] = True
+        hit[graph.neighbors[moved]] = True
+        assert np.all(graph.region_revisions[hit] == graph.revision)
+        np.testing.assert_array_equal(
+            graph.region_revisions[~hit], before_regions[~hit]
+        )
+
+        # Doors are never blocked, so every room stays reachable natively.
+        factors = np.where(graph.states == ConnectionState.OPEN, 0.6, 0.15)
+        field = np.zeros(graph.node_count)
+        region_max_product(graph.offsets, graph.neighbors, factors, 0, field)
+        assert np.all(field > 0.0)
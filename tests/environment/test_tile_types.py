@@ -9,6 +9,7 @@ from brileta.environment.tile_types import (
     get_tile_material,
 )
 from brileta.game.enums import ImpactMaterial
+from brileta.util.rng import derive_spatial_seed_array
 
 
 def test_get_walkable_map():
@@ -562,3 +563,126 @@ def test_decoration_locked_fg_when_zero_fg_jitter() -> None:
     fg_offsets = fg[:, 0].astype(np.int16) - 128
     bg_offsets = bg[:, 0].astype(np.int16) - 128
     np.testing.assert_array_equal(fg_offsets, bg_offsets)
+
+
+def _reference_decoration(
+    chars: np.ndarray,
+    fg_rgb: np.ndarray,
+    bg_rgb: np.ndarray,
+    tile_ids: np.ndarray,
+    world_x: np.ndarray,
+    world_y: np.ndarray,
+    decoration_seed: int,
+) -> None:
+    """The per-pool numpy decoration the native kernel replaced."""
+    h = derive_spatial_seed_array(world_x, world_y, map_seed=decoration_seed)
+    for tid, pool in tile_types.TERRAIN_GLYPH_POOLS.items():
+        mask = tile_ids == tid
+        if not np.any(mask):
+            continue
+        tile_hash = h[mask]
+        codes = pool.glyph_codes
+        chars[mask] = codes[np.abs(tile_hash % len(codes)).astype(np.intp)]
+        bg_brightness = (tile_hash >> 8) % (2 * pool.bg_jitter + 1) - pool.bg_jitter
+        bg_offset = np.column_stack([bg_brightness] * 3)
+        bg_rgb[mask] = np.clip(bg_rgb[mask].astype(np.int16) + bg_offset, 0, 255)
+        if pool.fg_jitter > 0:
+            fg_range = 2 * pool.fg_jitter + 1
+            fg_brightness = (tile_hash >> 16) % fg_range - pool.fg_jitter
+            fg_offset = np.column_stack([fg_brightness] * 3)
+        else:
+            fg_offset = bg_offset
+        fg_rgb[mask] = np.clip(fg_rgb[mask].astype(np.int16) + fg_offset, 0, 255)
+
+
+@pytest.mark.parametrize("trial", range(8))
+def test_decoration_matches_per_pool_reference_bit_for_bit(trial: int) -> None:
+    """Randomized ids, coordinates (incl. negative), seeds and dtypes."""
+    rng = np.random.default_rng(trial)
+    n = 5000
+    tile_dtype = (np.uint8, np.int32, np.int64)[trial % 3]
+    coord_dtype = (np.int32, np.int64)[trial % 2]
+    tile_ids = rng.integers(0, len(TileTypeID), n).astype(tile_dtype)
+    world_x = rng.integers(-5000, 5000, n).astype(coord_dtype)
+    world_y = rng.integers(-(2**20), 2**20, n).astype(coord_dtype)
+    seed = int(rng.integers(0, 2**32))
+
+    # Strided field views, like the appearance-map slices the renderer passes.
+    appearance = np.zeros(n, dtype=tile_types.TileTypeAppearance)
+    appearance["ch"] = rng.integers(0, 1000, n)
+    appearance["fg"] = rng.integers(0, 256, (n, 3))
+    appearance["bg"] = rng.integers(0, 256, (n, 3))
+    expected = appearance.copy()
+
+    tile_types.apply_terrain_decoration(
+        appearance["ch"],
+        appearance["fg"],
+        appearance["bg"],
+        tile_ids,
+        world_x,
+        world_y,
+        seed,
+    )
+    _reference_decoration(
+        expected["ch"], expected["fg"], expected["bg"], tile_ids, world_x, world_y, seed
+    )
+
+    assert appearance.tobytes() == expected.tobytes()
+
+
+_FUSED_GETTERS = {
+    "walkable": tile_types.get_walkable_map,
+    "transparent": tile_types.get_transparent_map,
+    "shadow_height": tile_types.get_shadow_height_map,
+    "hazard_cost": tile_types.get_hazard_cost_map,
+    "animation": tile_types.get_animation_map,
+    "emission": tile_types.get_emission_map,
+    "sub_tile_jitter": tile_types.get_sub_tile_jitter_map,
+    "sub_tile_pattern": tile_types.get_sub_tile_pattern_map,
+    "edge_blend": tile_types.get_edge_blend_map,
+}
+
+
+@pytest.mark.parametrize("order", ["C", "F"])
+def test_fused_property_maps_match_getters_byte_for_byte(order: str) -> None:
+    """Every fused output equals its get_*_map() getter, dtype and bytes."""
+    assert set(_FUSED_GETTERS) == set(tile_types.TILE_PROPERTY_FIELDS)
+    rng = np.random.default_rng(4)
+    tiles = np.array(
+        rng.integers(0, len(TileTypeID), size=(37, 23)), dtype=np.uint8, order=order
+    )
+
+    maps = tile_types.build_tile_property_maps(tiles)
+
+    for name, getter in _FUSED_GETTERS.items():
+        expected = getter(tiles)
+        assert maps[name].dtype == expected.dtype, name
+        assert maps[name].shape == expected.shape, name
+        assert maps[name].tobytes() == expected.tobytes(), name
+        assert maps[name].flags.f_contiguous == expected.flags.f_contiguous, name
+
+
+def test_fused_property_fill_patches_only_the_dirty_rect() -> None:
+    rng = np.random.default_rng(9)
+    tiles = np.asfortranarray(
+        rng.integers(0, len(TileTypeID), size=(20, 16)).astype(np.uint8)
+    )
+    maps = tile_types.build_tile_property_maps(tiles, ("walkable", "animation"))
+    before = {name: values.copy() for name, values in maps.items()}
+
+    tiles[3:9, 4:7] = rng.integers(0, len(TileTypeID), size=(6, 3))
+    tile_types.fill_tile_property_maps(tiles, maps, (3, 4, 9, 7))
+
+    fresh = tile_types.build_tile_property_maps(tiles, ("walkable", "animation"))
+    inside = np.zeros(tiles.shape, dtype=bool)
+    inside[3:9, 4:7] = True
+    for name in maps:
+        assert maps[name].tobytes() == fresh[name].tobytes(), name
+        assert maps[name][~inside].tobytes() == before[name][~inside].tobytes()
+
+
+def test_fused_property_fill_rejects_unknown_tile_ids() -> None:
+    tiles = np.full((3, 3), len(TileTypeID), dtype=np.uint8)
+
+    with pytest.raises(IndexError):
+        tile_types.build_tile_property_maps(tiles)
@@ -112,6 +112,18 @@ def test_build_context_collects_nearby_items_and_hostiles() -> None:
     assert ctx.selected_actor == hostile
 
 
+def test_build_context_drops_visible_actors_without_line_of_sight() -> None:
+    controller, player, hostile, _friend, _knife = _make_context_world()
+    controller.gw.game_map.tiles[3, 3] = TileTypeID.WALL
+    controller.gw.game_map.invalidate_property_caches(changed_tiles=[(3, 3)])
+    disc = ActionDiscovery()
+
+    ctx = disc._build_context(cast(Controller, controller), player)
+
+    assert hostile not in ctx.nearby_actors
+    assert not ctx.in_combat
+
+
 def _make_combat_world():
     gw = DummyGameWorld()
     player = Character(
@@ -510,6 +522,7 @@ def test_tile_specific_door_actions() -> None:
 
     # Test 1: Adjacent door (player at 0,0, door at 1,0 - distance 1)
     gw.game_map.tiles[1, 0] = TileTypeID.DOOR_CLOSED
+    gw.game_map.invalidate_property_caches(changed_tiles=[(1, 0)])
 
     adjacent_actions = disc.environment_discovery.discover_environment_actions_for_tile(
         cast(Controller, controller), player, ctx, 1, 0
@@ -340,6 +340,7 @@ def test_execute_intent_returns_failure_for_blocked_move() -> None:
     controller, player = _make_world()
     gm = controller.gw.game_map
     gm.tiles[1, 0] = TileTypeID.WALL
+    gm.invalidate_property_caches(changed_tiles=[(1, 0)])
 
     router = ActionRouter(cast(Controller, controller))
     intent = MoveIntent(cast(Controller, controller), player, 1, 0)
@@ -11,6 +11,7 @@ from brileta.sprites.characters import (
     CHARACTER_DIRECTIONAL_POSE_COUNT,
     CHARACTER_FRAMES_PER_FACING,
     CHARACTER_POSE_COUNT,
+    CHARACTER_POSES,
     FEM_PRESENTATION,
     MASC_PRESENTATION,
     POSE_BACK_STAND,
@@ -21,8 +22,14 @@ from brileta.sprites.characters import (
     CharacterAppearance,
     draw_character_pose,
     generate_character_pose_set,
+    generate_character_pose_sets,
     generate_character_sprite,
 )
+from brileta.sprites.characters.masks import PixelMask, render_mask
+from brileta.sprites.characters.renderer import (
+    _render_pose_reference,
+    _render_pose_sets,
+)
 
 
 def _hair_like_count(
@@ -583,3 +590,93 @@ def test_robe_front_shows_skin_vneck_on_chest() -> None:
         np.linalg.norm(rgb - skin_mid, axis=1) < np.linalg.norm(rgb - cloth_mid, axis=1)
     )
     assert skin_like > 0
+
+
+def _render_mask_reference(
+    canvas: np.ndarray,
+    mask: PixelMask,
+    palette: tuple[tuple[int, int, int], ...],
+    hx: float,
+    hy: float,
+    hr: float,
+    mirror: bool,
+) -> None:
+    """The per-pixel Python loop render_mask replaced, kept as the oracle."""
+    rows, cols = mask.tones.shape
+    left, right = hx + hr * mask.x0_f, hx + hr * mask.x1_f
+    top, bottom = hy + hr * mask.y0_f, hy + hr * mask.y1_f
+    h, w = canvas.shape[:2]
+    span_x, span_y = right - left, bottom - top
+    if span_x <= 0 or span_y <= 0:
+        return
+    for py in range(max(0, int(np.floor(top))), min(h, int(np.ceil(bottom)))):
+        row = int((py + 0.5 - top) / span_y * rows)
+        if row < 0 or row >= rows:
+            continue
+        for px in range(max(0, int(np.floor(left))), min(w, int(np.ceil(right)))):
+            col = int((px + 0.5 - left) / span_x * cols)
+            if col < 0 or col >= cols:
+                continue
+            tone = int(mask.tones[row, cols - 1 - col if mirror else col])
+            if tone >= 0:
+                canvas[py, px] = (*palette[tone], 255)
+
+
+def test_native_render_mask_matches_python_reference() -> None:
+    rng = np.random.default_rng(11)
+    palette = ((10, 20, 30), (90, 100, 110), (200, 210, 220))
+    for _ in range(200):
+        tones = rng.integers(-1, 3, size=(rng.integers(2, 12), rng.integers(2, 12)))
+        x0, y0 = rng.uniform(-1.6, 0.0, size=2)
+        mask = PixelMask(
+            tones=tones.astype(np.int8),
+            x0_f=float(x0),
+            y0_f=float(y0),
+            x1_f=float(x0 + rng.uniform(0.3, 2.5)),
+            y1_f=float(y0 + rng.uniform(0.3, 2.5)),
+        )
+        hx, hy = rng.uniform(-2.0, 22.0, size=2)
+        hr = float(rng.uniform(1.5, 6.0))
+        mirror = bool(rng.integers(0, 2))
+        base = rng.integers(0, 256, size=(20, 20, 4)).astype(np.uint8)
+
+        expected = base.copy()
+        _render_mask_reference(expected, mask, palette, hx, hy, hr, mirror)
+        actual = base.copy()
+        render_mask(actual, mask, palette, hx, hy, hr, mirror=mirror)
+        np.testing.assert_array_equal(actual, expected)
+
+
+def test_batch_pose_sets_match_per_seed_generation() -> None:
+    seeds = [3, 17, 17, 99]
+    profiles = [None, MASC_PRESENTATION, FEM_PRESENTATION, None]
+    batch = generate_character_pose_sets(seeds, presentation_profiles=profiles)
+    assert len(batch) == len(seeds)
+    for seed, profile, pose_set in zip(seeds, profiles, batch, strict=True):
+        single = generate_character_pose_set(seed, presentation_profile=profile)
+        for a, b in zip(pose_set, single, strict=True):
+            np.testing.assert_array_equal(a, b)
+
+
+def test_native_compositor_matches_python_layer_pipeline() -> None:
+    profiles = [None, MASC_PRESENTATION, FEM_PRESENTATION]
+    appearances = [
+        CharacterAppearance.from_seed(
+            seed,
+            size,
+            forced_build_idx=None if seed % 6 == 5 else seed % 6,
+            presentation_profile=profiles[seed % 3],
+        )
+        for seed in range(90)
+        for size in (12, 16, 20, 24)
+    ]
+    # The sample must reach every hair style and clothing style.
+    assert {a.hair_style_idx for a in appearances} == set(range(5))
+    assert {a.clothing_style_idx for a in appearances} == set(range(6))
+
+    batch = _render_pose_sets(appearances, CHARACTER_POSES)
+    for appearance, canvases in zip(appearances, batch, strict=True):
+        for pose, canvas in zip(CHARACTER_POSES, canvases, strict=True):
+            np.testing.assert_array_equal(
+                canvas, _render_pose_reference(appearance, pose)
+            )
@@ -14,6 +14,7 @@ from brileta.sprites.quadrupeds import (
     QuadrupedAppearance,
     draw_quadruped_pose,
     generate_quadruped_pose_set,
+    generate_quadruped_pose_sets,
 )
 from brileta.types import Facing
 
@@ -109,3 +110,10 @@ def test_dog_type_opts_into_critter_sprites() -> None:
     assert DOG_TYPE.critter_preset is DOG_PRESET
     dog = DOG_TYPE.create(0, 0, "Rex")
     assert dog.critter_preset is DOG_PRESET
+
+
+def test_batch_pose_sets_match_per_seed_generation() -> None:
+    seeds = [1, 2, 40]
+    batch = generate_quadruped_pose_sets(seeds, [DOG_PRESET] * len(seeds))
+    for seed, pose_set in zip(seeds, batch, strict=True):
+        assert _digest(pose_set) == _digest(generate_quadruped_pose_set(seed))
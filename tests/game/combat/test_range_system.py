@@ -87,3 +87,76 @@ def test_get_line():
         (2, 2),
         (3, 3),
     ]
+
+
+def _bresenham_los(
+    transparent: np.ndarray, start_x: int, start_y: int, end_x: int, end_y: int
+) -> bool:
+    """Reference semantics: every interior get_line() point is transparent."""
+    points = ranges.get_line(start_x, start_y, end_x, end_y)
+    return all(transparent[x, y] for x, y in points[1:-1])
+
+
+def _random_walls(seed: int, width: int = 24, height: int = 18) -> np.ndarray:
+    rng = np.random.default_rng(seed)
+    return rng.random((width, height)) > 0.25
+
+
+def test_native_has_line_of_sight_matches_bresenham():
+    transparent = _random_walls(1)
+    game_map = DummyMap(transparent)
+    rng = np.random.default_rng(2)
+    for _ in range(2000):
+        sx, dx = rng.integers(0, 24, size=2).tolist()
+        sy, dy = rng.integers(0, 18, size=2).tolist()
+        assert ranges.has_line_of_sight(game_map, sx, sy, dx, dy) == _bresenham_los(
+            transparent, sx, sy, dx, dy
+        )
+
+
+def test_line_of_sight_mask_matches_bresenham():
+    transparent = _random_walls(3)
+    game_map = DummyMap(transparent)
+    origin_x, origin_y = 5, 4
+    # The box hangs off the top-left edge of the map on purpose.
+    box_x, box_y, box_w, box_h = -3, -2, 17, 15
+
+    mask = ranges.line_of_sight_mask(
+        game_map, origin_x, origin_y, box_x, box_y, box_w, box_h
+    )
+
+    assert mask.shape == (box_w, box_h)
+    for i in range(box_w):
+        for j in range(box_h):
+            tx, ty = box_x + i, box_y + j
+            if not (0 <= tx < 24 and 0 <= ty < 18):
+                assert not mask[i, j]
+                continue
+            assert mask[i, j] == _bresenham_los(
+                transparent, origin_x, origin_y, tx, ty
+            ), (tx, ty)
+
+
+def test_has_line_of_sight_batch_matches_bresenham():
+    transparent = _random_walls(4)
+    # Opaque endpoints must not block: only interior points are tested.
+    transparent[0, 0] = False
+    game_map = DummyMap(transparent)
+    rng = np.random.default_rng(5)
+    src_x = rng.integers(0, 24, 500)
+    src_y = rng.integers(0, 18, 500)
+    dst_x = rng.integers(0, 24, 500)
+    dst_y = rng.integers(0, 18, 500)
+    src_x[:3] = 0
+    src_y[:3] = 0
+
+    result = ranges.has_line_of_sight_batch(game_map, src_x, src_y, dst_x, dst_y)
+
+    expected = [
+        _bresenham_los(transparent, *pair)
+        for pair in zip(
+            src_x.tolist(), src_y.tolist(), dst_x.tolist(), dst_y.tolist(), strict=True
+        )
+    ]
+    assert result.dtype == np.bool_
+    assert result.tolist() == expected
@@ -68,6 +68,7 @@ def test_move_checks_walkable_tiles() -> None:
     player.y = 2
     # Make tile to the right a wall
     gw.game_map.tiles[3, 2] = TileTypeID.WALL
+    gw.game_map.invalidate_property_caches(changed_tiles=[(3, 2)])
     intent = MoveIntent(cast(Controller, controller), player, dx=1, dy=0)
     result = MoveExecutor().execute(intent)
     assert result is not None
@@ -1093,8 +1093,8 @@ def test_on_approach_result_pops_path_on_success() -> None:
     assert active_plan.cached_path[0] == (2, 0)
 
 
-def test_on_approach_result_invalidates_path_on_failure() -> None:
-    """_on_approach_result sets cached_path to None when move fails."""
+def test_on_approach_result_repairs_path_on_failure() -> None:
+    """A blocked move repairs cached_path around the blocker in place."""
     from brileta.game.action_plan import ActivePlan, PlanContext, WalkToPlan
     from brileta.game.actions.base import GameActionResult
 
@@ -1111,14 +1111,51 @@ def test_on_approach_result_invalidates_path_on_failure() -> None:
     active_plan.cached_path = deque([(1, 0), (2, 0), (3, 0)])
     player.active_plan = active_plan
 
-    # Simulate a failed move result
-    result = GameActionResult(succeeded=False)
+    # Someone steps onto the next tile and the move fails.
+    blocker = Character(
+        1, 0, "b", colors.RED, "Bystander", game_world=cast(GameWorld, controller.gw)
+    )
+    controller.gw.add_actor(blocker)
+    tm._on_approach_result(player, GameActionResult(succeeded=False))
 
-    # Call _on_approach_result
-    tm._on_approach_result(player, result)
+    assert active_plan.cached_path is not None
+    assert (1, 0) not in active_plan.cached_path
+    assert active_plan.cached_path[-1] == (3, 0)
+    assert len(active_plan.cached_path) == 3
+    repair = active_plan.path_repair
+    assert repair is not None
+
+    # The bystander moves on; the same planner restores the straight route.
+    controller.gw.remove_actor(blocker)
+    tm._on_approach_result(player, GameActionResult(succeeded=False))
+
+    assert active_plan.path_repair is repair
+    assert list(active_plan.cached_path) == [(1, 0), (2, 0), (3, 0)]
+
+
+def test_on_approach_result_invalidates_cross_region_path_on_failure() -> None:
+    """A blocked move on a cross-region route drops the path for a re-plan."""
+    from brileta.game.action_plan import ActivePlan, PlanContext, WalkToPlan
+    from brileta.game.actions.base import GameActionResult
+
+    controller, player = _make_world()
+    tm = controller.turn_manager
+
+    context = PlanContext(
+        actor=player,
+        controller=cast(Controller, controller),
+        target_position=(3, 0),
+    )
+    active_plan = ActivePlan(plan=WalkToPlan, context=context)
+    active_plan.cached_path = deque([(1, 0), (2, 0), (3, 0)])
+    active_plan.cached_hierarchical_path = [0, 1]
+    player.active_plan = active_plan
+
+    tm._on_approach_result(player, GameActionResult(succeeded=False))
 
     # Path should be invalidated (set to None for recalculation)
     assert active_plan.cached_path is None
+    assert active_plan.cached_hierarchical_path is None
 
 
 def test_pc_can_open_doors_by_default() -> None:
@@ -1497,6 +1534,52 @@ def test_handle_approach_step_invalidates_stale_path_when_target_moves(
     assert list(active_plan.cached_path) == [(0, 1)]
 
 
+def test_handle_approach_step_paths_next_to_occupied_target() -> None:
+    """An occupied target is approached with one stop-distance search."""
+    from brileta.game.action_plan import (
+        ActionPlan,
+        ActivePlan,
+        ApproachStep,
+        PlanContext,
+    )
+
+    controller, player = _make_world()
+    tm = controller.turn_manager
+
+    enemy = Character(
+        6,
+        3,
+        "r",
+        colors.RED,
+        "Raider",
+        game_world=cast(GameWorld, controller.gw),
+    )
+    controller.gw.add_actor(enemy)
+
+    context = PlanContext(
+        actor=player,
+        controller=cast(Controller, controller),
+        target_actor=enemy,
+    )
+    approach_plan = ActionPlan(
+        name="Approach",
+        steps=[ApproachStep(stop_distance=1)],
+        requires_target=True,
+    )
+    active_plan = ActivePlan(plan=approach_plan, context=context)
+    player.active_plan = active_plan
+
+    step = active_plan.get_current_step()
+    assert isinstance(step, ApproachStep)
+    intent = tm._handle_approach_step(player, active_plan, step)
+
+    assert isinstance(intent, MoveIntent)
+    assert active_plan.cached_path is not None
+    end_x, end_y = active_plan.cached_path[-1]
+    assert max(abs(end_x - enemy.x), abs(end_y - enemy.y)) == 1
+    assert len(active_plan.cached_path) == 5
+
+
 def test_process_all_npc_reactions_rewinds_npc_plan_on_not_adjacent() -> None:
     """NPC active plans rewind to approach when intent returns not_adjacent."""
     from brileta.game.action_plan import (
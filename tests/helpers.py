@@ -464,6 +464,9 @@ class DummyGraphicsContext(GraphicsContext):
     def draw_texture_alpha(self, *_a: object, **_kw: object) -> None:
         return
 
+    def draw_texture_quads(self, *_a: object, **_kw: object) -> None:
+        return
+
     def draw_debug_tile_grid(self, *_a: object, **_kw: object) -> None:
         return
 
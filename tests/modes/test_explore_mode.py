@@ -113,7 +113,7 @@ def make_explore_mode() -> tuple[ExploreMode, Any, DummyGameWorld]:
         last_input_time=0.0,
         action_count_for_latency_metric=0,
         _execute_player_action_immediately=lambda intent: None,
-        turn_manager=SimpleNamespace(on_player_action=lambda: None),
+        _pass_player_turn=lambda: None,
     )
 
     mode = ExploreMode(cast(Any, controller))
@@ -10,7 +10,15 @@ from unittest.mock import MagicMock
 import numpy as np
 import pytest
 
-from brileta.backends.wgpu.sprite_atlas import PADDING, SpriteAtlas, compute_atlas_size
+from brileta.backends.wgpu.sprite_atlas import (
+    PADDING,
+    PagedSpriteAtlas,
+    SpriteAtlas,
+    compute_atlas_size,
+    required_atlas_side,
+    sprite_content_key,
+    unique_sprites,
+)
 from brileta.types import SpriteUV
 
 
@@ -26,6 +34,49 @@ def _make_pixels(width: int, height: int) -> np.ndarray:
     return np.zeros((height, width, 4), dtype=np.uint8)
 
 
+def _random_sprites(count: int, seed: int = 7) -> list[np.ndarray]:
+    """Variable-size sprites with random pixels, so misplaced bytes show up."""
+    rng = np.random.default_rng(seed)
+    return [
+        rng.integers(
+            0, 256, size=(int(rng.integers(4, 30)), int(rng.integers(4, 30)), 4)
+        ).astype(np.uint8)
+        for _ in range(count)
+    ]
+
+
+class _RecordingQueue:
+    """Stands in for the GPU queue, applying write_texture calls to an array."""
+
+    def __init__(self, width: int, height: int) -> None:
+        self.texture = np.zeros((height, width, 4), dtype=np.uint8)
+        self.calls = 0
+
+    def write_texture(
+        self, dest: dict, data: memoryview, layout: dict, size: tuple
+    ) -> None:
+        self.calls += 1
+        x, y, _ = dest["origin"]
+        w, h, _ = size
+        pixels = np.frombuffer(bytes(data), dtype=np.uint8).reshape(h, w, 4)
+        self.texture[y : y + h, x : x + w] = pixels
+
+
+def _expected_texture(
+    size: int, sprites: list[np.ndarray], uvs: list[SpriteUV | None]
+) -> np.ndarray:
+    """Texture contents implied by UVs: each sprite plus its bottom-row pad."""
+    texture = np.zeros((size, size, 4), dtype=np.uint8)
+    for px, uv in zip(sprites, uvs, strict=True):
+        assert uv is not None
+        x, y = round(uv.u1 * size), round(uv.v1 * size)
+        h, w = px.shape[:2]
+        texture[y : y + h, x : x + w] = px
+        if y + h < size:
+            texture[y + h, x : x + w] = px[h - 1]
+    return texture
+
+
 class TestSpriteAtlasAllocation:
     """Core allocation and UV coordinate tests."""
 
@@ -314,6 +365,49 @@ class TestBulkPackAll:
         uvs = atlas.pack_all(sprites)
         assert all(uv is not None for uv in uvs)
 
+    def test_native_pack_matches_python_shelf_reference(self) -> None:
+        """The native packer places and blits exactly like the Python loop it
+        replaced: tallest-first shelf placement plus bottom-row extension."""
+        size = 128
+        sprites = _random_sprites(60)
+        atlas = SpriteAtlas(_make_mock_resource_manager(), width=size, height=size)
+        uvs = atlas.pack_all(sprites)
+
+        ref = SpriteAtlas(_make_mock_resource_manager(), width=size, height=size)
+        ref_uvs: list[SpriteUV | None] = [None] * len(sprites)
+        order = sorted(
+            range(len(sprites)), key=lambda i: sprites[i].shape[0], reverse=True
+        )
+        for i in order:
+            h, w = sprites[i].shape[:2]
+            pos = ref._shelf_place(w + PADDING, h + PADDING)
+            if pos is not None:
+                ref_uvs[i] = ref._uv_for(pos[0], pos[1], w, h)
+
+        assert uvs == ref_uvs
+        assert any(uv is None for uv in uvs), "test should overflow the atlas"
+        assert (atlas._shelf_x, atlas._shelf_y, atlas._shelf_h) == (
+            ref._shelf_x,
+            ref._shelf_y,
+            ref._shelf_h,
+        )
+        placed = [(px, uv) for px, uv in zip(sprites, uvs, strict=True) if uv]
+        assert atlas._cpu_buffer is not None
+        np.testing.assert_array_equal(
+            atlas._cpu_buffer,
+            _expected_texture(size, [px for px, _ in placed], [uv for _, uv in placed]),
+        )
+
+    def test_sprite_larger_than_atlas_is_skipped(self) -> None:
+        """An oversize sprite gets no slot and does not disturb later packing."""
+        atlas = SpriteAtlas(_make_mock_resource_manager(), width=64, height=64)
+        uvs = atlas.pack_all([_make_pixels(8, 100), _make_pixels(10, 10)])
+
+        assert uvs[0] is None
+        assert uvs[1] is not None
+        assert (atlas._shelf_x, atlas._shelf_y) == (10 + PADDING, 0)
+        assert atlas.pack_incremental([_make_pixels(100, 8)]) == [None]
+
     def test_end_to_end_with_compute_atlas_size(self) -> None:
         """Full pipeline: compute size, pack_all, flush."""
         sprites = [_make_pixels(20, 20) for _ in range(500)]
@@ -359,16 +453,34 @@ class TestPackIncremental:
                 assert batch is not None
                 assert not _overlaps(late, batch)
 
-    def test_uploads_one_write_per_sprite(self) -> None:
-        """Each late sprite is a partial upload (region + its bottom-row pad)."""
+    def test_uploads_one_write_per_shelf_row(self) -> None:
+        """Late sprites on the same shelf row share one partial upload."""
         rm = _make_mock_resource_manager()
         atlas = SpriteAtlas(rm, width=128, height=128)
         atlas.pack_all([_make_pixels(20, 20) for _ in range(5)])
         atlas.flush()
         rm.queue.write_texture.reset_mock()
-        atlas.pack_incremental([_make_pixels(20, 20), _make_pixels(20, 20)])
-        # Two sprites, each a region write plus a bottom-row edge-extension write.
-        assert rm.queue.write_texture.call_count == 4
+        # The first late sprite finishes the batch row; the next three start a
+        # new row together.
+        atlas.pack_incremental([_make_pixels(20, 20) for _ in range(4)])
+        assert rm.queue.write_texture.call_count == 2
+
+    def test_coalesced_upload_matches_per_sprite_pixels(self) -> None:
+        """Row-band uploads leave the texture exactly as per-sprite writes would."""
+        size = 128
+        rm = _make_mock_resource_manager()
+        rm.queue = _RecordingQueue(size, size)
+        atlas = SpriteAtlas(rm, width=size, height=size)
+        batch = _random_sprites(12, seed=1)
+        late = _random_sprites(20, seed=2)
+        batch_uvs = atlas.pack_all(batch)
+        atlas.flush()
+        late_uvs = atlas.pack_incremental(late)
+
+        np.testing.assert_array_equal(
+            rm.queue.texture,
+            _expected_texture(size, batch + late, batch_uvs + late_uvs),
+        )
 
     def test_returns_none_when_full(self) -> None:
         atlas = SpriteAtlas(_make_mock_resource_manager(), width=64, height=64)
@@ -392,6 +504,168 @@ class TestPackIncremental:
         assert uvs[0].v1 == pytest.approx(0.0)
 
 
+def _make_solid(width: int, height: int, value: int) -> np.ndarray:
+    """A sprite filled with one RGBA value, so different values differ."""
+    return np.full((height, width, 4), value, dtype=np.uint8)
+
+
+class TestContentDedupe:
+    """Tests for dedupe=True: byte-identical sprites share one rectangle."""
+
+    def test_identical_sprites_share_uv(self) -> None:
+        atlas = SpriteAtlas(_make_mock_resource_manager(), width=128, height=128)
+        sprites = [_make_solid(10, 10, 7), _make_solid(10, 10, 9)] * 3
+        uvs = atlas.pack_all(sprites, dedupe=True)
+        assert uvs[0] == uvs[2] == uvs[4]
+        assert uvs[1] == uvs[3] == uvs[5]
+        assert uvs[0] != uvs[1]
+        assert atlas.allocated_count == 2
+        assert atlas.deduplicated_count == 4
+
+    def test_same_pixels_different_shape_do_not_share(self) -> None:
+        # A 10x20 and a 20x10 block of zeros hold the same bytes.
+        assert sprite_content_key(_make_pixels(10, 20)) != sprite_content_key(
+            _make_pixels(20, 10)
+        )
+
+    def test_without_dedupe_every_sprite_packs(self) -> None:
+        atlas = SpriteAtlas(_make_mock_resource_manager(), width=128, height=128)
+        uvs = atlas.pack_all([_make_solid(10, 10, 7)] * 4)
+        assert len(set(uvs)) == 4
+        assert atlas.deduplicated_count == 0
+
+    def test_incremental_reuses_batch_rectangle_without_upload(self) -> None:
+        rm = _make_mock_resource_manager()
+        atlas = SpriteAtlas(rm, width=128, height=128)
+        batch_uvs = atlas.pack_all([_make_solid(10, 10, 3)], dedupe=True)
+        atlas.flush()
+        rm.queue.write_texture.reset_mock()
+
+        late_uvs = atlas.pack_incremental([_make_solid(10, 10, 3)], dedupe=True)
+
+        assert late_uvs == batch_uvs
+        rm.queue.write_texture.assert_not_called()
+
+    def test_duplicate_of_unplaced_sprite_stays_none(self) -> None:
+        atlas = SpriteAtlas(_make_mock_resource_manager(), width=32, height=32)
+        big = _make_solid(30, 30, 1)
+        other = _make_solid(30, 30, 2)
+        uvs = atlas.pack_all([big, other, other], dedupe=True)
+        assert uvs[0] is not None
+        assert uvs[1] is None
+        assert uvs[2] is None
+
+    def test_unique_sprites_keeps_first_occurrences_in_order(self) -> None:
+        a, b = _make_solid(4, 4, 1), _make_solid(4, 4, 2)
+        result = unique_sprites([a, b, a.copy(), b.copy(), a])
+        assert len(result) == 2
+        assert result[0] is a
+        assert result[1] is b
+
+
+class TestPagedSpriteAtlas:
+    """Tests for the fixed-budget paged atlas used by sprite streaming."""
+
+    def _atlas(self, page_count: int = 4) -> PagedSpriteAtlas:
+        return PagedSpriteAtlas(
+            _make_mock_resource_manager(), page_size=32, page_count=page_count
+        )
+
+    @staticmethod
+    def _page_rect(atlas: PagedSpriteAtlas, uv: SpriteUV) -> tuple[int, int]:
+        """(column, row) of the page a UV falls in."""
+        return (
+            int(uv.u1 * atlas.width) // atlas.page_size,
+            int(uv.v1 * atlas.height) // atlas.page_size,
+        )
+
+    def test_texture_is_fixed_size_grid_of_pages(self) -> None:
+        atlas = self._atlas(page_count=4)
+        assert (atlas.width, atlas.height) == (64, 64)
+        assert atlas.texture is not None
+
+    def test_group_lands_on_one_page(self) -> None:
+        atlas = self._atlas()
+        sprites = [_make_solid(8, 8, v) for v in range(1, 5)]
+        uvs, evicted = atlas.pack_group("a", sprites, stamp=1)
+        assert uvs is not None
+        assert evicted == []
+        assert len({self._page_rect(atlas, uv) for uv in uvs}) == 1
+        assert atlas.page_of("a") == 0
+
+    def test_full_page_moves_to_a_free_page(self) -> None:
+        atlas = self._atlas()
+        atlas.pack_group("a", [_make_solid(30, 30, 1)], stamp=1)
+        uvs, evicted = atlas.pack_group("b", [_make_solid(30, 30, 2)], stamp=1)
+        assert uvs is not None
+        assert evicted == []
+        assert atlas.page_of("b") != atlas.page_of("a")
+
+    def test_evicts_least_recently_touched_page(self) -> None:
+        atlas = self._atlas(page_count=2)
+        atlas.pack_group("old", [_make_solid(30, 30, 1)], stamp=1)
+        atlas.pack_group("kept", [_make_solid(30, 30, 2)], stamp=2)
+        atlas.touch("old", 3)
+        atlas.touch("kept", 4)
+
+        uvs, evicted = atlas.pack_group("new", [_make_solid(30, 30, 3)], stamp=5)
+
+        assert uvs is not None
+        assert evicted == ["old"]
+        assert atlas.page_of("old") is None
+        assert atlas.page_of("kept") is not None
+        assert atlas.resident_count == 2
+        assert atlas.evicted_page_count == 1
+
+    def test_pages_used_this_frame_are_never_evicted(self) -> None:
+        atlas = self._atlas(page_count=2)
+        atlas.pack_group("a", [_make_solid(30, 30, 1)], stamp=1)
+        atlas.pack_group("b", [_make_solid(30, 30, 2)], stamp=1)
+        uvs, evicted = atlas.pack_group("c", [_make_solid(30, 30, 3)], stamp=1)
+        assert uvs is None
+        assert evicted == []
+        assert atlas.resident_count == 2
+
+    def test_group_larger_than_a_page_is_refused(self) -> None:
+        atlas = self._atlas()
+        uvs, _ = atlas.pack_group("big", [_make_solid(40, 40, 1)], stamp=1)
+        assert uvs is None
+        assert atlas.page_of("big") is None
+
+    def test_sprite_wider_than_a_page_is_refused(self) -> None:
+        """A wide, short sprite must not spill into the next page column."""
+        atlas = self._atlas()
+        uvs, _ = atlas.pack_group("wide", [_make_solid(40, 4, 1)], stamp=1)
+        assert uvs is None
+        assert atlas.page_of("wide") is None
+        assert atlas.resident_count == 0
+
+    def test_identical_sprites_on_a_page_share_a_rect(self) -> None:
+        atlas = self._atlas()
+        uvs_a, _ = atlas.pack_group("a", [_make_solid(8, 8, 5)], stamp=1)
+        uvs_b, _ = atlas.pack_group("b", [_make_solid(8, 8, 5)], stamp=1)
+        assert uvs_a == uvs_b
+        assert atlas.deduplicated_count == 1
+
+    def test_failed_group_leaves_page_cursor_untouched(self) -> None:
+        atlas = self._atlas(page_count=1)
+        atlas.pack_group("a", [_make_solid(30, 20, 1)], stamp=1)
+        # Two 30x20 sprites do not fit the rest of the page: nothing packs.
+        uvs, _ = atlas.pack_group(
+            "b", [_make_solid(30, 20, 2), _make_solid(30, 20, 3)], stamp=1
+        )
+        assert uvs is None
+        # A small sprite still fits right below the first one.
+        uvs, _ = atlas.pack_group("c", [_make_solid(8, 8, 4)], stamp=1)
+        assert uvs is not None
+
+    def test_resident_group_cannot_be_packed_twice(self) -> None:
+        atlas = self._atlas()
+        atlas.pack_group("a", [_make_solid(8, 8, 1)], stamp=1)
+        with pytest.raises(ValueError, match="already resident"):
+            atlas.pack_group("a", [_make_solid(8, 8, 1)], stamp=2)
+
+
 class TestSpriteAtlasValidation:
     """Input validation tests."""
 
@@ -522,3 +796,9 @@ class TestComputeAtlasSize:
                 f"Atlas {size}x{size} could not fit all 500 sprites "
                 f"({atlas.allocated_count} allocated)"
             )
+
+    def test_required_side_is_not_clamped(self) -> None:
+        sprites = [_make_pixels(20, 20) for _ in range(100_000)]
+        assert required_atlas_side(sprites) > compute_atlas_size(
+            sprites, gpu_max_texture_dim=4096
+        )
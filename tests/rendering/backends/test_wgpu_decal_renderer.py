@@ -0,0 +1,145 @@
+"""Unit tests for WGPUDecalRenderer's persistent instance buffer."""
+
+from __future__ import annotations
+
+from types import SimpleNamespace
+from unittest.mock import MagicMock, Mock
+
+import numpy as np
+
+from brileta.backends.wgpu.decal_renderer import (
+    DECAL_INSTANCE_DTYPE,
+    WGPUDecalRenderer,
+    pack_decal_instances,
+)
+from brileta.backends.wgpu.graphics import WGPUGraphicsContext
+from brileta.util.coordinates import Rect
+from brileta.util.tilesets import unicode_to_cp437
+from brileta.view.render.effects.decals import DecalSystem
+from brileta.view.render.graphics import GraphicsContext
+from brileta.view.render.viewport import ViewportSystem
+
+_UV_MAP = np.random.default_rng(1).random((256, 4), dtype=np.float32)
+
+
+def _make_renderer() -> WGPUDecalRenderer:
+    """Create a decal renderer whose GPU calls are recorded mocks."""
+    renderer = object.__new__(WGPUDecalRenderer)
+    renderer.resource_manager = SimpleNamespace(device=Mock(), queue=Mock())
+    renderer._instance_buffer = None
+    renderer._capacity = 0
+    renderer._synced_system = None
+    renderer._synced_generation = -1
+    renderer._synced_tail = 0
+    renderer._draw_ranges = []
+    renderer._frame_uniforms = ()
+    return renderer
+
+
+def _uploaded_slot_runs(renderer: WGPUDecalRenderer) -> list[tuple[int, int]]:
+    """(first_slot, count) of each instance upload since the last reset."""
+    stride = DECAL_INSTANCE_DTYPE.itemsize
+    runs = [
+        (offset // stride, len(data) // stride)
+        for _buffer, offset, data in (
+            c.args for c in renderer.resource_manager.queue.write_buffer.call_args_list
+        )
+    ]
+    renderer.resource_manager.queue.write_buffer.reset_mock()
+    return runs
+
+
+def _add(ds: DecalSystem, count: int, start_time: float) -> None:
+    for i in range(count):
+        ds.add_decal(float(i % 5), 2.0, "*", (120, 0, 0), game_time=start_time + i)
+
+
+def test_slot_ranges_split_at_the_ring_wrap() -> None:
+    assert WGPUDecalRenderer.slot_ranges(3, 3, 8) == []
+    assert WGPUDecalRenderer.slot_ranges(2, 7, 8) == [(2, 5)]
+    assert WGPUDecalRenderer.slot_ranges(6, 11, 8) == [(6, 2), (0, 3)]
+
+
+def test_sync_uploads_only_decals_added_since_last_sync() -> None:
+    renderer = _make_renderer()
+    ds = DecalSystem()
+    _add(ds, 10, 0.0)
+
+    renderer.sync(ds, _UV_MAP)
+    assert _uploaded_slot_runs(renderer) == [(0, 10)]
+
+    # Nothing new: nothing uploaded, however much time passes.
+    ds.update(Mock(), game_time=50.0)
+    renderer.sync(ds, _UV_MAP)
+    assert _uploaded_slot_runs(renderer) == []
+
+    _add(ds, 3, 60.0)
+    renderer.sync(ds, _UV_MAP)
+    assert _uploaded_slot_runs(renderer) == [(10, 3)]
+    renderer.resource_manager.device.create_buffer.assert_called_once()
+
+
+def test_sync_reuploads_everything_after_growth_or_clear() -> None:
+    renderer = _make_renderer()
+    ds = DecalSystem()
+    capacity = ds.capacity
+    _add(ds, capacity, 0.0)
+    renderer.sync(ds, _UV_MAP)
+    _uploaded_slot_runs(renderer)
+
+    _add(ds, 1, float(capacity))
+    renderer.sync(ds, _UV_MAP)
+    assert ds.capacity == capacity * 2
+    assert _uploaded_slot_runs(renderer) == [(0, capacity + 1)]
+    assert renderer.resource_manager.device.create_buffer.call_count == 2
+
+    ds.clear()
+    _add(ds, 2, 0.0)
+    renderer.sync(ds, _UV_MAP)
+    assert _uploaded_slot_runs(renderer) == [(0, 2)]
+
+
+def test_pack_decal_instances_matches_decal_arrays() -> None:
+    ds = DecalSystem()
+    ds.add_decal(1.25, 2.5, "*", (10, 20, 30), game_time=1.0)
+    ds.add_decal(3.5, 4.75, "•", (40, 50, 60), game_time=2.0)
+
+    instances = pack_decal_instances(ds, ds.live_slots(), _UV_MAP)
+
+    np.testing.assert_array_equal(instances["position"], [[1.25, 2.5], [3.5, 4.75]])
+    np.testing.assert_array_equal(instances["created_at"], [1.0, 2.0])
+    np.testing.assert_array_equal(
+        instances["color"][:, :3], [[10, 20, 30], [40, 50, 60]]
+    )
+    bullet = unicode_to_cp437(ord("•"))
+    np.testing.assert_array_equal(instances["uv"], _UV_MAP[[ord("*"), bullet]])
+
+
+def test_render_decals_transform_matches_cpu_mapping() -> None:
+    """The shader's affine world->pixel map reproduces the CPU conversion."""
+    graphics = object.__new__(WGPUGraphicsContext)
+    GraphicsContext.__init__(graphics)
+    graphics.letterbox_geometry = (12, 7, 1600, 1000)
+    graphics.uv_map = _UV_MAP
+    graphics.screen_renderer = Mock()
+    graphics.decal_renderer = MagicMock()
+
+    vs = ViewportSystem(8, 6)
+    vs.camera.set_position(6.0, 5.0)
+    vs.update_camera(MagicMock(x=6, y=5, render_x=6.0, render_y=5.0), 20, 16)
+    ds = DecalSystem()
+    ds.add_decal(5.3, 4.8, "*", (100, 0, 0), game_time=0.0)
+
+    graphics.render_decals(ds, Rect.from_bounds(0, 0, 7, 5), (2, 1), vs, 42.0)
+
+    kwargs = graphics.decal_renderer.prepare.call_args.kwargs
+    ax, ay, bx, by = kwargs["world_to_pixel"]
+    vp_x, vp_y = vs.world_to_screen_float(5.3, 4.8)
+    expected = graphics.console_to_screen_coords(2 + vp_x, 1 + vp_y)
+    np.testing.assert_allclose((5.3 * ax + bx, 4.8 * ay + by), expected)
+    assert kwargs["cull_bounds"] == (-1.0, -1.0, 8.0, 6.0)
+    assert kwargs["game_time"] == 42.0
+    graphics.decal_renderer.sync.assert_called_once_with(ds, _UV_MAP)
+    graphics.screen_renderer.mark_decal_layer.assert_called_once_with(
+        graphics.decal_renderer
+    )
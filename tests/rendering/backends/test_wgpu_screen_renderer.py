@@ -155,3 +155,68 @@ class TestAddQuadBatch:
         assert sr.vertex_count == 12
         # Second quad starts at vertex 6.
         assert sr.cpu_vertex_buffer[6]["position"][0] == 100.0
+
+    def test_matches_scalar_add_quad(self) -> None:
+        """Batch output is byte-identical to one add_quad() call per quad."""
+        rng = np.random.default_rng(9)
+        n = 20
+        x, y = rng.uniform(-50, 500, size=(2, n)).astype(np.float32)
+        w, h = rng.uniform(1, 40, size=(2, n)).astype(np.float32)
+        uvs = rng.random((n, 4), dtype=np.float32)
+        colors = rng.random((n, 4), dtype=np.float32)
+        world_pos = rng.integers(0, 100, size=(n, 2)).astype(np.float32)
+        light_scale = rng.random(n, dtype=np.float32)
+        flags = rng.integers(0, 4, size=n).astype(np.uint32)
+        tile_bg = rng.random((n, 3), dtype=np.float32)
+
+        batch = _make_renderer()
+        batch.add_quad_batch(
+            x,
+            y,
+            w,
+            h,
+            uvs,
+            colors,
+            world_pos=world_pos,
+            actor_light_scale=light_scale,
+            flags=flags,
+            tile_bg=tile_bg,
+        )
+
+        scalar = _make_renderer()
+        for i in range(n):
+            scalar.add_quad(
+                float(x[i]),
+                float(y[i]),
+                float(w[i]),
+                float(h[i]),
+                tuple(float(v) for v in uvs[i]),
+                tuple(float(v) for v in colors[i]),
+                world_pos=(float(world_pos[i, 0]), float(world_pos[i, 1])),
+                actor_light_scale=float(light_scale[i]),
+                actor_lighting_enabled=bool(flags[i] & 1),
+                tile_bg=tuple(float(v) for v in tile_bg[i]),
+                use_sprite_atlas=bool(flags[i] & 2),
+            )
+
+        assert batch.vertex_count == scalar.vertex_count == n * 6
+        np.testing.assert_array_equal(
+            batch.cpu_vertex_buffer[: n * 6], scalar.cpu_vertex_buffer[: n * 6]
+        )
+
+    def test_accepts_float64_inputs(self) -> None:
+        """Non-float32 inputs are converted rather than misread."""
+        sr = _make_renderer()
+        sr.add_quad_batch(
+            np.array([1.5]),
+            np.array([2.5]),
+            np.array([3.0]),
+            np.array([4.0]),
+            np.array([[0.0, 0.25, 0.5, 0.75]]),
+            np.array([[1.0, 1.0, 1.0, 1.0]]),
+            world_pos=np.array([[3, 4]]),
+        )
+        verts = sr.cpu_vertex_buffer[:6]
+        assert verts["position"][5].tolist() == [4.5, 6.5]
+        assert verts["uv"][5].tolist() == [0.5, 0.75]
+        assert verts["world_pos"][0].tolist() == [3.0, 4.0]
@@ -0,0 +1,62 @@
+"""Unit tests for WGPUTexturedQuadRenderer.add_textured_quads."""
+
+from __future__ import annotations
+
+from typing import Any
+
+import numpy as np
+
+from brileta.backends.wgpu.textured_quad_renderer import (
+    VERTEX_DTYPE,
+    WGPUTexturedQuadRenderer,
+)
+
+
+def _make_renderer(max_quads: int = 10) -> WGPUTexturedQuadRenderer:
+    """Create a minimal renderer with only the CPU vertex buffer and queue."""
+    renderer = object.__new__(WGPUTexturedQuadRenderer)
+    renderer.cpu_vertex_buffer = np.zeros(max_quads * 6, dtype=VERTEX_DTYPE)
+    renderer.vertex_count = 0
+    renderer.render_queue = []
+    return renderer
+
+
+def _quads(n: int, x: float = 0.0) -> np.ndarray:
+    vertices = np.zeros(n * 6, dtype=VERTEX_DTYPE)
+    vertices["position"][:, 0] = x
+    return vertices
+
+
+class TestAddTexturedQuads:
+    def test_run_is_queued_as_one_draw(self) -> None:
+        renderer = _make_renderer()
+        texture: Any = object()
+
+        renderer.add_textured_quads(texture, _quads(3, x=5.0))
+
+        assert renderer.vertex_count == 18
+        assert renderer.render_queue == [(texture, 18)]
+        assert (renderer.cpu_vertex_buffer["position"][:18, 0] == 5.0).all()
+
+    def test_consecutive_runs_of_one_texture_merge(self) -> None:
+        renderer = _make_renderer()
+        atlas: Any = object()
+        other: Any = object()
+
+        renderer.add_textured_quads(atlas, _quads(2))
+        renderer.add_textured_quads(atlas, _quads(1))
+        renderer.add_textured_quads(other, _quads(1))
+        renderer.add_textured_quads(atlas, _quads(1))
+
+        assert renderer.render_queue == [(atlas, 18), (other, 6), (atlas, 6)]
+
+    def test_quads_past_capacity_are_dropped(self) -> None:
+        renderer = _make_renderer(max_quads=4)
+        texture: Any = object()
+
+        renderer.add_textured_quads(texture, _quads(3))
+        renderer.add_textured_quads(texture, _quads(3))
+        renderer.add_textured_quads(texture, _quads(1))
+
+        assert renderer.vertex_count == 24
+        assert renderer.render_queue == [(texture, 24)]
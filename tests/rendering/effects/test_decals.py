@@ -3,6 +3,7 @@
 import math
 from unittest.mock import patch
 
+import numpy as np
 import pytest
 
 from brileta.view.render.effects import decals as decals_module
@@ -148,6 +149,89 @@ class TestDecalSystem:
         assert ds.get_alpha(decal, game_time=20.0) == 0.0
 
 
+class TestDecalRingBuffer:
+    """Tests for the ring-buffer storage behind DecalSystem."""
+
+    def test_growth_and_wraparound_preserve_creation_order(self) -> None:
+        """Decals stay oldest-first across slot wraparound and capacity growth."""
+        ds = DecalSystem()
+        ds.MAX_TOTAL_DECALS = 5000
+        initial_capacity = ds.capacity
+
+        # Fill, expire half so the head moves, then refill past capacity.
+        for i in range(initial_capacity):
+            ds.add_decal(float(i % 7), 1.0, "*", (i % 256, 0, 0), game_time=float(i))
+        ds.update(dt(0.0), game_time=ds.DECAL_LIFETIME + ds.FADE_DURATION + 127.5)
+        assert ds.total_count == initial_capacity - 128
+        for i in range(initial_capacity, initial_capacity * 2):
+            ds.add_decal(float(i % 7), 1.0, "*", (i % 256, 0, 0), game_time=float(i))
+
+        assert ds.capacity > initial_capacity
+        created = ds.created_at[ds.live_slots()]
+        np.testing.assert_array_equal(
+            created, np.arange(128, initial_capacity * 2, dtype=np.float64)
+        )
+        per_tile = ds.decals
+        assert sum(len(tile) for tile in per_tile.values()) == ds.total_count
+        for (tile_x, _tile_y), tile_decals in per_tile.items():
+            times = [d.created_at for d in tile_decals]
+            assert times == sorted(times)
+            assert all(int(d.x) == tile_x for d in tile_decals)
+
+    def test_eviction_keeps_tile_index_consistent(self) -> None:
+        """Evicting at the cap removes the oldest decal from its tile bucket."""
+        ds = DecalSystem()
+        ds.MAX_TOTAL_DECALS = 50
+        for i in range(400):
+            ds.add_decal(float(i % 3), 0.0, "*", (100, 0, 0), game_time=float(i))
+
+        assert ds.total_count == 50
+        times = sorted(
+            decal.created_at for tile in ds.decals.values() for decal in tile
+        )
+        assert times == [float(i) for i in range(350, 400)]
+
+    def test_out_of_order_creation_time_is_rejected(self) -> None:
+        """Expiry drops a prefix, so creation times must not go backwards."""
+        ds = DecalSystem()
+        ds.add_decal(1.0, 1.0, "*", (100, 0, 0), game_time=10.0)
+        ds.add_decal(2.0, 1.0, "*", (100, 0, 0), game_time=10.0)
+
+        with pytest.raises(ValueError, match="time order"):
+            ds.add_decal(3.0, 1.0, "*", (100, 0, 0), game_time=5.0)
+
+        assert ds.total_count == 2
+        # Once the older decals expire, earlier times are fine again.
+        ds.clear()
+        ds.add_decal(3.0, 1.0, "*", (100, 0, 0), game_time=5.0)
+        assert ds.total_count == 1
+
+    def test_default_cap_keeps_well_over_ten_thousand_decals(self) -> None:
+        """The cap is a memory backstop; expiry bounds the live count."""
+        ds = DecalSystem()
+        for i in range(25_000):
+            ds.add_decal(float(i % 40), float(i // 40 % 40), ".", (90, 0, 0))
+
+        assert ds.total_count == 25_000
+
+    def test_generation_changes_only_when_slots_are_relaid(self) -> None:
+        """Appends and expiry keep the generation; growth and clear bump it."""
+        ds = DecalSystem()
+        start = ds.generation
+        for i in range(ds.capacity):
+            ds.add_decal(1.0, 1.0, "*", (100, 0, 0), game_time=float(i))
+        ds.update(dt(0.0), game_time=ds.DECAL_LIFETIME + ds.FADE_DURATION + 10.0)
+        assert ds.generation == start
+
+        for i in range(ds.capacity):
+            ds.add_decal(1.0, 1.0, "*", (100, 0, 0), game_time=1000.0 + i)
+        grown = ds.generation
+        assert grown != start
+
+        ds.clear()
+        assert ds.generation != grown
+
+
 class TestSplatterCone:
     """Tests for the legacy splatter cone generation."""
 
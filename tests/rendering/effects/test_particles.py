@@ -334,3 +334,75 @@ def test_convert_particle_to_screen_coords(
     assert (
         ps._convert_particle_to_screen_coords(0, off_viewport, (0, 0), renderer) is None
     )
+
+
+def test_render_particles_batch_matches_per_particle_quads() -> None:
+    """The batched render path emits the same quads as the per-particle path."""
+    import numpy as np
+
+    from brileta.backends.wgpu.screen_renderer import VERTEX_DTYPE, WGPUScreenRenderer
+    from brileta.util.coordinates import convert_particle_to_screen_coords
+    from brileta.view.render.graphics import GraphicsContext
+    from brileta.view.render.viewport import ViewportSystem
+
+    def make_graphics() -> GraphicsContext:
+        sr = object.__new__(WGPUScreenRenderer)
+        sr.cpu_vertex_buffer = np.zeros(600, dtype=VERTEX_DTYPE)
+        sr.vertex_count = 0
+        graphics = GraphicsContext()
+        graphics.screen_renderer = sr
+        graphics.uv_map = np.random.default_rng(1).random((256, 4), dtype=np.float32)
+        return graphics
+
+    rng = np.random.default_rng(5)
+    ps = SubTileParticleSystem(12, 10, subdivision=3)
+    count = 60
+    ps.positions[:count] = rng.uniform(-6.0, 40.0, size=(count, 2))
+    ps.colors[:count] = rng.integers(0, 256, size=(count, 3))
+    ps.chars[:count] = rng.choice(np.array(["*", ".", "•", "░"]), count)
+    ps.lifetimes[:count] = rng.uniform(0.0, 1.0, count)
+    ps.max_lifetimes[:count] = 1.0
+    ps.flash_intensity[:count] = np.where(rng.random(count) < 0.3, 0.8, np.nan)
+    ps.layers[:count] = rng.choice(
+        np.array([ParticleLayer.OVER_ACTORS.value, ParticleLayer.UNDER_ACTORS.value]),
+        count,
+    )
+    ps.active_count = count
+
+    vs = ViewportSystem(8, 6)
+    vs.camera.set_position(5.0, 4.0)
+    vs.update_camera(MagicMock(x=5, y=4, render_x=5.0, render_y=4.0), 12, 10)
+    bounds = Rect.from_bounds(0, 0, 7, 5)
+    offset = (2, 1)
+
+    batch = make_graphics()
+    batch.render_particles(ps, ParticleLayer.OVER_ACTORS, bounds, offset, vs)
+
+    scalar = make_graphics()
+    for i in range(count):
+        if ps.layers[i] != ParticleLayer.OVER_ACTORS.value:
+            continue
+        coords = convert_particle_to_screen_coords(ps, i, bounds, offset, scalar, vs)
+        if coords is None:
+            continue
+        alpha = ps.flash_intensity[i]
+        if np.isnan(alpha):
+            alpha = ps.lifetimes[i] / ps.max_lifetimes[i]
+        scale_x, scale_y = vs.get_display_scale_factors()
+        scalar._draw_particle_to_buffer(
+            ps.chars[i],
+            tuple(ps.colors[i]),
+            *coords,
+            alpha,
+            scale_x=scale_x,
+            scale_y=scale_y,
+        )
+
+    assert batch.screen_renderer is not None and scalar.screen_renderer is not None
+    n = scalar.screen_renderer.vertex_count
+    assert n > 0
+    assert batch.screen_renderer.vertex_count == n
+    np.testing.assert_array_equal(
+        batch.screen_renderer.cpu_vertex_buffer[:n],
+        scalar.screen_renderer.cpu_vertex_buffer[:n],
+    )
@@ -93,6 +93,16 @@ class DummyGameMap:
         )
         self.animation_state = np.zeros((width, height), dtype=TileAnimationState)
 
+    def get_edge_transition_maps(self, is_light: bool = False):
+        from brileta.environment.edge_transitions import build_edge_transition_maps
+
+        appearance_map = (
+            self.light_appearance_map if is_light else self.dark_appearance_map
+        )
+        return build_edge_transition_maps(
+            self.tiles, appearance_map, self.decoration_seed
+        )
+
 
 class DummyGW:
     def __init__(self) -> None:
@@ -150,6 +160,9 @@ class DummyController:
             pixel_to_world_tile=lambda px_x, px_y: (int(px_x), int(px_y)),
         )
         self.clock = SimpleNamespace(last_delta_time=0.016)
+        self.actor_sprite_manager = SimpleNamespace(
+            update_residency=lambda bounds: None
+        )
         self.active_mode = None
         self.is_combat_mode = lambda: False
 
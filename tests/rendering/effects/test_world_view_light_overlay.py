@@ -6,6 +6,7 @@ import numpy as np
 import pytest
 
 from brileta.environment import tile_types
+from brileta.environment.edge_transitions import build_edge_transition_maps
 from brileta.environment.generators.buildings.building import Building
 from brileta.environment.map import TileAnimationState
 from brileta.util.coordinates import Rect
@@ -176,6 +177,11 @@ class TestWorldViewLightOverlay:
         mock_gw.player.y = 0
         mock_gw.buildings = []
         mock_gw.game_map.get_region_at.return_value = None
+        mock_gw.game_map.get_edge_transition_maps.return_value = (
+            build_edge_transition_maps(
+                mock_gw.game_map.tiles, mock_gw.game_map.light_appearance_map, 0
+            )
+        )
 
         mock_viewport_system = Mock()
         mock_viewport_system.get_visible_bounds.return_value = Rect(0, 0, 1, 1)
@@ -6,20 +6,25 @@ mock GPU resource manager, so packing/upload logic runs without a WGPU device.
 
 from __future__ import annotations
 
+from pathlib import Path
 from typing import Any
 from unittest.mock import MagicMock
 
 import numpy as np
 import pytest
 
-from brileta.backends.wgpu.sprite_atlas import SpriteAtlas
+from brileta import config
+from brileta.backends.wgpu.sprite_atlas import PagedSpriteAtlas, SpriteAtlas
 from brileta.game.actors.npc_types import DOG_TYPE, RESIDENT_TYPE
 from brileta.game.actors.trees import create_deciduous_tree
+from brileta.sprites.cache import SpriteCache
 from brileta.sprites.characters import MASC_PRESENTATION
 from brileta.sprites.quadrupeds import (
     generate_quadruped_pose_set,
     quadruped_sprite_seed,
 )
+from brileta.util.coordinates import Rect
+from brileta.util.spatial import SpatialHashGrid
 from brileta.view.render.actor_sprite_manager import ActorSpriteManager
 
 
@@ -41,6 +46,12 @@ class _FakeGraphics:
         self.atlas = SpriteAtlas(self._rm, width, height)
         return self.atlas
 
+    def create_paged_sprite_atlas(
+        self, page_size: int, page_count: int
+    ) -> PagedSpriteAtlas:
+        self.atlas = PagedSpriteAtlas(self._rm, page_size, page_count)
+        return self.atlas
+
     def set_sprite_atlas_texture(self, texture: Any) -> None:
         self.bound_texture = texture
 
@@ -55,6 +66,9 @@ class _FakeGameWorld:
     def __init__(self, actors: list[Any]) -> None:
         self.actors = actors
         self.game_map = _FakeMap()
+        self.actor_spatial_index: SpatialHashGrid[Any] = SpatialHashGrid(16)
+        for actor in actors:
+            self.actor_spatial_index.add(actor)
 
 
 def _manager_with_atlas(
@@ -95,20 +109,21 @@ def test_late_humanoid_passes_presentation_to_sprite_generator(
     resident.character_presentation = MASC_PRESENTATION
     captured_profile: list[object] = []
 
-    def fake_generate_character_pose_set(
-        _seed: int,
+    def fake_generate_character_pose_sets(
+        seeds: list[int],
         _size: int = 20,
         *,
-        presentation_profile: object | None = None,
-    ) -> list[np.ndarray]:
-        captured_profile.append(presentation_profile)
+        presentation_profiles: list[object] | None = None,
+    ) -> list[list[np.ndarray]]:
+        assert presentation_profiles is not None
+        captured_profile.extend(presentation_profiles)
         sprite = np.zeros((2, 2, 4), dtype=np.uint8)
         sprite[:, :] = np.array([255, 255, 255, 255], dtype=np.uint8)
-        return [sprite.copy() for _ in range(12)]
+        return [[sprite.copy() for _ in range(12)] for _ in seeds]
 
     monkeypatch.setattr(
-        "brileta.sprites.characters.generate_character_pose_set",
-        fake_generate_character_pose_set,
+        "brileta.sprites.characters.generate_character_pose_sets",
+        fake_generate_character_pose_sets,
     )
 
     manager.ensure_actor_sprites(resident)
@@ -210,3 +225,193 @@ def test_spawned_and_worldgen_dog_share_pixels() -> None:
     )
     for fa, fd in zip(a, direct, strict=True):
         assert np.array_equal(fa, fd)
+
+
+def _count_tree_generation(monkeypatch: pytest.MonkeyPatch) -> list[int]:
+    """Patch the tree generator with a counting wrapper; return the counter."""
+    from brileta.sprites import trees
+
+    calls: list[int] = []
+    real = trees.generate_tree_sprite
+
+    def counting(*args: Any) -> np.ndarray:
+        calls.append(1)
+        return real(*args)
+
+    monkeypatch.setattr(trees, "generate_tree_sprite", counting)
+    return calls
+
+
+def test_rebuild_reuses_cached_sprites(monkeypatch: pytest.MonkeyPatch) -> None:
+    """A second build of the same world generates nothing new."""
+    calls = _count_tree_generation(monkeypatch)
+    dog = DOG_TYPE.create(6, 6, "Rex")
+    manager, gw, _g = _manager_with_atlas([dog])
+    assert len(calls) == 1
+    first_pose_set = manager._generate_pose_set(dog, "quadruped")
+
+    manager.build_for_world(gw)  # ty: ignore[invalid-argument-type]
+
+    assert len(calls) == 1
+    assert manager._generate_pose_set(dog, "quadruped") is first_pose_set
+    _assert_has_sprites(dog)
+
+
+def test_identical_sprites_share_atlas_rectangle() -> None:
+    """Two trees with the same seed and archetype pack into one UV rect."""
+    tree_a = create_deciduous_tree(3, 3)
+    tree_b = create_deciduous_tree(3, 3)
+    manager, _gw, _g = _manager_with_atlas([tree_a, tree_b])
+    assert manager._atlas is not None
+    assert tree_a.sprite_uv is not None
+    assert tree_a.sprite_uv == tree_b.sprite_uv
+    assert manager._atlas.deduplicated_count >= 1
+
+
+def test_sprite_cache_persists_between_managers(
+    tmp_path: Path, monkeypatch: pytest.MonkeyPatch
+) -> None:
+    """A warm start loads the saved cache and skips generation entirely."""
+    cache_path = tmp_path / "sprites.npz"
+    calls = _count_tree_generation(monkeypatch)
+    actors: list[Any] = [create_deciduous_tree(1, 1), DOG_TYPE.create(6, 6, "Rex")]
+
+    cold = ActorSpriteManager(
+        _FakeGraphics(),  # ty: ignore[invalid-argument-type]
+        SpriteCache(cache_path),
+    )
+    cold.build_for_world(_FakeGameWorld(actors))  # ty: ignore[invalid-argument-type]
+    assert cache_path.exists()
+    assert len(calls) == 1
+    cold_uv = actors[0].sprite_uv
+
+    warm_cache = SpriteCache(cache_path)
+    warm = ActorSpriteManager(
+        _FakeGraphics(),  # ty: ignore[invalid-argument-type]
+        warm_cache,
+    )
+    warm.build_for_world(_FakeGameWorld(actors))  # ty: ignore[invalid-argument-type]
+
+    assert len(calls) == 1
+    assert warm_cache.misses == 0
+    assert actors[0].sprite_uv == cold_uv
+    _assert_has_sprites(actors[1])
+
+
+# ---------------------------------------------------------------------------
+# Streaming: worlds over the atlas budget
+# ---------------------------------------------------------------------------
+
+
+def _streaming_manager(
+    monkeypatch: pytest.MonkeyPatch,
+    actors: list[Any],
+    *,
+    page_size: int = 32,
+    page_count: int = 2,
+) -> tuple[ActorSpriteManager, _FakeGraphics]:
+    """Build a world under a tiny atlas budget so it streams.
+
+    Trees are patched to 30x30 solid sprites (distinct per seed), so exactly
+    one tree fits a 32px page and eviction order is easy to reason about.
+    """
+    from brileta.sprites import trees
+
+    def solid_tree(seed: int, *_args: Any) -> np.ndarray:
+        return np.full((30, 30, 4), seed % 251 + 1, dtype=np.uint8)
+
+    monkeypatch.setattr(trees, "generate_tree_sprite", solid_tree)
+    monkeypatch.setattr(config, "SPRITE_ATLAS_PAGE_SIZE", page_size)
+    monkeypatch.setattr(config, "SPRITE_ATLAS_PAGE_COUNT", page_count)
+    monkeypatch.setattr(config, "SPRITE_RESIDENCY_MARGIN_TILES", 0)
+    graphics = _FakeGraphics()
+    manager = ActorSpriteManager(graphics)  # ty: ignore[invalid-argument-type]
+    manager.build_for_world(_FakeGameWorld(actors))  # ty: ignore[invalid-argument-type]
+    return manager, graphics
+
+
+def _view_at(x: int) -> Rect:
+    return Rect(x, 0, 5, 5)
+
+
+def test_world_over_budget_streams_instead_of_packing(
+    monkeypatch: pytest.MonkeyPatch,
+) -> None:
+    actors = [create_deciduous_tree(x, 1) for x in (1, 21, 41)]
+    manager, graphics = _streaming_manager(monkeypatch, actors)
+
+    assert manager.is_streaming
+    assert manager._atlas is None
+    assert isinstance(graphics.atlas, PagedSpriteAtlas)
+    assert graphics.bound_texture is graphics.atlas.texture
+    assert all(tree.sprite_uv is None for tree in actors)
+
+
+def test_residency_streams_only_actors_near_the_view(
+    monkeypatch: pytest.MonkeyPatch,
+) -> None:
+    near, far = create_deciduous_tree(1, 1), create_deciduous_tree(41, 1)
+    manager, _g = _streaming_manager(monkeypatch, [near, far])
+
+    manager.update_residency(_view_at(0))
+
+    assert near.sprite_uv is not None
+    assert near.sprite_content_bbox is not None
+    assert far.sprite_uv is None
+
+
+def test_leaving_actors_are_evicted_back_to_glyphs(
+    monkeypatch: pytest.MonkeyPatch,
+) -> None:
+    actors = [create_deciduous_tree(x, 1) for x in (1, 21, 41)]
+    first, second, third = actors
+    glyph_scale = first.visual_scale
+    manager, graphics = _streaming_manager(monkeypatch, actors)
+
+    manager.update_residency(_view_at(0))
+    manager.update_residency(_view_at(20))
+    assert first.sprite_uv is not None
+    assert second.sprite_uv is not None
+
+    # Both pages are taken; the page last seen longest ago goes.
+    manager.update_residency(_view_at(40))
+
+    assert third.sprite_uv is not None
+    assert first.sprite_uv is None
+    assert first.sprite_content_bbox is None
+    assert first.visual_scale == glyph_scale
+    assert second.sprite_uv is not None
+    assert isinstance(graphics.atlas, PagedSpriteAtlas)
+    assert graphics.atlas.evicted_page_count == 1
+
+    # Coming back streams the evicted tree in again from the sprite cache.
+    manager.update_residency(_view_at(0))
+    assert first.sprite_uv is not None
+
+
+def test_streaming_is_capped_per_frame(monkeypatch: pytest.MonkeyPatch) -> None:
+    actors = [create_deciduous_tree(x, 1) for x in (1, 2, 3)]
+    manager, _g = _streaming_manager(monkeypatch, actors, page_size=64)
+    monkeypatch.setattr(config, "SPRITE_STREAM_ACTORS_PER_FRAME", 2)
+
+    manager.update_residency(_view_at(0))
+    assert sum(tree.sprite_uv is not None for tree in actors) == 2
+
+    manager.update_residency(_view_at(0))
+    assert all(tree.sprite_uv is not None for tree in actors)
+
+
+def test_late_spawn_streams_in_when_near_the_view(
+    monkeypatch: pytest.MonkeyPatch,
+) -> None:
+    tree = create_deciduous_tree(40, 1)
+    manager, _g = _streaming_manager(monkeypatch, [tree], page_size=128, page_count=1)
+    dog = DOG_TYPE.create(2, 2, "Rex")
+    assert manager._gw is not None
+    manager._gw.actor_spatial_index.add(dog)
+
+    manager.ensure_actor_sprites(dog)
+    assert dog.character_sprite_uvs is None  # Waits for residency.
+
+    manager.update_residency(_view_at(0))
+    _assert_has_sprites(dog)
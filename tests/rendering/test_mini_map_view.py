@@ -97,22 +97,20 @@ def test_reset_for_new_world_forces_full_rebuild() -> None:
     controller, _player, view = make_world()
 
     # Simulate having already rendered - mark revisions as current.
-    view._map_rgb_revision = controller.gw.game_map.structural_revision
-    view._map_rgb_exploration_revision = controller.gw.game_map.exploration_revision
-    view._feature_layer_rev = controller.gw.game_map.structural_revision
+    view._map_cells_revision = controller.gw.game_map.structural_revision
+    view._map_cells_exploration_revision = controller.gw.game_map.exploration_revision
 
     # Swap in a "new" game map with the same structural_revision (0).
     new_gw = DummyGameWorld(width=30, height=20)
     assert new_gw.game_map.structural_revision == 0
     controller.gw = new_gw
 
-    # Without reset, _ensure_map_rgb_current would see 0 == 0 and skip rebuild.
+    # Without reset, _ensure_map_cells_current would see 0 == 0 and skip rebuild.
     view.reset_for_new_world()
 
     # After reset, revisions are -1 so the next ensure call forces a full rebuild.
-    assert view._map_rgb_revision == -1
-    assert view._map_rgb_exploration_revision == -1
-    assert view._feature_layer_rev == -1
+    assert view._map_cells_revision == -1
+    assert view._map_cells_exploration_revision == -1
 
 
 def test_explored_colors_are_strictly_dimmer_than_visible_colors() -> None:
@@ -412,3 +410,82 @@ def test_draw_content_without_player_skips_markers() -> None:
     # Should not raise.
     view.draw_content(graphics, InterpolationAlpha(0.0))
     view.canvas.end_frame()
+
+
+# ---------------------------------------------------------------------------
+# Incremental cell grid / GPU palette map
+# ---------------------------------------------------------------------------
+
+
+def _see_around(controller: DummyController, x: int, y: int, radius: int) -> None:
+    """Make a square around (x, y) visible and mark it explored."""
+    game_map = controller.gw.game_map
+    game_map.visible[:] = False
+    game_map.visible[
+        max(0, x - radius) : x + radius + 1, max(0, y - radius) : y + radius + 1
+    ] = True
+    game_map.mark_explored(game_map.visible)
+
+
+def test_incremental_cell_updates_match_full_rebuild(monkeypatch) -> None:
+    """FOV-ring and per-tile patches must leave the same cells as a rebuild."""
+    from brileta import config
+    from brileta.environment.tile_types import TileTypeID
+
+    monkeypatch.setattr(config, "FOV_RADIUS", 3)
+    controller, player, view = make_world()
+    game_map = controller.gw.game_map
+    _see_around(controller, player.x, player.y, 3)
+    view._ensure_map_cells_current()
+
+    for _ in range(6):
+        player.x += 2
+        _see_around(controller, player.x, player.y, 3)
+        view._ensure_map_cells_current()
+    game_map.tiles[4, 4] = TileTypeID.WALL
+    game_map.invalidate_property_caches(changed_tiles=[(4, 4)])
+    view._ensure_map_cells_current()
+    incremental = view._map_cells.copy()
+
+    view.reset_for_new_world()
+    view._ensure_map_cells_current()
+    np.testing.assert_array_equal(incremental, view._map_cells)
+    assert incremental[4, 4, 0] == TileTypeID.WALL
+    assert incremental[5, 5, 1] == 1  # Left behind: explored, no longer visible.
+
+
+def test_palette_map_receives_only_changed_sub_rects(monkeypatch) -> None:
+    """After the initial upload, exploration changes upload only FOV rects."""
+    from brileta import config
+
+    monkeypatch.setattr(config, "FOV_RADIUS", 3)
+    controller, player, view = make_world()
+    game_map = controller.gw.game_map
+    palette_map = MagicMock()
+    palette_map.width, palette_map.height = game_map.width, game_map.height
+    graphics = controller.graphics
+    graphics.create_palette_map.return_value = palette_map
+
+    view.draw(graphics, InterpolationAlpha(0.0))
+    first = palette_map.write_cells.call_args_list
+    assert len(first) == 1
+    assert first[0].args[:2] == (0, 0)
+    assert first[0].args[2].shape == (game_map.height, game_map.width, 2)
+    assert view._cached_terrain_texture is palette_map.render.return_value
+
+    palette_map.reset_mock()
+    player.x += 1
+    _see_around(controller, player.x, player.y, 3)
+    view.draw(graphics, InterpolationAlpha(0.0))
+
+    uploads = palette_map.write_cells.call_args_list
+    assert uploads
+    for call in uploads:
+        cells = call.args[2]
+        assert cells.shape[0] < game_map.height or cells.shape[1] < game_map.width
+    palette_map.render.assert_called_once()
+
+    palette_map.reset_mock()
+    view.draw(graphics, InterpolationAlpha(0.0))
+    palette_map.write_cells.assert_not_called()
+    palette_map.render.assert_not_called()
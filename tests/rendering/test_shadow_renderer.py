@@ -2,6 +2,7 @@
 
 from __future__ import annotations
 
+from functools import partial
 from types import SimpleNamespace
 from typing import cast
 from unittest.mock import Mock, call, patch
@@ -17,6 +18,7 @@ from brileta.game.actors import Actor
 from brileta.game.actors.core import CharacterLayer
 from brileta.game.lights import DirectionalLight
 from brileta.types import InterpolationAlpha, SpriteUV
+from brileta.util._native import clip_shadow_lengths
 from brileta.util.coordinates import Rect
 from brileta.view.render.actor_renderer import ActorRenderer
 from brileta.view.render.graphics import GraphicsContext
@@ -65,6 +67,7 @@ def _build_shadow_renderer(lights: list[object]) -> ShadowRenderer:
     graphics = SimpleNamespace(
         tile_dimensions=(20, 20),
         draw_actor_shadow=Mock(),
+        draw_actor_shadow_batch=Mock(),
         console_to_screen_coords=lambda x, y: (x, y),
     )
     renderer = ShadowRenderer(
@@ -737,6 +740,8 @@ def _build_screen_renderer_for_split_tests(
     renderer.vertex_count = vertex_count
     renderer._shadow_start = shadow_start
     renderer._shadow_end = shadow_end
+    renderer._decal_layer = None
+    renderer._decal_vertex_index = 0
     renderer.cpu_vertex_buffer = np.zeros(vertex_count, dtype=VERTEX_DTYPE)
     renderer.resource_manager = SimpleNamespace(queue=Mock())
     renderer.uniform_buffer = Mock()
@@ -776,6 +781,53 @@ def test_render_to_screen_splits_pre_shadow_post_ranges() -> None:
     )
 
 
+def test_render_to_screen_splices_decal_layer_at_marked_vertex() -> None:
+    renderer = _build_screen_renderer_for_split_tests(
+        vertex_count=18,
+        shadow_start=12,
+        shadow_end=18,
+    )
+    frame = Mock()
+    decal_layer = frame.decal_layer
+    decal_layer.has_pending_draw.return_value = True
+    renderer.vertex_count = 6
+    renderer.mark_decal_layer(decal_layer)
+    renderer.vertex_count = 18
+
+    renderer.render_to_screen(render_pass=frame.render_pass, window_size=(800, 600))
+
+    draws = [
+        c
+        for c in frame.mock_calls
+        if c[0] in ("render_pass.draw", "decal_layer.render")
+    ]
+    assert draws == [
+        call.render_pass.draw(6, 1, 0),
+        call.decal_layer.render(frame.render_pass, (800, 600), None),
+        call.render_pass.draw(6, 1, 6),
+        call.render_pass.draw(6, 1, 12),
+    ]
+    # The screen pipeline is rebound after the decal pipeline ran.
+    assert frame.render_pass.set_pipeline.call_count == 2
+
+
+def test_render_to_screen_draws_decals_without_other_quads() -> None:
+    renderer = _build_screen_renderer_for_split_tests(
+        vertex_count=0,
+        shadow_start=0,
+        shadow_end=0,
+    )
+    decal_layer = Mock()
+    decal_layer.has_pending_draw.return_value = True
+    renderer.mark_decal_layer(decal_layer)
+    render_pass = Mock()
+
+    renderer.render_to_screen(render_pass=render_pass, window_size=(800, 600))
+
+    decal_layer.render.assert_called_once_with(render_pass, (800, 600), None)
+    render_pass.draw.assert_not_called()
+
+
 def test_render_to_screen_clamps_shadow_range_to_full_shadow_pass() -> None:
     renderer = _build_screen_renderer_for_split_tests(
         vertex_count=18,
@@ -1110,20 +1162,82 @@ def test_leftward_horizontal_shadow_projects_from_left_edge() -> None:
     assert vertex_colors[3] == base_color  # near-top: opaque
 
 
+def _accumulate_receiver_dimming_reference(
+    scale_map: dict[Actor, float],
+    caster: Actor,
+    receivers: list[Actor],
+    shadow_dir_x: float,
+    shadow_dir_y: float,
+    shadow_length_tiles: float,
+    shadow_alpha: float,
+    fade_tip: bool,
+) -> None:
+    """Scalar per-caster reference for ShadowRenderer._apply_receiver_dimming()."""
+    if shadow_length_tiles <= 0.0 or shadow_alpha <= 0.0:
+        return
+    if shadow_dir_x * shadow_dir_x + shadow_dir_y * shadow_dir_y <= 1e-12:
+        return
+
+    caster_center_x = float(caster.x) + 0.5
+    caster_center_y = float(caster.y) + 0.5
+    height_factor = min(1.0, max(0.0, float(caster.shadow_height)) / 4.0)
+    if height_factor <= 0.0:
+        return
+    shadow_half_width = 0.18 + 0.22 * max(0.5, float(caster.visual_scale))
+
+    for receiver in receivers:
+        if receiver is caster:
+            continue
+        receiver_radius = 0.2 + 0.18 * max(0.5, float(receiver.visual_scale))
+        rel_x = float(receiver.x) + 0.5 - caster_center_x
+        rel_y = float(receiver.y) + 0.5 - caster_center_y
+
+        distance_along_shadow = rel_x * shadow_dir_x + rel_y * shadow_dir_y
+        if distance_along_shadow <= 0.0 or distance_along_shadow >= shadow_length_tiles:
+            continue
+        distance_from_axis = abs(rel_x * shadow_dir_y - rel_y * shadow_dir_x)
+        lateral_limit = shadow_half_width + receiver_radius
+        if distance_from_axis >= lateral_limit:
+            continue
+
+        lateral_factor = 1.0 - distance_from_axis / lateral_limit
+        tip_factor = (
+            1.0 - distance_along_shadow / shadow_length_tiles if fade_tip else 1.0
+        )
+        attenuation = shadow_alpha * height_factor * lateral_factor * tip_factor
+        if attenuation <= 0.0:
+            continue
+        next_scale = scale_map.get(receiver, 1.0) * (1.0 - min(0.95, attenuation))
+        scale_map[receiver] = max(0.05, next_scale)
+
+
+def _single_shadow_row(caster: Actor, length: float) -> np.ndarray:
+    """One east-pointing shadow row for ``_apply_receiver_dimming``."""
+    return np.array(
+        [
+            (
+                caster.x + 0.5,
+                caster.y + 0.5,
+                caster.visual_scale,
+                float(caster.shadow_height),
+                1.0,
+                0.0,
+                length,
+                float(config.ACTOR_SHADOW_ALPHA),
+            )
+        ],
+        dtype=np.float64,
+    )
+
+
 def test_actor_shadow_receiver_dimming_for_overlap() -> None:
     caster = _build_actor(x=2, y=2, shadow_height=4)
     receiver = _build_actor(x=3, y=2, shadow_height=1)
     renderer = _build_shadow_renderer([])
     renderer.actor_shadow_receive_light_scale.clear()
 
-    renderer._accumulate_actor_shadow_receiver_dimming(
-        caster=caster,
-        receivers=[caster, receiver],
-        shadow_dir_x=1.0,
-        shadow_dir_y=0.0,
-        shadow_length_tiles=4.0,
-        shadow_alpha=config.ACTOR_SHADOW_ALPHA,
-        fade_tip=False,
+    renderer._apply_receiver_dimming(
+        [caster], _single_shadow_row(caster, 4.0), [caster, receiver], fade_tip=False
     )
 
     receiver_scale = renderer.actor_shadow_receive_light_scale[receiver]
@@ -1139,25 +1253,19 @@ def test_actor_shadow_receiver_dimming_scales_with_caster_height() -> None:
 
     renderer = _build_shadow_renderer([])
     renderer.actor_shadow_receive_light_scale.clear()
-    renderer._accumulate_actor_shadow_receiver_dimming(
-        caster=short_caster,
-        receivers=[receiver_short],
-        shadow_dir_x=1.0,
-        shadow_dir_y=0.0,
-        shadow_length_tiles=4.0,
-        shadow_alpha=config.ACTOR_SHADOW_ALPHA,
+    renderer._apply_receiver_dimming(
+        [short_caster],
+        _single_shadow_row(short_caster, 4.0),
+        [receiver_short],
         fade_tip=False,
     )
     short_scale = renderer.actor_shadow_receive_light_scale[receiver_short]
 
     renderer.actor_shadow_receive_light_scale.clear()
-    renderer._accumulate_actor_shadow_receiver_dimming(
-        caster=tall_caster,
-        receivers=[receiver_tall],
-        shadow_dir_x=1.0,
-        shadow_dir_y=0.0,
-        shadow_length_tiles=4.0,
-        shadow_alpha=config.ACTOR_SHADOW_ALPHA,
+    renderer._apply_receiver_dimming(
+        [tall_caster],
+        _single_shadow_row(tall_caster, 4.0),
+        [receiver_tall],
         fade_tip=False,
     )
     tall_scale = renderer.actor_shadow_receive_light_scale[receiver_tall]
@@ -1165,6 +1273,89 @@ def test_actor_shadow_receiver_dimming_scales_with_caster_height() -> None:
     assert tall_scale < short_scale
 
 
+@pytest.mark.parametrize("fade_tip", [False, True])
+def test_batched_receiver_dimming_matches_per_caster_reference(fade_tip: bool) -> None:
+    """The bucketed native pass must match sequential per-caster accumulation."""
+    rng = np.random.default_rng(11)
+    actors = []
+    for _ in range(60):
+        actor = _build_actor(
+            x=int(rng.integers(0, 20)),
+            y=int(rng.integers(0, 20)),
+            shadow_height=int(rng.integers(0, 5)),
+        )
+        actor.visual_scale = float(rng.uniform(0.4, 1.6))
+        actors.append(actor)
+    # The last few casters are not receivers, like actors outside the view.
+    receivers = actors[:50]
+
+    casters = []
+    rows = []
+    for _light in range(4):
+        angle = float(rng.uniform(0.0, 2.0 * np.pi))
+        dir_x, dir_y = float(np.cos(angle)), float(np.sin(angle))
+        for caster in actors:
+            casters.append(caster)
+            rows.append(
+                (
+                    caster.x + 0.5,
+                    caster.y + 0.5,
+                    caster.visual_scale,
+                    float(caster.shadow_height),
+                    dir_x,
+                    dir_y,
+                    float(rng.uniform(0.0, 6.0)),
+                    float(rng.uniform(0.1, 0.9)),
+                )
+            )
+
+    expected: dict[Actor, float] = {}
+    for caster, row in zip(casters, rows, strict=True):
+        _accumulate_receiver_dimming_reference(
+            expected,
+            caster=caster,
+            receivers=receivers,
+            shadow_dir_x=row[4],
+            shadow_dir_y=row[5],
+            shadow_length_tiles=row[6],
+            shadow_alpha=row[7],
+            fade_tip=fade_tip,
+        )
+
+    batched = _build_shadow_renderer([])
+    batched.actor_shadow_receive_light_scale.clear()
+    batched._apply_receiver_dimming(
+        casters, np.array(rows, dtype=np.float64), receivers, fade_tip=fade_tip
+    )
+
+    actual = batched.actor_shadow_receive_light_scale
+    assert len(expected) > 10
+    assert actual.keys() == expected.keys()
+    for receiver, scale in expected.items():
+        assert actual[receiver] == pytest.approx(scale, rel=1e-6)
+
+
+def test_batched_receiver_dimming_composes_with_existing_scales() -> None:
+    caster = _build_actor(x=2, y=2, shadow_height=4)
+    receiver = _build_actor(x=3, y=2, shadow_height=1)
+    renderer = _build_shadow_renderer([])
+    renderer.actor_shadow_receive_light_scale.clear()
+    row = (2.5, 2.5, 1.0, 4.0, 1.0, 0.0, 4.0, float(config.ACTOR_SHADOW_ALPHA))
+
+    renderer._apply_receiver_dimming(
+        [caster], np.array([row]), [caster, receiver], fade_tip=False
+    )
+    single = renderer.actor_shadow_receive_light_scale[receiver]
+    renderer._apply_receiver_dimming(
+        [caster], np.array([row]), [caster, receiver], fade_tip=False
+    )
+
+    assert renderer.actor_shadow_receive_light_scale[receiver] == pytest.approx(
+        single * single, rel=1e-6
+    )
+    assert caster not in renderer.actor_shadow_receive_light_scale
+
+
 def test_world_view_actor_lighting_reads_shadow_renderer_scale() -> None:
     actor = _build_actor(x=1, y=1, shadow_height=1)
     renderer = object.__new__(ActorRenderer)
@@ -1195,6 +1386,7 @@ def _build_terrain_shadow_view() -> tuple[ShadowRenderer, SimpleNamespace]:
     graphics = SimpleNamespace(
         tile_dimensions=(20, 20),
         draw_actor_shadow=Mock(),
+        draw_actor_shadow_batch=Mock(),
         console_to_screen_coords=lambda x, y: (float(x) * 20.0, float(y) * 20.0),
     )
     renderer.viewport_system = cast(ViewportSystem, viewport)
@@ -1220,9 +1412,10 @@ def test_terrain_glyph_shadow_for_short_shadow_tile() -> None:
     ):
         renderer._render_terrain_glyph_shadows(tile_height=20.0)
 
-    graphics.draw_actor_shadow.assert_called_once()
-    call_kwargs = graphics.draw_actor_shadow.call_args.kwargs
-    assert call_kwargs["char"] == "#"
+    graphics.draw_actor_shadow_batch.assert_called_once()
+    call_kwargs = graphics.draw_actor_shadow_batch.call_args.kwargs
+    assert call_kwargs["char_codes"].tolist() == [ord("#")]
+    assert call_kwargs["screen_x"].tolist() == [100.0]
     assert call_kwargs["shadow_alpha"] == config.TERRAIN_GLYPH_SHADOW_ALPHA
 
 
@@ -1238,7 +1431,7 @@ def test_no_terrain_glyph_shadow_for_walls() -> None:
 
     renderer._render_terrain_glyph_shadows(tile_height=20.0)
 
-    graphics.draw_actor_shadow.assert_not_called()
+    graphics.draw_actor_shadow_batch.assert_not_called()
 
 
 def test_terrain_glyph_shadow_clipped_by_walls() -> None:
@@ -1268,8 +1461,147 @@ def test_terrain_glyph_shadow_clipped_by_walls() -> None:
     ):
         renderer._render_terrain_glyph_shadows(tile_height=20.0)
 
-    graphics.draw_actor_shadow.assert_called_once()
-    shadow_length_pixels = graphics.draw_actor_shadow.call_args.kwargs[
+    graphics.draw_actor_shadow_batch.assert_called_once()
+    shadow_length_pixels = graphics.draw_actor_shadow_batch.call_args.kwargs[
         "shadow_length_pixels"
     ]
-    assert shadow_length_pixels == pytest.approx(10.0)
+    assert shadow_length_pixels.tolist() == pytest.approx([10.0])
+
+
+def test_native_clip_shadow_lengths_matches_scalar_clip() -> None:
+    """The batched native wall clip agrees with the per-caster reference."""
+    rng = np.random.default_rng(7)
+    renderer = _build_shadow_renderer([])
+    shadow_grid = rng.choice(
+        np.array([0, 1, 2, 4], dtype=np.uint8), size=(24, 18), p=[0.6, 0.1, 0.1, 0.2]
+    )
+    renderer.game_map = SimpleNamespace(width=24, height=18, shadow_heights=shadow_grid)
+
+    tile_x = rng.integers(0, 24, size=400).astype(np.int32)
+    tile_y = rng.integers(0, 18, size=400).astype(np.int32)
+    base_lengths = rng.uniform(0.0, 12.0, size=400)
+    for dir_x, dir_y in ((1.0, 0.0), (-0.6, 0.8), (0.3, -0.95), (0.0, 0.0)):
+        lengths = base_lengths.copy()
+        clip_shadow_lengths(shadow_grid, tile_x, tile_y, lengths, dir_x, dir_y)
+        expected = [
+            renderer._clip_shadow_length_by_walls(x, y, dir_x, dir_y, length)
+            for x, y, length in zip(
+                tile_x.tolist(), tile_y.tolist(), base_lengths.tolist(), strict=True
+            )
+        ]
+        np.testing.assert_array_equal(lengths, np.asarray(expected))
+
+
+@pytest.mark.parametrize(
+    ("dir_x", "dir_y"),
+    [(0.6, 0.8), (1.0, 0.0), (-1.0, 0.01), (-0.3, -0.7)],
+)
+def test_draw_actor_shadow_batch_matches_scalar_vertices(
+    dir_x: float, dir_y: float
+) -> None:
+    """Natively built glyph shadow vertices match scalar draw_actor_shadow()."""
+    graphics_pair = []
+    for _ in range(2):
+        screen_renderer = object.__new__(WGPUScreenRenderer)
+        screen_renderer.cpu_vertex_buffer = np.zeros(24, dtype=VERTEX_DTYPE)
+        screen_renderer.vertex_count = 0
+        graphics = object.__new__(WGPUGraphicsContext)
+        graphics._tile_dimensions = (16, 24)
+        graphics.screen_renderer = screen_renderer
+        graphics.uv_map = graphics._precalculate_uv_map()
+        graphics_pair.append(graphics)
+    scalar_graphics, batch_graphics = graphics_pair
+
+    char_codes = np.array([ord("#"), ord("♣"), ord("o"), ord("^")])
+    screen_x = np.array([100.0, 150.5, 220.0, 300.0])
+    screen_y = np.array([200.0, 240.0, 260.25, 280.0])
+    lengths = np.array([30.0, 17.3, 0.0, 42.0])  # zero-length shadow is skipped
+
+    for code, x, y, length in zip(char_codes, screen_x, screen_y, lengths, strict=True):
+        scalar_graphics.draw_actor_shadow(
+            char=chr(int(code)),
+            screen_x=float(x),
+            screen_y=float(y),
+            shadow_dir_x=dir_x,
+            shadow_dir_y=dir_y,
+            shadow_length_pixels=float(length),
+            shadow_alpha=0.35,
+            scale_x=1.25,
+            scale_y=0.9,
+            fade_tip=True,
+        )
+    batch_graphics.draw_actor_shadow_batch(
+        char_codes=char_codes,
+        screen_x=screen_x,
+        screen_y=screen_y,
+        shadow_dir_x=dir_x,
+        shadow_dir_y=dir_y,
+        shadow_length_pixels=lengths,
+        shadow_alpha=0.35,
+        scale_x=1.25,
+        scale_y=0.9,
+        fade_tip=True,
+    )
+
+    scalar_buffer = scalar_graphics.screen_renderer
+    batch_buffer = batch_graphics.screen_renderer
+    assert batch_buffer.vertex_count == scalar_buffer.vertex_count == 18
+    np.testing.assert_array_equal(
+        batch_buffer.cpu_vertex_buffer[:18], scalar_buffer.cpu_vertex_buffer[:18]
+    )
+
+
+def test_terrain_glyph_shadow_batch_matches_per_tile_draws() -> None:
+    """The batched terrain pass emits the same vertices as per-tile draws."""
+    rng = np.random.default_rng(11)
+    fake_heights = rng.choice(
+        np.array([0, 1, 2, 4], dtype=np.uint8), size=(16, 16), p=[0.5, 0.2, 0.2, 0.1]
+    )
+    glyphs = rng.choice(np.array([ord("T"), ord("♣"), ord("o")]), size=(16, 16))
+    sun = DirectionalLight.create_sun(
+        elevation_degrees=20.0, azimuth_degrees=135.0, intensity=0.8
+    )
+
+    buffers = []
+    for use_batch in (True, False):
+        renderer = _build_shadow_renderer([sun])
+        game_map = renderer.game_map
+        game_map.visible[:] = True
+        game_map.shadow_heights[:] = fake_heights
+        game_map.light_appearance_map["ch"] = glyphs
+        viewport = ViewportSystem(16, 16)
+        viewport.update_camera(cast(Actor, _build_actor(8, 8)), 16, 16)
+        renderer.viewport_system = viewport
+        renderer.set_view_transform(view_origin=(1.0, 2.0), camera_frac_offset=(0, 0))
+
+        screen_renderer = object.__new__(WGPUScreenRenderer)
+        screen_renderer.cpu_vertex_buffer = np.zeros(6 * 256, dtype=VERTEX_DTYPE)
+        screen_renderer.vertex_count = 0
+        graphics = object.__new__(WGPUGraphicsContext)
+        graphics._tile_dimensions = (20, 20)
+        graphics._console_width_tiles = 20
+        graphics._console_height_tiles = 20
+        graphics.letterbox_geometry = (7, 5, 330, 330)
+        graphics.screen_renderer = screen_renderer
+        graphics.uv_map = graphics._precalculate_uv_map()
+        renderer.graphics = graphics
+        if not use_batch:
+            # Scalar screen positions and one draw_actor_shadow() per glyph.
+            renderer._world_to_screen_float_batch = lambda _x, _y: None
+            graphics.draw_actor_shadow_batch = partial(
+                GraphicsContext.draw_actor_shadow_batch, graphics
+            )
+
+        with patch(
+            "brileta.view.render.shadow_renderer.get_shadow_height_map",
+            return_value=fake_heights,
+        ):
+            renderer._render_terrain_glyph_shadows(tile_height=20.0)
+        buffers.append(screen_renderer)
+
+    batch_buffer, scalar_buffer = buffers
+    assert batch_buffer.vertex_count == scalar_buffer.vertex_count > 0
+    count = batch_buffer.vertex_count
+    np.testing.assert_array_equal(
+        batch_buffer.cpu_vertex_buffer[:count], scalar_buffer.cpu_vertex_buffer[:count]
+    )
@@ -0,0 +1,200 @@
+"""Session recording and deterministic headless replay.
+
+Records a short session through the real App frame loop, then proves the
+replay reproduces it tick for tick and pinpoints the first divergent tick.
+"""
+
+from __future__ import annotations
+
+import json
+from unittest.mock import patch
+
+import pytest
+
+from brileta.game.actions.combat import AttackIntent
+from brileta.game.actions.movement import MoveIntent
+from brileta.game.actors import NPC
+from brileta.game.session_recording import (
+    SessionRecorder,
+    SessionRecording,
+    decode_intent,
+    encode_intent,
+)
+from brileta.input_events import KeySym
+from brileta.testing import ReplayDivergence, SimHarness, replay_session
+from brileta.types import DeltaTime
+from tests.helpers import DummyApp
+
+_SEED = "acid-helm-pivot"
+# (dx, dy) of the step queued before each recorded frame, None for idle frames.
+_STEPS = [(1, 0), None, (0, 1), None, None, (-1, 0), (0, -1), None]
+
+
+def _record_session() -> SessionRecording:
+    """Play a few frames through App.update_game_logic with a recorder on."""
+    sim = SimHarness(seed=_SEED)
+    controller = sim.controller
+    app = DummyApp()
+    app.controller = controller
+    controller.app = app
+    recorder = SessionRecorder(controller)
+
+    # Alternate one and two logic steps per frame, as a live loop would.
+    with patch("brileta.app.live_variable_registry.record_metric"):
+        for i, step in enumerate(_STEPS):
+            if step is not None:
+                controller.queue_action(MoveIntent(controller, sim.player, *step))
+            controller.accumulator = 0.0
+            app.update_game_logic(DeltaTime(controller.fixed_timestep * (1 + i % 2)))
+
+    recording = recorder.detach()
+    assert controller.session_recorder is None
+    # Recordings travel as JSON files.
+    return SessionRecording.from_dict(json.loads(json.dumps(recording.to_dict())))
+
+
+def _record_held_key_walk(sim: SimHarness, frames: int) -> SessionRecording:
+    """Hold RIGHT through App frames, as ExploreMode.update() sees it live."""
+    controller = sim.controller
+    app = DummyApp()
+    app.controller = controller
+    controller.app = app
+    recorder = SessionRecorder(controller)
+    explore = controller.explore_mode
+    explore.movement_keys.add(KeySym.RIGHT)
+    with patch("brileta.app.live_variable_registry.record_metric"):
+        for _ in range(frames):
+            # Key repeat runs on wall-clock time; make every frame a repeat.
+            explore.move_generator.next_move_time = 0.0
+            controller.accumulator = 0.0
+            app.update_game_logic(DeltaTime(controller.fixed_timestep))
+    explore.movement_keys.clear()
+    return recorder.detach()
+
+
+def test_recorder_captures_seed_intents_and_frame_boundaries() -> None:
+    recording = _record_session()
+
+    assert recording.seed == _SEED
+    assert len(recording.frames) == len(_STEPS)
+    assert [f.logic_steps for f in recording.frames] == [1, 2] * (len(_STEPS) // 2)
+    intents = [f.intents for f in recording.frames]
+    assert [bool(i) for i in intents] == [step is not None for step in _STEPS]
+    assert intents[0][0]["fields"]["dx"] == 1
+
+
+def test_replay_is_deterministic_and_reports_phase_timings() -> None:
+    recording = _record_session()
+
+    blessed = replay_session(recording)
+    assert len(blessed.tick_hashes) == recording.tick_count
+    recording.tick_hashes = blessed.tick_hashes
+
+    result = replay_session(recording)
+
+    assert result.tick_hashes == blessed.tick_hashes
+    assert result.phase_timings["time.logic_ms"].samples == recording.tick_count
+    assert result.phase_timings["replay.input_ms"].samples == len(recording.frames)
+
+
+def test_held_key_walk_is_recorded_and_replayed() -> None:
+    """Held-key movement never goes through queue_action() but is recorded."""
+    sim = SimHarness(seed=_SEED)
+    start = (sim.player.x, sim.player.y)
+    recording = _record_held_key_walk(sim, frames=4)
+    end = (sim.player.x, sim.player.y)
+    assert end != start
+    assert all(f.intents for f in recording.frames)
+
+    harnesses: list[SimHarness] = []
+
+    def tracked_harness(*args: object, **kwargs: object) -> SimHarness:
+        harnesses.append(SimHarness(*args, **kwargs))
+        return harnesses[-1]
+
+    with patch("brileta.testing.replay.SimHarness", side_effect=tracked_harness):
+        replay_session(recording)
+
+    replayed = harnesses[-1].player
+    assert (replayed.x, replayed.y) == end
+
+
+def test_replay_names_first_divergent_tick() -> None:
+    recording = _record_session()
+    recording.tick_hashes = replay_session(recording).tick_hashes
+    recording.tick_hashes[4] = "0" * 16
+
+    with pytest.raises(ReplayDivergence) as excinfo:
+        replay_session(recording)
+
+    # Frames run 1, 2, 1, 2, ... ticks, so tick 4 opens frame 3.
+    assert excinfo.value.tick == 4
+    assert excinfo.value.frame == 3
+
+
+def test_intent_round_trips_through_encoding() -> None:
+    sim = SimHarness(seed=_SEED)
+    controller = sim.controller
+    intent = MoveIntent(controller, sim.player, 0, -1, duration_ms=120)
+
+    decoded = decode_intent(json.loads(json.dumps(encode_intent(intent))), controller)
+
+    assert type(decoded) is MoveIntent
+    assert decoded.actor is sim.player
+    assert vars(decoded) == vars(intent)
+
+
+def test_attack_with_equipped_weapon_is_recorded_and_replayed() -> None:
+    """Equipped weapons live in ready slots, outside get_items()."""
+    sim = SimHarness(seed=_SEED)
+    controller = sim.controller
+    inventory = sim.player.inventory
+    weapon = inventory.ready_slots[0]
+    assert weapon is not None and weapon not in inventory.get_items()
+    # Target a world NPC so the replayed world has it too.
+    target = next(a for a in controller.gw.actors if isinstance(a, NPC))
+    recorder = SessionRecorder(controller)
+
+    controller.queue_action(AttackIntent(controller, sim.player, target, weapon))
+    recorder.begin_frame()
+    controller.process_player_input()
+    recorder.end_frame(1)
+    recording = recorder.detach()
+
+    assert recording.unreplayable is None
+    fields = recording.frames[0].intents[0]["fields"]
+    assert fields["weapon"] == {"ready_slot": [int(sim.player.actor_id), 0]}
+    decoded = decode_intent(recording.frames[0].intents[0], controller)
+    assert decoded.weapon is weapon
+    assert len(replay_session(recording).tick_hashes) == 1
+
+
+def test_outfit_item_round_trips_through_encoding() -> None:
+    sim = SimHarness(seed=_SEED)
+    controller = sim.controller
+    outfit = sim.player.inventory.equipped_outfit
+    assert outfit is not None
+    intent = MoveIntent(controller, sim.player, 0, 1)
+    intent.item = outfit[0]
+
+    data = encode_intent(intent)
+
+    assert data["fields"]["item"] == {"outfit": int(sim.player.actor_id)}
+    assert decode_intent(data, controller).item is outfit[0]
+
+
+def test_unrecordable_intent_marks_recording_instead_of_raising() -> None:
+    sim = SimHarness(seed=_SEED)
+    controller = sim.controller
+    recorder = SessionRecorder(controller)
+    intent = MoveIntent(controller, sim.player, 1, 0)
+    intent.callback = object()
+
+    recorder.record_intent(intent)
+
+    recording = recorder.detach()
+    assert recording.unreplayable is not None
+    assert "MoveIntent" in recording.unreplayable
+    assert SessionRecording.from_dict(recording.to_dict()).unreplayable
+    with pytest.raises(ValueError, match="cannot be replayed"):
+        replay_session(recording)
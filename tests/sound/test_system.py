@@ -1839,25 +1839,92 @@ class TestSoundOcclusion:
         assert result == 0.0
 
     def test_cache_invalidation_on_door_toggle(self) -> None:
-        """Cache is invalidated when structural_revision changes (door toggle)."""
+        """The field is recomputed when a connection tile changes (door toggle)."""
         game_map = _make_occlusion_map()
         self.system._current_game_map = game_map
+        field = self.system._occlusion_field
 
         self.system.audio_listener_x = 5.0
         self.system.audio_listener_y = 5.0
 
-        # First call with closed door - caches the result
+        # First call with closed door - computes the field
         result_closed = self.system._calculate_occlusion(15, 5)
         assert result_closed == CLOSED_DOOR_OCCLUSION
-        assert len(self.system._occlusion_cache) == 1
+        assert field.recompute_count == 1
+
+        # Further emitters are array lookups
+        self.system._calculate_occlusion(15, 15)
+        assert field.recompute_count == 1
 
         # Open the door (this bumps structural_revision)
         game_map.tiles[10, 5] = TileTypeID.DOOR_OPEN
-        game_map.invalidate_property_caches()
+        game_map.invalidate_property_caches(changed_tiles=[(10, 5)])
 
         # Second call should pick up the new door state
         result_open = self.system._calculate_occlusion(15, 5)
         assert result_open == OPEN_DOOR_OCCLUSION
+        assert field.recompute_count == 2
+
+    def test_non_door_tile_change_keeps_field(self) -> None:
+        """Structural changes away from connection tiles do not recompute."""
+        game_map = _make_occlusion_map()
+        self.system._current_game_map = game_map
+        field = self.system._occlusion_field
+
+        self.system.audio_listener_x = 5.0
+        self.system.audio_listener_y = 5.0
+        assert self.system._calculate_occlusion(15, 15) == (
+            CLOSED_DOOR_OCCLUSION * CLOSED_DOOR_OCCLUSION
+        )
+
+        game_map.tiles[3, 3] = TileTypeID.WALL
+        game_map.invalidate_property_caches(changed_tiles=[(3, 3)])
+
+        assert self.system._calculate_occlusion(15, 15) == (
+            CLOSED_DOOR_OCCLUSION * CLOSED_DOOR_OCCLUSION
+        )
+        assert field.recompute_count == 1
+
+    def test_listener_moving_within_region_keeps_field(self) -> None:
+        """Only a change of listener region triggers a recompute."""
+        game_map = _make_occlusion_map()
+        self.system._current_game_map = game_map
+        field = self.system._occlusion_field
+
+        self.system.audio_listener_x = 5.0
+        self.system.audio_listener_y = 5.0
+        self.system._calculate_occlusion(15, 5)
+        self.system.audio_listener_x = 7.0
+        self.system._calculate_occlusion(15, 5)
+        assert field.recompute_count == 1
+
+        self.system.audio_listener_x = 15.0
+        self.system._calculate_occlusion(15, 15)
+        assert field.recompute_count == 2
+
+    def test_best_route_wins_over_fewest_doors(self) -> None:
+        """Sound takes the least-occluded route, not the one with fewest doors."""
+        game_map = _make_occlusion_map()
+        # A direct closed door between Room 0 and Room 2 (one hop, 0.15)
+        # competes with two open doors through Room 1 (two hops, 0.36).
+        game_map.tiles[10, 15] = TileTypeID.DOOR_CLOSED
+        game_map.tiles[10, 5] = TileTypeID.DOOR_OPEN
+        game_map.tiles[15, 10] = TileTypeID.DOOR_OPEN
+        game_map.regions[0].connections[2] = (10, 15)
+        game_map.regions[2].connections[0] = (10, 15)
+        game_map.invalidate_property_caches()
+        self.system._current_game_map = game_map
+
+        self.system.audio_listener_x = 5.0
+        self.system.audio_listener_y = 5.0
+        result = self.system._calculate_occlusion(15, 15)
+        assert abs(result - OPEN_DOOR_OCCLUSION * OPEN_DOOR_OCCLUSION) < 1e-10
+
+        # Closing the far door makes the direct route the better one.
+        game_map.tiles[15, 10] = TileTypeID.DOOR_CLOSED
+        game_map.invalidate_property_caches(changed_tiles=[(15, 10)])
+        result = self.system._calculate_occlusion(15, 15)
+        assert result == CLOSED_DOOR_OCCLUSION
 
     def test_occlusion_applied_to_volume_calculation(self) -> None:
         """Verify that _calculate_volume integrates occlusion correctly."""
@@ -1899,8 +1966,6 @@ class TestSoundOcclusion:
         # Listener in Room 1, emitter in Room 0
         self.system.audio_listener_x = 15.0
         self.system.audio_listener_y = 5.0
-        # Clear cache since listener moved to a different region
-        self.system._occlusion_cache.clear()
         backward = self.system._calculate_occlusion(5, 5)
 
         assert forward == backward
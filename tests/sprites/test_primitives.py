@@ -8,8 +8,10 @@ from brileta import colors
 from brileta.sprites.primitives import (
     alpha_blend,
     composite_over,
+    darken_rim,
     draw_line,
     draw_thick_line,
+    finish_pose,
     generate_deciduous_canopy,
     nibble_canopy,
     paste_sprite,
@@ -361,3 +363,23 @@ class TestNibbleCanopyBridgeProtection:
                 interior_probability=1.0,
             )
             assert int(canvas[5, 4, 3]) > 128, f"Bridge erased with seed={seed}"
+
+
+class TestFinishPose:
+    """finish_pose() must match the numpy harden/mirror/darken_rim sequence."""
+
+    def test_matches_numpy_reference(self) -> None:
+        rng = np.random.default_rng(3)
+        for mirror in (False, True):
+            for _ in range(10):
+                canvas = rng.integers(0, 256, size=(20, 20, 4)).astype(np.uint8)
+                canvas[rng.random((20, 20)) < 0.3, 3] = 0
+
+                expected = canvas.copy()
+                expected[:, :, 3] = np.where(expected[:, :, 3] >= 110, 255, 0)
+                if mirror:
+                    expected = np.ascontiguousarray(expected[:, ::-1, :])
+                darken_rim(expected, (35, 35, 25))
+
+                finish_pose(canvas, 110, (35, 35, 25), mirror=mirror)
+                np.testing.assert_array_equal(canvas, expected)
@@ -0,0 +1,184 @@
+"""Tests for the content-keyed sprite cache and its on-disk persistence."""
+
+from __future__ import annotations
+
+from pathlib import Path
+
+import numpy as np
+
+from brileta.sprites.cache import SpriteCache, SpriteCacheKey, archetype_tag
+from brileta.sprites.characters import MASC_PRESENTATION, NEUTRAL_PRESENTATION
+from brileta.sprites.quadrupeds import DOG_PRESET
+from brileta.sprites.trees import TreeArchetype
+
+
+def _key(seed: int, generator: str = "tree") -> SpriteCacheKey:
+    return SpriteCacheKey(generator, "deciduous", seed, 20, 1)
+
+
+def _frame(value: int, h: int = 3, w: int = 2) -> np.ndarray:
+    return np.full((h, w, 4), value, dtype=np.uint8)
+
+
+def test_key_round_trips_through_encoding() -> None:
+    key = SpriteCacheKey("character", "ab12", 2**40 + 7, 20, 3)
+    assert SpriteCacheKey.decode(key.encode()) == key
+
+
+def test_archetype_tag_is_stable_and_distinguishes_values() -> None:
+    assert archetype_tag(TreeArchetype.CONIFER) == "conifer"
+    assert archetype_tag(DOG_PRESET) == DOG_PRESET.name
+    assert archetype_tag(None) == "default"
+    assert archetype_tag(MASC_PRESENTATION) == archetype_tag(MASC_PRESENTATION)
+    assert archetype_tag(MASC_PRESENTATION) != archetype_tag(NEUTRAL_PRESENTATION)
+
+
+def test_get_or_generate_generates_once() -> None:
+    cache = SpriteCache()
+    calls: list[int] = []
+
+    def generate() -> list[np.ndarray]:
+        calls.append(1)
+        return [_frame(5)]
+
+    first = cache.get_or_generate(_key(1), generate)
+    second = cache.get_or_generate(_key(1), generate)
+
+    assert len(calls) == 1
+    assert second is first
+    assert (cache.hits, cache.misses) == (1, 1)
+
+
+def test_get_or_generate_many_only_generates_misses_once_each() -> None:
+    cache = SpriteCache()
+    cache.put(_key(1), [_frame(1)])
+    requested: list[list[int]] = []
+
+    def generate_misses(seeds: list[int]) -> list[list[np.ndarray]]:
+        requested.append(seeds)
+        return [[_frame(s)] for s in seeds]
+
+    seeds = [1, 2, 3, 2]
+    results = cache.get_or_generate_many(
+        [_key(s) for s in seeds], seeds, generate_misses
+    )
+
+    assert requested == [[2, 3]]
+    assert [int(frames[0][0, 0, 0]) for frames in results] == seeds
+    assert results[1] is results[3]
+
+
+def test_save_and_load_round_trip(tmp_path: Path) -> None:
+    path = tmp_path / "nested" / "sprites.npz"
+    cache = SpriteCache(path)
+    pose_set = [_frame(i, h=4 + i, w=3) for i in range(12)]
+    cache.put(_key(1, "character"), pose_set)
+    cache.put(_key(2), [_frame(99, h=7, w=5)])
+    cache.save()
+    assert not cache.dirty
+
+    reloaded = SpriteCache(path)
+    reloaded.load()
+
+    assert len(reloaded) == 2
+    frames = reloaded.get(_key(1, "character"))
+    assert frames is not None
+    assert len(frames) == 12
+    for original, restored in zip(pose_set, frames, strict=True):
+        np.testing.assert_array_equal(original, restored)
+    single = reloaded.get(_key(2))
+    assert single is not None
+    np.testing.assert_array_equal(single[0], _frame(99, h=7, w=5))
+
+
+def test_save_without_changes_does_not_write(tmp_path: Path) -> None:
+    path = tmp_path / "sprites.npz"
+    SpriteCache(path).save()
+    assert not path.exists()
+
+
+def test_save_keeps_most_recently_used_entries(tmp_path: Path) -> None:
+    path = tmp_path / "sprites.npz"
+    cache = SpriteCache(path, max_entries=2)
+    cache.put(_key(0), [_frame(0)])
+    cache.put(_key(1), [_frame(1)])
+    cache.get(_key(0))  # Touch the oldest so it survives the cap.
+    cache.put(_key(2), [_frame(2)])
+    cache.save()
+
+    reloaded = SpriteCache(path)
+    reloaded.load()
+    assert _key(0) in reloaded
+    assert _key(2) in reloaded
+    assert _key(1) not in reloaded
+
+
+def test_put_evicts_least_recently_used_entry_past_cap() -> None:
+    cache = SpriteCache(max_entries=2)
+    cache.put(_key(0), [_frame(0)])
+    cache.put(_key(1), [_frame(1)])
+    cache.get(_key(0))
+    cache.put(_key(2), [_frame(2)])
+
+    assert len(cache) == 2
+    assert _key(1) not in cache
+    assert _key(0) in cache
+    assert _key(2) in cache
+
+
+def test_get_or_generate_many_returns_all_frames_when_batch_exceeds_cap() -> None:
+    cache = SpriteCache(max_entries=2)
+    seeds = [1, 2, 3, 4]
+
+    results = cache.get_or_generate_many(
+        [_key(s) for s in seeds], seeds, lambda items: [[_frame(s)] for s in items]
+    )
+
+    assert [int(frames[0][0, 0, 0]) for frames in results] == seeds
+    assert len(cache) == 2
+
+
+def test_load_trims_file_entries_to_cap(tmp_path: Path) -> None:
+    path = tmp_path / "sprites.npz"
+    writer = SpriteCache(path)
+    for seed in range(3):
+        writer.put(_key(seed), [_frame(seed)])
+    writer.save()
+
+    cache = SpriteCache(path, max_entries=2)
+    cache.put(_key(9), [_frame(9)])
+    cache.load()
+
+    assert len(cache) == 2
+    assert _key(9) in cache
+    assert _key(2) in cache
+
+
+def test_unreadable_file_is_ignored(tmp_path: Path) -> None:
+    path = tmp_path / "sprites.npz"
+    path.write_bytes(b"not an npz file")
+    cache = SpriteCache(path)
+    cache.load()
+    assert len(cache) == 0
+
+    # The next save replaces the bad file with a valid one.
+    cache.put(_key(1), [_frame(1)])
+    cache.save()
+    reloaded = SpriteCache(path)
+    reloaded.load()
+    assert _key(1) in reloaded
+
+
+def test_memory_entries_win_over_file_entries(tmp_path: Path) -> None:
+    path = tmp_path / "sprites.npz"
+    writer = SpriteCache(path)
+    writer.put(_key(1), [_frame(1)])
+    writer.save()
+
+    cache = SpriteCache(path)
+    cache.put(_key(1), [_frame(42)])
+    cache.load()
+
+    frames = cache.get(_key(1))
+    assert frames is not None
+    assert int(frames[0][0, 0, 0]) == 42
@@ -0,0 +1,70 @@
+from __future__ import annotations
+
+import numpy as np
+import pytest
+
+from brileta.util._native import atlas_pack_blit
+
+
+def _args(
+    sprites: list[np.ndarray], atlas_size: int = 32
+) -> tuple[list[np.ndarray], np.ndarray, np.ndarray, np.ndarray, np.ndarray]:
+    order = np.arange(len(sprites), dtype=np.int32)
+    atlas = np.zeros((atlas_size, atlas_size, 4), dtype=np.uint8)
+    cursor = np.zeros(3, dtype=np.int32)
+    positions = np.full((len(sprites), 2), -1, dtype=np.int32)
+    return sprites, order, atlas, cursor, positions
+
+
+def test_atlas_pack_blit_places_on_shelves_and_blits() -> None:
+    a = np.full((4, 5, 4), 10, dtype=np.uint8)
+    b = np.full((3, 6, 4), 20, dtype=np.uint8)
+    sprites, order, atlas, cursor, positions = _args([a, b])
+
+    assert atlas_pack_blit(sprites, order, atlas, cursor, positions, 1) == 2
+
+    assert positions.tolist() == [[0, 0], [6, 0]]
+    assert cursor.tolist() == [13, 0, 5]
+    assert (atlas[0:4, 0:5] == 10).all()
+    assert (atlas[4, 0:5] == 10).all()  # bottom-row edge extension
+    assert (atlas[0:4, 6:12] == 20).all()
+
+
+def test_atlas_pack_blit_marks_sprites_that_do_not_fit() -> None:
+    sprites, order, atlas, cursor, positions = _args(
+        [np.ones((20, 20, 4), dtype=np.uint8), np.ones((20, 20, 4), dtype=np.uint8)]
+    )
+    assert atlas_pack_blit(sprites, order, atlas, cursor, positions, 1) == 1
+    assert positions.tolist() == [[0, 0], [-1, -1]]
+
+
+def test_atlas_pack_blit_skips_sprites_larger_than_the_atlas() -> None:
+    wide = np.full((2, 40, 4), 7, dtype=np.uint8)
+    tall = np.full((40, 2, 4), 7, dtype=np.uint8)
+    small = np.full((3, 3, 4), 9, dtype=np.uint8)
+    sprites, order, atlas, cursor, positions = _args([wide, tall, small])
+
+    assert atlas_pack_blit(sprites, order, atlas, cursor, positions, 1) == 1
+
+    assert positions.tolist() == [[-1, -1], [-1, -1], [0, 0]]
+    assert cursor.tolist() == [4, 0, 4]
+    # Nothing of the oversize sprites reached the atlas.
+    assert not (atlas == 7).any()
+
+
+def test_atlas_pack_blit_rejects_non_rgba_sprites() -> None:
+    sprites, order, atlas, cursor, positions = _args(
+        [np.zeros((4, 4, 3), dtype=np.uint8)]
+    )
+    with pytest.raises(TypeError, match=r"\(H, W, 4\) uint8"):
+        atlas_pack_blit(sprites, order, atlas, cursor, positions, 1)
+
+
+def test_atlas_pack_blit_rejects_out_of_range_order() -> None:
+    sprites, _order, atlas, cursor, positions = _args(
+        [np.zeros((4, 4, 4), dtype=np.uint8)]
+    )
+    with pytest.raises(IndexError, match="out of range"):
+        atlas_pack_blit(
+            sprites, np.array([3], dtype=np.int32), atlas, cursor, positions, 1
+        )
@@ -0,0 +1,185 @@
+from __future__ import annotations
+
+import heapq
+import math
+
+import numpy as np
+import pytest
+
+from brileta.util._native import IncrementalPlanner, astar, astar_within
+
+_MOVES = [(-1, 0), (1, 0), (0, -1), (0, 1), (-1, -1), (-1, 1), (1, -1), (1, 1)]
+
+
+def _optimal_cost(
+    cost: np.ndarray, start: tuple[int, int], target: tuple[int, int], distance: int
+) -> float:
+    """Dijkstra cost from start to any tile within distance of target."""
+    w, h = cost.shape
+    best = {start: 0.0}
+    queue = [(0.0, start)]
+    while queue:
+        d, (x, y) = heapq.heappop(queue)
+        if d > best[(x, y)]:
+            continue
+        if max(abs(x - target[0]), abs(y - target[1])) <= distance:
+            return d
+        for dx, dy in _MOVES:
+            nx, ny = x + dx, y + dy
+            if not (0 <= nx < w and 0 <= ny < h) or cost[nx, ny] <= 0:
+                continue
+            nd = d + float(cost[nx, ny]) * (math.sqrt(2) if dx and dy else 1.0)
+            if nd < best.get((nx, ny), math.inf):
+                best[(nx, ny)] = nd
+                heapq.heappush(queue, (nd, (nx, ny)))
+    return math.inf
+
+
+def _path_cost(cost: np.ndarray, start: tuple[int, int], path: list) -> float:
+    total = 0.0
+    px, py = start
+    for x, y in path:
+        assert max(abs(x - px), abs(y - py)) == 1
+        assert cost[x, y] > 0
+        total += float(cost[x, y]) * (math.sqrt(2) if x != px and y != py else 1.0)
+        px, py = x, y
+    return total
+
+
+def test_planner_finds_straight_path() -> None:
+    cost = np.ones((10, 10), dtype=np.int16)
+    planner = IncrementalPlanner(cost, 0, 0, 3, 0)
+
+    assert planner.compute_path() == [(1, 0), (2, 0), (3, 0)]
+    assert planner.target == (3, 0)
+    assert planner.distance == 0
+
+
+def test_planner_stops_within_distance_of_blocked_target() -> None:
+    cost = np.ones((10, 10), dtype=np.int16)
+    cost[6, 4] = 0
+    planner = IncrementalPlanner(cost, 0, 4, 6, 4, 1)
+
+    path = planner.compute_path()
+
+    assert path[-1] == (5, 4)
+    assert planner.compute_path() == path
+
+
+def test_planner_routes_around_new_blocker_and_back() -> None:
+    cost = np.ones((9, 5), dtype=np.int16)
+    planner = IncrementalPlanner(cost, 0, 2, 8, 2)
+    assert len(planner.compute_path()) == 8
+
+    assert planner.update_costs([(1, 2, 0), (1, 2, 0)]) == 1
+    detour = planner.compute_path()
+    assert (1, 2) not in detour
+    assert planner.get_cost(1, 2) == 0
+
+    planner.update_costs([(1, 2, 1)])
+    assert planner.compute_path() == [(x, 2) for x in range(1, 9)]
+
+
+def test_planner_reports_unreachable_and_recovers() -> None:
+    cost = np.ones((7, 7), dtype=np.int16)
+    wall = [(3, y, 0) for y in range(7)]
+    planner = IncrementalPlanner(cost, 0, 3, 6, 3)
+
+    planner.update_costs(wall)
+    assert planner.compute_path() == []
+
+    planner.update_costs([(3, 5, 1)])
+    path = planner.compute_path()
+    assert (3, 5) in path
+    assert path[-1] == (6, 3)
+
+
+@pytest.mark.parametrize("seed", range(3))
+def test_planner_repair_is_cheaper_than_fresh_search(seed: int) -> None:
+    """Blocking the next tile re-searches a fraction of a fresh search."""
+    rng = np.random.default_rng(seed)
+    cost = rng.integers(1, 4, size=(100, 100)).astype(np.int16)
+    cost[rng.random(cost.shape) < 0.2] = 0
+    cost[2, 50] = 1
+    planner = IncrementalPlanner(cost, 2, 50, 97, 50, 1)
+    x, y = planner.compute_path()[0]
+
+    planner.update_costs([(x, y, 0)])
+    repaired = planner.compute_path()
+    cost[x, y] = 0
+    fresh = IncrementalPlanner(cost, 2, 50, 97, 50, 1)
+
+    assert _path_cost(cost, (2, 50), repaired) == pytest.approx(
+        _path_cost(cost, (2, 50), fresh.compute_path())
+    )
+    assert 0 < planner.expansions < fresh.expansions // 10
+
+
+def test_planner_rejects_bad_input() -> None:
+    with pytest.raises(TypeError, match="int16"):
+        IncrementalPlanner(np.ones((4, 4)), 0, 0, 3, 3)
+    with pytest.raises(ValueError, match="start is out of bounds"):
+        IncrementalPlanner(np.ones((4, 4), dtype=np.int16), 4, 0, 3, 3)
+
+    planner = IncrementalPlanner(np.ones((4, 4), dtype=np.int16), 0, 0, 3, 3)
+    with pytest.raises(ValueError, match="out of bounds"):
+        planner.update_costs([(4, 0, 1)])
+    with pytest.raises(ValueError, match="out of bounds"):
+        planner.set_start(0, -1)
+
+
+@pytest.mark.parametrize("distance", [0, 1, 2])
+@pytest.mark.parametrize("seed", range(5))
+def test_planner_repairs_match_fresh_search_on_random_blocking(
+    seed: int, distance: int
+) -> None:
+    """Each repair is as cheap as a from-scratch search of the current grid.
+
+    The planner walks its own path while random tiles are blocked, freed and
+    reweighted around it; after every batch the repaired path must cost
+    exactly the Dijkstra optimum and no more than a fresh A* (whose 1.01
+    heuristic weight can only make it costlier).
+    """
+    rng = np.random.default_rng(seed)
+    w, h = 28, 22
+    cost = rng.integers(1, 5, size=(w, h)).astype(np.int16)
+    cost[rng.random(cost.shape) < 0.2] = 0
+    start = (0, 0)
+    target = (w - 2, h - 3)
+    cost[start] = 1
+
+    planner = IncrementalPlanner(cost, *start, *target, distance)
+    for _ in range(30):
+        path = planner.compute_path()
+        expected = _optimal_cost(cost, start, target, distance)
+        if (
+            expected == math.inf
+            or max(abs(start[0] - target[0]), abs(start[1] - target[1])) <= distance
+        ):
+            assert path == []
+        else:
+            end = path[-1]
+            assert max(abs(end[0] - target[0]), abs(end[1] - target[1])) <= distance
+            assert _path_cost(cost, start, path) == pytest.approx(expected)
+            c_cost = np.ascontiguousarray(cost)
+            fresh = (
+                astar_within(c_cost, *start, *target, distance)
+                if distance
+                else astar(c_cost, *start, *target)
+            )
+            assert _path_cost(cost, start, path) <= (
+                _path_cost(cost, start, fresh) + 1e-9
+            )
+            # Walk a couple of steps along the repaired path.
+            start = path[min(len(path), 2) - 1]
+            planner.set_start(*start)
+
+        updates = []
+        for _ in range(int(rng.integers(1, 6))):
+            x, y = int(rng.integers(w)), int(rng.integers(h))
+            if (x, y) == start:
+                continue
+            value = 0 if rng.random() < 0.5 else int(rng.integers(1, 5))
+            cost[x, y] = value
+            updates.append((x, y, value))
+        planner.update_costs(updates)
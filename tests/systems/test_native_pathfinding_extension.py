@@ -1,9 +1,11 @@
 from __future__ import annotations
 
+import math
+
 import numpy as np
 import pytest
 
-from brileta.util._native import astar
+from brileta.util._native import astar, astar_goals, astar_within
 
 
 def test_astar_raises_type_error_for_wrong_dtype() -> None:
@@ -61,3 +63,105 @@ def test_astar_returns_empty_when_start_is_blocked() -> None:
     cost[4, 4] = 1
 
     assert astar(cost, 0, 0, 4, 4) == []
+
+
+def _path_cost(cost: np.ndarray, start: tuple[int, int], path: list) -> float:
+    """Octile cost of *path* under the native weighting (destination weight)."""
+    total = 0.0
+    px, py = start
+    for x, y in path:
+        assert max(abs(x - px), abs(y - py)) == 1
+        diagonal = x != px and y != py
+        total += float(cost[x, y]) * (math.sqrt(2) if diagonal else 1.0)
+        px, py = x, y
+    return total
+
+
+def test_astar_within_stops_next_to_blocked_target() -> None:
+    """The goal box may have a blocked centre; the path ends one tile away."""
+    cost = np.ones((9, 9), dtype=np.int16)
+    cost[6, 4] = 0
+
+    path = astar_within(cost, 0, 4, 6, 4, 1)
+
+    assert path[-1] == (5, 4)
+    assert len(path) == 5
+
+
+def test_astar_within_returns_empty_when_start_is_in_range() -> None:
+    cost = np.ones((5, 5), dtype=np.int16)
+
+    assert astar_within(cost, 1, 1, 2, 2, 1) == []
+
+
+def test_astar_within_accepts_target_off_the_grid() -> None:
+    cost = np.ones((5, 5), dtype=np.int16)
+
+    path = astar_within(cost, 0, 0, 6, 2, 2)
+
+    assert path[-1][0] == 4
+
+
+@pytest.mark.parametrize("seed", range(6))
+def test_astar_within_matches_cheapest_single_goal_search(seed: int) -> None:
+    """One goal-box search costs no more than the best per-tile search."""
+    rng = np.random.default_rng(seed)
+    cost = rng.integers(1, 6, size=(24, 18)).astype(np.int16)
+    cost[rng.random(cost.shape) < 0.25] = 0
+    cost[0, 0] = 1
+    tx, ty, k = 17, 11, 2
+    cost[tx, ty] = 0
+
+    best = math.inf
+    for gx in range(tx - k, tx + k + 1):
+        for gy in range(ty - k, ty + k + 1):
+            candidate = astar(cost, 0, 0, gx, gy)
+            if candidate:
+                best = min(best, _path_cost(cost, (0, 0), candidate))
+
+    path = astar_within(cost, 0, 0, tx, ty, k)
+
+    if best == math.inf:
+        assert path == []
+        return
+    end = path[-1]
+    assert max(abs(end[0] - tx), abs(end[1] - ty)) <= k
+    # The 1.01 heuristic weight allows at most a 1% overshoot.
+    assert _path_cost(cost, (0, 0), path) <= best * 1.01 + 1e-9
+
+
+def test_astar_goals_accepts_pairs_and_mask() -> None:
+    cost = np.ones((10, 10), dtype=np.int16)
+    goals = [(9, 9), (3, 0), (-1, 4)]
+    mask = np.zeros(cost.shape, dtype=np.bool_)
+    mask[9, 9] = mask[3, 0] = True
+
+    from_pairs = astar_goals(cost, 0, 0, goals)
+    from_mask = astar_goals(cost, 0, 0, mask)
+
+    assert from_pairs == [(1, 0), (2, 0), (3, 0)]
+    assert from_mask == from_pairs
+
+
+def test_astar_goals_with_many_goals_uses_box_heuristic() -> None:
+    """Large goal sets still reach the nearest goal."""
+    cost = np.ones((40, 40), dtype=np.int16)
+    goals = [(x, 39) for x in range(40)] + [(20, 5)]
+
+    path = astar_goals(cost, 20, 0, goals)
+
+    assert path[-1] == (20, 5)
+
+
+def test_astar_goals_empty_set_has_no_path() -> None:
+    cost = np.ones((4, 4), dtype=np.int16)
+
+    assert astar_goals(cost, 0, 0, []) == []
+    assert astar_goals(cost, 0, 0, np.zeros((4, 4), dtype=np.bool_)) == []
+
+
+def test_astar_goals_rejects_mismatched_mask() -> None:
+    cost = np.ones((4, 4), dtype=np.int16)
+
+    with pytest.raises(ValueError, match="shaped like cost"):
+        astar_goals(cost, 0, 0, np.zeros((3, 4), dtype=np.bool_))
@@ -0,0 +1,102 @@
+from __future__ import annotations
+
+import itertools
+
+import numpy as np
+import pytest
+
+from brileta.util._native import region_max_product
+
+
+def _csr(
+    node_count: int, edges: list[tuple[int, int, float]]
+) -> tuple[np.ndarray, np.ndarray, np.ndarray]:
+    edges = sorted(edges, key=lambda e: e[0])
+    offsets = np.zeros(node_count + 1, dtype=np.int32)
+    for src, _, _ in edges:
+        offsets[src + 1] += 1
+    np.cumsum(offsets, out=offsets)
+    neighbors = np.array([e[1] for e in edges], dtype=np.int32)
+    factors = np.array([e[2] for e in edges], dtype=np.float64)
+    return offsets, neighbors, factors
+
+
+def _brute_force(
+    node_count: int, edges: list[tuple[int, int, float]], source: int
+) -> np.ndarray:
+    """Best product over every simple path, by exhaustive enumeration."""
+    adjacency: dict[int, list[tuple[int, float]]] = {}
+    for src, dst, factor in edges:
+        adjacency.setdefault(src, []).append((dst, factor))
+    best = np.zeros(node_count)
+
+    def walk(node: int, value: float, seen: set[int]) -> None:
+        best[node] = max(best[node], value)
+        for nxt, factor in adjacency.get(node, []):
+            if nxt not in seen:
+                walk(nxt, value * factor, seen | {nxt})
+
+    walk(source, 1.0, {source})
+    return best
+
+
+def test_region_max_product_chain_compounds_factors() -> None:
+    offsets, neighbors, factors = _csr(3, [(0, 1, 0.6), (1, 2, 0.15)])
+    out = np.full(3, -1.0)
+
+    region_max_product(offsets, neighbors, factors, 0, out)
+
+    assert out.tolist() == pytest.approx([1.0, 0.6, 0.09])
+
+
+def test_region_max_product_prefers_best_product_over_fewest_hops() -> None:
+    # 0 -> 3 directly at 0.15, or 0 -> 1 -> 2 -> 3 at 0.6^3 = 0.216.
+    edges = [(0, 3, 0.15), (0, 1, 0.6), (1, 2, 0.6), (2, 3, 0.6)]
+    offsets, neighbors, factors = _csr(4, edges)
+    out = np.zeros(4)
+
+    region_max_product(offsets, neighbors, factors, 0, out)
+
+    assert out[3] == pytest.approx(0.6**3)
+
+
+def test_region_max_product_unreachable_and_blocked_nodes_are_zero() -> None:
+    offsets, neighbors, factors = _csr(4, [(0, 1, 0.0), (1, 2, 0.6)])
+    out = np.ones(4)
+
+    region_max_product(offsets, neighbors, factors, 0, out)
+
+    assert out.tolist() == [1.0, 0.0, 0.0, 0.0]
+
+
+def test_region_max_product_matches_brute_force_on_random_graphs() -> None:
+    rng = np.random.default_rng(7)
+    for _ in range(30):
+        node_count = int(rng.integers(2, 8))
+        edges = [
+            (a, b, float(rng.choice([0.0, 0.15, 0.6, 1.0])))
+            for a, b in itertools.permutations(range(node_count), 2)
+            if rng.random() < 0.4
+        ]
+        offsets, neighbors, factors = _csr(node_count, edges)
+        out = np.zeros(node_count)
+
+        region_max_product(offsets, neighbors, factors, 0, out)
+
+        np.testing.assert_allclose(out, _brute_force(node_count, edges, 0))
+
+
+def test_region_max_product_rejects_malformed_graphs() -> None:
+    offsets, neighbors, factors = _csr(2, [(0, 1, 0.6)])
+    out = np.zeros(2)
+
+    with pytest.raises(ValueError, match="factors must lie"):
+        region_max_product(offsets, neighbors, np.array([1.5]), 0, out)
+    with pytest.raises(ValueError, match="out of range"):
+        region_max_product(offsets, np.array([5], dtype=np.int32), factors, 0, out)
+    with pytest.raises(ValueError, match="source is out of range"):
+        region_max_product(offsets, neighbors, factors, 2, out)
+    with pytest.raises(ValueError, match="len\\(out\\) \\+ 1"):
+        region_max_product(offsets, neighbors, factors, 0, np.zeros(3))
+    with pytest.raises(TypeError, match="int32"):
+        region_max_product(offsets.astype(np.int64), neighbors, factors, 0, out)
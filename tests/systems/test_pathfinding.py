@@ -1,5 +1,6 @@
 from __future__ import annotations
 
+import math
 from dataclasses import dataclass
 from typing import TYPE_CHECKING, cast
 
@@ -15,7 +16,7 @@ if TYPE_CHECKING:
     from brileta.environment.map import MapRegion
 from brileta.game.actors import Actor
 from brileta.game.enums import StepBlock
-from brileta.util.pathfinding import find_local_path, probe_step
+from brileta.util.pathfinding import RepairablePath, find_local_path, probe_step
 from brileta.util.spatial import SpatialHashGrid, SpatialIndex
 
 
@@ -667,3 +668,83 @@ def test_find_path_through_door_when_only_option(
     assert path
     assert (1, 3) in path  # Had to go through the door
     assert path[-1] == (1, 5)
+
+
+def _step_cost(start: tuple[int, int], path: list[tuple[int, int]]) -> float:
+    """Octile length of a path on uniform-cost floor."""
+    total = 0.0
+    px, py = start
+    for x, y in path:
+        total += math.sqrt(2) if x != px and y != py else 1.0
+        px, py = x, y
+    return total
+
+
+def test_repairable_path_reopens_after_door_toggle(
+    basic_setup: tuple[GameMap, SpatialHashGrid[DummyActor]],
+) -> None:
+    """Tiles reported to invalidate_property_caches() reach the planner."""
+    gm, index = basic_setup
+    for x in range(10):
+        gm.tiles[x, 3] = TileTypeID.WALL
+    gm.tiles[1, 3] = TileTypeID.DOOR_CLOSED
+    gm.invalidate_property_caches()
+
+    actor = DummyActor(1, 1)
+    repair = RepairablePath(
+        gm, cast(SpatialIndex[Actor], index), cast(Actor, actor), (1, 5)
+    )
+    assert repair.repair((1, 1)) == []
+
+    gm.tiles[1, 3] = TileTypeID.DOOR_OPEN
+    gm.invalidate_property_caches(changed_tiles=[(1, 3)])
+
+    assert repair.repair((1, 1)) == [(1, 2), (1, 3), (1, 4), (1, 5)]
+
+
+@pytest.mark.parametrize("seed", range(4))
+def test_repairable_path_matches_fresh_search_as_actors_move(seed: int) -> None:
+    """Repairs under random actor traffic cost what a fresh search costs."""
+    rng = np.random.default_rng(seed)
+    size = 24
+    tiles = np.full((size, size), TileTypeID.FLOOR, dtype=np.uint8, order="F")
+    tiles[rng.random(tiles.shape) < 0.15] = TileTypeID.WALL
+    start, target = (1, 1), (size - 3, size - 2)
+    tiles[start] = TileTypeID.FLOOR
+    regions: dict[int, MapRegion] = {}
+    gm = GameMap(
+        size,
+        size,
+        GeneratedMapData(
+            tiles=tiles,
+            regions=regions,
+            tile_to_region_id=np.full((size, size), -1, dtype=np.int16, order="F"),
+        ),
+    )
+    gm.invalidate_property_caches()
+    index: SpatialHashGrid[DummyActor] = SpatialHashGrid(cell_size=8)
+    walker = DummyActor(*start)
+    index.add(walker)
+    crowd = [DummyActor(int(x), int(y)) for x, y in rng.integers(0, size, (12, 2))]
+    for other in crowd:
+        index.add(other)
+
+    asi = cast(SpatialIndex[Actor], index)
+    repair = RepairablePath(gm, asi, cast(Actor, walker), target, stop_distance=1)
+    for _ in range(15):
+        pos = (walker.x, walker.y)
+        repaired = repair.repair(pos)
+        fresh = find_local_path(
+            gm, asi, cast(Actor, walker), pos, target, stop_distance=1
+        )
+        assert bool(repaired) == bool(fresh)
+        if fresh:
+            # Fresh A* carries a 1.01 heuristic weight; the repair is optimal.
+            assert _step_cost(pos, repaired) <= _step_cost(pos, fresh) + 1e-9
+            assert _step_cost(pos, repaired) * 1.01 >= _step_cost(pos, fresh) - 1e-9
+            walker.x, walker.y = repaired[0]
+            index.update(walker)
+        for other in crowd:
+            other.x = int(np.clip(other.x + rng.integers(-1, 2), 0, size - 1))
+            other.y = int(np.clip(other.y + rng.integers(-1, 2), 0, size - 1))
+            index.update(other)
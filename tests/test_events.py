@@ -1,17 +1,27 @@
 """Tests for the event bus system."""
 
 import logging
+from typing import cast
 
 import pytest
 
 from brileta.events import (
+    EffectEvent,
     EventBus,
+    FloatingTextEvent,
     GameEvent,
     MessageEvent,
+    QueuePolicy,
+    ScreenShakeEvent,
+    cap_floating_text_per_tile,
+    drain_event_queue,
+    enable_event_queue,
+    merge_screen_shakes,
     publish_event,
     reset_event_bus_for_testing,
     subscribe_to_event,
 )
+from brileta.types import ActorId, DeltaTime
 
 
 class TestEventBus:
@@ -78,6 +88,122 @@ class TestEventBus:
         assert "Deep error" in caplog.text
 
 
+class TestQueuedEventBus:
+    """Tests for queued mode: deferral, batching and coalescing."""
+
+    def test_queued_types_wait_for_drain(self) -> None:
+        """Types with a policy are deferred; other types stay synchronous."""
+        bus = EventBus(queued=True)
+        bus.set_queue_policy(EffectEvent, QueuePolicy())
+        received: list[GameEvent] = []
+        bus.subscribe(EffectEvent, received.append)
+        bus.subscribe(MessageEvent, received.append)
+
+        bus.publish(EffectEvent("blood", 1, 2))
+        bus.publish(MessageEvent(text="hit"))
+        assert [type(e) for e in received] == [MessageEvent]
+
+        assert bus.drain() == 1
+        assert [type(e) for e in received] == [MessageEvent, EffectEvent]
+        assert bus.drain() == 0
+
+    def test_batch_handler_receives_whole_drain(self) -> None:
+        """Batch subscribers get one list per drain, in publish order."""
+        bus = EventBus(queued=True)
+        bus.set_queue_policy(EffectEvent, QueuePolicy())
+        batches: list[list[GameEvent]] = []
+        bus.subscribe_batch(EffectEvent, batches.append)
+
+        for x in range(3):
+            bus.publish(EffectEvent("smoke", x, 0))
+        bus.drain()
+
+        assert len(batches) == 1
+        assert [cast(EffectEvent, e).x for e in batches[0]] == [0, 1, 2]
+
+    def test_batch_handler_in_sync_mode_gets_single_event_lists(self) -> None:
+        bus = EventBus()
+        batches: list[list[GameEvent]] = []
+        bus.subscribe_batch(EffectEvent, batches.append)
+
+        bus.publish(EffectEvent("smoke", 0, 0))
+        bus.publish(EffectEvent("smoke", 1, 0))
+
+        assert [len(b) for b in batches] == [1, 1]
+
+    def test_capacity_drops_oldest_pending_event(self) -> None:
+        bus = EventBus(queued=True)
+        bus.set_queue_policy(EffectEvent, QueuePolicy(capacity=2))
+        received: list[EffectEvent] = []
+        bus.subscribe(EffectEvent, received.append)
+
+        for x in range(4):
+            bus.publish(EffectEvent("smoke", x, 0))
+        bus.drain()
+
+        assert [e.x for e in received] == [2, 3]
+
+    def test_screen_shakes_merge_to_strongest(self) -> None:
+        bus = EventBus(queued=True)
+        bus.set_queue_policy(
+            ScreenShakeEvent, QueuePolicy(coalesce=merge_screen_shakes)
+        )
+        received: list[ScreenShakeEvent] = []
+        bus.subscribe(ScreenShakeEvent, received.append)
+
+        bus.publish(ScreenShakeEvent(0.1, DeltaTime(0.5)))
+        bus.publish(ScreenShakeEvent(0.3, DeltaTime(0.2)))
+        bus.publish(ScreenShakeEvent(0.2, DeltaTime(0.4)))
+        bus.drain()
+
+        assert received == [ScreenShakeEvent(0.3, DeltaTime(0.5))]
+
+    def test_floating_text_capped_per_tile_keeps_newest(self) -> None:
+        bus = EventBus(queued=True)
+        bus.set_queue_policy(
+            FloatingTextEvent, QueuePolicy(coalesce=cap_floating_text_per_tile(2))
+        )
+        received: list[FloatingTextEvent] = []
+        bus.subscribe(FloatingTextEvent, received.append)
+
+        for text in ("-1", "-2", "-3", "skull"):
+            bus.publish(FloatingTextEvent(text, ActorId(1), world_x=4, world_y=4))
+        bus.publish(FloatingTextEvent("-5", ActorId(2), world_x=5, world_y=4))
+        bus.drain()
+
+        assert [e.text for e in received] == ["-3", "skull", "-5"]
+
+    def test_events_published_during_drain_are_delivered(self) -> None:
+        """Handler-published queued events are dispatched by the same drain."""
+        bus = EventBus(queued=True)
+        bus.set_queue_policy(EffectEvent, QueuePolicy())
+        bus.set_queue_policy(ScreenShakeEvent, QueuePolicy())
+        shakes: list[ScreenShakeEvent] = []
+
+        bus.subscribe(
+            EffectEvent,
+            lambda _e: bus.publish(ScreenShakeEvent(0.1, DeltaTime(0.1))),
+        )
+        bus.subscribe(ScreenShakeEvent, shakes.append)
+
+        bus.publish(EffectEvent("explosion", 0, 0))
+        assert bus.drain() == 2
+        assert len(shakes) == 1
+
+    def test_removing_policy_flushes_pending_events(self) -> None:
+        bus = EventBus(queued=True)
+        bus.set_queue_policy(EffectEvent, QueuePolicy())
+        received: list[EffectEvent] = []
+        bus.subscribe(EffectEvent, received.append)
+
+        bus.publish(EffectEvent("smoke", 0, 0))
+        bus.set_queue_policy(EffectEvent, None)
+        assert len(received) == 1
+
+        bus.publish(EffectEvent("smoke", 1, 0))
+        assert len(received) == 2
+
+
 class TestGlobalEventBus:
     """Tests for the global event bus API."""
 
@@ -113,3 +239,19 @@ class TestGlobalEventBus:
             publish_event(MessageEvent(text="Test"))
 
         assert "Error handling event MessageEvent" in caplog.text
+
+    def test_global_queue_drains_and_reset_restores_sync(self) -> None:
+        """enable_event_queue() defers effects; the testing reset undoes it."""
+        received: list[EffectEvent] = []
+        subscribe_to_event(EffectEvent, received.append)
+        enable_event_queue()
+
+        publish_event(EffectEvent("blood", 0, 0))
+        assert received == []
+        assert drain_event_queue() == 1
+        assert len(received) == 1
+
+        reset_event_bus_for_testing()
+        subscribe_to_event(EffectEvent, received.append)
+        publish_event(EffectEvent("blood", 0, 0))
+        assert len(received) == 2
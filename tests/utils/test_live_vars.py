@@ -195,3 +195,36 @@ def test_record_time_records_in_strict_mode_for_registered_metric() -> None:
     assert var is not None
     assert var.stats_var is not None
     assert var.stats_var.sample_count == 1
+
+
+def test_capture_metrics_collects_every_sample() -> None:
+    """capture_metrics keeps all samples, including unregistered names."""
+    live_variable_registry.register_metric("cap.metric", num_samples=1)
+    live_variable_registry.strict = False
+    with live_variable_registry.capture_metrics() as samples:
+        live_variable_registry.record_metric("cap.metric", 1.0)
+        live_variable_registry.record_metric("cap.metric", 2.0)
+        with record_time_live_variable("missing.metric"):
+            pass
+    live_variable_registry.record_metric("cap.metric", 3.0)
+
+    assert samples["cap.metric"] == [1.0, 2.0]
+    assert len(samples["missing.metric"]) == 1
+
+
+def test_isolated_registrations_shadow_and_restore() -> None:
+    live_variable_registry.register("iso.var", getter=lambda: "outer")
+    live_variable_registry.watch("iso.var")
+    with live_variable_registry.isolated_registrations():
+        live_variable_registry.register("iso.var", getter=lambda: "inner")
+        live_variable_registry.register("iso.new", getter=lambda: 0)
+        live_variable_registry.unwatch("iso.var")
+        var = live_variable_registry.get_variable("iso.var")
+        assert var is not None and var.get_value() == "inner"
+
+    var = live_variable_registry.get_variable("iso.var")
+    assert var is not None and var.get_value() == "outer"
+    assert live_variable_registry.get_variable("iso.new") is None
+    assert live_variable_registry.is_watched("iso.var")
+    with pytest.raises(ValueError):
+        live_variable_registry.register("iso.var", getter=lambda: 1)
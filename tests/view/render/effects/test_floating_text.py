@@ -5,16 +5,18 @@ Tests cover:
 - FloatingText color selection based on valence
 - FloatingTextManager lifecycle (creation, max limit, cleanup)
 - Event handling creating FloatingText instances
-- Texture cleanup lifecycle (via mocking since GPU ops are backend-specific)
+- Atlas-backed batched rendering (via mocking since GPU ops are backend-specific)
 
-Graphics rendering is NOT tested here as it requires actual backends.
+Actual GPU drawing is NOT tested here; rendering is checked through the
+calls it makes on a mocked graphics context.
 """
 
 from __future__ import annotations
 
 from typing import TYPE_CHECKING, cast
-from unittest.mock import MagicMock, patch
+from unittest.mock import MagicMock
 
+import numpy as np
 import pytest
 
 from brileta import colors
@@ -535,222 +537,144 @@ class TestFloatingTextValence:
 
 
 # ---------------------------------------------------------------------------
-# TestFloatingTextTextureCleanup
+# TestFloatingTextAtlasRendering
 # ---------------------------------------------------------------------------
 
 
-class TestFloatingTextTextureCleanup:
-    """Tests for FloatingText texture lifecycle and cleanup.
+def make_graphics() -> MagicMock:
+    """Mock graphics whose texture factory hands out distinct objects."""
+    graphics = MagicMock()
+    graphics.tile_dimensions = (20, 20)
+    graphics.console_to_screen_coords.return_value = (100.0, 100.0)
+    graphics.texture_from_numpy.side_effect = lambda *_a, **_kw: object()
+    return graphics
 
-    Since actual GPU texture destruction is backend-specific, these tests
-    verify that:
-    - cleanup_texture() sets _texture to None
-    - cleanup_texture() is called at the right times (via mocking)
-    """
-
-    def test_cleanup_texture_sets_texture_to_none(self) -> None:
-        """cleanup_texture() should set _texture to None and call release_texture."""
-        ft = make_floating_text()
-        # Simulate having a texture by setting _texture to a mock object
-        mock_texture = MagicMock()
-        ft._texture = mock_texture
 
-        mock_graphics = MagicMock()
-        ft.cleanup_texture(mock_graphics)
+def make_viewport() -> MagicMock:
+    viewport = MagicMock()
+    viewport.is_visible.return_value = True
+    viewport.world_to_screen_float.return_value = (0.0, 0.0)
+    viewport.get_display_scale_factors.return_value = (1.0, 1.0)
+    return viewport
 
-        assert ft._texture is None
-        mock_graphics.release_texture.assert_called_once_with(mock_texture)
 
-    def test_cleanup_texture_handles_none_texture(self) -> None:
-        """cleanup_texture() should handle already-None texture gracefully."""
-        ft = make_floating_text()
-        assert ft._texture is None
+class TestFloatingTextAtlasRendering:
+    """Texts render as batched quads from a persistent per-size glyph atlas.
 
-        mock_graphics = MagicMock()
-        # Should not raise
-        ft.cleanup_texture(mock_graphics)
+    GPU work is backend-specific, so these assert on the graphics calls.
+    """
 
-        assert ft._texture is None
-        # release_texture should not be called when texture is None
-        mock_graphics.release_texture.assert_not_called()
+    def _render(self, manager: FloatingTextManager, graphics: MagicMock) -> None:
+        manager.render(graphics, make_viewport(), (0, 0), make_world())
 
-    def test_update_queues_completed_texts_for_cleanup(self) -> None:
-        """Manager.update() should queue completed texts for deferred cleanup."""
-        manager = FloatingTextManager()
-        ft = make_floating_text(duration=0.5)
-        ft._texture = MagicMock()  # Simulate having a texture
-        manager._texts = [ft]
+    def test_spawning_many_texts_creates_one_texture_per_size(self) -> None:
+        """500 texts of one size share one atlas upload and one draw call."""
+        manager = FloatingTextManager(max_texts=500)
+        for i in range(500):
+            manager._texts.append(make_floating_text(f"-{i}"))
+        graphics = make_graphics()
 
-        # Update with enough time to complete the animation
-        manager.update(DeltaTime(0.6))
+        self._render(manager, graphics)
+        self._render(manager, graphics)
 
-        # Text should be removed from active list
-        assert manager.active_count == 0
-        # But queued for cleanup (happens in render())
-        assert len(manager._pending_cleanup) == 1
-        assert manager._pending_cleanup[0] is ft
+        assert graphics.texture_from_numpy.call_count == 1
+        assert graphics.draw_texture_quads.call_count == 2
+        graphics.release_texture.assert_not_called()
+        rects = graphics.draw_texture_quads.call_args.args[1]
+        assert len(rects) == sum(len(f"-{i}") for i in range(500))
 
-    def test_update_does_not_queue_active_texts_for_cleanup(self) -> None:
-        """Manager.update() should NOT queue texts for cleanup while animating."""
+    def test_each_size_draws_from_its_own_atlas(self) -> None:
         manager = FloatingTextManager()
-        ft = make_floating_text(duration=1.0)
-        ft._texture = MagicMock()
-        manager._texts = [ft]
-
-        # Update with time that does NOT complete animation
-        manager.update(DeltaTime(0.3))
+        manager._texts = [
+            make_floating_text("A", size=FloatingTextSize.NORMAL),
+            make_floating_text("B", size=FloatingTextSize.LARGE),
+        ]
+        graphics = make_graphics()
 
-        # Text should still be active
-        assert manager.active_count == 1
-        # And not queued for cleanup
-        assert len(manager._pending_cleanup) == 0
-
-    def test_max_limit_queues_removed_text_for_cleanup(self) -> None:
-        """_handle_event() should queue removed texts for deferred cleanup."""
-        manager = FloatingTextManager(max_texts=2)
+        self._render(manager, graphics)
 
-        # Add first two texts
-        event1 = FloatingTextEvent(
-            text="First",
-            target_actor_id=ActorId(1),
-            valence=FloatingTextValence.NEUTRAL,
-            world_x=0,
-            world_y=0,
-        )
-        event2 = FloatingTextEvent(
-            text="Second",
-            target_actor_id=ActorId(2),
-            valence=FloatingTextValence.NEUTRAL,
-            world_x=0,
-            world_y=0,
-        )
-        manager._handle_event(event1)
-        manager._handle_event(event2)
+        assert graphics.texture_from_numpy.call_count == 2
+        textures = [call.args[0] for call in graphics.draw_texture_quads.call_args_list]
+        assert textures[0] is not textures[1]
 
-        # Get reference to first text and give it a mock texture
-        first_text = manager._texts[0]
-        first_text._texture = MagicMock()
+    def test_glyph_outside_preloaded_set_reuploads_atlas_once(self) -> None:
+        manager = FloatingTextManager()
+        manager._texts = [make_floating_text("ok")]
+        graphics = make_graphics()
+        self._render(manager, graphics)
+        first_texture = graphics.draw_texture_quads.call_args.args[0]
 
-        # Add third text - should trigger removal of first
-        event3 = FloatingTextEvent(
-            text="Third",
-            target_actor_id=ActorId(3),
-            valence=FloatingTextValence.NEUTRAL,
-            world_x=0,
-            world_y=0,
-        )
-        manager._handle_event(event3)
+        manager._texts.append(make_floating_text("\u2691"))
+        self._render(manager, graphics)
+        self._render(manager, graphics)
 
-        # Should still have max_texts items
-        assert manager.active_count == 2
-        # First text should be gone from active list
-        texts = [ft.text for ft in manager._texts]
-        assert "First" not in texts
-        # But queued for cleanup (happens in render())
-        assert len(manager._pending_cleanup) == 1
-        assert manager._pending_cleanup[0] is first_text
+        assert graphics.texture_from_numpy.call_count == 2
+        graphics.release_texture.assert_called_once_with(first_texture)
 
-    def test_clear_with_graphics_calls_cleanup_on_all_texts(self) -> None:
-        """clear(graphics) should call cleanup_texture() on every text immediately."""
+    def test_tints_carry_text_color_and_alpha(self) -> None:
+        ft = make_floating_text("hi", valence=FloatingTextValence.NEGATIVE)
+        ft._current_alpha = 0.5
         manager = FloatingTextManager()
+        manager._texts = [ft]
+        graphics = make_graphics()
 
-        # Add multiple texts
-        ft1 = make_floating_text("Text1")
-        ft2 = make_floating_text("Text2")
-        ft3 = make_floating_text("Text3")
-        ft1._texture = MagicMock()
-        ft2._texture = MagicMock()
-        ft3._texture = MagicMock()
-        manager._texts = [ft1, ft2, ft3]
-
-        mock_graphics = MagicMock()
-        with (
-            patch.object(ft1, "cleanup_texture") as mock1,
-            patch.object(ft2, "cleanup_texture") as mock2,
-            patch.object(ft3, "cleanup_texture") as mock3,
-        ):
-            manager.clear(mock_graphics)
-
-            mock1.assert_called_once_with(mock_graphics)
-            mock2.assert_called_once_with(mock_graphics)
-            mock3.assert_called_once_with(mock_graphics)
+        self._render(manager, graphics)
 
-        assert manager.active_count == 0
+        tints = graphics.draw_texture_quads.call_args.args[3]
+        expected = [*(c / 255 for c in VALENCE_COLORS[ft.valence]), 0.5]
+        np.testing.assert_allclose(tints, [expected, expected], rtol=1e-6)
 
-    def test_clear_without_graphics_queues_for_cleanup(self) -> None:
-        """clear() without graphics should queue texts for deferred cleanup."""
+    def test_bubble_quads_keep_their_own_colors(self) -> None:
+        ft = make_floating_text("hi")
+        ft.bubble = True
         manager = FloatingTextManager()
+        manager._texts = [ft]
+        graphics = make_graphics()
 
-        # Add multiple texts
-        ft1 = make_floating_text("Text1")
-        ft2 = make_floating_text("Text2")
-        ft1._texture = MagicMock()
-        ft2._texture = MagicMock()
-        manager._texts = [ft1, ft2]
-
-        manager.clear()  # No graphics context provided
+        self._render(manager, graphics)
 
-        assert manager.active_count == 0
-        # Texts should be queued for cleanup (happens in render())
-        assert len(manager._pending_cleanup) == 2
+        tints = graphics.draw_texture_quads.call_args.args[3]
+        # Nine bubble slices drawn untinted, then the two glyphs.
+        assert len(tints) == 11
+        assert (tints[:9] == 1.0).all()
 
-    def test_clear_handles_empty_manager(self) -> None:
-        """clear() should handle empty text list gracefully."""
+    def test_text_block_is_centered_above_the_tile(self) -> None:
         manager = FloatingTextManager()
+        manager._texts = [make_floating_text("-3")]
+        graphics = make_graphics()
+
+        self._render(manager, graphics)
+
+        layout = manager._texts[0]._layout
+        assert layout is not None
+        rects = graphics.draw_texture_quads.call_args.args[1]
+        left = 100.0 + (20 - layout.width) / 2
+        top = 100.0 - layout.height
+        offset = np.array([left, top, left, top], dtype=np.float32)
+        np.testing.assert_allclose(rects, layout.rects + offset)
+
+    def test_faded_and_offscreen_texts_are_skipped(self) -> None:
+        faded = make_floating_text("gone")
+        faded._current_alpha = 0.0
+        manager = FloatingTextManager()
+        manager._texts = [faded]
+        graphics = make_graphics()
 
-        # Should not raise
-        manager.clear()
+        self._render(manager, graphics)
 
-        assert manager.active_count == 0
+        graphics.draw_texture_quads.assert_not_called()
+        graphics.texture_from_numpy.assert_not_called()
 
-    def test_multiple_completions_all_queued_for_cleanup(self) -> None:
-        """update() should queue all completed texts for deferred cleanup."""
-        manager = FloatingTextManager()
-        ft1 = make_floating_text(duration=0.3)
-        ft2 = make_floating_text(duration=0.4)
-        ft3 = make_floating_text(duration=1.0)  # This one stays active
-        ft1._texture = MagicMock()
-        ft2._texture = MagicMock()
-        ft3._texture = MagicMock()
-        manager._texts = [ft1, ft2, ft3]
-
-        # Update with time that completes ft1 and ft2, but not ft3
-        manager.update(DeltaTime(0.5))
-
-        # Only ft3 should remain active
-        assert manager.active_count == 1
-        # ft1 and ft2 should be queued for cleanup
-        assert len(manager._pending_cleanup) == 2
-        assert ft1 in manager._pending_cleanup
-        assert ft2 in manager._pending_cleanup
-        assert ft3 not in manager._pending_cleanup
-
-    def test_render_clears_pending_cleanup(self) -> None:
-        """render() should call cleanup_texture() on all pending texts."""
+    def test_clear_keeps_the_atlas(self) -> None:
         manager = FloatingTextManager()
+        manager._texts = [make_floating_text("x")]
+        graphics = make_graphics()
+        self._render(manager, graphics)
+
+        manager.clear(graphics)
+        manager._texts = [make_floating_text("y")]
+        self._render(manager, graphics)
 
-        # Add texts that need cleanup
-        ft1 = make_floating_text("Text1")
-        ft2 = make_floating_text("Text2")
-        mock_texture1 = MagicMock()
-        mock_texture2 = MagicMock()
-        ft1._texture = mock_texture1
-        ft2._texture = mock_texture2
-        manager._pending_cleanup = [ft1, ft2]
-
-        # Mock graphics and other dependencies
-        mock_graphics = MagicMock()
-        mock_viewport = MagicMock()
-        mock_game_world = make_world()
-
-        with (
-            patch.object(ft1, "cleanup_texture") as mock1,
-            patch.object(ft2, "cleanup_texture") as mock2,
-        ):
-            manager.render(mock_graphics, mock_viewport, (0, 0), mock_game_world)
-
-            mock1.assert_called_once_with(mock_graphics)
-            mock2.assert_called_once_with(mock_graphics)
-
-        # Pending cleanup should be cleared
-        assert len(manager._pending_cleanup) == 0
+        assert manager.active_count == 1
+        assert graphics.texture_from_numpy.call_count == 1
+        graphics.release_texture.assert_not_called()
@@ -51,7 +51,7 @@ def test_draws_indicator_for_visible_npc() -> None:
         graphics, _make_viewport(), cast(ViewOffset, (0, 0)), cast(GameWorld, gw)
     )
 
-    assert graphics.draw_texture_alpha.call_count == 1
+    assert graphics.draw_texture_quads.call_count == 1
 
 
 def test_skips_npc_outside_fov() -> None:
@@ -64,7 +64,7 @@ def test_skips_npc_outside_fov() -> None:
         graphics, _make_viewport(), cast(ViewOffset, (0, 0)), cast(GameWorld, gw)
     )
 
-    assert graphics.draw_texture_alpha.call_count == 0
+    assert graphics.draw_texture_quads.call_count == 0
 
 
 def test_skips_npc_offscreen() -> None:
@@ -79,7 +79,7 @@ def test_skips_npc_offscreen() -> None:
         cast(GameWorld, gw),
     )
 
-    assert graphics.draw_texture_alpha.call_count == 0
+    assert graphics.draw_texture_quads.call_count == 0
 
 
 def test_skips_npc_with_no_indicator() -> None:
@@ -92,4 +92,4 @@ def test_skips_npc_with_no_indicator() -> None:
         graphics, _make_viewport(), cast(ViewOffset, (0, 0)), cast(GameWorld, gw)
     )
 
-    assert graphics.draw_texture_alpha.call_count == 0
+    assert graphics.draw_texture_quads.call_count == 0
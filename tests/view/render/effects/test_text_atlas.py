@@ -0,0 +1,174 @@
+"""Unit tests for the floating text glyph atlas.
+
+Layouts are composited on the CPU from the atlas sheet and compared against
+Pillow drawing the same string directly (the old per-string texture path).
+"""
+
+from __future__ import annotations
+
+import numpy as np
+import pytest
+from PIL import Image as PILImage
+from PIL import ImageDraw, ImageFont
+
+from brileta import config
+from brileta.events import FloatingTextSize
+from brileta.view.render.effects.text_atlas import (
+    BUBBLE_BORDER,
+    BUBBLE_FILL,
+    TextAtlas,
+    TextLayout,
+)
+
+SAMPLE_TEXTS = ["-3", "TRIPPED", "Get out of here!", "ijl gqy", "?", "⚑"]
+
+
+@pytest.fixture(scope="module", params=list(FloatingTextSize))
+def atlas(request: pytest.FixtureRequest) -> TextAtlas:
+    font = ImageFont.truetype(str(config.UI_FONT_PATH), request.param.value)
+    return TextAtlas(font)
+
+
+def _pillow_reference(
+    font: ImageFont.FreeTypeFont, text: str, color: tuple[int, int, int], bubble: bool
+) -> np.ndarray:
+    """The image the old per-string builder produced."""
+    bbox = font.getbbox(text)
+    padding_x, padding_y = (11, 8) if bubble else (4, 4)
+    width = max(1, int(bbox[2] - bbox[0]) + padding_x * 2)
+    height = max(1, int(bbox[3] - bbox[1]) + padding_y * 2)
+    image = PILImage.new("RGBA", (width, height), (0, 0, 0, 0))
+    draw = ImageDraw.Draw(image)
+    if bubble:
+        draw.rounded_rectangle(
+            (0, 0, width - 1, height - 1),
+            radius=10,
+            fill=BUBBLE_FILL,
+            outline=BUBBLE_BORDER,
+            width=2,
+        )
+    draw.text(
+        (padding_x - int(bbox[0]), padding_y - int(bbox[1])),
+        text,
+        font=font,
+        fill=(*color, 255),
+    )
+    return np.asarray(image)
+
+
+def _composite(
+    atlas: TextAtlas, layout: TextLayout, color: tuple[int, int, int]
+) -> np.ndarray:
+    """Draw a layout's quads the way the GPU would (nearest, tinted, over)."""
+    out = PILImage.new("RGBA", (layout.width, layout.height), (0, 0, 0, 0))
+    tints = layout.quad_colors(color)
+    for rect, src, tint in zip(
+        layout.rects.astype(int), layout.src.astype(int), tints, strict=True
+    ):
+        cell = atlas.pixels[src[1] : src[3], src[0] : src[2]]
+        image = PILImage.fromarray(cell).resize(
+            (int(rect[2] - rect[0]), int(rect[3] - rect[1])),
+            PILImage.Resampling.NEAREST,
+        )
+        tinted = np.round(np.asarray(image, dtype=np.float32) * tint)
+        out.alpha_composite(
+            PILImage.fromarray(tinted.astype(np.uint8)), (int(rect[0]), int(rect[1]))
+        )
+    return np.asarray(out)
+
+
+def test_printable_ascii_is_preloaded(atlas: TextAtlas) -> None:
+    assert atlas.glyph_count >= 95
+    sheet = atlas.pixels.copy()
+
+    atlas.layout("Hello, world! 0123456789")
+
+    np.testing.assert_array_equal(atlas.pixels, sheet)
+
+
+@pytest.mark.parametrize("text", SAMPLE_TEXTS)
+def test_plain_text_matches_pillow_exactly(atlas: TextAtlas, text: str) -> None:
+    color = (255, 130, 60)
+    layout = atlas.layout(text)
+
+    np.testing.assert_array_equal(
+        _composite(atlas, layout, color),
+        _pillow_reference(atlas.font, text, color, bubble=False),
+    )
+
+
+@pytest.mark.parametrize("text", SAMPLE_TEXTS)
+def test_bubble_matches_pillow_panel(atlas: TextAtlas, text: str) -> None:
+    """The 9-slice bubble reproduces the panel; ink over the translucent fill
+    may round one step differently from Pillow's in-image blend."""
+    color = (40, 40, 40)
+    layout = atlas.layout(text, bubble=True)
+
+    composite = _composite(atlas, layout, color).astype(int)
+    reference = _pillow_reference(atlas.font, text, color, bubble=True).astype(int)
+
+    assert composite.shape == reference.shape
+    assert np.abs(composite - reference).max() <= 1
+
+
+def test_bubble_without_text_keeps_whole_corners(atlas: TextAtlas) -> None:
+    layout = atlas.layout("", bubble=True)
+
+    assert layout.width >= 23
+    assert layout.height >= 23
+    assert layout.quad_count == 9
+    assert not layout.inked.any()
+
+
+def test_new_glyph_marks_sheet_for_reupload(atlas: TextAtlas) -> None:
+    class Graphics:
+        def __init__(self) -> None:
+            self.uploads = 0
+            self.released: list[object] = []
+
+        def texture_from_numpy(self, pixels: np.ndarray, transparent: bool) -> object:
+            self.uploads += 1
+            return object()
+
+        def release_texture(self, texture: object) -> None:
+            self.released.append(texture)
+
+    graphics = Graphics()
+    first = atlas.texture(graphics)  # type: ignore[arg-type]
+    assert atlas.texture(graphics) is first  # type: ignore[arg-type]
+
+    atlas.layout("☠")
+    second = atlas.texture(graphics)  # type: ignore[arg-type]
+
+    assert second is not first
+    assert graphics.released == [first]
+
+
+def test_sheet_grows_and_keeps_existing_glyphs() -> None:
+    font = ImageFont.truetype(str(config.UI_FONT_PATH), FloatingTextSize.LARGE.value)
+    atlas = TextAtlas(font)
+    before = atlas.layout("Ab")
+    cells = [
+        atlas.pixels[int(s[1]) : int(s[3]), int(s[0]) : int(s[2])].copy()
+        for s in before.src
+    ]
+    height = atlas.pixels.shape[0]
+
+    atlas.layout("".join(chr(code) for code in range(0x410, 0x410 + 200)))
+
+    assert atlas.pixels.shape[0] > height
+    for src, cell in zip(atlas.layout("Ab").src, cells, strict=True):
+        np.testing.assert_array_equal(
+            atlas.pixels[int(src[1]) : int(src[3]), int(src[0]) : int(src[2])], cell
+        )
+    uvs = atlas.uvs(before.src)
+    assert (uvs >= 0).all()
+    assert (uvs <= 1).all()
+
+
+def test_repeated_strings_share_one_readonly_layout(atlas: TextAtlas) -> None:
+    layout = atlas.layout("-12")
+
+    assert atlas.layout("-12") is layout
+    assert atlas.layout("-12", bubble=True) is not layout
+    assert not layout.rects.flags.writeable
@@ -10,9 +10,17 @@ import numpy as np
 import pytest
 
 from brileta.environment import tile_types
+from brileta.environment.edge_transitions import (
+    _compute_tile_edge_transition_metadata,
+    _override_edge_neighbor_bg_with_self_darken,
+    _suppress_edge_blend_toward_hard_edges,
+)
+from brileta.environment.generators.base import GeneratedMapData
 from brileta.environment.generators.buildings import Building
+from brileta.environment.map import GameMap, MapRegion, TileAnimationState
 from brileta.environment.tile_types import TileTypeID
 from brileta.types import InterpolationAlpha
+from brileta.util._native import tile_animation_walk
 from brileta.util.coordinates import Rect
 from brileta.view.render.actor_renderer import (
     COMBAT_OUTLINE_MAX_ALPHA,
@@ -20,12 +28,9 @@ from brileta.view.render.actor_renderer import (
     ActorRenderer,
 )
 from brileta.view.views.world_view import (
-    _EDGE_BLEND_CARDINAL_DIRECTIONS,
     WorldView,
-    _compute_tile_edge_transition_metadata,
-    _override_edge_neighbor_bg_with_self_darken,
     _RoofSubstitutionResult,
-    _suppress_edge_blend_toward_hard_edges,
+    _TerrainChunkCache,
 )
 
 
@@ -173,29 +178,30 @@ class TestSunDirectionPropagation:
 class TestMapUnlitDirtyTracking:
     """Tests for `_render_map_unlit()` GlyphBuffer dirty tracking."""
 
-    def test_skips_rebuild_when_viewport_output_is_unchanged(
-        self, monkeypatch: pytest.MonkeyPatch
-    ) -> None:
+    @staticmethod
+    def _make_view(
+        monkeypatch: pytest.MonkeyPatch,
+    ) -> tuple[WorldView, GameMap, Mock]:
         from brileta.util.glyph_buffer import GlyphBuffer
 
-        tiles = np.full((6, 6), TileTypeID.GRASS, dtype=np.uint8)
-        explored = np.zeros((6, 6), dtype=bool)
-        explored[0:3, 0:3] = True
-        dark_appearance_map = tile_types.get_dark_appearance_map(tiles)
-        game_map = SimpleNamespace(
-            width=6,
-            height=6,
-            tiles=tiles,
-            explored=explored,
-            dark_appearance_map=dark_appearance_map,
-            decoration_seed=123,
-            structural_revision=7,
-            exploration_revision=10,
+        game_map = GameMap(
+            40,
+            40,
+            GeneratedMapData(
+                tiles=np.full((40, 40), TileTypeID.GRASS, dtype=np.uint8, order="F"),
+                regions={},
+                tile_to_region_id=np.full((40, 40), -1, dtype=np.int16, order="F"),
+                decoration_seed=123,
+            ),
         )
+        explored = np.zeros((40, 40), dtype=bool)
+        explored[0:2, 0:2] = True
+        game_map.mark_explored(explored)
 
         view = object.__new__(WorldView)
         view._SCROLL_PADDING = 1
         view._map_unlit_buffer_cache_key = None
+        view._terrain_chunks = _TerrainChunkCache(32)
         view._viewport_zoom = 1.0
         view.map_glyph_buffer = GlyphBuffer(4, 4)
         view.controller = SimpleNamespace(
@@ -225,231 +231,241 @@ class TestMapUnlitDirtyTracking:
             tile_types, "apply_terrain_decoration", lambda *args, **kwargs: None
         )
 
-        original_clear = view.map_glyph_buffer.clear
-        clear_mock = Mock(wraps=original_clear)
+        clear_mock = Mock(wraps=view.map_glyph_buffer.clear)
         view.map_glyph_buffer.clear = clear_mock
+        return view, game_map, clear_mock
+
+    @staticmethod
+    def _reveal(game_map: GameMap, x: int, y: int) -> None:
+        mask = np.zeros((game_map.width, game_map.height), dtype=bool)
+        mask[x, y] = True
+        game_map.mark_explored(mask)
+
+    def test_skips_rebuild_when_viewport_output_is_unchanged(
+        self, monkeypatch: pytest.MonkeyPatch
+    ) -> None:
+        view, game_map, clear_mock = self._make_view(monkeypatch)
 
         view._render_map_unlit()
         assert clear_mock.call_count == 1
 
         # Change exploration outside the rendered padded viewport slice only.
-        game_map.explored[5, 5] = True
-        game_map.exploration_revision += 1
+        self._reveal(game_map, 35, 35)
 
         view._render_map_unlit()
 
         # The second call should return before clearing/refilling the buffer.
         assert clear_mock.call_count == 1
 
-
-class TestTileEdgeTransitionMetadata:
-    """Tests for vectorized organic tile edge metadata generation."""
-
-    def test_uses_cardinals_one_sided_ownership_and_no_wraparound(self) -> None:
-        tile_ids = np.array(
-            [
-                [1, 5, 1],
-                [5, 2, 2],
-                [3, 5, 4],
-            ],
-            dtype=np.int32,
-        )
-        drawn_mask = np.ones((3, 3), dtype=np.bool_)
-        drawn_mask[2, 2] = False  # Hidden neighbor should not contribute
-        edge_blend = np.full((3, 3), 0.5, dtype=np.float32)
-
-        bg_rgb = np.zeros((3, 3, 3), dtype=np.uint8)
-        bg_rgb[0, 1] = (10, 20, 30)  # west of center
-        bg_rgb[1, 0] = (40, 50, 60)  # north of center
-        bg_rgb[2, 2] = (70, 80, 90)  # southeast (hidden)
-
-        neighbor_mask, neighbor_bg = _compute_tile_edge_transition_metadata(
-            tile_id_window=tile_ids,
-            edge_blend_window=edge_blend,
-            drawn_mask_window=drawn_mask,
-            bg_rgb_window=bg_rgb,
-        )
-
-        west_idx = _EDGE_BLEND_CARDINAL_DIRECTIONS.index((-1, 0))
-        north_idx = _EDGE_BLEND_CARDINAL_DIRECTIONS.index((0, -1))
-        east_idx = _EDGE_BLEND_CARDINAL_DIRECTIONS.index((1, 0))
-        west_bit = 1 << west_idx
-        north_bit = 1 << north_idx
-        east_bit = 1 << east_idx
-
-        center_mask = int(neighbor_mask[1, 1])
-        assert center_mask & west_bit
-        assert center_mask & north_bit
-        assert neighbor_bg.shape[2] == len(_EDGE_BLEND_CARDINAL_DIRECTIONS)
-
-        np.testing.assert_array_equal(neighbor_bg[1, 1, west_idx], (10, 20, 30))
-        np.testing.assert_array_equal(neighbor_bg[1, 1, north_idx], (40, 50, 60))
-
-        # One-sided ownership: west tile (id=5) should not also blend toward the
-        # center tile (id=2) on the same boundary because 5 !< 2.
-        assert (int(neighbor_mask[0, 1]) & east_bit) == 0
-
-        # Left-edge cells should not see wrapped neighbors from the right edge.
-        assert (int(neighbor_mask[0, 1]) & west_bit) == 0
-
-    def test_higher_edge_blend_owns_boundary_even_with_higher_tile_id(self) -> None:
-        """Ownership should follow edge_blend strength, not enum ordering alone."""
-        tile_ids = np.array([[2, 0], [5, 0]], dtype=np.int32)  # x,y indexing
-        edge_blend = np.array([[0.0, 0.0], [0.45, 0.0]], dtype=np.float32)
-        drawn_mask = np.array([[True, False], [True, False]], dtype=np.bool_)
-        bg_rgb = np.zeros((2, 2, 3), dtype=np.uint8)
-        bg_rgb[0, 0] = (10, 10, 10)  # rigid neighbor (west)
-        neighbor_mask, neighbor_bg = _compute_tile_edge_transition_metadata(
-            tile_id_window=tile_ids,
-            edge_blend_window=edge_blend,
-            drawn_mask_window=drawn_mask,
-            bg_rgb_window=bg_rgb,
-        )
-
-        west_idx = _EDGE_BLEND_CARDINAL_DIRECTIONS.index((-1, 0))
-        west_bit = 1 << west_idx
-
-        # Grass-like tile (id 5) should own the boundary because it has higher
-        # edge_blend than the rigid neighbor (id 2), despite its higher ID.
-        assert int(neighbor_mask[1, 0]) & west_bit
-        np.testing.assert_array_equal(neighbor_bg[1, 0, west_idx], (10, 10, 10))
-        # Rigid tile remains non-owner.
-        assert (
-            int(neighbor_mask[0, 0])
-            & (1 << _EDGE_BLEND_CARDINAL_DIRECTIONS.index((1, 0)))
-        ) == 0
-
-    @pytest.mark.parametrize(
-        "architectural_tile_id",
-        [
-            TileTypeID.WALL,
-            TileTypeID.ROOF_THATCH,
-            TileTypeID.ROOF_SHINGLE,
-            TileTypeID.ROOF_TIN,
-        ],
-    )
-    def test_suppresses_blending_toward_architectural_neighbors_only(
-        self, architectural_tile_id: TileTypeID
+    def test_rebuilds_when_exploration_inside_window_changes(
+        self, monkeypatch: pytest.MonkeyPatch
     ) -> None:
-        """Grass-side roof/wall blending is suppressed without harming natural edges."""
-        # x-major layout: [architectural][grass][dirt]
-        tile_ids = np.array(
-            [[architectural_tile_id], [TileTypeID.GRASS], [TileTypeID.DIRT]],
-            dtype=np.int32,
-        )
-        edge_blend = tile_types.get_edge_blend_map(tile_ids.astype(np.uint8))
-        drawn_mask = np.ones((3, 1), dtype=np.bool_)
-        bg_rgb = np.zeros((3, 1, 3), dtype=np.uint8)
-        bg_rgb[0, 0] = (5, 5, 5)
-        bg_rgb[2, 0] = (40, 30, 20)
-
-        neighbor_mask, _neighbor_bg = _compute_tile_edge_transition_metadata(
-            tile_id_window=tile_ids,
-            edge_blend_window=edge_blend,
-            drawn_mask_window=drawn_mask,
-            bg_rgb_window=bg_rgb,
-        )
-
-        west_idx = _EDGE_BLEND_CARDINAL_DIRECTIONS.index((-1, 0))
-        east_idx = _EDGE_BLEND_CARDINAL_DIRECTIONS.index((1, 0))
-        west_bit = 1 << west_idx
-        east_bit = 1 << east_idx
-        arch_east_bit = 1 << _EDGE_BLEND_CARDINAL_DIRECTIONS.index((1, 0))
-
-        grass_mask_before = int(neighbor_mask[1, 0])
-        arch_mask_before = int(neighbor_mask[0, 0])
-
-        # Grass should still own its natural boundary with dirt.
-        assert grass_mask_before & east_bit
-
-        # Rigid architectural tiles (wall/shingle/tin roof) force grass to own the
-        # boundary pre-suppression. Thatch may own instead when tuned to higher
-        # edge_blend so the roof can render a soft self-darkened edge.
-        if architectural_tile_id in (
-            TileTypeID.WALL,
-            TileTypeID.ROOF_SHINGLE,
-            TileTypeID.ROOF_TIN,
-        ):
-            assert grass_mask_before & west_bit
+        view, game_map, clear_mock = self._make_view(monkeypatch)
+        view._render_map_unlit()
 
-        _suppress_edge_blend_toward_hard_edges(
-            edge_neighbor_mask=neighbor_mask, tile_id_window=tile_ids
-        )
+        assert view.map_glyph_buffer.data["bg"][3, 3, 3] == 0
 
-        # Grass-side architectural edge is always hard after suppression.
-        assert (int(neighbor_mask[1, 0]) & west_bit) == 0
-        assert int(neighbor_mask[1, 0]) & east_bit
+        self._reveal(game_map, 2, 2)
+        view._render_map_unlit()
 
-        if architectural_tile_id == TileTypeID.ROOF_THATCH:
-            # Suppression is one-sided: a thatch-owned roof edge remains available
-            # so the roof can use self-darkened soft edges.
-            assert arch_mask_before & arch_east_bit
-            assert int(neighbor_mask[0, 0]) & arch_east_bit
+        assert clear_mock.call_count == 2
+        # World (2, 2) sits at buffer (3, 3) behind the one-tile scroll padding.
+        assert view.map_glyph_buffer.data["bg"][3, 3, 3] == 255
 
-    def test_thatch_edge_neighbor_colors_are_overridden_with_darkened_self_color(
-        self,
+    def test_debug_verification_catches_unrevisioned_exploration(
+        self, monkeypatch: pytest.MonkeyPatch
     ) -> None:
-        """Thatch roof edges should darken toward self-color, not neighbor color."""
-        tile_ids = np.array(
-            [[TileTypeID.GRASS], [TileTypeID.ROOF_THATCH], [TileTypeID.DIRT]],
-            dtype=np.int32,
-        )
-        edge_blend = tile_types.get_edge_blend_map(tile_ids.astype(np.uint8))
-        drawn_mask = np.ones((3, 1), dtype=np.bool_)
-        bg_rgb = np.zeros((3, 1, 3), dtype=np.uint8)
-        bg_rgb[0, 0] = (10, 90, 10)  # grass neighbor (green)
-        bg_rgb[1, 0] = (120, 100, 70)  # thatch tile's own color
-        bg_rgb[2, 0] = (80, 55, 35)  # dirt neighbor
-
-        _neighbor_mask, neighbor_bg = _compute_tile_edge_transition_metadata(
-            tile_id_window=tile_ids,
-            edge_blend_window=edge_blend,
-            drawn_mask_window=drawn_mask,
-            bg_rgb_window=bg_rgb,
-        )
+        from brileta import config
 
-        _override_edge_neighbor_bg_with_self_darken(
-            edge_neighbor_bg=neighbor_bg,
-            tile_id_window=tile_ids,
-            bg_rgb_window=bg_rgb,
-        )
+        monkeypatch.setattr(config, "DEBUG_VERIFY_RENDER_CACHE_KEYS", True)
+        view, game_map, _clear_mock = self._make_view(monkeypatch)
+        view._render_map_unlit()
 
-        expected = np.array([85, 65, 35], dtype=np.uint8)  # 120/100/70 - 35
-        for direction_index in range(len(_EDGE_BLEND_CARDINAL_DIRECTIONS)):
-            np.testing.assert_array_equal(neighbor_bg[1, 0, direction_index], expected)
+        game_map.explored[2, 1] = True  # Bypasses mark_explored().
 
-    def test_edge_neighbor_colors_are_unchanged_for_tiles_without_self_darken(
-        self,
-    ) -> None:
-        """Tiles with edge_self_darken=0 keep their normal neighbor colors."""
-        tile_ids = np.array([[TileTypeID.GRASS], [TileTypeID.DIRT]], dtype=np.int32)
-        edge_blend = tile_types.get_edge_blend_map(tile_ids.astype(np.uint8))
-        drawn_mask = np.ones((2, 1), dtype=np.bool_)
-        bg_rgb = np.zeros((2, 1, 3), dtype=np.uint8)
-        bg_rgb[0, 0] = (20, 60, 20)
-        bg_rgb[1, 0] = (70, 50, 30)
+        with pytest.raises(AssertionError, match="revision bump"):
+            view._render_map_unlit()
 
-        neighbor_mask, neighbor_bg = _compute_tile_edge_transition_metadata(
-            tile_id_window=tile_ids,
-            edge_blend_window=edge_blend,
-            drawn_mask_window=drawn_mask,
-            bg_rgb_window=bg_rgb,
-        )
-        neighbor_bg_before = neighbor_bg.copy()
 
-        _override_edge_neighbor_bg_with_self_darken(
-            edge_neighbor_bg=neighbor_bg,
-            tile_id_window=tile_ids,
-            bg_rgb_window=bg_rgb,
-        )
-
-        east_idx = _EDGE_BLEND_CARDINAL_DIRECTIONS.index((1, 0))
-        east_bit = 1 << east_idx
-        # Grass owns the grass->dirt boundary in this setup, so the slot is populated
-        # and should remain the actual dirt color after the no-op override pass.
-        assert int(neighbor_mask[0, 0]) & east_bit
-        np.testing.assert_array_equal(neighbor_bg[0, 0, east_idx], bg_rgb[1, 0])
-        np.testing.assert_array_equal(neighbor_bg, neighbor_bg_before)
+def _chunk_test_map(seed: int = 5, size: int = 20) -> GameMap:
+    rng = np.random.default_rng(seed)
+    palette = np.array(
+        [
+            TileTypeID.GRASS,
+            TileTypeID.DIRT,
+            TileTypeID.GRAVEL,
+            TileTypeID.FLOOR,
+            TileTypeID.WALL,
+            TileTypeID.ROOF_THATCH,
+        ],
+        dtype=np.uint8,
+    )
+    map_data = GeneratedMapData(
+        tiles=np.asfortranarray(rng.choice(palette, size=(size, size))),
+        regions={},
+        tile_to_region_id=np.full((size, size), -1, dtype=np.int16, order="F"),
+        decoration_seed=99,
+    )
+    game_map = GameMap(size, size, map_data)
+    game_map.explored[:] = rng.random((size, size)) < 0.7
+    return game_map
+
+
+def _reference_terrain_cells(game_map: GameMap) -> np.ndarray:
+    """Whole-map unlit cells computed in one pass, as one giant viewport."""
+    from brileta.util.glyph_buffer import GlyphBuffer
+
+    buffer = GlyphBuffer(game_map.width, game_map.height)
+    explored = np.asarray(game_map.explored, dtype=np.bool_)
+    xs, ys = np.nonzero(explored)
+    dark_app = game_map.dark_appearance_map[xs, ys]
+    chars, fg_rgb, bg_rgb = dark_app["ch"], dark_app["fg"], dark_app["bg"]
+    tile_ids = game_map.tiles[xs, ys]
+    tile_types.apply_terrain_decoration(
+        chars, fg_rgb, bg_rgb, tile_ids, xs, ys, game_map.decoration_seed
+    )
+    data = buffer.data
+    data["ch"][xs, ys] = chars
+    data["fg"][xs, ys, :3] = fg_rgb
+    data["fg"][xs, ys, 3] = 255
+    data["bg"][xs, ys, :3] = bg_rgb
+    data["bg"][xs, ys, 3] = 255
+    data["noise"][xs, ys] = tile_types.get_sub_tile_jitter_map(tile_ids)
+    data["noise_pattern"][xs, ys] = tile_types.get_sub_tile_pattern_map(tile_ids)
+
+    edge_blend = tile_types.get_edge_blend_map(tile_ids)
+    data["edge_blend"][xs, ys] = edge_blend
+    tile_id_window = np.zeros(explored.shape, dtype=np.int32)
+    edge_blend_window = np.zeros(explored.shape, dtype=np.float32)
+    bg_rgb_window = np.zeros((*explored.shape, 3), dtype=np.uint8)
+    tile_id_window[xs, ys] = tile_ids
+    edge_blend_window[xs, ys] = edge_blend
+    bg_rgb_window[xs, ys] = bg_rgb
+    neighbor_mask, neighbor_bg = _compute_tile_edge_transition_metadata(
+        tile_id_window=tile_id_window,
+        edge_blend_window=edge_blend_window,
+        drawn_mask_window=explored,
+        bg_rgb_window=bg_rgb_window,
+    )
+    _suppress_edge_blend_toward_hard_edges(
+        edge_neighbor_mask=neighbor_mask, tile_id_window=tile_id_window
+    )
+    _override_edge_neighbor_bg_with_self_darken(
+        edge_neighbor_bg=neighbor_bg,
+        tile_id_window=tile_id_window,
+        bg_rgb_window=bg_rgb_window,
+    )
+    data["edge_neighbor_mask"][xs, ys] = neighbor_mask[xs, ys]
+    data["edge_neighbor_bg"][xs, ys] = neighbor_bg[xs, ys]
+    return data
+
+
+class TestTerrainChunkCache:
+    """Tests for the world-space unlit terrain chunk cache."""
+
+    def test_chunked_cells_match_whole_map_pass(self) -> None:
+        game_map = _chunk_test_map()
+        cache = _TerrainChunkCache(chunk_size=8)
+        cache.sync(game_map, lod_detail=True)
+        dest = np.zeros((20, 20), dtype=cache.cells.dtype)
+
+        assert cache.blit(game_map, dest, 0, 0) == (slice(0, 20), slice(0, 20))
+
+        np.testing.assert_array_equal(dest, _reference_terrain_cells(game_map))
+        assert cache.chunks_built == 9
+
+    def test_scrolled_window_is_a_slice_of_world_cells(self) -> None:
+        game_map = _chunk_test_map()
+        cache = _TerrainChunkCache(chunk_size=8)
+        cache.sync(game_map, lod_detail=True)
+        reference = _reference_terrain_cells(game_map)
+        dest = np.zeros((6, 5), dtype=cache.cells.dtype)
+
+        slices = cache.blit(game_map, dest, -2, 17)
+
+        assert slices == (slice(2, 6), slice(0, 3))
+        np.testing.assert_array_equal(dest[slices], reference[0:4, 17:20])
+        assert cache.chunks_built == 1
+        # Scrolling back over built chunks copies without rebuilding.
+        cache.blit(game_map, dest, -1, 16)
+        assert cache.chunks_built == 1
+
+    def test_exploration_change_rebuilds_only_touched_chunks(self) -> None:
+        game_map = _chunk_test_map()
+        game_map.explored[:] = False
+        cache = _TerrainChunkCache(chunk_size=8)
+        cache.sync(game_map, lod_detail=True)
+        dest = np.zeros((20, 20), dtype=cache.cells.dtype)
+        cache.blit(game_map, dest, 0, 0)
+        assert cache.chunks_built == 9
+
+        game_map.explored[3:5, 3:5] = True  # Chunk interior.
+        cache.blit(game_map, dest, 0, 0)
+        assert cache.chunks_built == 10
+
+        game_map.explored[7, 3] = True  # Border tile: east neighbor's halo too.
+        cache.blit(game_map, dest, 0, 0)
+        assert cache.chunks_built == 12
+        np.testing.assert_array_equal(dest, _reference_terrain_cells(game_map))
+
+    def test_tile_change_rebuilds_only_nearby_chunks(self) -> None:
+        game_map = _chunk_test_map()
+        cache = _TerrainChunkCache(chunk_size=8)
+        cache.sync(game_map, lod_detail=True)
+        dest = np.zeros((20, 20), dtype=cache.cells.dtype)
+        cache.blit(game_map, dest, 0, 0)
+
+        game_map.tiles[10, 10] = TileTypeID.WALL
+        game_map.invalidate_property_caches(changed_tiles=[(10, 10)])
+        cache.sync(game_map, lod_detail=True)
+        cache.blit(game_map, dest, 0, 0)
+        assert cache.chunks_built == 10
+
+        game_map.tiles[8, 13] = TileTypeID.DIRT  # West neighbor is in chunk 0.
+        game_map.invalidate_property_caches(changed_tiles=[(8, 13)])
+        cache.sync(game_map, lod_detail=True)
+        cache.blit(game_map, dest, 0, 0)
+        assert cache.chunks_built == 12
+        np.testing.assert_array_equal(dest, _reference_terrain_cells(game_map))
+
+    def test_unreported_structural_change_drops_every_chunk(self) -> None:
+        game_map = _chunk_test_map()
+        cache = _TerrainChunkCache(chunk_size=8)
+        cache.sync(game_map, lod_detail=True)
+        dest = np.zeros((20, 20), dtype=cache.cells.dtype)
+        cache.blit(game_map, dest, 0, 0)
+
+        game_map.tiles[10, 10] = TileTypeID.WALL
+        game_map.invalidate_property_caches()
+        cache.sync(game_map, lod_detail=True)
+        cache.blit(game_map, dest, 0, 0)
+
+        assert cache.chunks_built == 18
+        np.testing.assert_array_equal(dest, _reference_terrain_cells(game_map))
+
+    def test_region_appearance_rewrite_rebuilds_only_its_chunks(self) -> None:
+        game_map = _chunk_test_map()
+        game_map.tiles[2:6, 2:6] = TileTypeID.FLOOR
+        game_map.tile_to_region_id[:] = 1
+        game_map.tile_to_region_id[2:6, 2:6] = 0
+        game_map.regions = {
+            0: MapRegion.create_indoor_region(0),
+            1: MapRegion.create_outdoor_region(1),
+        }
+        game_map.invalidate_appearance_caches()
+        cache = _TerrainChunkCache(chunk_size=8)
+        cache.sync(game_map, lod_detail=True)
+        dest = np.zeros((20, 20), dtype=cache.cells.dtype)
+        cache.blit(game_map, dest, 0, 0)
+        assert cache.chunks_built == 9
+
+        game_map.regions[0].sky_exposure = 1.0
+        assert game_map.refresh_region_appearance(0) is not None
+        cache.sync(game_map, lod_detail=True)
+        cache.blit(game_map, dest, 0, 0)
+
+        assert cache.chunks_built == 10
+        np.testing.assert_array_equal(dest, _reference_terrain_cells(game_map))
 
 
 class TestActorParticleEmitterCache:
@@ -603,6 +619,13 @@ class TestRoofSubstitution:
         assert player_building_id == 7
         assert viewport_buildings == [building]
 
+    @staticmethod
+    def _place_buildings(view: WorldView, buildings: list[Building]) -> None:
+        """Put ``buildings`` in the view's world, all within the viewport."""
+        view.controller.gw.buildings = buildings
+        view.controller.gw.buildings_revision = 0
+        view._compute_roof_state = lambda: (None, buildings)
+
     def test_applies_roof_only_to_building_footprint(
         self, monkeypatch: pytest.MonkeyPatch
     ) -> None:
@@ -610,14 +633,13 @@ class TestRoofSubstitution:
         monkeypatch.setattr(tile_types, "apply_terrain_decoration", lambda *args: None)
 
         view = object.__new__(WorldView)
-        view._roof_stamp_cache = {}
+        view._roof_layers = {}
         view.controller = SimpleNamespace(
             gw=SimpleNamespace(player=SimpleNamespace(x=50, y=50))
         )
         view._get_directional_light = lambda: None
-        view._compute_roof_state = lambda: (
-            None,
-            [Building(id=1, building_type="house", footprint=Rect(2, 2, 4, 4))],
+        self._place_buildings(
+            view, [Building(id=1, building_type="house", footprint=Rect(2, 2, 4, 4))]
         )
 
         # Two tiles inside footprint, two outside.
@@ -664,14 +686,14 @@ class TestRoofSubstitution:
         assert tuple(int(v) for v in fg_rgb[2]) == (100, 100, 100)
         assert tuple(int(v) for v in bg_rgb[2]) == (120, 120, 120)
 
-    def test_roof_fast_path_with_buffer_lookup_matches_fallback(
+    def test_roof_layer_gather_is_independent_of_query_order(
         self, monkeypatch: pytest.MonkeyPatch
     ) -> None:
-        """Direct footprint indexing should preserve the legacy substitution output."""
+        """Any subset or order of query cells gets the same roof cells."""
         monkeypatch.setattr(tile_types, "apply_terrain_decoration", lambda *args: None)
 
         view = object.__new__(WorldView)
-        view._roof_stamp_cache = {}
+        view._roof_layers = {}
         view.controller = SimpleNamespace(
             gw=SimpleNamespace(player=SimpleNamespace(x=50, y=50))
         )
@@ -682,19 +704,13 @@ class TestRoofSubstitution:
             footprint=Rect(10, 20, 5, 4),
             door_positions=[(10, 21)],
         )
-        view._compute_roof_state = lambda: (None, [building])
+        building.chimney_offset = (3, 1)
+        self._place_buildings(view, [building])
 
-        world_origin_x = 8
-        world_origin_y = 18
-        buf_width = 12
-        buf_height = 10
-
-        # Sparse explored subset inside the visible buffer; includes roof tiles,
-        # a doorway clearance tile, the chimney tile, and an outside tile.
+        # Includes roof tiles, a doorway clearance tile, the chimney tile,
+        # and an outside tile.
         world_x = np.array([11, 12, 10, 13, 9], dtype=np.int32)
         world_y = np.array([21, 22, 21, 21, 19], dtype=np.int32)
-        buf_x = world_x - world_origin_x
-        buf_y = world_y - world_origin_y
         tile_ids = np.array(
             [
                 TileTypeID.FLOOR,
@@ -710,48 +726,41 @@ class TestRoofSubstitution:
         )
         fg_rgb = np.full((5, 3), 100, dtype=np.uint8)
         bg_rgb = np.full((5, 3), 120, dtype=np.uint8)
-        building.chimney_offset = (3, 1)  # -> (13, 21), included above
-
-        chars_fallback = chars.copy()
-        fg_fallback = fg_rgb.copy()
-        bg_fallback = bg_rgb.copy()
-        ids_fallback = view._apply_roof_substitution(
-            chars_fallback,
-            fg_fallback,
-            bg_fallback,
-            tile_ids.copy(),
+
+        result = view._apply_roof_substitution(
+            chars,
+            fg_rgb,
+            bg_rgb,
+            tile_ids,
             world_x,
             world_y,
             is_light=False,
             decoration_seed=0,
         )
 
-        chars_fast = chars.copy()
-        fg_fast = fg_rgb.copy()
-        bg_fast = bg_rgb.copy()
-        ids_fast = view._apply_roof_substitution(
-            chars_fast,
-            fg_fast,
-            bg_fast,
-            tile_ids.copy(),
-            world_x,
-            world_y,
+        order = np.array([3, 0, 4, 1])
+        chars_sub = np.array(
+            [ord("."), ord("."), ord("+"), ord("."), ord(",")], dtype=np.int32
+        )[order]
+        fg_sub = np.full((4, 3), 100, dtype=np.uint8)
+        bg_sub = np.full((4, 3), 120, dtype=np.uint8)
+        result_sub = view._apply_roof_substitution(
+            chars_sub,
+            fg_sub,
+            bg_sub,
+            tile_ids[order],
+            world_x[order],
+            world_y[order],
             is_light=False,
             decoration_seed=0,
-            buf_x=buf_x,
-            buf_y=buf_y,
-            buf_width=buf_width,
-            buf_height=buf_height,
-            world_origin_x=world_origin_x,
-            world_origin_y=world_origin_y,
         )
 
         np.testing.assert_array_equal(
-            ids_fast.effective_tile_ids, ids_fallback.effective_tile_ids
+            result_sub.effective_tile_ids, result.effective_tile_ids[order]
         )
-        np.testing.assert_array_equal(chars_fast, chars_fallback)
-        np.testing.assert_array_equal(fg_fast, fg_fallback)
-        np.testing.assert_array_equal(bg_fast, bg_fallback)
+        np.testing.assert_array_equal(chars_sub, chars[order])
+        np.testing.assert_array_equal(fg_sub, fg_rgb[order])
+        np.testing.assert_array_equal(bg_sub, bg_rgb[order])
 
     def test_entry_doorway_remains_visible_through_roof(
         self, monkeypatch: pytest.MonkeyPatch
@@ -760,7 +769,7 @@ class TestRoofSubstitution:
         monkeypatch.setattr(tile_types, "apply_terrain_decoration", lambda *args: None)
 
         view = object.__new__(WorldView)
-        view._roof_stamp_cache = {}
+        view._roof_layers = {}
         view.controller = SimpleNamespace(
             gw=SimpleNamespace(player=SimpleNamespace(x=50, y=50))
         )
@@ -771,10 +780,7 @@ class TestRoofSubstitution:
             footprint=Rect(4, 4, 4, 4),
             door_positions=[(4, 5)],  # West wall door
         )
-        view._compute_roof_state = lambda: (
-            None,
-            [building],
-        )
+        self._place_buildings(view, [building])
 
         # door tile (on footprint edge), interior roof tile
         world_x = np.array([4, 5], dtype=np.int32)
@@ -835,7 +841,7 @@ class TestRoofSubstitution:
         monkeypatch.setattr(tile_types, "apply_terrain_decoration", lambda *args: None)
 
         view = object.__new__(WorldView)
-        view._roof_stamp_cache = {}
+        view._roof_layers = {}
         view.controller = SimpleNamespace(
             gw=SimpleNamespace(player=SimpleNamespace(x=50, y=50))
         )
@@ -846,7 +852,7 @@ class TestRoofSubstitution:
             footprint=Rect(4, 4, 4, 4),
             door_positions=[(4, 5)],
         )
-        view._compute_roof_state = lambda: (None, [building])
+        self._place_buildings(view, [building])
 
         world_x = np.array([5], dtype=np.int32)
         world_y = np.array([5], dtype=np.int32)
@@ -880,7 +886,7 @@ class TestRoofSubstitution:
         monkeypatch.setattr(tile_types, "apply_terrain_decoration", lambda *args: None)
 
         view = object.__new__(WorldView)
-        view._roof_stamp_cache = {}
+        view._roof_layers = {}
         view.controller = SimpleNamespace(
             gw=SimpleNamespace(player=SimpleNamespace(x=50, y=50))
         )
@@ -891,7 +897,7 @@ class TestRoofSubstitution:
             footprint=Rect(4, 4, 4, 4),
             door_positions=[(4, 5)],  # west wall door should remain clear
         )
-        view._compute_roof_state = lambda: (None, [building])
+        self._place_buildings(view, [building])
 
         # corner roof, top-edge roof, left-edge roof, interior roof, door (clearance), outside
         # For this even-parity square footprint, ridge shading is horizontal. We pick:
@@ -1003,7 +1009,7 @@ class TestRoofSubstitution:
         monkeypatch.setattr(tile_types, "apply_terrain_decoration", lambda *args: None)
 
         view = object.__new__(WorldView)
-        view._roof_stamp_cache = {}
+        view._roof_layers = {}
         view.controller = SimpleNamespace(
             gw=SimpleNamespace(player=SimpleNamespace(x=50, y=50))
         )
@@ -1020,7 +1026,7 @@ class TestRoofSubstitution:
             building_type="house",
             footprint=Rect(10, 10, 10, 8),
         )
-        view._compute_roof_state = lambda: (None, [building])
+        self._place_buildings(view, [building])
 
         # Three interior tiles (none on perimeter) at different distances from
         # shifted ridge center at y=12.0:
@@ -1084,7 +1090,7 @@ class TestRoofSubstitution:
         monkeypatch.setattr(tile_types, "apply_terrain_decoration", lambda *args: None)
 
         view = object.__new__(WorldView)
-        view._roof_stamp_cache = {}
+        view._roof_layers = {}
         view.controller = SimpleNamespace(
             gw=SimpleNamespace(player=SimpleNamespace(x=50, y=50))
         )
@@ -1100,7 +1106,7 @@ class TestRoofSubstitution:
             building_type="house",
             footprint=Rect(10, 10, 6, 10),
         )
-        view._compute_roof_state = lambda: (None, [building])
+        self._place_buildings(view, [building])
 
         # Interior tiles west and east of the vertical ridge (y=14, not on perimeter).
         #   x=11: offset = -1.5, sun-facing (+10)
@@ -1134,7 +1140,7 @@ class TestRoofSubstitution:
         monkeypatch.setattr(tile_types, "apply_terrain_decoration", lambda *args: None)
 
         view = object.__new__(WorldView)
-        view._roof_stamp_cache = {}
+        view._roof_layers = {}
         view.controller = SimpleNamespace(
             gw=SimpleNamespace(player=SimpleNamespace(x=50, y=50))
         )
@@ -1149,7 +1155,7 @@ class TestRoofSubstitution:
             footprint=Rect(10, 10, 10, 8),
             roof_style="tin",
         )
-        view._compute_roof_state = lambda: (None, [building])
+        self._place_buildings(view, [building])
 
         # Matches the horizontal-ridge test sampling: sun-facing, ridge, shadow.
         world_x = np.array([12, 12, 12], dtype=np.int32)
@@ -1228,7 +1234,7 @@ class TestRoofSubstitution:
         monkeypatch.setattr(tile_types, "apply_terrain_decoration", lambda *args: None)
 
         view = object.__new__(WorldView)
-        view._roof_stamp_cache = {}
+        view._roof_layers = {}
         view.controller = SimpleNamespace(
             gw=SimpleNamespace(player=SimpleNamespace(x=50, y=50))
         )
@@ -1239,7 +1245,7 @@ class TestRoofSubstitution:
             footprint=footprint,
             roof_style="tin",
         )
-        view._compute_roof_state = lambda: (None, [building])
+        self._place_buildings(view, [building])
 
         world_x = np.array([footprint.x1 + 2], dtype=np.int32)
         world_y = np.array([footprint.y1 + 2], dtype=np.int32)
@@ -1287,7 +1293,7 @@ class TestRoofSubstitution:
         monkeypatch.setattr(tile_types, "apply_terrain_decoration", lambda *args: None)
 
         view = object.__new__(WorldView)
-        view._roof_stamp_cache = {}
+        view._roof_layers = {}
         view.controller = SimpleNamespace(
             gw=SimpleNamespace(player=SimpleNamespace(x=50, y=50))
         )
@@ -1298,7 +1304,7 @@ class TestRoofSubstitution:
             footprint=footprint,
             roof_style="shingle",
         )
-        view._compute_roof_state = lambda: (None, [building])
+        self._place_buildings(view, [building])
 
         world_x = np.array([footprint.x1 + 2], dtype=np.int32)
         world_y = np.array([footprint.y1 + 2], dtype=np.int32)
@@ -1330,7 +1336,7 @@ class TestRoofSubstitution:
         monkeypatch.setattr(tile_types, "apply_terrain_decoration", lambda *args: None)
 
         view = object.__new__(WorldView)
-        view._roof_stamp_cache = {}
+        view._roof_layers = {}
         view.controller = SimpleNamespace(
             gw=SimpleNamespace(player=SimpleNamespace(x=50, y=50))
         )
@@ -1348,7 +1354,7 @@ class TestRoofSubstitution:
             roof_profile="low_slope",
             flat_section_ratio=0.5,
         )
-        view._compute_roof_state = lambda: (None, [building])
+        self._place_buildings(view, [building])
 
         # y=10 -> sun-facing outer slope, y=13 -> flat center, y=17 -> shadow slope.
         world_x = np.array([13, 13, 13], dtype=np.int32)
@@ -1411,7 +1417,7 @@ class TestRoofSubstitution:
         monkeypatch.setattr(tile_types, "apply_terrain_decoration", lambda *args: None)
 
         view = object.__new__(WorldView)
-        view._roof_stamp_cache = {}
+        view._roof_layers = {}
         view.controller = SimpleNamespace(
             gw=SimpleNamespace(player=SimpleNamespace(x=50, y=50))
         )
@@ -1427,7 +1433,7 @@ class TestRoofSubstitution:
             roof_profile="flat",
             flat_section_ratio=1.0,
         )
-        view._compute_roof_state = lambda: (None, [building])
+        self._place_buildings(view, [building])
 
         world_x = np.array([12, 12], dtype=np.int32)
         world_y = np.array([10, 15], dtype=np.int32)
@@ -1450,6 +1456,107 @@ class TestRoofSubstitution:
         np.testing.assert_array_equal(fg_rgb[0], fg_rgb[1])
         np.testing.assert_array_equal(bg_rgb[0], bg_rgb[1])
 
+    @staticmethod
+    def _make_roof_layer_view(
+        buildings: list[Building], sun: tuple[float, float]
+    ) -> tuple[WorldView, dict[str, object]]:
+        """Return a roof-substitution view over a world building list."""
+        view = object.__new__(WorldView)
+        view._roof_layers = {}
+        state: dict[str, object] = {"player_building_id": None, "sun": sun}
+        view.controller = SimpleNamespace(
+            gw=SimpleNamespace(
+                player=SimpleNamespace(x=50, y=50),
+                buildings=buildings,
+                buildings_revision=0,
+            )
+        )
+        view._get_directional_light = lambda: SimpleNamespace(
+            direction=SimpleNamespace(x=state["sun"][0], y=state["sun"][1])
+        )
+        view._compute_roof_state = lambda: (state["player_building_id"], buildings)
+        return view, state
+
+    @staticmethod
+    def _substitute_grid(view: WorldView, x1: int, y1: int, x2: int, y2: int):
+        """Run roof substitution over a world rectangle of floor tiles."""
+        gx, gy = np.meshgrid(np.arange(x1, x2), np.arange(y1, y2), indexing="ij")
+        world_x = gx.ravel().astype(np.int32)
+        world_y = gy.ravel().astype(np.int32)
+        n = len(world_x)
+        chars = np.full(n, ord("."), dtype=np.int32)
+        fg_rgb = np.full((n, 3), 100, dtype=np.uint8)
+        bg_rgb = np.full((n, 3), 120, dtype=np.uint8)
+        result = view._apply_roof_substitution(
+            chars,
+            fg_rgb,
+            bg_rgb,
+            np.full(n, TileTypeID.FLOOR, dtype=np.uint8),
+            world_x,
+            world_y,
+            is_light=False,
+            decoration_seed=5,
+        )
+        return result.effective_tile_ids.reshape(gx.shape), bg_rgb, world_x, world_y
+
+    def test_entering_building_masks_its_roof_without_rebuilding_layer(
+        self, monkeypatch: pytest.MonkeyPatch
+    ) -> None:
+        """Hiding the player's building is a mask over the prebuilt layer."""
+        near = Building(id=1, building_type="house", footprint=Rect(5, 10, 6, 5))
+        far = Building(id=2, building_type="house", footprint=Rect(20, 10, 6, 5))
+        view, state = self._make_roof_layer_view([near, far], sun=(-0.7, -0.7))
+        builds: list[int] = []
+        build_roof_layer = WorldView._build_roof_layer
+
+        def counting_build(self, *args, **kwargs):
+            builds.append(1)
+            return build_roof_layer(self, *args, **kwargs)
+
+        monkeypatch.setattr(WorldView, "_build_roof_layer", counting_build)
+
+        outside_ids, *_ = self._substitute_grid(view, 0, 0, 30, 20)
+        state["player_building_id"] = 1
+        inside_ids, *_ = self._substitute_grid(view, 0, 0, 30, 20)
+
+        assert len(builds) == 1
+        roof_ids = list(tile_types.ROOF_STYLE_TILE_TYPES.values())
+        assert np.isin(outside_ids[5:11, 10:13], roof_ids).all()
+        assert (inside_ids[5:11, :] == TileTypeID.FLOOR).all()
+        np.testing.assert_array_equal(inside_ids[20:26], outside_ids[20:26])
+
+    def test_sun_change_reshades_ridge_without_rebuilding_layer(self) -> None:
+        """Ridge shading follows the sun while the cached layer is reused."""
+        building = Building(id=1, building_type="house", footprint=Rect(10, 10, 10, 8))
+        view, state = self._make_roof_layer_view([building], sun=(0.0, -1.0))
+
+        _ids, bg_north_sun, *_ = self._substitute_grid(view, 10, 8, 20, 18)
+        layer = view._roof_layers[False][1]
+        state["sun"] = (0.0, 1.0)
+        _ids, bg_south_sun, *_ = self._substitute_grid(view, 10, 8, 20, 18)
+
+        assert view._roof_layers[False][1] is layer
+        assert not np.array_equal(bg_north_sun, bg_south_sun)
+
+    def test_hidden_building_uncovers_overlapped_roof_below(self) -> None:
+        """Where stamps overlap, hiding the top building shows the one below."""
+        north = Building(id=1, building_type="house", footprint=Rect(10, 4, 6, 6))
+        # Two floors push this roof's overhang north over the first building.
+        south = Building(
+            id=2, building_type="house", footprint=Rect(10, 10, 6, 5), floor_count=2
+        )
+        view, state = self._make_roof_layer_view([north, south], sun=(-0.7, -0.7))
+        layer = view._get_roof_layer(is_light=False, decoration_seed=5)
+        assert layer.stacked_owners == frozenset({2})
+
+        state["player_building_id"] = 2
+        ids, bg_rgb, *_ = self._substitute_grid(view, 10, 0, 16, 15)
+        north_only, _state = self._make_roof_layer_view([north], sun=(-0.7, -0.7))
+        expected_ids, expected_bg, *_ = self._substitute_grid(north_only, 10, 0, 16, 15)
+
+        np.testing.assert_array_equal(ids, expected_ids)
+        np.testing.assert_array_equal(bg_rgb, expected_bg)
+
     def test_tags_occluded_actors_under_opaque_roof(self) -> None:
         """Actors under opaque roofs are tagged as occluded, not removed."""
         view = object.__new__(WorldView)
@@ -1562,7 +1669,7 @@ class TestRoofSubstitution:
         monkeypatch.setattr(tile_types, "apply_terrain_decoration", lambda *args: None)
 
         view = object.__new__(WorldView)
-        view._roof_stamp_cache = {}
+        view._roof_layers = {}
         view.controller = SimpleNamespace(
             gw=SimpleNamespace(player=SimpleNamespace(x=50, y=50))
         )
@@ -1576,7 +1683,7 @@ class TestRoofSubstitution:
             floor_count=2,
         )
         assert building.perspective_has_frac is False
-        view._compute_roof_state = lambda: (None, [building])
+        self._place_buildings(view, [building])
 
         # South footprint row (y=27) should be a wall face tile, not a split.
         # Interior row (y=22) should be a roof tile.
@@ -1610,7 +1717,7 @@ class TestRoofSubstitution:
         monkeypatch.setattr(tile_types, "apply_terrain_decoration", lambda *args: None)
 
         view = object.__new__(WorldView)
-        view._roof_stamp_cache = {}
+        view._roof_layers = {}
         view.controller = SimpleNamespace(
             gw=SimpleNamespace(player=SimpleNamespace(x=50, y=50))
         )
@@ -1625,7 +1732,7 @@ class TestRoofSubstitution:
             footprint=Rect(5, 10, 6, 10),
         )
         assert building.perspective_has_frac is True
-        view._compute_roof_state = lambda: (None, [building])
+        self._place_buildings(view, [building])
 
         # Query the south split row (y=18) and a full roof row (y=12).
         world_x = np.array([8, 8], dtype=np.int32)
@@ -1948,3 +2055,103 @@ class TestAtmosphericViewportSizing:
         mask = view._build_rain_exclusion_mask((10, 20), (8, 6))
 
         assert mask is None
+
+
+class TestTileAnimationWalk:
+    """Tests for the native tile animation random-walk kernel."""
+
+    def _make_state(
+        self, width: int = 24, height: int = 16, seed: int = 3
+    ) -> tuple[np.ndarray, np.ndarray, np.ndarray]:
+        """Build packed F-order animation state plus visible/animates masks."""
+        rng = np.random.default_rng(seed)
+        state = np.zeros((width, height), dtype=TileAnimationState, order="F")
+        state["fg_values"] = rng.integers(0, 1001, size=(width, height, 3))
+        state["bg_values"] = rng.integers(0, 1001, size=(width, height, 3))
+        visible = rng.random((width, height)) < 0.7
+        params = np.zeros(
+            (width, height), dtype=[("animates", np.bool_), ("speed", "f4")], order="F"
+        )
+        params["animates"] = rng.random((width, height)) < 0.5
+        return state, visible, params["animates"]
+
+    def _walk(
+        self,
+        state: np.ndarray,
+        visible: np.ndarray,
+        animates: np.ndarray,
+        bounds: tuple[int, int, int, int] = (2, 1, 19, 13),
+        percent: int = 30,
+        seed: int = 99,
+    ) -> int:
+        return tile_animation_walk(
+            visible,
+            animates,
+            state["fg_values"],
+            state["bg_values"],
+            *bounds,
+            percent,
+            WorldView._TILE_ANIM_STEP,
+            seed,
+        )
+
+    def test_same_seed_reproduces_walk(self) -> None:
+        state_a, visible, animates = self._make_state()
+        state_b = state_a.copy(order="F")
+
+        self._walk(state_a, visible, animates, seed=1234)
+        self._walk(state_b, visible, animates, seed=1234)
+
+        np.testing.assert_array_equal(state_a, state_b)
+
+    def test_updates_exact_share_of_candidates_in_bounds(self) -> None:
+        state, visible, animates = self._make_state()
+        before = state.copy(order="F")
+        x0, y0, x1, y1 = 2, 1, 19, 13
+
+        updated = self._walk(state, visible, animates, bounds=(x0, y0, x1, y1))
+
+        in_bounds = np.zeros(visible.shape, dtype=bool)
+        in_bounds[x0 : x1 + 1, y0 : y1 + 1] = True
+        candidates = visible & animates & in_bounds
+        assert updated == max(1, int(candidates.sum()) * 30 // 100)
+
+        changed = np.any(state["fg_values"] != before["fg_values"], axis=2) | np.any(
+            state["bg_values"] != before["bg_values"], axis=2
+        )
+        assert not np.any(changed & ~candidates)
+        assert int(changed.sum()) <= updated
+        np.testing.assert_array_equal(state["show_glyph"], before["show_glyph"])
+
+    def test_steps_are_bounded_and_clamped(self) -> None:
+        state, visible, animates = self._make_state()
+        state["fg_values"][:, :, 0] = 0
+        state["bg_values"][:, :, 1] = 1000
+        before = state.copy(order="F")
+        step = WorldView._TILE_ANIM_STEP
+
+        self._walk(state, visible, animates, bounds=(0, 0, 23, 15), percent=100)
+
+        for field in ("fg_values", "bg_values"):
+            values = state[field].astype(np.int32)
+            delta = values - before[field].astype(np.int32)
+            assert values.min() >= 0
+            assert values.max() <= 1000
+            assert np.abs(delta).max() <= step
+
+    def test_bounds_outside_map_are_clipped(self) -> None:
+        state, visible, animates = self._make_state(width=8, height=6)
+
+        updated = self._walk(
+            state, visible, animates, bounds=(-5, -5, 40, 40), percent=100
+        )
+
+        assert updated == int((visible & animates).sum())
+
+    def test_no_candidates_updates_nothing(self) -> None:
+        state, visible, animates = self._make_state()
+        before = state.copy(order="F")
+        visible[:] = False
+
+        assert self._walk(state, visible, animates) == 0
+        np.testing.assert_array_equal(state, before)